@@ -0,0 +1,341 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::cigar_gapped_view.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/range/concept.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Selects which sequence of a CIGAR described alignment is expanded by seqan3::cigar_gapped_view.
+ * \ingroup aligned_sequence
+ */
+enum struct cigar_side : uint8_t
+{
+    reference, //!< The sequence the CIGAR string refers to, i.e. the first sequence of the alignment.
+    query      //!< The sequence described by the CIGAR string, i.e. the second sequence of the alignment.
+};
+
+/*!\brief A lazy view that expands a sequence and its CIGAR operations to the gapped sequence of the alignment.
+ * \ingroup aligned_sequence
+ * \tparam urng_t The type of the underlying range; must model std::ranges::view and std::ranges::forward_range.
+ * \implements std::ranges::view
+ *
+ * \details
+ *
+ * The alignment computed with seqan3::align_cfg::output_cigar is only stored as a vector of seqan3::cigar elements.
+ * This view reconstructs one row of the alignment on demand without materialising it, e.g. in order to print or
+ * inspect the alignment of a few selected results. The underlying range is the complete reference or query sequence,
+ * and the reference must start at the begin position of the alignment.
+ *
+ * | operation     | reference side     | query side         |
+ * |---------------|--------------------|--------------------|
+ * | M, =, X       | letter             | letter             |
+ * | I             | gap                | letter             |
+ * | D, N          | letter             | gap                |
+ * | S             | nothing            | skipped letters    |
+ * | H, P          | nothing            | nothing            |
+ *
+ * \note Most members of this class are generated by std::ranges::view_interface which is not yet documented here.
+ */
+template <std::ranges::view urng_t>
+class cigar_gapped_view : public std::ranges::view_interface<cigar_gapped_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng_t>, "The cigar_gapped_view only works on forward_ranges.");
+    static_assert(semialphabet<std::ranges::range_value_t<urng_t>>,
+                  "The value type of the underlying range must model seqan3::semialphabet.");
+
+    template <bool const_range>
+    class basic_iterator;
+
+    //!\brief The underlying range.
+    urng_t urange{};
+    //!\brief The CIGAR operations of the alignment.
+    std::span<cigar const> cigar_vector{};
+    //!\brief The expanded side of the alignment.
+    cigar_side side{cigar_side::reference};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    cigar_gapped_view() = default; //!< Defaulted.
+    cigar_gapped_view(cigar_gapped_view const &) = default; //!< Defaulted.
+    cigar_gapped_view(cigar_gapped_view &&) = default; //!< Defaulted.
+    cigar_gapped_view & operator=(cigar_gapped_view const &) = default; //!< Defaulted.
+    cigar_gapped_view & operator=(cigar_gapped_view &&) = default; //!< Defaulted.
+    ~cigar_gapped_view() = default; //!< Defaulted.
+
+    /*!\brief Constructs the view from the underlying range and the CIGAR operations.
+     * \param[in] urange The reference or query sequence.
+     * \param[in] cigar_vector The CIGAR operations of the alignment; must outlive this view.
+     * \param[in] side Whether `urange` is the reference or the query sequence.
+     */
+    cigar_gapped_view(urng_t urange, std::span<cigar const> cigar_vector, cigar_side const side) :
+        urange{std::move(urange)},
+        cigar_vector{cigar_vector},
+        side{side}
+    {}
+
+    /*!\brief Constructs the view from a non-view that can be view-wrapped and the CIGAR operations.
+     * \tparam other_urng_t The type of another range; must model std::ranges::viewable_range and the view-wrapped
+     *                      type must be constructible to `urng_t`.
+     * \param[in] urange The reference or query sequence.
+     * \param[in] cigar_vector The CIGAR operations of the alignment; must outlive this view.
+     * \param[in] side Whether `urange` is the reference or the query sequence.
+     */
+    template <typename other_urng_t>
+    //!\cond
+        requires (!std::same_as<std::remove_cvref_t<other_urng_t>, urng_t> &&
+                  std::ranges::viewable_range<other_urng_t> &&
+                  std::constructible_from<urng_t, std::views::all_t<other_urng_t>>)
+    //!\endcond
+    cigar_gapped_view(other_urng_t && urange, std::span<cigar const> cigar_vector, cigar_side const side) :
+        cigar_gapped_view{urng_t{std::views::all(std::forward<other_urng_t>(urange))}, cigar_vector, side}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the gapped sequence.
+    basic_iterator<false> begin()
+    {
+        return {std::ranges::begin(urange), cigar_vector, side};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const
+    //!\cond
+        requires const_iterable_range<urng_t>
+    //!\endcond
+    {
+        return {std::ranges::begin(urange), cigar_vector, side};
+    }
+
+    //!\brief Returns the sentinel of the gapped sequence.
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+    //!\}
+};
+
+/*!\brief The iterator of the seqan3::cigar_gapped_view.
+ * \tparam const_range Whether the underlying range is const.
+ */
+template <std::ranges::view urng_t>
+template <bool const_range>
+class cigar_gapped_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using urng_iterator_t = detail::maybe_const_iterator_t<const_range, urng_t>;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The value type of this iterator.
+    using value_type = gapped<std::ranges::range_value_t<urng_t>>;
+    //!\brief The reference type is the value type.
+    using reference = value_type;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_category = std::forward_iterator_tag;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_concept = iterator_category;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default; //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default; //!< Defaulted.
+    ~basic_iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs the iterator pointing to the first emitted element.
+     * \param[in] urng_iterator The begin of the underlying range.
+     * \param[in] cigar_vector The CIGAR operations.
+     * \param[in] side The expanded side of the alignment.
+     */
+    basic_iterator(urng_iterator_t urng_iterator, std::span<cigar const> cigar_vector, cigar_side const side) :
+        urng_iterator{std::move(urng_iterator)},
+        cigar_vector{cigar_vector},
+        side{side}
+    {
+        skip_to_next_emitting_operation();
+    }
+    //!\}
+
+    //!\brief Returns the current letter or a gap.
+    reference operator*() const
+    {
+        if (consumes_letter)
+            return value_type{*urng_iterator};
+        else
+            return value_type{gap{}};
+    }
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Advances to the next element of the gapped sequence.
+    basic_iterator & operator++()
+    {
+        assert(remaining > 0);
+
+        if (consumes_letter)
+            ++urng_iterator;
+
+        if (--remaining == 0)
+        {
+            ++cigar_position;
+            skip_to_next_emitting_operation();
+        }
+
+        return *this;
+    }
+
+    //!\brief Advances to the next element of the gapped sequence and returns the previous position.
+    basic_iterator operator++(int)
+    {
+        basic_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Compares two iterators by their position in the CIGAR operations.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+    {
+        return lhs.cigar_position == rhs.cigar_position && lhs.remaining == rhs.remaining;
+    }
+
+    //!\brief Compares two iterators by their position in the CIGAR operations.
+    friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Checks whether all CIGAR operations are processed.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.cigar_position == lhs.cigar_vector.size();
+    }
+
+    //!\copydoc operator==(basic_iterator const &, std::default_sentinel_t const &)
+    friend bool operator==(std::default_sentinel_t const &, basic_iterator const & rhs) noexcept
+    {
+        return rhs == std::default_sentinel_t{};
+    }
+
+    //!\brief Checks whether not all CIGAR operations are processed.
+    friend bool operator!=(basic_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return !(lhs == std::default_sentinel_t{});
+    }
+
+    //!\copydoc operator!=(basic_iterator const &, std::default_sentinel_t const &)
+    friend bool operator!=(std::default_sentinel_t const &, basic_iterator const & rhs) noexcept
+    {
+        return !(rhs == std::default_sentinel_t{});
+    }
+    //!\}
+
+private:
+    /*!\brief Moves to the next operation that emits a letter or a gap on the expanded side.
+     *
+     * \details
+     *
+     * Soft clipped letters of the query are skipped in the underlying range, all other non-emitting operations are
+     * ignored.
+     */
+    void skip_to_next_emitting_operation()
+    {
+        for (; cigar_position < cigar_vector.size(); ++cigar_position)
+        {
+            using seqan3::get;
+
+            size_t const count = get<0>(cigar_vector[cigar_position]);
+            char const operation = get<1>(cigar_vector[cigar_position]).to_char();
+            bool const is_aligned = operation == 'M' || operation == '=' || operation == 'X';
+            bool const is_insertion = operation == 'I';
+            bool const is_deletion = operation == 'D' || operation == 'N';
+
+            if (side == cigar_side::reference)
+                consumes_letter = is_aligned || is_deletion;
+            else
+                consumes_letter = is_aligned || is_insertion;
+
+            if (!(is_aligned || is_insertion || is_deletion))
+            {
+                if (side == cigar_side::query && operation == 'S')
+                    std::ranges::advance(urng_iterator, count);
+
+                continue;
+            }
+
+            if (count > 0)
+            {
+                remaining = count;
+                return;
+            }
+        }
+
+        remaining = 0;
+    }
+
+    //!\brief The iterator of the underlying range.
+    urng_iterator_t urng_iterator{};
+    //!\brief The CIGAR operations.
+    std::span<cigar const> cigar_vector{};
+    //!\brief The position of the current CIGAR operation.
+    size_t cigar_position{};
+    //!\brief The number of elements left in the current CIGAR operation.
+    size_t remaining{};
+    //!\brief The expanded side of the alignment.
+    cigar_side side{cigar_side::reference};
+    //!\brief Whether the current CIGAR operation consumes a letter of the underlying range or emits a gap.
+    bool consumes_letter{false};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::cigar_gapped_view
+ * \{
+ */
+//!\brief Deduces the underlying range as a view of the given range.
+template <std::ranges::viewable_range rng_t>
+cigar_gapped_view(rng_t &&, std::span<cigar const>, cigar_side) -> cigar_gapped_view<std::views::all_t<rng_t>>;
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::matrix_memory_limit.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <limits>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Limits the memory of the alignment matrices that is kept for subsequent alignments.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The alignment algorithm keeps its score and trace matrices in thread local storage and reuses them for all
+ * alignments that are computed by the same thread, also across different calls to seqan3::align_pairwise.
+ * The matrices only grow, such that after a few alignments no more memory needs to be allocated
+ * (high-water mark reuse). If a single long alignment is computed, however, the memory of its matrices stays
+ * allocated as well.
+ * With this configuration the retained memory can be limited: if the matrices of a thread occupy more than the given
+ * number of bytes, they are released before the next alignment is computed. Accordingly, a limit of `0` allocates new
+ * matrices for every alignment. By default, the memory is not limited.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_matrix_memory_limit_example.cpp
+ */
+class matrix_memory_limit : public pipeable_config_element<matrix_memory_limit>
+{
+public:
+    //!\brief The maximal number of bytes that are kept for the next alignment [default: unlimited].
+    size_t bytes{std::numeric_limits<size_t>::max()};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr matrix_memory_limit() noexcept = default; //!< Defaulted
+    constexpr matrix_memory_limit(matrix_memory_limit const &) noexcept = default; //!< Defaulted
+    constexpr matrix_memory_limit(matrix_memory_limit &&) noexcept = default; //!< Defaulted
+    constexpr matrix_memory_limit & operator=(matrix_memory_limit const &) noexcept = default; //!< Defaulted
+    constexpr matrix_memory_limit & operator=(matrix_memory_limit &&) noexcept = default; //!< Defaulted
+    ~matrix_memory_limit() noexcept = default; //!< Defaulted
+
+    /*!\brief Initialises the memory limit.
+     *
+     * \param bytes \copybrief bytes
+     */
+    constexpr matrix_memory_limit(size_t const bytes) noexcept :
+        bytes{bytes}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::matrix_memory_limit};
+};
+
+} // namespace seqan3::align_cfg
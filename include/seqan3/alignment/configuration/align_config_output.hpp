@@ -164,6 +164,7 @@ public:
  * \see seqan3::align_cfg::output_score
  * \see seqan3::align_cfg::output_end_position
  * \see seqan3::align_cfg::output_begin_position
+ * \see seqan3::align_cfg::output_cigar
  * \see seqan3::align_cfg::output_sequence1_id
  * \see seqan3::align_cfg::output_sequence2_id
  */
@@ -187,6 +188,54 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_alignment};
 };
 
+/*!\brief Configures the alignment result to output the alignment as a CIGAR string.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This option forces the alignment to compute the run-length encoded alignment operations as a
+ * std::vector<seqan3::cigar> directly from the trace matrix, without building the aligned sequences.
+ * The first sequence is treated as the reference and the second sequence as the query, i.e. a gap in the first
+ * sequence is an insertion ('I') and a gap in the second sequence is a deletion ('D'). The aligned columns are reported
+ * as 'M'. Unaligned prefixes and suffixes of the second sequence, e.g. in a local alignment, are reported as soft
+ * clipping ('S'). Hence, the vector can be written as seqan3::field::cigar of a SAM/BAM record with the begin
+ * position of the first sequence as seqan3::field::ref_offset and the entire second sequence as seqan3::field::seq.
+ * Use seqan3::cigar_gapped_view to iterate over the aligned sequences without storing them.
+ *
+ * If this option is not set in the alignment configuration, accessing the CIGAR vector via the
+ * seqan3::alignment_result object is forbidden and will lead to a compile time error.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_output_cigar.cpp
+ *
+ * \see seqan3::align_cfg::output_score
+ * \see seqan3::align_cfg::output_end_position
+ * \see seqan3::align_cfg::output_begin_position
+ * \see seqan3::align_cfg::output_alignment
+ * \see seqan3::align_cfg::output_sequence1_id
+ * \see seqan3::align_cfg::output_sequence2_id
+ */
+class output_cigar : public pipeable_config_element<output_cigar>
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr output_cigar() = default; //!< Defaulted.
+    constexpr output_cigar(output_cigar const &) = default; //!< Defaulted.
+    constexpr output_cigar(output_cigar &&) = default; //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar const &) = default; //!< Defaulted.
+    constexpr output_cigar & operator=(output_cigar &&) = default; //!< Defaulted.
+    ~output_cigar() = default; //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::output_cigar};
+};
+
 /*!\brief Configures the alignment result to output the id of the first sequence.
  * \ingroup alignment_configuration
  *
@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::detail::simd_target.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/concepts>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/utility/simd/detail/simd_dispatch.hpp>
+
+namespace seqan3::align_cfg::detail
+{
+/*!\brief Configuration element capturing the SIMD instruction set the vectorised alignment algorithm is generated for.
+ * \ingroup alignment_configuration
+ * \tparam instruction_set_t The instruction set; a std::integral_constant over seqan3::detail::simd_instruction_set.
+ *
+ * \details
+ *
+ * By default, the vectorised alignment uses the simd vectors of the instruction set that is enabled at compile time.
+ * If SEQAN3_SIMD_FLATTEN_DISPATCH is enabled and the executing CPU supports a wider instruction set (see
+ * seqan3::detail::runtime_simd_instruction_set), the seqan3::detail::alignment_configurator adds this element to the
+ * configuration of the vectorised alignment such that the algorithm is instantiated with the wider simd vectors. The
+ * vector width can be accessed via the seqan3::detail::alignment_configuration_traits over the corresponding
+ * alignment configuration type.
+ *
+ * \note This configuration element is only added internally during the alignment configuration and is not intended for
+ *       public use.
+ */
+template <typename instruction_set_t>
+//!\cond
+    requires std::same_as<typename instruction_set_t::value_type, seqan3::detail::simd_instruction_set>
+//!\endcond
+class simd_target : public pipeable_config_element<simd_target<instruction_set_t>>
+{
+public:
+    //!\brief The instruction set.
+    static constexpr seqan3::detail::simd_instruction_set instruction_set = instruction_set_t::value;
+
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr simd_target() = default; //!< Defaulted.
+    constexpr simd_target(simd_target const &) = default; //!< Defaulted.
+    constexpr simd_target(simd_target &&) = default; //!< Defaulted.
+    constexpr simd_target & operator=(simd_target const &) = default; //!< Defaulted.
+    constexpr simd_target & operator=(simd_target &&) = default; //!< Defaulted.
+    ~simd_target() = default; //!< Defaulted.
+
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::simd_target};
+};
+} // namespace seqan3::align_cfg::detail
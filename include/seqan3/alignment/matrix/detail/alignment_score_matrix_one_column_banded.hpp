@@ -113,6 +113,31 @@ public:
                                                        second_sequence_t && second,
                                                        align_cfg::band_fixed_size const & band,
                                                        score_t const initial_value = score_t{})
+    {
+        resize(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for the given ranges and band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first          The first range.
+     * \param[in] second         The second range.
+     * \param[in] band           The seqan3::align_cfg::band_fixed_size in which to calculate the alignment.
+     * \param[in] initial_value  The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Same as the construction from two ranges and a band, but reuses the already allocated memory. Reallocation
+     * happens only if the new band exceeds the current capacity.
+     */
+    template <std::ranges::forward_range first_sequence_t,
+              std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          align_cfg::band_fixed_size const & band,
+                          score_t const initial_value = score_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -123,9 +148,9 @@ public:
 
         band_size = band_col_index + band_row_index + 1;
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
-        matrix_base_t::pool.resize(band_size + 1, element_type{initial_value, initial_value});
+        matrix_base_t::pool.assign(band_size + 1, element_type{initial_value, initial_value});
+        matrix_base_t::cache = {};
     }
-    //!\}
 
     //!\brief The column index where the upper bound of the band passes through.
     int32_t band_col_index{};
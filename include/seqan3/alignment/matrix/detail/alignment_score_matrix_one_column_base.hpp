@@ -58,6 +58,12 @@ public:
     size_type num_cols{};
     //!\brief The number of num_rows.
     size_type num_rows{};
+
+    //!\brief Returns the number of bytes allocated by the memory pool.
+    size_t memory_footprint() const noexcept
+    {
+        return pool.capacity() * sizeof(element_type);
+    }
 };
 
 } // namespace seqan3::detail
@@ -65,6 +65,12 @@ public:
     size_type num_cols{};
     //!\brief The number of num_rows.
     size_type num_rows{};
+
+    //!\brief Returns the number of bytes allocated by the trace matrix and the cache.
+    size_t memory_footprint() const noexcept
+    {
+        return (data.capacity() + cache_left.capacity()) * sizeof(element_type);
+    }
 };
 
 } // namespace seqan3::detail
@@ -18,6 +18,7 @@
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_proxy.hpp>
 #include <seqan3/alignment/matrix/detail/trace_iterator_banded.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/std/algorithm>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 
@@ -128,7 +129,31 @@ public:
     constexpr alignment_trace_matrix_full_banded(first_sequence_t && first,
                                                  second_sequence_t && second,
                                                  align_cfg::band_fixed_size const & band,
-                                                 [[maybe_unused]] trace_t const initial_value = trace_t{})
+                                                 trace_t const initial_value = trace_t{})
+    {
+        resize(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Resizes the matrix for the given ranges and band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] band          The seqan3::align_cfg::band_fixed_size in which to calculate the alignment.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Same as the construction from two ranges and a band, but reuses the already allocated memory. Reallocation
+     * happens only if the new banded matrix exceeds the current capacity.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          align_cfg::band_fixed_size const & band,
+                          [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -142,12 +167,13 @@ public:
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
         if constexpr (!coordinate_only)
         {
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{static_cast<size_type>(band_size)},
-                                                                    number_cols{matrix_base_t::num_cols}};
-            matrix_base_t::cache_left.resize(band_size + 1, initial_value);
+            matrix_base_t::data.resize(number_rows{static_cast<size_type>(band_size)},
+                                       number_cols{matrix_base_t::num_cols});
+            std::ranges::fill(matrix_base_t::data, trace_t{});
+            matrix_base_t::cache_left.assign(band_size + 1, initial_value);
+            matrix_base_t::cache_up = trace_t{};
         }
     }
-    //!\}
 
     //!\copydoc seqan3::detail::alignment_trace_matrix_full::trace_path
     auto trace_path(matrix_coordinate const & trace_begin)
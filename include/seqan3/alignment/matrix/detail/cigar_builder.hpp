@@ -0,0 +1,153 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::cigar_builder.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alphabet/cigar/cigar.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Builds the run-length encoded CIGAR operations for a given trace path.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * In contrast to the seqan3::detail::aligned_sequence_builder, this class does not build the aligned sequences but
+ * only collects the consecutive trace directions as seqan3::cigar elements. The first sequence is treated as the
+ * reference and the second sequence as the query, such that the result can be directly written as the CIGAR string of
+ * a SAM/BAM record:
+ *
+ * | trace direction | CIGAR operation |
+ * |-----------------|-----------------|
+ * | diagonal        | 'M'             |
+ * | up              | 'I'             |
+ * | left            | 'D'             |
+ *
+ * The prefix and suffix of the second sequence that are not covered by the trace path are added as soft clipping
+ * ('S'). The first sequence is never clipped, because its offset is stored as the begin position of the alignment.
+ */
+class cigar_builder
+{
+public:
+    //!\brief The result type when building the CIGAR vector.
+    struct [[nodiscard]] result_type
+    {
+        //!\brief The slice positions of the first sequence.
+        std::pair<size_t, size_t> first_sequence_slice_positions{};
+        //!\brief The slice positions of the second sequence.
+        std::pair<size_t, size_t> second_sequence_slice_positions{};
+        //!\brief The CIGAR operations of the alignment including the soft clipping of the second sequence.
+        std::vector<cigar> cigar_vector{};
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr cigar_builder() = default; //!< Defaulted.
+    constexpr cigar_builder(cigar_builder const &) = default; //!< Defaulted.
+    constexpr cigar_builder(cigar_builder &&) = default; //!< Defaulted.
+    constexpr cigar_builder & operator=(cigar_builder const &) = default; //!< Defaulted.
+    constexpr cigar_builder & operator=(cigar_builder &&) = default; //!< Defaulted.
+    ~cigar_builder() = default; //!< Defaulted.
+
+    /*!\brief Construction from the size of the second sequence.
+     * \param[in] second_sequence_size The size of the second sequence to compute the soft clipping at the end.
+     */
+    constexpr explicit cigar_builder(size_t const second_sequence_size) noexcept :
+        second_sequence_size{second_sequence_size}
+    {}
+    //!\}
+
+    /*!\brief Builds the CIGAR vector from the given trace path.
+     * \tparam trace_path_t The type of the trace path; must model std::ranges::input_range and
+     *                      std::same_as<std::ranges::range_value_t<trace_path_t>, seqan::detail::trace_directions>
+     *                      must evaluate to `true`.
+     * \param[in] trace_path The trace path.
+     * \returns seqan3::detail::cigar_builder::result_type with the built CIGAR vector.
+     *
+     * \details
+     *
+     * The trace path runs from the end to the begin of the alignment. Hence, the operations are collected in reverse
+     * order and the vector is reversed once at the end.
+     */
+    template <std::ranges::input_range trace_path_t>
+    result_type operator()(trace_path_t && trace_path) const
+    {
+        static_assert(std::same_as<std::ranges::range_value_t<trace_path_t>, trace_directions>,
+                      "The value type of the trace path must be seqan3::detail::trace_directions");
+
+        result_type res{};
+        auto trace_it = std::ranges::begin(trace_path);
+        std::tie(res.first_sequence_slice_positions.second, res.second_sequence_slice_positions.second) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        assert(res.second_sequence_slice_positions.second <= second_sequence_size);
+        append_operation(res.cigar_vector,
+                         second_sequence_size - res.second_sequence_slice_positions.second,
+                         'S'_cigar_operation);
+
+        while (trace_it != std::ranges::end(trace_path))
+        {
+            trace_directions const last_dir = *trace_it;
+            size_t span = 0;
+            for (; trace_it != std::ranges::end(trace_path) && *trace_it == last_dir; ++trace_it, ++span)
+            {}
+
+            assert(last_dir == trace_directions::up ||
+                   last_dir == trace_directions::left ||
+                   last_dir == trace_directions::diagonal);
+
+            if (last_dir == trace_directions::up)
+                append_operation(res.cigar_vector, span, 'I'_cigar_operation);
+            else if (last_dir == trace_directions::left)
+                append_operation(res.cigar_vector, span, 'D'_cigar_operation);
+            else
+                append_operation(res.cigar_vector, span, 'M'_cigar_operation);
+        }
+
+        std::tie(res.first_sequence_slice_positions.first, res.second_sequence_slice_positions.first) =
+            std::pair<size_t, size_t>{trace_it.coordinate()};
+
+        append_operation(res.cigar_vector, res.second_sequence_slice_positions.first, 'S'_cigar_operation);
+        std::ranges::reverse(res.cigar_vector);
+
+        return res;
+    }
+
+private:
+    /*!\brief Appends the operation to the CIGAR vector if the count is not zero.
+     * \param[in,out] cigar_vector The CIGAR vector to append to.
+     * \param[in] count The number of repetitions of the operation.
+     * \param[in] operation The CIGAR operation.
+     */
+    static void append_operation(std::vector<cigar> & cigar_vector,
+                                 size_t const count,
+                                 cigar::operation const operation)
+    {
+        if (count > 0)
+            cigar_vector.emplace_back(static_cast<uint32_t>(count), operation);
+    }
+
+    //!\brief The size of the second sequence.
+    size_t second_sequence_size{};
+};
+
+} // namespace seqan3::detail
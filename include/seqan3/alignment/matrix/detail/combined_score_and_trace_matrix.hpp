@@ -83,7 +83,8 @@ public:
      *
      * \details
      *
-     * Resizes the underlying score and trace matrix to the given dimensions.
+     * Resizes the underlying score and trace matrix to the given dimensions. The memory of the underlying matrices is
+     * reused, i.e. reallocation only happens if the new dimensions exceed the capacity of the score or trace matrix.
      *
      * ### Complexity
      *
@@ -91,21 +92,21 @@ public:
      *
      * ### Exception
      *
-     * Strong exception guarantee. Might throw std::bad_alloc.
+     * Basic exception guarantee. Might throw std::bad_alloc.
      */
     template <std::integral column_index_t, std::integral row_index_t>
     void resize(column_index_type<column_index_t> const column_count,
                 row_index_type<row_index_t> const row_count,
                 score_type const initial_score = score_type{})
     {
-        score_matrix_t tmp_score_matrix{};
-        tmp_score_matrix.resize(column_count, row_count, initial_score);
-
-        trace_matrix_t tmp_trace_matrix{};
-        tmp_trace_matrix.resize(column_count, row_count);
+        score_matrix.resize(column_count, row_count, initial_score);
+        trace_matrix.resize(column_count, row_count);
+    }
 
-        score_matrix = std::move(tmp_score_matrix);
-        trace_matrix = std::move(tmp_trace_matrix);
+    //!\brief Returns the number of bytes allocated by the underlying score and trace matrix.
+    size_t memory_footprint() const noexcept
+    {
+        return score_matrix.memory_footprint() + trace_matrix.memory_footprint();
     }
 
     /*!\name Iterators
@@ -123,6 +123,12 @@ public:
         vertical_column = views::repeat_n(initial_value, number_of_rows.get());
     }
 
+    //!\brief Returns the number of bytes allocated by the optimal and the horizontal score column.
+    size_t memory_footprint() const noexcept
+    {
+        return (optimal_column.capacity() + horizontal_column.capacity()) * sizeof(score_t);
+    }
+
     /*!\name Iterators
      * \{
      */
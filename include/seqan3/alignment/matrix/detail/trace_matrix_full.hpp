@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
 #include <seqan3/std/ranges>
 #include <seqan3/std/span>
 #include <vector>
@@ -102,6 +103,7 @@ public:
      * Note the trace matrix requires the number of columns and rows to be one bigger than the size of sequence1,
      * respectively sequence2 for the initialisation of the matrix.
      * Reallocation happens only if the new column size exceeds the current capacity of the underlying trace matrix.
+     * All traces are reset to seqan3::detail::trace_directions::none.
      *
      * ### Complexity
      *
@@ -118,10 +120,18 @@ public:
         this->column_count = column_count.get();
         this->row_count = row_count.get();
         complete_matrix.resize(number_rows{this->row_count}, number_cols{this->column_count});
+        std::ranges::fill(complete_matrix, trace_t{});
+        horizontal_column.clear();
         horizontal_column.resize(this->row_count);
         vertical_column = views::repeat_n(trace_t{}, this->row_count);
     }
 
+    //!\brief Returns the number of bytes allocated by the trace matrix and the horizontal trace column.
+    size_t memory_footprint() const noexcept
+    {
+        return (complete_matrix.capacity() + horizontal_column.capacity()) * sizeof(trace_t);
+    }
+
     /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
      *        seqan3::detail::trace_directions::none.
      * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
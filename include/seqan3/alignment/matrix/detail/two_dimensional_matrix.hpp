@@ -242,6 +242,12 @@ public:
         storage.resize(this->row_dim * this->col_dim);
     }
 
+    //!\brief Returns the number of elements that can be stored without reallocating the underlying storage.
+    size_t capacity() const noexcept
+    {
+        return storage.capacity();
+    }
+
     //!\copydoc seqan3::detail::matrix::rows
     size_t rows() const noexcept
     {
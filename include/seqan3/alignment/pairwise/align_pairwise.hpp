@@ -26,6 +26,7 @@
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_async.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/range/views/persist.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
@@ -72,8 +73,10 @@ namespace seqan3
  * For each sequence pair one or more \ref seqan3::alignment_result "seqan3::alignment_result"s can be computed.
  * The seqan3::align_pairwise function returns an seqan3::algorithm_result_generator_range which can be used to iterate
  * over the alignments. If the `vectorised` configurations are omitted the alignments are computed on-demand when
- * iterating over the results. In case of a parallel execution all alignments are computed at once in parallel when
- * calling `begin` on the associated seqan3::algorithm_result_generator_range.
+ * iterating over the results. In case of a parallel execution the alignments are computed asynchronously by the
+ * configured number of threads while the results are consumed. The results are still returned in the order of the
+ * input and at most a small multiple of the thread count many sequence pairs are processed ahead of the consumer,
+ * such that the memory stays bounded even for very large inputs.
  *
  * The following snippets demonstrate the single element and the range based interface.
  *
@@ -179,45 +182,65 @@ constexpr auto align_pairwise(sequence_t && sequences,
     using complete_config_t = std::remove_cvref_t<decltype(complete_config)>;
     using traits_t = detail::alignment_configuration_traits<complete_config_t>;
 
-    auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0))
-                                     | views::chunk(traits_t::alignments_per_vector);
+    // The chunk size depends on the SIMD instruction set selected at runtime for the vectorised alignment.
+    size_t const chunk_size = detail::alignment_configurator::chunk_size<complete_config_t>();
+    auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0)) | views::chunk(chunk_size);
 
     using indexed_sequences_t = decltype(indexed_sequence_chunk_view);
     using alignment_result_t = typename traits_t::alignment_result_type;
-    using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
+    constexpr bool is_parallel = complete_config_t::template exists<align_cfg::parallel>();
+    using execution_handler_t = std::conditional_t<is_parallel,
                                                    detail::execution_handler_parallel,
                                                    detail::execution_handler_sequential>;
-    using executor_t = detail::algorithm_executor_blocking<indexed_sequences_t,
-                                                           decltype(algorithm),
-                                                           alignment_result_t,
-                                                           execution_handler_t>;
+
+    // Returns the configured number of threads.
+    auto configured_thread_count = [] (auto const & parallel_config) -> size_t
+    {
+        if (!parallel_config.thread_count)
+            throw std::runtime_error{"You must configure the number of threads in seqan3::align_cfg::parallel."};
+
+        return *parallel_config.thread_count;
+    };
 
     // Select the execution handler for the alignment configuration.
     auto select_execution_handler = [&] ()
     {
-        if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
-        {
-            auto thread_count = get<align_cfg::parallel>(complete_config).thread_count;
-            if (!thread_count)
-                throw std::runtime_error{"You must configure the number of threads in seqan3::align_cfg::parallel."};
-
-            return execution_handler_t{*thread_count};
-        }
+        if constexpr (is_parallel)
+            return execution_handler_t{configured_thread_count(get<align_cfg::parallel>(complete_config))};
         else
-        {
             return execution_handler_t{};
-        }
     };
 
     if constexpr (traits_t::is_one_way_execution) // Just compute alignment and wait until all alignments are computed.
+    {
         select_execution_handler().bulk_execute(algorithm,
                                                 indexed_sequence_chunk_view,
                                                 get<align_cfg::on_result>(complete_config).callback);
+    }
+    else if constexpr (is_parallel) // Pipeline the computation of the alignments with the consumption of the results.
+    {
+        using executor_t = detail::algorithm_executor_async<indexed_sequences_t,
+                                                            decltype(algorithm),
+                                                            alignment_result_t>;
+
+        size_t const thread_count = configured_thread_count(get<align_cfg::parallel>(complete_config));
+        return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
+                                                           std::move(algorithm),
+                                                           alignment_result_t{},
+                                                           thread_count}};
+    }
     else  // Require two way execution: return the range over the alignments.
+    {
+        using executor_t = detail::algorithm_executor_blocking<indexed_sequences_t,
+                                                               decltype(algorithm),
+                                                               alignment_result_t,
+                                                               execution_handler_t>;
+
         return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
                                                 std::move(algorithm),
                                                 alignment_result_t{},
                                                 select_execution_handler()}};
+    }
 }
 //!\endcond
 
@@ -26,6 +26,7 @@
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
 #include <seqan3/core/detail/deferred_crtp_base.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/range/container/aligned_allocator.hpp>
@@ -423,7 +424,7 @@ private:
 
         // Allocate and initialise first column.
         this->allocate_matrix(sequence1, sequence2, band, this->alignment_state);
-        size_t last_row_index = this->score_matrix.band_row_index;
+        size_t last_row_index = this->score_matrix().band_row_index;
         initialise_first_alignment_column(sequence2 | views::take(last_row_index));
 
         // ----------------------------------------------------------------------------
@@ -431,7 +432,7 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t sequence2_size = std::ranges::distance(sequence2);
-        for (auto const & seq1_value : sequence1 | views::take(this->score_matrix.band_col_index))
+        for (auto const & seq1_value : sequence1 | views::take(this->score_matrix().band_col_index))
         {
             compute_alignment_column<true>(seq1_value, sequence2 | views::take(++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
@@ -443,7 +444,7 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t first_row_index = 0;
-        for (auto const & seq1_value : sequence1 | views::drop(this->score_matrix.band_col_index))
+        for (auto const & seq1_value : sequence1 | views::drop(this->score_matrix().band_col_index))
         {
             // In the second phase the band moves in every column one base down on the second sequence.
             compute_alignment_column<false>(seq1_value, sequence2 | views::slice(first_row_index++, ++last_row_index));
@@ -488,7 +489,7 @@ private:
         // Finalise the last cell of the initial column.
         bool at_last_row = true;
         if constexpr (traits_t::is_banded) // If the band reaches until the last row of the matrix.
-            at_last_row = static_cast<size_t>(this->score_matrix.band_row_index) == this->score_matrix.num_rows - 1;
+            at_last_row = static_cast<size_t>(this->score_matrix().band_row_index) == this->score_matrix().num_rows - 1;
 
         finalise_last_cell_in_column(at_last_row);
     }
@@ -585,6 +586,7 @@ private:
      * 2. The end positions of the aligned range for the first and second sequence.
      * 3. The begin positions of the aligned range for the first and second sequence.
      * 4. The alignment between both sequences in the respective aligned region.
+     * 5. The CIGAR vector of the alignment, which is built directly from the trace path.
      *
      * If the alignment is run in debug mode (see seqan3::align_cfg::detail::debug) the debug score and optionally trace
      * matrix are stored in the alignment result as well.
@@ -627,21 +629,43 @@ private:
                                                      row_index_type{this->alignment_state.optimum.row_index}};
             // At some point this needs to be refactored so that it is not necessary to adapt the coordinate.
             if constexpr (traits_t::is_banded)
-                res.end_positions.second += res.end_positions.first - this->trace_matrix.band_col_index;
+                res.end_positions.second += res.end_positions.first - this->trace_matrix().band_col_index;
         }
 
-        if constexpr (traits_t::compute_begin_positions)
+        if constexpr (traits_t::requires_trace_information)
         {
-            // Get a aligned sequence builder for banded or un-banded case.
-            aligned_sequence_builder builder{sequence1, sequence2};
             auto optimum_coordinate = alignment_coordinate{column_index_type{this->alignment_state.optimum.column_index},
                                                            row_index_type{this->alignment_state.optimum.row_index}};
-            auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
-            res.begin_positions.first = trace_res.first_sequence_slice_positions.first;
-            res.begin_positions.second = trace_res.second_sequence_slice_positions.first;
 
-            if constexpr (traits_t::compute_sequence_alignment)
-                res.alignment = std::move(trace_res.alignment);
+            if constexpr (traits_t::compute_sequence_alignment || !traits_t::compute_cigar)
+            {
+                // Get a aligned sequence builder for banded or un-banded case.
+                aligned_sequence_builder builder{sequence1, sequence2};
+                auto trace_res = builder(this->trace_matrix().trace_path(optimum_coordinate));
+
+                if constexpr (traits_t::compute_begin_positions)
+                {
+                    res.begin_positions.first = trace_res.first_sequence_slice_positions.first;
+                    res.begin_positions.second = trace_res.second_sequence_slice_positions.first;
+                }
+
+                if constexpr (traits_t::compute_sequence_alignment)
+                    res.alignment = std::move(trace_res.alignment);
+            }
+
+            if constexpr (traits_t::compute_cigar)
+            {
+                cigar_builder builder{static_cast<size_t>(std::ranges::distance(sequence2))};
+                auto cigar_res = builder(this->trace_matrix().trace_path(optimum_coordinate));
+
+                if constexpr (traits_t::compute_begin_positions && !traits_t::compute_sequence_alignment)
+                {
+                    res.begin_positions.first = cigar_res.first_sequence_slice_positions.first;
+                    res.begin_positions.second = cigar_res.second_sequence_slice_positions.first;
+                }
+
+                res.cigar = std::move(cigar_res.cigar_vector);
+            }
         }
 
         // Store the matrices in debug mode.
@@ -731,7 +755,7 @@ private:
 
         auto coord = get<1>(column.front()).coordinate;
         if constexpr (traits_t::is_banded)
-            coord.second += coord.first - this->score_matrix.band_col_index;
+            coord.second += coord.first - this->score_matrix().band_col_index;
 
         matrix_offset offset{row_index_type{static_cast<std::ptrdiff_t>(coord.second)},
                              column_index_type{static_cast<std::ptrdiff_t>(coord.first)}};
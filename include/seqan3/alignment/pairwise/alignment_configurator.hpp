@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <tuple>
 #include <utility>
@@ -19,6 +20,7 @@
 
 #include <seqan3/alignment/configuration/align_config_output.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_simd_target.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column_banded.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_full.hpp>
@@ -26,6 +28,7 @@
 #include <seqan3/alignment/matrix/detail/combined_score_and_trace_matrix.hpp>
 #include <seqan3/alignment/matrix/detail/score_matrix_single_column.hpp>
 #include <seqan3/alignment/matrix/detail/trace_matrix_full.hpp>
+#include <seqan3/alignment/pairwise/detail/alignment_batch_scheduler.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
@@ -58,6 +61,7 @@
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/range/views/type_reduce.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/utility/simd/detail/simd_dispatch.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
@@ -143,7 +147,8 @@ private:
     private:
         //!\brief Indicates whether only the coordinate is required to compute the alignment.
         static constexpr bool only_coordinates = !(traits_t::compute_begin_positions ||
-                                                   traits_t::compute_sequence_alignment);
+                                                   traits_t::compute_sequence_alignment ||
+                                                   traits_t::compute_cigar);
 
         //!\brief The selected score matrix for either banded or unbanded alignments.
         using score_matrix_t = std::conditional_t<traits_t::is_banded,
@@ -360,10 +365,60 @@ public:
             throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
                                                   "specific edit distance computation."};
         // Configure the alignment algorithm.
-        return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
+        return std::pair{configure_simd_target<function_wrapper_t>(config_with_result_type),
                          config_with_result_type};
     }
 
+    /*!\brief Returns the number of sequence pairs the configured alignment algorithm computes at once.
+     * \tparam config_t The type of the alignment configuration as returned by
+     *                  seqan3::detail::alignment_configurator::configure.
+     *
+     * \details
+     *
+     * For the vectorised alignment this depends on the SIMD instruction set that is selected at runtime (see
+     * seqan3::detail::runtime_simd_instruction_set) if SEQAN3_SIMD_FLATTEN_DISPATCH is enabled. Otherwise, a single
+     * sequence pair is computed at once.
+     */
+    template <typename config_t>
+    static size_t alignments_per_vector() noexcept
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::is_vectorised && max_flattened_simd_instruction_set > compiled_simd_instruction_set)
+        {
+            using scalar_t = typename traits_t::original_score_type;
+            size_t const runtime_length = simd_instruction_set_byte_width(runtime_simd_instruction_set()) /
+                                          sizeof(scalar_t);
+            return std::max<size_t>(traits_t::alignments_per_vector, runtime_length);
+        }
+        else
+        {
+            return traits_t::alignments_per_vector;
+        }
+    }
+
+    /*!\brief Returns the number of sequence pairs that are passed to the configured alignment algorithm at once.
+     * \tparam config_t The type of the alignment configuration as returned by
+     *                  seqan3::detail::alignment_configurator::configure.
+     *
+     * \details
+     *
+     * The vectorised alignment algorithm is wrapped in a seqan3::detail::alignment_batch_scheduler which distributes
+     * the sequence pairs of #scheduled_batches_per_chunk batches onto batches of similar length. Otherwise, this is
+     * the same as seqan3::detail::alignment_configurator::alignments_per_vector.
+     */
+    template <typename config_t>
+    static size_t chunk_size() noexcept
+    {
+        if constexpr (alignment_configuration_traits<config_t>::is_vectorised)
+            return alignments_per_vector<config_t>() * scheduled_batches_per_chunk;
+        else
+            return alignments_per_vector<config_t>();
+    }
+
+    //!\brief The number of simd batches that are scheduled together by seqan3::detail::alignment_batch_scheduler.
+    static constexpr size_t scheduled_batches_per_chunk = 8;
+
 private:
     /*!\brief Adds maybe the default output arguments if the user did not provide any.
      *
@@ -467,6 +522,92 @@ private:
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
 
+    /*!\brief Selects the widest SIMD instruction set of the executing CPU for the vectorised alignment.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg The configuration object.
+     * \returns The configured alignment algorithm.
+     *
+     * \details
+     *
+     * If the vectorised alignment is configured, SEQAN3_SIMD_FLATTEN_DISPATCH is enabled and the executing CPU supports
+     * a wider instruction set than the one enabled at compile time, seqan3::align_cfg::detail::simd_target is added to
+     * the configuration. The algorithm is then instantiated with the wider simd vectors and wrapped in a
+     * seqan3::detail::simd_target_invoker (see make_algorithm), such that it is compiled for the selected instruction
+     * set.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static function_wrapper_t configure_simd_target(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::is_vectorised && max_flattened_simd_instruction_set > compiled_simd_instruction_set)
+        {
+            auto configure_with = [&] (auto instruction_set)
+            {
+                using simd_target_t = align_cfg::detail::simd_target<decltype(instruction_set)>;
+                return configure_scoring_scheme<function_wrapper_t>(cfg | simd_target_t{});
+            };
+
+            using is = simd_instruction_set;
+            is const instruction_set = runtime_simd_instruction_set();
+
+            if (instruction_set == is::avx512)
+                return configure_with(std::integral_constant<is, is::avx512>{});
+
+            if constexpr (compiled_simd_instruction_set < is::avx2)
+            {
+                if (instruction_set == is::avx2)
+                    return configure_with(std::integral_constant<is, is::avx2>{});
+            }
+        }
+
+        return configure_scoring_scheme<function_wrapper_t>(cfg);
+    }
+
+    /*!\brief Wraps the algorithm in a seqan3::detail::simd_target_invoker if a wider instruction set was selected.
+     * \tparam config_t The alignment configuration type.
+     * \tparam algorithm_t The type of the alignment algorithm.
+     * \param[in] algorithm The alignment algorithm.
+     * \returns The algorithm or the seqan3::detail::simd_target_invoker wrapping it.
+     */
+    template <typename config_t, typename algorithm_t>
+    static constexpr auto make_simd_target_invoker(algorithm_t algorithm)
+    {
+        if constexpr (config_t::template exists<align_cfg::detail::simd_target>())
+        {
+            using simd_target_t = std::remove_cvref_t<decltype(get<align_cfg::detail::simd_target>(std::declval<config_t>()))>;
+            return simd_target_invoker<simd_target_t::instruction_set, algorithm_t>{std::move(algorithm)};
+        }
+        else
+        {
+            return algorithm;
+        }
+    }
+
+    /*!\brief Wraps the vectorised algorithm in a seqan3::detail::alignment_batch_scheduler.
+     * \tparam config_t The alignment configuration type.
+     * \tparam algorithm_t The type of the alignment algorithm.
+     * \param[in] algorithm The alignment algorithm.
+     * \returns The algorithm or the seqan3::detail::alignment_batch_scheduler wrapping it.
+     */
+    template <typename config_t, typename algorithm_t>
+    static constexpr auto make_batch_scheduler(algorithm_t algorithm)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::is_vectorised)
+        {
+            using alignment_result_t = typename traits_t::alignment_result_type;
+            return alignment_batch_scheduler<algorithm_t, alignment_result_t>{std::move(algorithm),
+                                                                              traits_t::alignments_per_vector};
+        }
+        else
+        {
+            return algorithm;
+        }
+    }
+
     /*!\brief Constructs the actual alignment algorithm wrapped in the passed std::function object.
      *
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
@@ -491,18 +632,25 @@ private:
         // macrobenchmarks to show that it maintains a high performance.
 
         // Use old alignment implementation if...
-        if constexpr (traits_t::is_local ||                                          // it is a local alignment,
-                      traits_t::is_debug ||                                          // it runs in debug mode,
-                      traits_t::compute_sequence_alignment ||                        // it computes more than the begin position.
-                     (traits_t::is_banded && traits_t::compute_begin_positions) ||   // banded && more than end positions.
-                     (traits_t::is_vectorised && traits_t::compute_end_positions))   // simd and more than the score.
+        if constexpr (traits_t::is_local ||                                           // it is a local alignment,
+                      traits_t::is_debug ||                                           // it runs in debug mode,
+                      traits_t::compute_sequence_alignment ||                         // it computes more than the begin position.
+                     (traits_t::is_banded && traits_t::requires_trace_information) || // banded && more than end positions.
+                     (traits_t::is_vectorised && (traits_t::compute_end_positions ||  // simd and more than the score.
+                                                  traits_t::compute_cigar)))
         {
             using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
             using gap_policy_t = typename select_gap_policy<traits_t>::type;
             using find_optimum_t = typename select_find_optimum_policy<traits_t>::type;
             using gap_init_policy_t = deferred_crtp_base<affine_gap_init_policy>;
 
-            return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, find_optimum_t, gap_init_policy_t, policies_t...>{cfg};
+            using algorithm_t = alignment_algorithm<config_t,
+                                                    matrix_policy_t,
+                                                    gap_policy_t,
+                                                    find_optimum_t,
+                                                    gap_init_policy_t,
+                                                    policies_t...>;
+            return make_batch_scheduler<config_t>(make_simd_target_invoker<config_t>(algorithm_t{cfg}));
         }
         else  // Use new alignment algorithm implementation.
         {
@@ -588,7 +736,7 @@ private:
                                                              result_builder_policy_t,
                                                              scoring_scheme_policy_t,
                                                              alignment_matrix_policy_t>;
-            return algorithm_t{cfg};
+            return make_batch_scheduler<config_t>(make_simd_target_invoker<config_t>(algorithm_t{cfg}));
         }
     }
 };
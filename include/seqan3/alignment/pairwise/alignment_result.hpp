@@ -40,6 +40,7 @@ class policy_alignment_result_builder;
  * \tparam end_positions_t       The type of the end positions, can be omitted.
  * \tparam begin_positions_t     The type of the begin positions, can be omitted.
  * \tparam alignment_t           The type of the alignment, can be omitted.
+ * \tparam cigar_t               The type of the CIGAR vector, can be omitted.
  * \tparam score_debug_matrix_t  The type of the score matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
  * \tparam trace_debug_matrix_t  The type of the trace matrix. Only present if seqan3::align_cfg::detail::debug is enabled.
  */
@@ -49,6 +50,7 @@ template <typename sequence1_id_t,
           typename end_positions_t = std::nullopt_t *,
           typename begin_positions_t = std::nullopt_t *,
           typename alignment_t = std::nullopt_t *,
+          typename cigar_t = std::nullopt_t *,
           typename score_debug_matrix_t = std::nullopt_t *,
           typename trace_debug_matrix_t = std::nullopt_t *>
 struct alignment_result_value_type
@@ -65,6 +67,8 @@ struct alignment_result_value_type
     begin_positions_t begin_positions{};
     //! \brief The alignment, i.e. the actual base pair matching.
     alignment_t alignment{};
+    //! \brief The alignment as run-length encoded CIGAR operations.
+    cigar_t cigar{};
 
     //!\brief The score matrix. Only accessible with seqan3::align_cfg::detail::debug.
     score_debug_matrix_t score_debug_matrix{};
@@ -113,6 +117,29 @@ alignment_result_value_type(sequence1_id_t, sequence2_id_t, score_t, end_positio
                                    end_positions_t,
                                    begin_positions_t,
                                    alignment_t>;
+
+//! \brief Type deduction for id, score, end positions, begin positions, alignment and CIGAR vector.
+template <typename sequence1_id_t,
+          typename sequence2_id_t,
+          typename score_t,
+          typename end_positions_t,
+          typename begin_positions_t,
+          typename alignment_t,
+          typename cigar_t>
+alignment_result_value_type(sequence1_id_t,
+                            sequence2_id_t,
+                            score_t,
+                            end_positions_t,
+                            begin_positions_t,
+                            alignment_t,
+                            cigar_t)
+    -> alignment_result_value_type<sequence1_id_t,
+                                   sequence2_id_t,
+                                   score_t,
+                                   end_positions_t,
+                                   begin_positions_t,
+                                   alignment_t,
+                                   cigar_t>;
 //!\}
 
 //!\cond
@@ -173,6 +200,8 @@ private:
     using begin_positions_t = decltype(data.begin_positions);
     //! \brief The type for the alignment.
     using alignment_t = decltype(data.alignment);
+    //! \brief The type for the CIGAR vector.
+    using cigar_t = decltype(data.cigar);
     //!\}
 
     //!\brief Befriend alignment result builder.
@@ -319,6 +348,26 @@ public:
                       "Trying to access the alignment, although it was not requested in the alignment configuration.");
         return data.alignment;
     }
+
+    /*!\brief Returns the alignment as run-length encoded CIGAR operations.
+     * \return A std::vector over seqan3::cigar elements.
+     *
+     * \details
+     *
+     * The first sequence is the reference and the second sequence is the query. The unaligned prefix and suffix of the
+     * second sequence are reported as soft clipping.
+     * Use seqan3::cigar_gapped_view to iterate over the aligned sequences.
+     *
+     * \note This function is only available if the CIGAR vector was requested via the alignment configuration
+     * (see seqan3::align_cfg::output_cigar).
+     */
+    constexpr cigar_t const & cigar() const noexcept
+    {
+        static_assert(!std::is_same_v<cigar_t, std::nullopt_t *>,
+                      "Trying to access the CIGAR vector, although it was not requested in the alignment"
+                      " configuration.");
+        return data.cigar;
+    }
     //!\}
 
     //!\cond DEV
@@ -411,6 +460,7 @@ inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream
     constexpr bool has_begin_positions = !std::is_same_v<decltype(std::declval<result_data_t>().begin_positions),
                                                          disabled_t>;
     constexpr bool has_alignment = !std::is_same_v<decltype(std::declval<result_data_t>().alignment), disabled_t>;
+    constexpr bool has_cigar = !std::is_same_v<decltype(std::declval<result_data_t>().cigar), disabled_t>;
 
     bool prepend_comma = false;
     auto append_to_stream = [&] (auto && ...args)
@@ -432,6 +482,8 @@ inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & stream
         append_to_stream("end: (", result.sequence1_end_position(), ",", result.sequence2_end_position(), ")");
     if constexpr (has_alignment)
         append_to_stream("\nalignment:\n", result.alignment());
+    if constexpr (has_cigar)
+        append_to_stream("cigar: ", result.cigar());
     stream << '}';
 
     return stream;
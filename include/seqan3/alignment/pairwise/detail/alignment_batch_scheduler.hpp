@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::alignment_batch_scheduler.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <seqan3/std/concepts>
+#include <numeric>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/range/views/zip.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Distributes a chunk of sequence pairs onto batches of similar length before invoking the vectorised
+ *        alignment algorithm.
+ * \ingroup pairwise_alignment
+ * \implements std::invocable
+ *
+ * \tparam algorithm_t The type of the wrapped vectorised alignment algorithm.
+ * \tparam alignment_result_t The type of the alignment result.
+ *
+ * \details
+ *
+ * The vectorised alignment computes one batch of sequence pairs at once and every simd lane runs until the longest
+ * sequences of the batch are processed. If a batch contains sequences of very different lengths, most lanes only
+ * compute padding. Accordingly, this scheduler receives a chunk that is a multiple of the batch size, sorts the
+ * sequence pairs of the chunk by the lengths of their sequences and invokes the wrapped algorithm on consecutive
+ * batches of the sorted order. The results are buffered and passed to the callback in the original order of the
+ * chunk. The sequences themselves are not copied.
+ *
+ * The wrapped algorithm must invoke the callback exactly once per sequence pair in the order of the batch.
+ */
+template <typename algorithm_t, typename alignment_result_t>
+class alignment_batch_scheduler
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    alignment_batch_scheduler() = default; //!< Defaulted.
+    alignment_batch_scheduler(alignment_batch_scheduler const &) = default; //!< Defaulted.
+    alignment_batch_scheduler(alignment_batch_scheduler &&) = default; //!< Defaulted.
+    alignment_batch_scheduler & operator=(alignment_batch_scheduler const &) = default; //!< Defaulted.
+    alignment_batch_scheduler & operator=(alignment_batch_scheduler &&) = default; //!< Defaulted.
+    ~alignment_batch_scheduler() = default; //!< Defaulted.
+
+    /*!\brief Constructs the scheduler from the wrapped algorithm and the batch size.
+     * \param[in] algorithm The vectorised alignment algorithm.
+     * \param[in] batch_size The number of alignments that are computed at once, i.e. the number of simd lanes.
+     */
+    alignment_batch_scheduler(algorithm_t algorithm, size_t const batch_size) :
+        algorithm{std::move(algorithm)},
+        batch_size{std::max<size_t>(batch_size, 1u)}
+    {}
+    //!\}
+
+    /*!\brief Invokes the wrapped algorithm on length-sorted batches of the given indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with `alignment_result_t` as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The sequence pairs are sorted stably by the length of the first and then of the second sequence.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_t>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using iterator_t = std::ranges::iterator_t<indexed_sequence_pairs_t>;
+        using sequence_pair_reference_t = std::tuple_element_t<0,
+                                                               std::ranges::range_reference_t<indexed_sequence_pairs_t>>;
+
+        std::vector<iterator_t> positions{};
+        std::vector<std::pair<size_t, size_t>> lengths{};
+        for (auto it = std::ranges::begin(indexed_sequence_pairs); it != std::ranges::end(indexed_sequence_pairs); ++it)
+        {
+            auto && [sequence_pair, idx] = *it;
+            (void) idx;
+            positions.push_back(it);
+            lengths.emplace_back(std::ranges::size(get<0>(sequence_pair)), std::ranges::size(get<1>(sequence_pair)));
+        }
+
+        std::vector<size_t> order(positions.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&] (size_t const lhs, size_t const rhs)
+        {
+            return lengths[lhs] < lengths[rhs];
+        });
+
+        std::vector<alignment_result_t> results(positions.size());
+
+        for (size_t batch_begin = 0; batch_begin < order.size(); batch_begin += batch_size)
+        {
+            std::span<size_t const> batch_order{order.data() + batch_begin,
+                                                std::min(batch_size, order.size() - batch_begin)};
+
+            // The batch refers to the original sequence pairs and indices.
+            auto batch = views::zip(batch_order | std::views::transform([&] (size_t const pos)
+                                                                        -> sequence_pair_reference_t
+                                    {
+                                        return get<0>(*positions[pos]);
+                                    }),
+                                    batch_order | std::views::transform([&] (size_t const pos)
+                                    {
+                                        return get<1>(*positions[pos]);
+                                    }));
+
+            size_t lane = 0;
+            algorithm(batch, [&] (auto && result)
+            {
+                assert(lane < batch_order.size());
+                results[batch_order[lane++]] = std::forward<decltype(result)>(result);
+            });
+        }
+
+        for (alignment_result_t & result : results)
+            callback(std::move(result));
+    }
+
+private:
+    //!\brief The wrapped alignment algorithm.
+    algorithm_t algorithm{};
+    //!\brief The number of sequence pairs that are aligned at once.
+    size_t batch_size{1u};
+};
+
+} // namespace seqan3::detail
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <limits>
 #include <tuple>
 
+#include <seqan3/alignment/configuration/align_config_matrix_memory_limit.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/coordinate_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
@@ -35,7 +37,8 @@ namespace seqan3::detail
  *
  * The alignment matrix must be a matrix type that is compatible with the configured alignment algorithm. It must offer
  * a resize member function that takes a seqan3::detail::column_index_type and seqan3::detail::row_index_type and an
- * additional parameter to initialise the allocated matrix memory.
+ * additional parameter to initialise the allocated matrix memory. Furthermore, it must offer a member function
+ * `memory_footprint()` returning the number of bytes allocated by the matrix.
  */
 template <typename traits_t, typename alignment_matrix_t>
 //!\cond
@@ -43,6 +46,7 @@ template <typename traits_t, typename alignment_matrix_t>
               requires (alignment_matrix_t & matrix, typename traits_t::score_type const initial_score)
               {
                   { matrix.resize(column_index_type{size_t{}}, row_index_type{size_t{}}, initial_score) };
+                  { matrix.memory_footprint() } -> std::convertible_to<size_t>;
               })
 //!\endcond
 class policy_alignment_matrix
@@ -61,6 +65,8 @@ protected:
     bool last_column_is_free{};
     //!\brief A flag indicating whether the final gaps in the last row are free.
     bool last_row_is_free{};
+    //!\brief The maximal number of bytes of the thread local alignment matrix that are kept for the next alignment.
+    size_t matrix_memory_limit{std::numeric_limits<size_t>::max()};
 
     /*!\name Constructors, destructor and assignment
      * \{
@@ -97,6 +103,7 @@ protected:
 
         lower_diagonal = band.lower_diagonal;
         upper_diagonal = band.upper_diagonal;
+        matrix_memory_limit = config.get_or(seqan3::align_cfg::matrix_memory_limit{}).bytes;
 
         bool invalid_band = upper_diagonal < lower_diagonal;
         std::string error_cause = (invalid_band) ? " The upper diagonal is smaller than the lower diagonal." : "";
@@ -135,6 +142,8 @@ protected:
      * Acquires a thread local alignment and index matrix. Initialises the matrices with the given
      * sequence sizes and the initial score value. In the banded alignment, the alignment matrix is reduced to
      * the column count times the band size.
+     * The memory of the alignment matrix is reused from the previous alignments of the same thread, unless it
+     * exceeds the configured seqan3::align_cfg::matrix_memory_limit. In this case it is released first.
      *
      * ### Exception
      *
@@ -163,6 +172,9 @@ protected:
 
         index_matrix.resize(column_index_type{column_count}, row_index_type{row_count});
 
+        if (alignment_matrix.memory_footprint() > matrix_memory_limit)
+            alignment_matrix = alignment_matrix_t{};
+
         if constexpr (traits_t::is_banded)
         {
             assert(upper_diagonal - lower_diagonal + 1 > 0); // Band size is a positive integer.
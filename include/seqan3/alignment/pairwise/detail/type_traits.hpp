@@ -16,6 +16,7 @@
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
+#include <seqan3/alignment/configuration/align_config_simd_target.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
@@ -72,6 +73,32 @@ struct chunked_indexed_sequence_pairs
 // alignment_configuration_traits
 //------------------------------------------------------------------------------
 
+/*!\brief Returns the number of packed values of the given scalar type in a simd vector of the vectorised alignment.
+ * \ingroup pairwise_alignment
+ * \tparam configuration_t The type of the alignment configuration object; must be a specialisation of
+ *                         seqan3::configuration.
+ * \tparam scalar_t The scalar type.
+ *
+ * \details
+ *
+ * If the configuration contains seqan3::align_cfg::detail::simd_target, the vector width of the selected instruction set
+ * is used. Otherwise, the default length of seqan3::simd::simd_type is returned.
+ */
+template <typename configuration_t, typename scalar_t>
+constexpr size_t alignment_simd_length() noexcept
+{
+    if constexpr (configuration_t::template exists<align_cfg::detail::simd_target>())
+    {
+        using simd_target_cfg_t =
+            std::remove_cvref_t<decltype(seqan3::get<align_cfg::detail::simd_target>(std::declval<configuration_t>()))>;
+        return simd_instruction_set_byte_width(simd_target_cfg_t::instruction_set) / sizeof(scalar_t);
+    }
+    else
+    {
+        return default_simd_length<scalar_t, default_simd_backend>;
+    }
+}
+
 /*!\brief A traits type for the alignment algorithm that exposes static information stored within the alignment
  *        configuration object.
  * \ingroup pairwise_alignment
@@ -116,6 +143,10 @@ private:
         }
     }
 
+    //!\brief The simd vector type over the given scalar type.
+    template <typename scalar_t>
+    using select_simd_t = simd_type_t<scalar_t, alignment_simd_length<configuration_t, scalar_t>()>;
+
 public:
     //!\brief Flag to indicate vectorised mode.
     static constexpr bool is_vectorised = configuration_t::template exists<align_cfg::vectorised>();
@@ -140,14 +171,14 @@ public:
     using original_score_type = typename std::remove_reference_t<decltype(
         std::declval<configuration_t>().get_or(align_cfg::score_type<int32_t>{}))>::type;
     //!\brief The score type for the alignment algorithm.
-    using score_type = std::conditional_t<is_vectorised, simd_type_t<original_score_type>, original_score_type>;
+    using score_type = std::conditional_t<is_vectorised, select_simd_t<original_score_type>, original_score_type>;
     //!\brief The trace directions type for the alignment algorithm.
-    using trace_type = std::conditional_t<is_vectorised, simd_type_t<original_score_type>, trace_directions>;
+    using trace_type = std::conditional_t<is_vectorised, select_simd_t<original_score_type>, trace_directions>;
     //!\brief The alignment result type if present. Otherwise seqan3::detail::empty_type.
     using alignment_result_type = decltype(determine_alignment_result_type());
     //!\brief The type of the matrix index.
     using matrix_index_type = std::conditional_t<is_vectorised,
-                                                 simd_type_t<select_scalar_index_t<original_score_type>>,
+                                                 select_simd_t<select_scalar_index_t<original_score_type>>,
                                                  size_t>;
     //!\brief The type of the matrix coordinate.
     using matrix_coordinate_type = lazy_conditional_t<is_vectorised,
@@ -173,6 +204,8 @@ public:
     //!\brief Flag indicating whether the sequence alignment shall be computed.
     static constexpr bool compute_sequence_alignment =
         configuration_t::template exists<align_cfg::output_alignment>();
+    //!\brief Flag indicating whether the alignment shall be computed as CIGAR vector.
+    static constexpr bool compute_cigar = configuration_t::template exists<align_cfg::output_cigar>();
     //!\brief Flag indicating whether the id of the first sequence shall be returned.
     static constexpr bool output_sequence1_id =
         configuration_t::template exists<align_cfg::output_sequence1_id>();
@@ -184,10 +217,13 @@ public:
                                                      compute_end_positions ||
                                                      compute_begin_positions ||
                                                      compute_sequence_alignment ||
+                                                     compute_cigar ||
                                                      output_sequence1_id ||
                                                      output_sequence2_id;
     //!\brief Flag indicating whether the trace matrix needs to be computed.
-    static constexpr bool requires_trace_information = compute_begin_positions || compute_sequence_alignment;
+    static constexpr bool requires_trace_information = compute_begin_positions ||
+                                                       compute_sequence_alignment ||
+                                                       compute_cigar;
 };
 
 //------------------------------------------------------------------------------
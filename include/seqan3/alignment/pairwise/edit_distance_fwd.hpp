@@ -101,9 +101,12 @@ struct default_edit_distance_trait_type
     static constexpr bool compute_score = true;
     //!\brief Whether the alignment configuration indicates to compute and/or store the alignment of the sequences.
     static constexpr bool compute_sequence_alignment = alignment_traits_type::compute_sequence_alignment;
+    //!\brief Whether the alignment configuration indicates to compute and/or store the CIGAR vector.
+    static constexpr bool compute_cigar = alignment_traits_type::compute_cigar;
     //!\brief Whether the alignment configuration indicates to compute and/or store the begin positions.
     static constexpr bool compute_begin_positions = alignment_traits_type::compute_begin_positions ||
-                                                    compute_sequence_alignment;
+                                                    compute_sequence_alignment ||
+                                                    compute_cigar;
     //!\brief Whether the alignment configuration indicates to compute and/or store the end positions.
     static constexpr bool compute_end_positions = alignment_traits_type::compute_end_positions ||
                                                   compute_begin_positions;
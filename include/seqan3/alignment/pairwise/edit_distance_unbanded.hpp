@@ -19,6 +19,7 @@
 #include <utility>
 
 #include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
 #include <seqan3/alignment/matrix/edit_distance_score_matrix_full.hpp>
 #include <seqan3/alignment/matrix/edit_distance_trace_matrix_full.hpp>
 #include <seqan3/alignment/matrix/matrix_concept.hpp>
@@ -751,6 +752,7 @@ private:
     using edit_traits::compute_end_positions;
     using edit_traits::compute_begin_positions;
     using edit_traits::compute_sequence_alignment;
+    using edit_traits::compute_cigar;
     using edit_traits::compute_score_matrix;
     using edit_traits::compute_trace_matrix;
     using edit_traits::compute_matrix;
@@ -1063,7 +1065,7 @@ public:
         if constexpr (compute_end_positions)
             cached_end_positions = this->end_positions();
 
-        if constexpr (compute_begin_positions && !compute_sequence_alignment)
+        if constexpr (compute_begin_positions && !compute_sequence_alignment && !compute_cigar)
         {
             static_assert(compute_end_positions, "End positions required to compute the begin positions.");
             cached_begin_positions = this->begin_positions();
@@ -1095,6 +1097,18 @@ public:
             }
         }
 
+        if constexpr (traits_type::compute_cigar)
+        {
+            if (this->is_valid())
+            {
+                cigar_builder builder{static_cast<size_t>(std::ranges::distance(this->query))};
+                auto cigar_res = builder(this->trace_matrix().trace_path(cached_end_positions));
+                res_vt.cigar = std::move(cigar_res.cigar_vector);
+                cached_begin_positions.first = cigar_res.first_sequence_slice_positions.first;
+                cached_begin_positions.second = cigar_res.second_sequence_slice_positions.first;
+            }
+        }
+
         if constexpr (traits_type::compute_end_positions)
             res_vt.end_positions = std::move(cached_end_positions);
 
@@ -16,6 +16,7 @@
 #include <tuple>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_matrix_memory_limit.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/range/views/zip.hpp>
@@ -39,6 +40,11 @@ namespace seqan3::detail
  * iterators are used as a global state within this particular alignment instance and are accessed from the alignment
  * algorithm.
  *
+ * The matrices are stored thread locally and are reused for all alignments that are computed by the same thread, such
+ * that memory is only allocated if a matrix exceeds the capacity of the previous alignments. Copies of the
+ * algorithm, e.g. when it is executed in parallel, share the matrices of the executing thread. If the memory of the
+ * matrices exceeds the limit set by seqan3::align_cfg::matrix_memory_limit, it is released before the next alignment.
+ *
  * \remarks The template parameters of this CRTP-policy are selected in the
  *          seqan3::detail::alignment_configurator::select_matrix_policy when selecting the alignment for the given
  *          configuration.
@@ -62,10 +68,35 @@ private:
 
     //!\brief Initialise the policy.
     template <typename configuration_t>
-    alignment_matrix_policy(configuration_t const & /*config*/)
+    alignment_matrix_policy(configuration_t const & config) :
+        matrix_memory_limit{config.get_or(align_cfg::matrix_memory_limit{}).bytes}
     {}
     //!}
 
+    //!\brief Returns the thread local score matrix.
+    static score_matrix_t & score_matrix() noexcept
+    {
+        static thread_local score_matrix_t matrix{};
+        return matrix;
+    }
+
+    //!\brief Returns the thread local trace matrix.
+    static trace_matrix_t & trace_matrix() noexcept
+    {
+        static thread_local trace_matrix_t matrix{};
+        return matrix;
+    }
+
+    //!\brief Releases the memory of the thread local matrices if it exceeds the configured memory limit.
+    void release_matrix_memory_above_limit() const
+    {
+        if (score_matrix().memory_footprint() + trace_matrix().memory_footprint() > matrix_memory_limit)
+        {
+            score_matrix() = score_matrix_t{};
+            trace_matrix() = trace_matrix_t{};
+        }
+    }
+
     /*!\brief Allocates the memory of the underlying matrices.
      * \tparam sequence1_t The type of the first sequence to align; must model std::forward_ranges.
      * \tparam sequence2_t The type of the second sequence to align; must model std::forward_ranges.
@@ -76,13 +107,14 @@ private:
      * \details
      *
      * Initialises the underlying score and trace matrices and sets the respective matrix iterators to the begin of the
-     * corresponding matrix.
+     * corresponding matrix. The memory of the thread local matrices is reused.
      */
     template <typename sequence1_t, typename sequence2_t>
-    constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        release_matrix_memory_above_limit();
+        score_matrix().resize(sequence1, sequence2);
+        trace_matrix().resize(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -109,25 +141,26 @@ private:
      * can get the smallest possible value as an infinity.
      */
     template <typename sequence1_t, typename sequence2_t, typename score_t>
-    constexpr void allocate_matrix(sequence1_t && sequence1,
-                                   sequence2_t && sequence2,
-                                   align_cfg::band_fixed_size const & band,
-                                   alignment_algorithm_state<score_t> const & state)
+    void allocate_matrix(sequence1_t && sequence1,
+                         sequence2_t && sequence2,
+                         align_cfg::band_fixed_size const & band,
+                         alignment_algorithm_state<score_t> const & state)
     {
         assert(state.gap_extension_score <= 0); // We expect it to never be positive.
 
         score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        release_matrix_memory_above_limit();
+        score_matrix().resize(sequence1, sequence2, band, inf);
+        trace_matrix().resize(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
 
     //!\brief Initialises the score and trace matrix iterator after allocating the matrices.
-    constexpr void initialise_matrix_iterator() noexcept
+    void initialise_matrix_iterator() noexcept
     {
-        score_matrix_iter = score_matrix.begin();
-        trace_matrix_iter = trace_matrix.begin();
+        score_matrix_iter = score_matrix().begin();
+        trace_matrix_iter = trace_matrix().begin();
     }
 
     /*!\brief Slices the sequences according to the band parameters.
@@ -195,8 +228,8 @@ private:
         ++trace_matrix_iter;
     }
 
-    score_matrix_t score_matrix{}; //!< The scoring matrix.
-    trace_matrix_t trace_matrix{}; //!< The trace matrix if needed.
+    //!\brief The maximal number of bytes of the thread local matrices that are kept for the next alignment.
+    size_t matrix_memory_limit{std::numeric_limits<size_t>::max()};
 
     typename score_matrix_t::iterator score_matrix_iter{}; //!< The matrix iterator over the score matrix.
     typename trace_matrix_t::iterator trace_matrix_iter{}; //!< The matrix iterator over the trace matrix.
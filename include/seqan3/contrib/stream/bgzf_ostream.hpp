@@ -157,20 +157,21 @@ public:
 
     basic_bgzf_ostreambuf(ostream_reference ostream_,
                          size_t numThreads = bgzf_thread_count,
+                         int compressionLevel = Z_BEST_SPEED,
                          size_t jobsPerThread = 8) :
-        numThreads(numThreads),
-        numJobs(numThreads * jobsPerThread),
+        numThreads(std::max<size_t>(numThreads, 1u)), // at least one thread must compress the blocks
+        numJobs(this->numThreads * jobsPerThread),
         jobQueue(numJobs),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numJobs)
     {
         jobs.resize(numJobs);
         currentJobId = 0;
 
         lockWriting(jobQueue);
         lockReading(idleQueue);
-        setReaderWriterCount(jobQueue, numThreads, 1);
-        setReaderWriterCount(idleQueue, 1, numThreads);
+        setReaderWriterCount(jobQueue, this->numThreads, 1);
+        setReaderWriterCount(idleQueue, 1, this->numThreads);
 
         // Prepare idle queue.
         for (size_t i = 0; i < numJobs; ++i)
@@ -180,8 +181,11 @@ public:
         }
 
         // Start off threads.
-        for (size_t i = 0; i < numThreads; ++i)
-            pool.emplace_back(CompressionThread{this, CompressionContext<detail::bgzf_compression>{}});
+        CompressionContext<detail::bgzf_compression> compressionCtx{};
+        compressionCtx.level = compressionLevel;
+
+        for (size_t i = 0; i < this->numThreads; ++i)
+            pool.emplace_back(CompressionThread{this, compressionCtx});
 
         currentJobAvail = popFront(currentJobId, idleQueue);
         assert(currentJobAvail);
@@ -305,8 +309,10 @@ public:
     typedef std::basic_ostream<Elem, Tr>&                         ostream_reference;
     typedef basic_bgzf_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_streambuf_type;
 
-    basic_bgzf_ostreambase(ostream_reference ostream_)
-        : m_buf(ostream_)
+    basic_bgzf_ostreambase(ostream_reference ostream_,
+                           size_t numThreads = bgzf_thread_count,
+                           int compressionLevel = Z_BEST_SPEED)
+        : m_buf(ostream_, numThreads, compressionLevel)
     {
         this->init(&m_buf );
     };
@@ -346,8 +352,12 @@ public:
     typedef std::basic_ostream<Elem,Tr>                        ostream_type;
     typedef ostream_type&                                      ostream_reference;
 
-    basic_bgzf_ostream(ostream_reference ostream_) :
-        bgzf_ostreambase_type(ostream_),
+    // numThreads: the number of compression threads (at least one is used).
+    // compressionLevel: the zlib compression level; Z_NO_COMPRESSION (0) to Z_BEST_COMPRESSION (9).
+    basic_bgzf_ostream(ostream_reference ostream_,
+                       size_t numThreads = bgzf_thread_count,
+                       int compressionLevel = Z_BEST_SPEED) :
+        bgzf_ostreambase_type(ostream_, numThreads, compressionLevel),
         ostream_type(bgzf_ostreambase_type::rdbuf())
     {}
 
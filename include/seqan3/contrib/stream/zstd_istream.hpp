@@ -0,0 +1,198 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_istream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if SEQAN3_HAS_ZSTD
+#include <zstd.h>
+#else
+#error "This file cannot be used when building without ZSTD-support."
+#endif  // SEQAN3_HAS_ZSTD
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A stream buffer that decompresses zstd compressed input.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The character traits type.
+ *
+ * \details
+ *
+ * Concatenated frames are decompressed one after another and skippable frames (e.g. the seek table of the zstd
+ * seekable format) are skipped. Truncated or corrupt input raises seqan3::io_error.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1u, "The zstd streams only support character types with a size of one byte.");
+
+private:
+    //!\brief The base type.
+    using base_t = std::basic_streambuf<char_t, traits_t>;
+
+    //!\brief Frees the decompression context.
+    struct context_deleter
+    {
+        //!\brief Frees the decompression context.
+        void operator()(ZSTD_DCtx * context) const noexcept
+        {
+            ZSTD_freeDCtx(context);
+        }
+    };
+
+    //!\brief The number of characters that can be put back.
+    static constexpr size_t max_putback = 4u;
+
+public:
+    //!\brief The integer type of the stream buffer.
+    using int_type = typename base_t::int_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_zstd_istreambuf() = delete; //!< Deleted.
+    basic_zstd_istreambuf(basic_zstd_istreambuf const &) = delete; //!< Deleted.
+    basic_zstd_istreambuf(basic_zstd_istreambuf &&) = delete; //!< Deleted.
+    basic_zstd_istreambuf & operator=(basic_zstd_istreambuf const &) = delete; //!< Deleted.
+    basic_zstd_istreambuf & operator=(basic_zstd_istreambuf &&) = delete; //!< Deleted.
+    ~basic_zstd_istreambuf() = default; //!< Defaulted.
+
+    /*!\brief Constructs the stream buffer reading from the given stream.
+     * \param[in] primary_stream The stream the compressed data is read from.
+     * \throws seqan3::io_error If the decompression context cannot be created.
+     */
+    explicit basic_zstd_istreambuf(std::basic_istream<char_t, traits_t> & primary_stream) :
+        primary_stream{primary_stream},
+        context{ZSTD_createDCtx()},
+        input_buffer(ZSTD_DStreamInSize()),
+        output_buffer(max_putback + ZSTD_DStreamOutSize())
+    {
+        if (!context)
+            throw io_error{"Calling ZSTD_createDCtx() failed."};
+
+        char_t * const begin = output_buffer.data() + max_putback;
+        this->setg(begin, begin, begin);
+    }
+    //!\}
+
+protected:
+    //!\brief Decompresses the next characters into the get area.
+    int_type underflow() override
+    {
+        if (this->gptr() < this->egptr())
+            return traits_t::to_int_type(*this->gptr());
+
+        // keep the last characters for putting back
+        size_t const putback = std::min<size_t>(this->gptr() - this->eback(), max_putback);
+        std::memmove(output_buffer.data() + max_putback - putback, this->gptr() - putback, putback);
+
+        char_t * const begin = output_buffer.data() + max_putback;
+        size_t const size = decompress(begin, output_buffer.size() - max_putback);
+        this->setg(begin - putback, begin, begin + size);
+
+        return (size == 0u) ? traits_t::eof() : traits_t::to_int_type(*this->gptr());
+    }
+
+private:
+    //!\brief The stream the compressed data is read from.
+    std::basic_istream<char_t, traits_t> & primary_stream;
+    //!\brief The decompression context.
+    std::unique_ptr<ZSTD_DCtx, context_deleter> context;
+    //!\brief The compressed data read from the primary stream.
+    std::vector<char_t> input_buffer;
+    //!\brief The get area preceded by the put back area.
+    std::vector<char_t> output_buffer;
+    //!\brief The part of the input buffer that was not yet decompressed.
+    ZSTD_inBuffer input{nullptr, 0u, 0u};
+    //!\brief Whether the data read so far ends with a complete frame.
+    bool frame_complete{true};
+
+    //!\brief Reads the next compressed data; returns `false` at the end of the primary stream.
+    bool refill()
+    {
+        primary_stream.read(input_buffer.data(), input_buffer.size());
+        input = ZSTD_inBuffer{input_buffer.data(), static_cast<size_t>(primary_stream.gcount()), 0u};
+        return input.size > 0u;
+    }
+
+    //!\brief Decompresses at most `capacity` characters; returns 0 only at the end of the compressed data.
+    size_t decompress(char_t * const data, size_t const capacity)
+    {
+        ZSTD_outBuffer output{data, capacity, 0u};
+
+        while (output.pos == 0u)
+        {
+            bool const has_input = (input.pos < input.size) || refill();
+            size_t const input_pos = input.pos;
+
+            // even without input, there may be buffered output if the output buffer was full in the last call
+            size_t const result = ZSTD_decompressStream(context.get(), &output, &input);
+
+            if (ZSTD_isError(result))
+                throw io_error{std::string{"zstd decompression failed: "} + ZSTD_getErrorName(result)};
+
+            if (input.pos != input_pos || output.pos != 0u)
+                frame_complete = (result == 0u);
+            else if (!has_input)
+                break;
+        }
+
+        if (output.pos == 0u && !frame_complete)
+            throw io_error{"Unexpected end of zstd compressed data."};
+
+        return output.pos;
+    }
+};
+
+/*!\brief An input stream that decompresses zstd compressed input.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The character traits type.
+ * \sa seqan3::contrib::basic_zstd_istreambuf
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_istream : public std::basic_istream<char_t, traits_t>
+{
+public:
+    /*!\brief Constructs the stream reading from the given stream.
+     * \param[in] primary_stream The stream the compressed data is read from.
+     */
+    explicit basic_zstd_istream(std::basic_istream<char_t, traits_t> & primary_stream) :
+        std::basic_istream<char_t, traits_t>{nullptr},
+        buffer{primary_stream}
+    {
+        this->init(&buffer);
+    }
+
+    //!\brief Returns the stream buffer.
+    basic_zstd_istreambuf<char_t, traits_t> * rdbuf()
+    {
+        return &buffer;
+    }
+
+private:
+    //!\brief The stream buffer.
+    basic_zstd_istreambuf<char_t, traits_t> buffer;
+};
+
+//!\brief A zstd input stream over `char`.
+using zstd_istream = basic_zstd_istream<char>;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,345 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_ostream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if SEQAN3_HAS_ZSTD
+#include <zstd.h>
+#else
+#error "This file cannot be used when building without ZSTD-support."
+#endif  // SEQAN3_HAS_ZSTD
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/utility/detail/to_little_endian.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief The maximal number of uncompressed bytes per zstd frame written via seqan3::detail::make_secondary_ostream.
+ *
+ * \details
+ *
+ * The default of 0 writes a single frame. Any other value writes independent frames of at most this size, followed
+ * by a seek table (the zstd "seekable format"), such that a reader can decompress parts of the file. The result is
+ * a regular zstd file, i.e. readers that do not support the seek table ignore it.
+ */
+inline static size_t zstd_seekable_frame_size = 0;
+
+/*!\brief A stream buffer that compresses its output with zstd.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The character traits type.
+ *
+ * \details
+ *
+ * If a frame size is given, the input is split into independent frames of at most that many bytes and a seek table
+ * in the zstd seekable format is written at the end. Otherwise, all input is compressed into a single frame.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1u, "The zstd streams only support character types with a size of one byte.");
+
+private:
+    //!\brief The base type.
+    using base_t = std::basic_streambuf<char_t, traits_t>;
+
+    //!\brief Frees the compression context.
+    struct context_deleter
+    {
+        //!\brief Frees the compression context.
+        void operator()(ZSTD_CCtx * context) const noexcept
+        {
+            ZSTD_freeCCtx(context);
+        }
+    };
+
+    //!\brief The magic number of the skippable frame holding the seek table.
+    static constexpr uint32_t skippable_magic_number = 0x184D2A5Eu;
+    //!\brief The magic number at the very end of a seekable file.
+    static constexpr uint32_t seekable_magic_number = 0x8F92EAB1u;
+
+public:
+    //!\brief The integer type of the stream buffer.
+    using int_type = typename base_t::int_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_zstd_ostreambuf() = delete; //!< Deleted.
+    basic_zstd_ostreambuf(basic_zstd_ostreambuf const &) = delete; //!< Deleted.
+    basic_zstd_ostreambuf(basic_zstd_ostreambuf &&) = delete; //!< Deleted.
+    basic_zstd_ostreambuf & operator=(basic_zstd_ostreambuf const &) = delete; //!< Deleted.
+    basic_zstd_ostreambuf & operator=(basic_zstd_ostreambuf &&) = delete; //!< Deleted.
+
+    /*!\brief Constructs the stream buffer writing to the given stream.
+     * \param[in] primary_stream The stream the compressed data is written to.
+     * \param[in] level          The zstd compression level.
+     * \param[in] thread_count   The number of compression threads; 0 uses std::thread::hardware_concurrency.
+     * \param[in] frame_size     The maximal number of uncompressed bytes per frame; 0 writes a single frame.
+     * \throws seqan3::io_error If the compression context cannot be created.
+     *
+     * \details
+     *
+     * The thread count is ignored if the zstd library was built without multithreading support.
+     */
+    basic_zstd_ostreambuf(std::basic_ostream<char_t, traits_t> & primary_stream,
+                          int const level,
+                          size_t const thread_count,
+                          size_t const frame_size) :
+        primary_stream{primary_stream},
+        context{ZSTD_createCCtx()},
+        frame_size{frame_size},
+        input_buffer(ZSTD_CStreamInSize()),
+        output_buffer(ZSTD_CStreamOutSize())
+    {
+        if (!context)
+            throw io_error{"Calling ZSTD_createCCtx() failed."};
+
+        check(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, level));
+
+        size_t const threads = (thread_count == 0u) ? std::thread::hardware_concurrency() : thread_count;
+        if (threads > 1u) // fails if zstd was built without multithreading support, which is fine
+            ZSTD_CCtx_setParameter(context.get(), ZSTD_c_nbWorkers, static_cast<int>(threads));
+
+        this->setp(input_buffer.data(), input_buffer.data() + input_buffer.size());
+    }
+
+    //!\brief Writes the end of the compressed data; errors are ignored.
+    ~basic_zstd_ostreambuf()
+    {
+        try
+        {
+            finish();
+        }
+        catch (...)
+        {}
+    }
+    //!\}
+
+    //!\brief Compresses the buffered data and writes the end of the frame and the seek table, if any.
+    void finish()
+    {
+        if (finished)
+            return;
+
+        finished = true;
+        compress(this->pbase(), this->pptr() - this->pbase(), ZSTD_e_continue);
+        this->setp(input_buffer.data(), input_buffer.data() + input_buffer.size());
+
+        if (frame_input_size > 0u || frames.empty())
+            end_frame();
+
+        if (frame_size > 0u)
+            write_seek_table();
+
+        primary_stream.flush();
+    }
+
+protected:
+    //!\brief Compresses the buffered data and writes `c` unless it is EOF.
+    int_type overflow(int_type c = traits_t::eof()) override
+    {
+        try
+        {
+            compress(this->pbase(), this->pptr() - this->pbase(), ZSTD_e_continue);
+        }
+        catch (io_error const &)
+        {
+            return traits_t::eof();
+        }
+
+        this->setp(input_buffer.data(), input_buffer.data() + input_buffer.size());
+
+        if (!traits_t::eq_int_type(c, traits_t::eof()))
+        {
+            *this->pptr() = traits_t::to_char_type(c);
+            this->pbump(1);
+        }
+
+        return traits_t::not_eof(c);
+    }
+
+    //!\brief Compresses the buffered data and flushes it to the primary stream.
+    int sync() override
+    {
+        try
+        {
+            compress(this->pbase(), this->pptr() - this->pbase(), ZSTD_e_flush);
+        }
+        catch (io_error const &)
+        {
+            return -1;
+        }
+
+        this->setp(input_buffer.data(), input_buffer.data() + input_buffer.size());
+        primary_stream.flush();
+        return primary_stream ? 0 : -1;
+    }
+
+private:
+    //!\brief The stream the compressed data is written to.
+    std::basic_ostream<char_t, traits_t> & primary_stream;
+    //!\brief The compression context.
+    std::unique_ptr<ZSTD_CCtx, context_deleter> context;
+    //!\brief The maximal number of uncompressed bytes per frame; 0 for a single frame.
+    size_t frame_size;
+    //!\brief The put area.
+    std::vector<char_t> input_buffer;
+    //!\brief The compressed data before it is written to the primary stream.
+    std::vector<char_t> output_buffer;
+    //!\brief The number of uncompressed bytes in the current frame.
+    size_t frame_input_size{};
+    //!\brief The number of compressed bytes of the current frame.
+    size_t frame_output_size{};
+    //!\brief The compressed and uncompressed size of each finished frame.
+    std::vector<std::pair<uint32_t, uint32_t>> frames{};
+    //!\brief Whether finish() was called.
+    bool finished{false};
+
+    //!\brief Throws seqan3::io_error if `code` is a zstd error code.
+    static size_t check(size_t const code)
+    {
+        if (ZSTD_isError(code))
+            throw io_error{std::string{"zstd compression failed: "} + ZSTD_getErrorName(code)};
+
+        return code;
+    }
+
+    //!\brief Compresses the given data until zstd has consumed all input and, if requested, flushed all output.
+    void run(ZSTD_inBuffer & input, ZSTD_EndDirective const mode)
+    {
+        size_t remaining{};
+
+        do
+        {
+            ZSTD_outBuffer output{output_buffer.data(), output_buffer.size(), 0u};
+            remaining = check(ZSTD_compressStream2(context.get(), &output, &input, mode));
+
+            primary_stream.write(output_buffer.data(), output.pos);
+            frame_output_size += output.pos;
+
+            if (!primary_stream)
+                throw io_error{"Writing zstd compressed data failed."};
+        }
+        while ((mode == ZSTD_e_continue) ? (input.pos < input.size) : (remaining != 0u));
+    }
+
+    //!\brief Compresses `size` bytes, ending a frame whenever it reaches the frame size.
+    void compress(char_t const * data, size_t size, ZSTD_EndDirective const mode)
+    {
+        do
+        {
+            size_t chunk_size = size;
+            ZSTD_EndDirective chunk_mode = mode;
+
+            if (frame_size > 0u && frame_input_size + size >= frame_size)
+            {
+                chunk_size = frame_size - frame_input_size;
+                chunk_mode = ZSTD_e_continue;
+            }
+
+            ZSTD_inBuffer input{data, chunk_size, 0u};
+            run(input, chunk_mode);
+            frame_input_size += chunk_size;
+            data += chunk_size;
+            size -= chunk_size;
+
+            if (frame_size > 0u && frame_input_size == frame_size)
+                end_frame();
+        }
+        while (size > 0u);
+    }
+
+    //!\brief Ends the current frame and records its size.
+    void end_frame()
+    {
+        ZSTD_inBuffer input{nullptr, 0u, 0u};
+        run(input, ZSTD_e_end);
+        frames.emplace_back(static_cast<uint32_t>(frame_output_size), static_cast<uint32_t>(frame_input_size));
+        frame_input_size = 0u;
+        frame_output_size = 0u;
+    }
+
+    //!\brief Writes the seek table as skippable frame (without checksums).
+    void write_seek_table()
+    {
+        auto put32 = [this] (uint32_t value)
+        {
+            value = detail::to_little_endian(value);
+            primary_stream.write(reinterpret_cast<char_t const *>(&value), sizeof(value));
+        };
+
+        put32(skippable_magic_number);
+        put32(static_cast<uint32_t>(frames.size() * 8u + 9u)); // entries + footer
+
+        for (auto [compressed_size, decompressed_size] : frames)
+        {
+            put32(compressed_size);
+            put32(decompressed_size);
+        }
+
+        put32(static_cast<uint32_t>(frames.size()));
+        primary_stream.put(char_t{}); // descriptor: no checksums
+        put32(seekable_magic_number);
+
+        if (!primary_stream)
+            throw io_error{"Writing the zstd seek table failed."};
+    }
+};
+
+/*!\brief An output stream that compresses its output with zstd.
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The character traits type.
+ * \sa seqan3::contrib::basic_zstd_ostreambuf
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class basic_zstd_ostream : public std::basic_ostream<char_t, traits_t>
+{
+public:
+    /*!\brief Constructs the stream writing to the given stream.
+     * \param[in] primary_stream The stream the compressed data is written to.
+     * \param[in] level          The zstd compression level.
+     * \param[in] thread_count   The number of compression threads; 0 uses std::thread::hardware_concurrency.
+     * \param[in] frame_size     The maximal number of uncompressed bytes per frame; 0 writes a single frame.
+     */
+    basic_zstd_ostream(std::basic_ostream<char_t, traits_t> & primary_stream,
+                       int const level = ZSTD_CLEVEL_DEFAULT,
+                       size_t const thread_count = 1u,
+                       size_t const frame_size = 0u) :
+        std::basic_ostream<char_t, traits_t>{nullptr},
+        buffer{primary_stream, level, thread_count, frame_size}
+    {
+        this->init(&buffer);
+    }
+
+    //!\brief Returns the stream buffer.
+    basic_zstd_ostreambuf<char_t, traits_t> * rdbuf()
+    {
+        return &buffer;
+    }
+
+private:
+    //!\brief The stream buffer.
+    basic_zstd_ostreambuf<char_t, traits_t> buffer;
+};
+
+//!\brief A zstd output stream over `char`.
+using zstd_ostream = basic_zstd_ostream<char>;
+
+} // namespace seqan3::contrib
@@ -25,7 +25,8 @@ namespace seqan3
  * \implements std::ranges::input_range
  *
  * \tparam algorithm_executor_type The type of the underlying algorithm executor; must be of type
- *                                 seqan3::detail::algorithm_executor_blocking.
+ *                                 seqan3::detail::algorithm_executor_blocking or
+ *                                 seqan3::detail::algorithm_executor_async.
  *
  * \details
  *
@@ -0,0 +1,481 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::algorithm_executor_async.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <seqan3/std/ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Specifies the order in which seqan3::detail::algorithm_executor_async delivers the algorithm results.
+ * \ingroup algorithm
+ */
+enum struct result_order : uint8_t
+{
+    input,     //!< The results are delivered in the order of the elements of the input resource.
+    completion //!< The results are delivered as soon as they have been computed.
+};
+
+/*!\brief An asynchronous algorithm executor that pipelines reading the input, computing the algorithm and consuming
+ *        the results.
+ * \ingroup algorithm
+ * \tparam resource_t The underlying range of elements to be computed; must model std::ranges::viewable_range and
+ *                    std::ranges::input_range.
+ * \tparam algorithm_t The algorithm to be invoked on the elements of the given resource; must model std::semiregular.
+ * \tparam algorithm_result_t The result type generated by the algorithm; must model std::semiregular.
+ *
+ * \details
+ *
+ * In contrast to the seqan3::detail::algorithm_executor_blocking, this executor does not wait until a complete bucket
+ * of invocations has been computed before the results can be accessed. Instead, reading the input, computing the
+ * algorithm and consuming the results happen concurrently:
+ *
+ *  1. A reader thread iterates over the input resource and pushes one task per element into a bounded queue.
+ *  2. The worker threads pop the tasks from the queue and invoke their own copy of the algorithm on them. The results
+ *     of a single invocation are collected in a bucket.
+ *  3. The consumer fetches the buckets via seqan3::detail::algorithm_executor_async::next_result() either in the order
+ *     of the input or in the order of completion (see seqan3::detail::result_order).
+ *
+ * The number of tasks that have been read but whose results have not yet been fetched by the consumer is bounded by
+ * the given capacity. Hence, the reader pauses if the consumer or the workers are behind and the memory stays bounded
+ * even for very large or streamed inputs.
+ *
+ * If the resource models std::ranges::forward_range, a task stores the iterator to its element and the element is
+ * accessed by the worker. Otherwise, for single-pass input ranges like a file, the element is moved into the task by
+ * the reader thread and the algorithm is invoked with an lvalue to it.
+ *
+ * ### Exceptions
+ *
+ * If reading the resource or invoking the algorithm throws, the execution is cancelled and the exception is rethrown
+ * on the next call to seqan3::detail::algorithm_executor_async::next_result().
+ *
+ * ### Thread safety
+ *
+ * Only one thread may consume the results. Destroying the executor cancels the remaining tasks and waits until all
+ * threads have finished.
+ */
+template <std::ranges::viewable_range resource_t,
+          std::semiregular algorithm_t,
+          std::semiregular algorithm_result_t>
+//!\cond
+    requires std::ranges::input_range<resource_t> &&
+             std::invocable<algorithm_t &,
+                            std::conditional_t<std::ranges::forward_range<resource_t>,
+                                               std::ranges::range_reference_t<resource_t>,
+                                               std::ranges::range_value_t<resource_t> &>,
+                            std::function<void(algorithm_result_t)>>
+//!\endcond
+class algorithm_executor_async
+{
+private:
+    //!\brief The underlying resource type.
+    using resource_type = std::views::all_t<resource_t>;
+    //!\brief The iterator over the underlying resource.
+    using resource_iterator_type = std::ranges::iterator_t<resource_type>;
+    //!\brief Whether the elements are accessed via the resource iterator or moved into the task.
+    static constexpr bool stores_iterator = std::ranges::forward_range<resource_type>;
+    //!\brief The input of a single task.
+    using task_input_type = std::conditional_t<stores_iterator,
+                                               resource_iterator_type,
+                                               std::ranges::range_value_t<resource_type>>;
+
+    //!\brief A single algorithm invocation together with the position of its input within the resource.
+    struct task_type
+    {
+        //!\brief The position of the input within the resource.
+        size_t index{};
+        //!\brief The input of the algorithm.
+        task_input_type input{};
+    };
+
+    //!\brief The type of a bucket storing the results produced by a single algorithm invocation.
+    using bucket_type = std::vector<algorithm_result_t>;
+
+    class shared_state;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only, i.e. it is not copy-constructible or copy-assignable.
+     * \{
+     */
+    //!\brief Deleted default constructor because this class manages an external resource.
+    algorithm_executor_async() = delete;
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_async(algorithm_executor_async const &) = delete;
+    algorithm_executor_async(algorithm_executor_async &&) = default; //!< Defaulted.
+    //!\brief This class provides unique ownership over the managed resource and is therefor not copyable.
+    algorithm_executor_async & operator=(algorithm_executor_async const &) = delete;
+    algorithm_executor_async & operator=(algorithm_executor_async &&) = default; //!< Defaulted.
+    ~algorithm_executor_async() = default; //!< Defaulted.
+
+    /*!\brief Constructs this executor with the given resource range and starts the execution.
+     *
+     * \param[in] resource The underlying resource.
+     * \param[in] algorithm The algorithm to invoke on the elements of the underlying resource.
+     * \param[in] result A dummy result object to deduce the type of the result buckets.
+     * \param[in] thread_count The number of worker threads; at least one worker thread is spawned.
+     * \param[in] capacity The maximal number of tasks that are read but not yet fetched by the consumer
+     *                     [default: four times the number of worker threads].
+     * \param[in] order The order in which the results are delivered [default: seqan3::detail::result_order::input].
+     *
+     * \details
+     *
+     * Spawns one reader thread and `thread_count` many worker threads that immediately start processing the resource.
+     * Also note that the third argument is used for deducing the algorithm result type and is otherwise
+     * not used in the context of the class' construction.
+     */
+    algorithm_executor_async(resource_t resource,
+                             algorithm_t algorithm,
+                             algorithm_result_t const SEQAN3_DOXYGEN_ONLY(result),
+                             size_t const thread_count,
+                             size_t const capacity = 0u,
+                             result_order const order = result_order::input) :
+        state{std::make_unique<shared_state>(std::views::all(std::forward<resource_t>(resource)),
+                                             std::move(algorithm),
+                                             std::max<size_t>(thread_count, 1u),
+                                             (capacity == 0u) ? 4u * std::max<size_t>(thread_count, 1u) : capacity,
+                                             order)}
+    {
+        state->start();
+    }
+    //!\}
+
+    /*!\brief Returns the next available algorithm result.
+     * \returns A std::optional that either contains the next algorithm result or is empty, i.e. the
+     *          underlying resource has been completely consumed.
+     *
+     * \details
+     *
+     * Blocks until the next bucket of results is available. Depending on the configured seqan3::detail::result_order,
+     * this is the bucket of the next element of the resource or any completed bucket.
+     *
+     * ### Exception
+     *
+     * Rethrows the first exception that occurred while reading the resource or invoking the algorithm.
+     */
+    std::optional<algorithm_result_t> next_result()
+    {
+        assert(state != nullptr);
+
+        // Each invocation of the algorithm might produce zero results, so fetch buckets until one is not empty.
+        while (bucket_position == current_bucket.size())
+        {
+            if (!state->fetch_bucket(current_bucket))
+                return {std::nullopt};
+
+            bucket_position = 0;
+        }
+
+        return {std::move(current_bucket[bucket_position++])};
+    }
+
+private:
+    //!\brief The bucket that is currently consumed.
+    bucket_type current_bucket{};
+    //!\brief The position of the next result in the current bucket.
+    size_t bucket_position{};
+    //!\brief The state shared with the reader and worker threads, stored on the heap to allow safe moves.
+    std::unique_ptr<shared_state> state{nullptr};
+};
+
+/*!\brief The state shared between the consumer and the reader and worker threads.
+ *
+ * \details
+ *
+ * All members except the task queue are protected by the mutex.
+ */
+template <std::ranges::viewable_range resource_t,
+          std::semiregular algorithm_t,
+          std::semiregular algorithm_result_t>
+//!\cond
+    requires std::ranges::input_range<resource_t> &&
+             std::invocable<algorithm_t &,
+                            std::conditional_t<std::ranges::forward_range<resource_t>,
+                                               std::ranges::range_reference_t<resource_t>,
+                                               std::ranges::range_value_t<resource_t> &>,
+                            std::function<void(algorithm_result_t)>>
+//!\endcond
+class algorithm_executor_async<resource_t, algorithm_t, algorithm_result_t>::shared_state
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Instances of this class are neither copyable nor movable.
+     * \{
+     */
+    shared_state(shared_state const &) = delete; //!< Deleted.
+    shared_state(shared_state &&) = delete; //!< Deleted.
+    shared_state & operator=(shared_state const &) = delete; //!< Deleted.
+    shared_state & operator=(shared_state &&) = delete; //!< Deleted.
+
+    //!\brief Cancels the execution and waits until all threads have finished.
+    ~shared_state()
+    {
+        cancel();
+
+        for (auto & thread : threads)
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    /*!\brief Constructs the state.
+     * \param[in] resource The underlying resource.
+     * \param[in] algorithm The algorithm that is copied by every worker thread.
+     * \param[in] thread_count The number of worker threads.
+     * \param[in] capacity The maximal number of tasks that are read but not yet fetched.
+     * \param[in] order The order in which the results are delivered.
+     */
+    shared_state(resource_type resource,
+                 algorithm_t algorithm,
+                 size_t const thread_count,
+                 size_t const capacity,
+                 result_order const order) :
+        resource{std::move(resource)},
+        algorithm{std::move(algorithm)},
+        task_queue{capacity},
+        thread_count{thread_count},
+        capacity{capacity},
+        order{order}
+    {}
+    //!\}
+
+    //!\brief Spawns the reader and the worker threads.
+    void start()
+    {
+        running_workers = thread_count;
+        threads.reserve(thread_count + 1);
+        threads.emplace_back([this] () { read_resource(); });
+
+        for (size_t i = 0; i < thread_count; ++i)
+            threads.emplace_back([this] () { compute_tasks(); });
+    }
+
+    /*!\brief Moves the next bucket into the given bucket.
+     * \param[out] bucket The bucket to move the results into.
+     * \returns `false` if all buckets have been fetched, `true` otherwise.
+     * \throws The first exception that occurred in the reader or a worker thread.
+     */
+    bool fetch_bucket(bucket_type & bucket)
+    {
+        std::unique_lock lock{mutex};
+        bucket_ready.wait(lock, [this] ()
+        {
+            return exception != nullptr || has_next_bucket() || running_workers == 0;
+        });
+
+        if (exception != nullptr)
+            std::rethrow_exception(exception);
+
+        if (!has_next_bucket())
+            return false;
+
+        auto next_bucket_it = finished_buckets.begin(); // In input order this is the bucket of the next task.
+        bucket = std::move(next_bucket_it->second);
+        finished_buckets.erase(next_bucket_it);
+        ++fetched_tasks;
+        lock.unlock();
+
+        capacity_available.notify_one();
+        return true;
+    }
+
+private:
+    //!\brief Checks whether the next bucket can be fetched by the consumer.
+    bool has_next_bucket() const
+    {
+        if (finished_buckets.empty())
+            return false;
+
+        return order == result_order::completion || finished_buckets.begin()->first == fetched_tasks;
+    }
+
+    //!\brief Stops the reader and the workers and closes the task queue.
+    void cancel()
+    {
+        {
+            std::lock_guard lock{mutex};
+            cancelled = true;
+        }
+
+        capacity_available.notify_all();
+        task_queue.close();
+    }
+
+    //!\brief Stores the first exception and cancels the execution.
+    void store_exception(std::exception_ptr current_exception)
+    {
+        {
+            std::lock_guard lock{mutex};
+            if (exception == nullptr)
+                exception = std::move(current_exception);
+        }
+
+        cancel();
+        bucket_ready.notify_all();
+    }
+
+    //!\brief Reads the resource and pushes a task for every element as long as the capacity is not exhausted.
+    void read_resource()
+    {
+        try
+        {
+            size_t index = 0;
+            for (auto it = std::ranges::begin(resource); it != std::ranges::end(resource); ++it, ++index)
+            {
+                {
+                    std::unique_lock lock{mutex};
+                    capacity_available.wait(lock, [&] () { return cancelled || index - fetched_tasks < capacity; });
+
+                    if (cancelled)
+                        break;
+                }
+
+                contrib::queue_op_status status{};
+                if constexpr (stores_iterator)
+                    status = task_queue.wait_push(task_type{index, it});
+                else
+                    status = task_queue.wait_push(task_type{index, std::ranges::iter_move(it)});
+
+                if (status == contrib::queue_op_status::closed)
+                    break;
+            }
+        }
+        catch (...)
+        {
+            store_exception(std::current_exception());
+        }
+
+        task_queue.close();
+    }
+
+    //!\brief Computes the tasks from the queue until it is closed and empty.
+    void compute_tasks()
+    {
+        algorithm_t worker_algorithm{algorithm};
+        task_type task{};
+
+        while (task_queue.wait_pop(task) != contrib::queue_op_status::closed)
+        {
+            bucket_type bucket{};
+
+            if (!is_cancelled())
+            {
+                try
+                {
+                    auto store_result = [&bucket] (auto && algorithm_result)
+                    {
+                        bucket.push_back(std::forward<decltype(algorithm_result)>(algorithm_result));
+                    };
+
+                    if constexpr (stores_iterator)
+                        worker_algorithm(*task.input, store_result);
+                    else
+                        worker_algorithm(task.input, store_result);
+                }
+                catch (...)
+                {
+                    store_exception(std::current_exception());
+                }
+            }
+
+            {
+                std::lock_guard lock{mutex};
+                finished_buckets.emplace(task.index, std::move(bucket));
+            }
+            bucket_ready.notify_one();
+        }
+
+        {
+            std::lock_guard lock{mutex};
+            --running_workers;
+        }
+        bucket_ready.notify_all();
+    }
+
+    //!\brief Whether the execution was cancelled.
+    bool is_cancelled()
+    {
+        std::lock_guard lock{mutex};
+        return cancelled;
+    }
+
+    //!\brief The underlying resource; only accessed by the reader thread and via the iterators of the tasks.
+    resource_type resource;
+    //!\brief The algorithm that is copied by every worker thread.
+    algorithm_t algorithm;
+    //!\brief The bounded queue transferring the tasks from the reader to the workers.
+    contrib::fixed_buffer_queue<task_type> task_queue;
+    //!\brief The number of worker threads.
+    size_t thread_count{};
+    //!\brief The maximal number of tasks that are read but not yet fetched.
+    size_t capacity{};
+    //!\brief The order in which the buckets are delivered.
+    result_order order{};
+
+    //!\brief The mutex protecting the following members.
+    std::mutex mutex{};
+    //!\brief Signals the reader that a bucket has been fetched or the execution was cancelled.
+    std::condition_variable capacity_available{};
+    //!\brief Signals the consumer that a bucket has been finished or the workers are done.
+    std::condition_variable bucket_ready{};
+    //!\brief The computed buckets that have not yet been fetched, sorted by the position of their input.
+    std::map<size_t, bucket_type> finished_buckets{};
+    //!\brief The number of buckets fetched by the consumer.
+    size_t fetched_tasks{};
+    //!\brief The number of worker threads that are still running.
+    size_t running_workers{};
+    //!\brief Whether the execution was cancelled.
+    bool cancelled{false};
+    //!\brief The first exception that occurred in the reader or a worker thread.
+    std::exception_ptr exception{};
+
+    //!\brief The reader and the worker threads.
+    std::vector<std::thread> threads{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::algorithm_executor_async
+ * \{
+ */
+
+//!\brief Deduces the resource type from the provided arguments.
+template <typename resource_rng_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+algorithm_executor_async(resource_rng_t &&, algorithm_t, algorithm_result_t const &, size_t) ->
+    algorithm_executor_async<resource_rng_t, algorithm_t, algorithm_result_t>;
+
+//!\brief Deduces the resource type from the provided arguments and the capacity.
+template <typename resource_rng_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+algorithm_executor_async(resource_rng_t &&, algorithm_t, algorithm_result_t const &, size_t, size_t) ->
+    algorithm_executor_async<resource_rng_t, algorithm_t, algorithm_result_t>;
+
+//!\brief Deduces the resource type from the provided arguments, the capacity and the result order.
+template <typename resource_rng_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+algorithm_executor_async(resource_rng_t &&, algorithm_t, algorithm_result_t const &, size_t, size_t, result_order) ->
+    algorithm_executor_async<resource_rng_t, algorithm_t, algorithm_result_t>;
+//!\}
+} // namespace seqan3::detail
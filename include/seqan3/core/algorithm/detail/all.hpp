@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <seqan3/core/algorithm/detail/algorithm_executor_async.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
 #include <seqan3/core/algorithm/detail/execution_handler_sequential.hpp>
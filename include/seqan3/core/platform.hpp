@@ -323,6 +323,16 @@
 #   endif
 #endif
 
+//!\brief See https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105593
+//!       The AVX512 intrinsics trigger -Wuninitialized within the headers of gcc.
+#ifndef SEQAN3_WORKAROUND_GCC_105593 // regressed in gcc12, fixed for gcc12.3
+#   if defined(__GNUC__) && (__GNUC__ == 12 && __GNUC_MINOR__ < 3)
+#       define SEQAN3_WORKAROUND_GCC_105593 1
+#   else
+#       define SEQAN3_WORKAROUND_GCC_105593 0
+#   endif
+#endif
+
 /*!\brief This is needed to support CentOS 7 or RHEL 7; Newer CentOS's include a more modern default-gcc version making
  *        this macro obsolete.
  *
@@ -23,10 +23,15 @@
  * | GZip       | `.gz`¹          | [zlib](https://zlib.net/)                  | GNU-Zip, most common format on UNIX                                                                                   |
  * | BGZF       | `.gz`, `.bgzf`² | [zlib](https://zlib.net/)                  | [Blocked GZip](https://samtools.github.io/hts-specs/SAMv1.pdf), compatible extension to GZip, features parallelisation|
  * | BZip2      | `.bz2`          | [libbz2](https://www.sourceware.org/bzip2) | Stronger compression than GZip, slower to compress                                                                    |
+ * | Zstandard  | `.zst`³         | [libzstd](https://facebook.github.io/zstd) | Better compression than GZip and much faster decompression                                                            |
  *
  * <small>¹ SeqAn always assumes GZip and does not handle pure `.Z`.<br>
  * ² Some file formats like `.bam` or `.bcf` are implicitly BGZF-compressed without showing this in the
- * extension.</small>
+ * extension.<br>
+ * ³ Files in the zstd seekable format are read like any other zstd file.</small>
+ *
+ * If [libdeflate](https://github.com/ebiggers/libdeflate) is available in addition to zlib, it is used to
+ * compress and decompress the blocks of BGZF files, which is considerably faster than zlib.
  *
  * Support for these compression formats is **optional** and depends on whether the respective dependency is available
  * when you build your program (if you use CMake, this should happen automatically).
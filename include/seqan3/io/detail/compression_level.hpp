@@ -0,0 +1,30 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::default_compression_level.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The compression level of compressed file output if none is configured.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Level 1 is the fastest level that actually compresses; for BGZF it is about twice as fast as the zlib default
+ * and produces only slightly larger files.
+ */
+inline constexpr int default_compression_level = 1;
+
+} // namespace seqan3::detail
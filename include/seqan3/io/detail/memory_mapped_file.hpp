@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_file.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <memory>
+#include <seqan3/std/span>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SEQAN3_HAS_MMAP 1
+#else
+#define SEQAN3_HAS_MMAP 0
+#endif
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A file that is mapped read-only into memory.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The file is mapped with `mmap`, i.e. the pages are only loaded by the operating system when they are accessed.
+ * On platforms without `mmap` the file is read into memory instead. In both cases the data is aligned to at least
+ * 8 bytes. Copies share the mapping, which is released when the last copy is destroyed.
+ * The file must not be modified while it is mapped.
+ */
+class memory_mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = default; //!< Defaulted.
+    memory_mapped_file(memory_mapped_file const &) = default; //!< Defaulted.
+    memory_mapped_file(memory_mapped_file &&) = default; //!< Defaulted.
+    memory_mapped_file & operator=(memory_mapped_file const &) = default; //!< Defaulted.
+    memory_mapped_file & operator=(memory_mapped_file &&) = default; //!< Defaulted.
+    ~memory_mapped_file() = default; //!< Defaulted.
+
+    /*!\brief Maps the given file.
+     * \param[in] file_path The path of the file.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     * \throws seqan3::io_error if the file cannot be read on platforms without `mmap`.
+     */
+    explicit memory_mapped_file(std::filesystem::path const & file_path)
+    {
+#if SEQAN3_HAS_MMAP
+        int const file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+            throw file_open_error{"Could not open file " + file_path.string() + " for reading."};
+
+        struct stat file_status{};
+        if (::fstat(file_descriptor, &file_status) == -1)
+        {
+            ::close(file_descriptor);
+            throw file_open_error{"Could not determine the size of file " + file_path.string() + "."};
+        }
+        size_in_bytes = static_cast<size_t>(file_status.st_size);
+
+        if (size_in_bytes == 0) // An empty file cannot be mapped.
+        {
+            ::close(file_descriptor);
+            return;
+        }
+
+        void * mapped = ::mmap(nullptr, size_in_bytes, PROT_READ, MAP_SHARED, file_descriptor, 0);
+        ::close(file_descriptor); // The mapping stays valid after closing the file descriptor.
+
+        if (mapped == MAP_FAILED)
+            throw file_open_error{"Could not map file " + file_path.string() + " into memory."};
+
+        storage = std::shared_ptr<void const>{mapped, [size = size_in_bytes] (void const * pointer)
+        {
+            ::munmap(const_cast<void *>(pointer), size);
+        }};
+#else // Read the file into memory if it cannot be mapped.
+        std::ifstream file{file_path, std::ios::binary | std::ios::ate};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + file_path.string() + " for reading."};
+
+        size_in_bytes = static_cast<size_t>(file.tellg());
+        size_t const word_count = (size_in_bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        auto buffer = std::make_shared<std::vector<uint64_t>>(word_count);
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(buffer->data()), size_in_bytes);
+        if (file.fail())
+            throw io_error{"Could not read the file " + file_path.string() + "."};
+
+        void const * data = buffer->data();
+        storage = std::shared_ptr<void const>{std::move(buffer), data};
+#endif
+    }
+    //!\}
+
+    //!\brief Returns a pointer to the first byte of the file; `nullptr` for an empty file.
+    void const * data() const noexcept
+    {
+        return storage.get();
+    }
+
+    //!\brief Returns the size of the file in bytes.
+    size_t size() const noexcept
+    {
+        return size_in_bytes;
+    }
+
+    //!\brief Returns the content of the file as characters.
+    std::span<char const> chars() const noexcept
+    {
+        return {static_cast<char const *>(storage.get()), size_in_bytes};
+    }
+
+    //!\brief Returns the owner of the mapping, e.g. to construct an aliasing std::shared_ptr to the data.
+    std::shared_ptr<void const> const & owner() const noexcept
+    {
+        return storage;
+    }
+
+private:
+    //!\brief Owns the mapping or the buffer.
+    std::shared_ptr<void const> storage{};
+    //!\brief The size of the file in bytes.
+    size_t size_in_bytes{};
+};
+
+} // namespace seqan3::detail
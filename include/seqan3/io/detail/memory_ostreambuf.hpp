@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_ostreambuf.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <seqan3/std/span>
+#include <streambuf>
+#include <vector>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer that writes into a growing, reusable memory buffer.
+ * \ingroup io
+ * \tparam char_t The character type.
+ *
+ * \details
+ *
+ * The put area is the memory buffer itself, hence writing (e.g. via seqan3::detail::fast_ostreambuf_iterator) does
+ * not involve virtual calls until the buffer is full. Unlike std::basic_ostringstream, the buffer keeps its capacity
+ * when it is cleared, such that it can be reused for many rounds of output without reallocation.
+ */
+template <typename char_t>
+class memory_ostreambuf : public std::basic_streambuf<char_t>
+{
+private:
+    //!\brief The base type.
+    using base_t = std::basic_streambuf<char_t>;
+
+public:
+    //!\brief The integer type of the stream buffer.
+    using int_type = typename base_t::int_type;
+    //!\brief The traits type of the stream buffer.
+    using traits_type = typename base_t::traits_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_ostreambuf() = default; //!< Defaulted.
+    memory_ostreambuf(memory_ostreambuf const &) = delete; //!< Deleted.
+    memory_ostreambuf(memory_ostreambuf &&) = delete; //!< Deleted.
+    memory_ostreambuf & operator=(memory_ostreambuf const &) = delete; //!< Deleted.
+    memory_ostreambuf & operator=(memory_ostreambuf &&) = delete; //!< Deleted.
+    ~memory_ostreambuf() = default; //!< Defaulted.
+    //!\}
+
+    //!\brief The characters written since the last call to clear().
+    std::span<char_t const> written() const noexcept
+    {
+        return {this->pbase(), static_cast<size_t>(this->pptr() - this->pbase())};
+    }
+
+    //!\brief Discards the written characters but keeps the memory.
+    void clear() noexcept
+    {
+        this->setp(buffer.data(), buffer.data() + buffer.size());
+    }
+
+protected:
+    //!\brief Grows the buffer and writes `c` unless it is EOF.
+    int_type overflow(int_type c = traits_type::eof()) override
+    {
+        grow(1u);
+
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *this->pptr() = traits_type::to_char_type(c);
+            this->pbump(1);
+        }
+
+        return traits_type::not_eof(c);
+    }
+
+    //!\brief Copies `count` characters into the buffer.
+    std::streamsize xsputn(char_t const * data, std::streamsize count) override
+    {
+        if (this->epptr() - this->pptr() < count)
+            grow(count);
+
+        std::memcpy(this->pptr(), data, count * sizeof(char_t));
+        this->pbump(count);
+        return count;
+    }
+
+private:
+    //!\brief The memory buffer.
+    std::vector<char_t> buffer{};
+
+    //!\brief Makes room for at least `count` more characters while keeping the written ones.
+    void grow(size_t const count)
+    {
+        size_t const size = this->pptr() - this->pbase();
+        buffer.resize(std::max<size_t>({2u * buffer.size(), size + count, 4096u}));
+        this->setp(buffer.data(), buffer.data() + buffer.size());
+        this->pbump(size);
+    }
+};
+
+} // namespace seqan3::detail
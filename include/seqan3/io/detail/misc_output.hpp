@@ -12,10 +12,12 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
 #include <iostream>
 #include <string>
 #include <tuple>
 
+#include <seqan3/io/detail/compression_level.hpp>
 #include <seqan3/utility/detail/exposition_only_concept.hpp>
 #ifdef SEQAN3_HAS_BZIP2
     #include <seqan3/contrib/stream/bz2_ostream.hpp>
@@ -24,26 +26,21 @@
     #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
 #include <seqan3/std/filesystem>
 
 namespace seqan3::detail
 {
 
-/*!\brief Depending on the given filename/extension, create a compression stream or just forward the primary stream.
- * \param[in] primary_stream The primary (uncompressed) stream for writing.
- * \param[in,out] filename  The associated filename; compression extensions will be stripped.
- * \returns A pointer to the secondary stream with a default deleter or a nop-deleter.
+/*!\brief Removes the compression extension from the filename, except for ".bam" which denotes compressed output itself.
+ * \param[in,out] filename The associated filename; compression extensions will be stripped.
+ * \returns Whether the output needs to be compressed.
  * \throws seqan3::file_open_error If a compression-extension is used, but is not supported/available.
  */
-template <builtin_character char_t>
-inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream, std::filesystem::path & filename)
-    -> std::unique_ptr<std::basic_ostream<char_t>, std::function<void(std::basic_ostream<char_t>*)>>
+inline bool strip_compression_extension(std::filesystem::path & filename)
 {
-    // don't assume ownership
-    constexpr auto stream_deleter_noop     = [] (std::basic_ostream<char_t> *) {};
-    // assume ownership
-    [[maybe_unused]] constexpr auto stream_deleter_default  = [] (std::basic_ostream<char_t> * ptr) { delete ptr; };
-
     std::string extension = filename.extension().string();
 
     if ((extension == ".gz") || (extension == ".bgzf") || (extension == ".bam"))
@@ -52,8 +49,7 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
         if (extension != ".bam") // remove extension except for bam
             filename.replace_extension("");
 
-        return {new contrib::basic_bgzf_ostream<char_t>{primary_stream},
-                stream_deleter_default};
+        return true;
     #else
         throw file_open_error{"Trying to write a gzipped file, but no ZLIB available."};
     #endif
@@ -62,17 +58,82 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     {
     #ifdef SEQAN3_HAS_BZIP2
         filename.replace_extension("");
-        return {new contrib::basic_bz2_ostream<char_t>{primary_stream}, stream_deleter_default};
+        return true;
     #else
         throw file_open_error{"Trying to write a bzipped file, but no libbz2 available."};
     #endif
     }
     else if (extension == ".zst")
     {
-        throw file_open_error{"Trying to write a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        filename.replace_extension("");
+        return true;
+    #else
+        throw file_open_error{"Trying to write a zst'ed file, but no libzstd available."};
+    #endif
     }
 
+    return false;
+}
+
+/*!\brief Depending on the given filename/extension, create a compression stream or just forward the primary stream.
+ * \param[in] primary_stream The primary (uncompressed) stream for writing.
+ * \param[in,out] filename  The associated filename; compression extensions will be stripped.
+ * \param[in] compression_thread_count The number of threads used for BGZF and zstd compression; 0 uses
+ *                                     seqan3::contrib::bgzf_thread_count and std::thread::hardware_concurrency,
+ *                                     respectively.
+ * \param[in] compression_level The BGZF compression level in [0, 9]; values outside this range are clamped.
+ *                              For zstd, the level is clamped to [1, ZSTD_maxCLevel()].
+ * \returns A pointer to the secondary stream with a default deleter or a nop-deleter.
+ * \throws seqan3::file_open_error If a compression-extension is used, but is not supported/available.
+ *
+ * \details
+ *
+ * The thread count and the level only apply to BGZF compressed output (".gz", ".bgzf" and ".bam") and zstd
+ * compressed output (".zst"). zstd output is split into seekable frames if
+ * seqan3::contrib::zstd_seekable_frame_size is set.
+ */
+template <builtin_character char_t>
+inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
+                                   std::filesystem::path & filename,
+                                   [[maybe_unused]] size_t const compression_thread_count = 0u,
+                                   [[maybe_unused]] int const compression_level = default_compression_level)
+    -> std::unique_ptr<std::basic_ostream<char_t>, std::function<void(std::basic_ostream<char_t>*)>>
+{
+    // don't assume ownership
+    constexpr auto stream_deleter_noop     = [] (std::basic_ostream<char_t> *) {};
+    // assume ownership
+    [[maybe_unused]] constexpr auto stream_deleter_default  = [] (std::basic_ostream<char_t> * ptr) { delete ptr; };
+
+    std::string extension = filename.extension().string();
+
+    if (!strip_compression_extension(filename))
+        return {&primary_stream, stream_deleter_noop};
+
+    #ifdef SEQAN3_HAS_BZIP2
+    if (extension == ".bz2")
+        return {new contrib::basic_bz2_ostream<char_t>{primary_stream}, stream_deleter_default};
+    #endif
+
+    #ifdef SEQAN3_HAS_ZSTD
+    if (extension == ".zst")
+        return {new contrib::basic_zstd_ostream<char_t>{primary_stream,
+                                                        std::clamp(compression_level, 1, ZSTD_maxCLevel()),
+                                                        compression_thread_count,
+                                                        contrib::zstd_seekable_frame_size},
+                stream_deleter_default};
+    #endif
+
+    #ifdef SEQAN3_HAS_ZLIB
+    size_t const thread_count = (compression_thread_count == 0u) ? contrib::bgzf_thread_count
+                                                                  : compression_thread_count;
+    return {new contrib::basic_bgzf_ostream<char_t>{primary_stream,
+                                                    thread_count,
+                                                    std::clamp(compression_level, 0, 9)},
+            stream_deleter_default};
+    #else // unreachable, strip_compression_extension() throws if no compression library is available
     return {&primary_stream, stream_deleter_noop};
+    #endif
 }
 
 } // namespace seqan3::detail
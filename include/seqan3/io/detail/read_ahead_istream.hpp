@@ -0,0 +1,392 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::read_ahead_istreambuf and seqan3::detail::read_ahead_istream.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#define SEQAN3_HAS_PREAD 1
+#else
+#define SEQAN3_HAS_PREAD 0
+#endif
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer that reads ahead on a background thread.
+ * \ingroup io
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The character traits type.
+ *
+ * \details
+ *
+ * A background thread fills up to `buffer_count` buffers of `buffer_size` characters in file order, while the get
+ * area of this stream buffer is the oldest filled buffer. A consumed buffer is handed back to the thread once the
+ * next one is requested, hence at least two buffers are needed to overlap reading and parsing.
+ *
+ * The data is either read from another stream buffer, e.g. a decompression stream buffer, such that the
+ * decompression runs on the background thread, or directly from a file. Files are read with `pread` and the
+ * operating system is advised of the sequential access via `posix_fadvise`, if available.
+ *
+ * Errors on the background thread (e.g. seqan3::io_error on corrupt compressed data) are rethrown by `underflow()`
+ * after all data read before the error was consumed.
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class read_ahead_istreambuf : public std::basic_streambuf<char_t, traits_t>
+{
+    static_assert(sizeof(char_t) == 1u, "The read-ahead stream only supports character types with a size of one byte.");
+
+private:
+    //!\brief The base type.
+    using base_t = std::basic_streambuf<char_t, traits_t>;
+
+    //!\brief The number of characters that can be put back.
+    static constexpr size_t max_putback = 4u;
+
+public:
+    //!\brief The integer type of the stream buffer.
+    using int_type = typename base_t::int_type;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    read_ahead_istreambuf() = delete; //!< Deleted.
+    read_ahead_istreambuf(read_ahead_istreambuf const &) = delete; //!< Deleted.
+    read_ahead_istreambuf(read_ahead_istreambuf &&) = delete; //!< Deleted.
+    read_ahead_istreambuf & operator=(read_ahead_istreambuf const &) = delete; //!< Deleted.
+    read_ahead_istreambuf & operator=(read_ahead_istreambuf &&) = delete; //!< Deleted.
+
+    /*!\brief Reads ahead from the given stream buffer.
+     * \param[in] source       The stream buffer to read from; must outlive this object and must not be used by others
+     *                         while this object exists.
+     * \param[in] buffer_size  The number of characters per buffer; must be greater than 0.
+     * \param[in] buffer_count The number of buffers; must be greater than 0.
+     */
+    read_ahead_istreambuf(std::basic_streambuf<char_t, traits_t> & source,
+                          size_t const buffer_size,
+                          size_t const buffer_count) :
+        source{&source}
+    {
+        start(buffer_size, buffer_count);
+    }
+
+    /*!\brief Reads ahead from the given file.
+     * \param[in] file_path    The path of the file.
+     * \param[in] offset       The position in the file to start reading from.
+     * \param[in] buffer_size  The number of characters per buffer; must be greater than 0.
+     * \param[in] buffer_count The number of buffers; must be greater than 0.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     */
+    read_ahead_istreambuf(std::filesystem::path const & file_path,
+                          std::streamoff const offset,
+                          size_t const buffer_size,
+                          size_t const buffer_count)
+    {
+#if SEQAN3_HAS_PREAD
+        file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+            throw file_open_error{"Could not open file " + file_path.string() + " for reading."};
+
+        file_offset = static_cast<off_t>(offset);
+#   ifdef POSIX_FADV_SEQUENTIAL
+        ::posix_fadvise(file_descriptor, file_offset, 0, POSIX_FADV_SEQUENTIAL); // only a hint, errors are irrelevant
+#   endif
+#else // Read through a file stream buffer if pread is not available.
+        file_buffer = std::make_unique<std::basic_filebuf<char_t, traits_t>>();
+        if (!file_buffer->open(file_path, std::ios_base::in | std::ios_base::binary) ||
+            file_buffer->pubseekpos(offset, std::ios_base::in) != std::streampos{offset})
+            throw file_open_error{"Could not open file " + file_path.string() + " for reading."};
+
+        source = file_buffer.get();
+#endif
+        start(buffer_size, buffer_count);
+    }
+
+    //!\brief Stops the background thread; it finishes a read that is in progress.
+    ~read_ahead_istreambuf()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopped = true;
+        }
+
+        free_buffer.notify_one();
+        reader.join();
+
+#if SEQAN3_HAS_PREAD
+        if (file_descriptor != -1)
+            ::close(file_descriptor);
+#endif
+    }
+    //!\}
+
+protected:
+    //!\brief Hands the consumed buffer back and waits for the next one.
+    int_type underflow() override
+    {
+        if (this->gptr() < this->egptr())
+            return traits_t::to_int_type(*this->gptr());
+
+        // keep the last characters for putting back; the buffer may be refilled as soon as it is released
+        size_t const putback = std::min<size_t>(this->gptr() - this->eback(), max_putback);
+        std::array<char_t, max_putback> putback_area{};
+        std::memcpy(putback_area.data(), this->gptr() - putback, putback);
+
+        std::unique_lock lock{mutex};
+
+        if (holds_buffer)
+        {
+            holds_buffer = false;
+            ++released_count;
+            free_buffer.notify_one();
+        }
+
+        filled_buffer.wait(lock, [this] () { return filled_count > released_count || finished; });
+
+        if (filled_count == released_count) // finished and all buffers consumed
+        {
+            this->setg(this->gptr(), this->gptr(), this->gptr());
+
+            if (error)
+                std::rethrow_exception(std::exchange(error, nullptr));
+
+            return traits_t::eof();
+        }
+
+        holds_buffer = true;
+        size_t const index = released_count % buffers.size();
+        lock.unlock();
+
+        char_t * const begin = buffers[index].data() + max_putback;
+        std::memcpy(begin - putback, putback_area.data(), putback);
+        this->setg(begin - putback, begin, begin + sizes[index]);
+
+        return traits_t::to_int_type(*this->gptr());
+    }
+
+private:
+    //!\brief The stream buffer to read from; `nullptr` if the file is read with `pread`.
+    std::basic_streambuf<char_t, traits_t> * source{nullptr};
+#if SEQAN3_HAS_PREAD
+    //!\brief The file descriptor if the file is read with `pread`; -1 otherwise.
+    int file_descriptor{-1};
+    //!\brief The position in the file of the next read.
+    off_t file_offset{};
+#else
+    //!\brief The file stream buffer if a file is read.
+    std::unique_ptr<std::basic_filebuf<char_t, traits_t>> file_buffer{};
+#endif
+
+    //!\brief The buffers, each preceded by a put back area.
+    std::vector<std::vector<char_t>> buffers{};
+    //!\brief The number of characters in each buffer.
+    std::vector<size_t> sizes{};
+
+    //!\brief Protects the counters and flags below.
+    std::mutex mutex{};
+    //!\brief Signals that a buffer was filled or that the background thread finished.
+    std::condition_variable filled_buffer{};
+    //!\brief Signals that a buffer was released or that the background thread should stop.
+    std::condition_variable free_buffer{};
+    //!\brief The number of buffers filled by the background thread so far.
+    size_t filled_count{};
+    //!\brief The number of buffers consumed and handed back so far.
+    size_t released_count{};
+    //!\brief Whether the get area is a filled buffer that was not released yet.
+    bool holds_buffer{false};
+    //!\brief Whether the background thread reached the end of the data or failed.
+    bool finished{false};
+    //!\brief Whether the background thread should stop.
+    bool stopped{false};
+    //!\brief The error that ended the background thread, if any.
+    std::exception_ptr error{};
+
+    //!\brief The background thread; declared last such that it starts after all other members are initialised.
+    std::thread reader{};
+
+    //!\brief Allocates the buffers and starts the background thread.
+    void start(size_t const buffer_size, size_t const buffer_count)
+    {
+        assert(buffer_size > 0u);
+        assert(buffer_count > 0u);
+
+        buffers.assign(buffer_count, std::vector<char_t>(max_putback + buffer_size));
+        sizes.assign(buffer_count, 0u);
+        this->setg(buffers[0].data() + max_putback, buffers[0].data() + max_putback, buffers[0].data() + max_putback);
+
+        reader = std::thread{[this] () { read_ahead(); }};
+    }
+
+    //!\brief Reads at most `size` characters; returns less only at the end of the data.
+    size_t read(char_t * const data, size_t const size)
+    {
+#if SEQAN3_HAS_PREAD
+        if (source == nullptr)
+        {
+            size_t count{};
+
+            while (count < size)
+            {
+                ssize_t const result = ::pread(file_descriptor, data + count, size - count, file_offset);
+
+                if (result == -1 && errno == EINTR)
+                    continue;
+
+                if (result == -1)
+                    throw io_error{std::string{"Reading the file failed: "} + std::strerror(errno)};
+
+                if (result == 0)
+                    break;
+
+                count += static_cast<size_t>(result);
+                file_offset += result;
+            }
+
+            return count;
+        }
+#endif
+        return static_cast<size_t>(source->sgetn(data, static_cast<std::streamsize>(size)));
+    }
+
+    //!\brief The work of the background thread: fills the free buffers in order until the end of the data.
+    void read_ahead()
+    {
+        try
+        {
+            for (size_t index = 0u; ; index = (index + 1u) % buffers.size())
+            {
+                {
+                    std::unique_lock lock{mutex};
+                    free_buffer.wait(lock, [this] () { return filled_count - released_count < buffers.size() ||
+                                                              stopped; });
+                    if (stopped)
+                        return;
+                }
+
+                size_t const capacity = buffers[index].size() - max_putback;
+                sizes[index] = read(buffers[index].data() + max_putback, capacity);
+
+                std::lock_guard lock{mutex};
+
+                if (sizes[index] > 0u)
+                    ++filled_count;
+
+                if (sizes[index] < capacity)
+                {
+                    finished = true;
+                    filled_buffer.notify_one();
+                    return;
+                }
+
+                filled_buffer.notify_one();
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard lock{mutex};
+            error = std::current_exception();
+            finished = true;
+            filled_buffer.notify_one();
+        }
+    }
+};
+
+/*!\brief An input stream that reads ahead on a background thread.
+ * \ingroup io
+ * \tparam char_t   The character type; must have a size of one byte.
+ * \tparam traits_t The character traits type.
+ *
+ * \details
+ *
+ * The stream optionally takes ownership of the stream it reads from, such that a decompression stream stays alive as
+ * long as it is used by the background thread.
+ * \sa seqan3::detail::read_ahead_istreambuf
+ */
+template <typename char_t, typename traits_t = std::char_traits<char_t>>
+class read_ahead_istream : public std::basic_istream<char_t, traits_t>
+{
+public:
+    //!\brief The type of the owning pointer to the stream that is read from, as used by the files.
+    using source_ptr_t = std::unique_ptr<std::basic_istream<char_t, traits_t>,
+                                         std::function<void(std::basic_istream<char_t, traits_t> *)>>;
+
+    /*!\brief Reads ahead from the given stream.
+     * \param[in] source       The stream to read from; kept alive by this object.
+     * \param[in] buffer_size  The number of characters per buffer; must be greater than 0.
+     * \param[in] buffer_count The number of buffers; must be greater than 0.
+     */
+    read_ahead_istream(source_ptr_t source, size_t const buffer_size, size_t const buffer_count) :
+        std::basic_istream<char_t, traits_t>{nullptr},
+        source{std::move(source)},
+        buffer{std::make_unique<read_ahead_istreambuf<char_t, traits_t>>(*this->source->rdbuf(),
+                                                                          buffer_size,
+                                                                          buffer_count)}
+    {
+        this->init(buffer.get());
+    }
+
+    /*!\brief Reads ahead from the given file, starting at the current position of the given stream.
+     * \param[in] source       The stream that has the file opened; kept alive by this object, but not read from.
+     * \param[in] file_path    The path of the file.
+     * \param[in] buffer_size  The number of characters per buffer; must be greater than 0.
+     * \param[in] buffer_count The number of buffers; must be greater than 0.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     */
+    read_ahead_istream(source_ptr_t source,
+                       std::filesystem::path const & file_path,
+                       size_t const buffer_size,
+                       size_t const buffer_count) :
+        std::basic_istream<char_t, traits_t>{nullptr},
+        source{std::move(source)},
+        buffer{std::make_unique<read_ahead_istreambuf<char_t, traits_t>>(file_path,
+                                                                          std::streamoff{this->source->tellg()},
+                                                                          buffer_size,
+                                                                          buffer_count)}
+    {
+        this->init(buffer.get());
+    }
+
+    //!\brief Returns the stream buffer.
+    read_ahead_istreambuf<char_t, traits_t> * rdbuf()
+    {
+        return buffer.get();
+    }
+
+private:
+    //!\brief The stream that is read from.
+    source_ptr_t source;
+    //!\brief The stream buffer; destroyed (and hence stopped) before the source.
+    std::unique_ptr<read_ahead_istreambuf<char_t, traits_t>> buffer;
+};
+
+} // namespace seqan3::detail
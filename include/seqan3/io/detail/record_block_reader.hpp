@@ -0,0 +1,231 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::record_block_reader and seqan3::detail::memory_istreambuf.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <istream>
+#include <seqan3/std/span>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only stream buffer over an externally owned, contiguous character range.
+ * \ingroup io
+ * \tparam char_t The character type.
+ *
+ * \details
+ *
+ * The get area is set to the given range, hence seqan3::views::istreambuf iterates directly over the memory without
+ * any copying or virtual calls (underflow() of the base class simply signals end of file).
+ */
+template <typename char_t>
+class memory_istreambuf : public std::basic_streambuf<char_t>
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_istreambuf() = default; //!< Defaulted.
+    memory_istreambuf(memory_istreambuf const &) = delete; //!< Deleted.
+    memory_istreambuf(memory_istreambuf &&) = delete; //!< Deleted.
+    memory_istreambuf & operator=(memory_istreambuf const &) = delete; //!< Deleted.
+    memory_istreambuf & operator=(memory_istreambuf &&) = delete; //!< Deleted.
+    ~memory_istreambuf() = default; //!< Defaulted.
+
+    //!\brief Construct from a character range.
+    explicit memory_istreambuf(std::span<char_t const> const range)
+    {
+        reset(range);
+    }
+    //!\}
+
+    //!\brief Sets the get area to the given range.
+    void reset(std::span<char_t const> const range) noexcept
+    {
+        // The get area of std::basic_streambuf is non-const by interface, but is never written to on input.
+        char_t * first = const_cast<char_t *>(range.data());
+        this->setg(first, first, first + range.size());
+    }
+
+    //!\brief Whether all characters have been consumed.
+    bool exhausted() const noexcept
+    {
+        return this->gptr() == this->egptr();
+    }
+};
+
+/*!\brief Reads large blocks of complete, newline terminated lines from a stream and splits them for parallel parsing.
+ * \ingroup io
+ * \tparam char_t The character type.
+ *
+ * \details
+ *
+ * Line based formats (e.g. SAM) are parsed much faster if the parser operates on a contiguous memory block instead of
+ * pulling single characters through a stream. This class reads blocks of roughly `block_size` bytes via
+ * std::basic_istream::read and keeps any incomplete trailing line for the next block, such that every block returned
+ * by read_block() only consists of complete records (the last line of the stream need not end in a newline).
+ *
+ * Delimiters are located with std::char_traits::find which is lowered to `memchr` for `char` and hence uses the
+ * vectorised (SIMD) implementation of the C library.
+ */
+template <typename char_t>
+class record_block_reader
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    record_block_reader() = default; //!< Defaulted.
+    record_block_reader(record_block_reader const &) = default; //!< Defaulted.
+    record_block_reader(record_block_reader &&) = default; //!< Defaulted.
+    record_block_reader & operator=(record_block_reader const &) = default; //!< Defaulted.
+    record_block_reader & operator=(record_block_reader &&) = default; //!< Defaulted.
+    ~record_block_reader() = default; //!< Defaulted.
+
+    //!\brief Construct with a custom block size.
+    explicit record_block_reader(size_t const block_size) : block_size{std::max<size_t>(block_size, 1u)}
+    {}
+    //!\}
+
+    /*!\brief Reads the next block of complete lines from the stream.
+     * \param[in] stream The stream to read from.
+     * \param[in] unconsumed The number of bytes at the end of the previous block that were not processed, e.g. an
+     *                       incomplete multi-line record. They are placed at the front of the next block.
+     * \returns A view on the block; empty if the stream is exhausted.
+     *
+     * \details
+     *
+     * The returned span is valid until the next call to read_block(). Leading line breaks are skipped.
+     * If the unconsumed bytes are at least as large as the block size, more bytes are read at once, such that a single
+     * record that is larger than the block size is read in linear time.
+     */
+    std::span<char_t const> read_block(std::basic_istream<char_t> & stream, size_t const unconsumed = 0)
+    {
+        assert(unconsumed <= block_end);
+
+        // move the unconsumed bytes and the incomplete line of the last block to the front
+        block_end -= unconsumed;
+        std::copy(buffer.begin() + block_end, buffer.begin() + buffer_end, buffer.begin());
+        buffer_end -= block_end;
+        block_end = 0;
+
+        size_t const read_size = std::max(block_size, unconsumed);
+
+        for (bool stream_end = last_block; ; )
+        {
+            if (!stream_end)
+            {
+                if (buffer.size() < buffer_end + read_size)
+                    buffer.resize(buffer_end + read_size);
+
+                stream.read(buffer.data() + buffer_end, read_size);
+                buffer_end += static_cast<size_t>(stream.gcount());
+                stream_end = !stream.good();
+            }
+
+            if (stream_end) // everything that is left constitutes the last block
+            {
+                block_end = buffer_end;
+                last_block = true;
+                break;
+            }
+
+            // find the last line break; a line longer than the block makes us read more
+            size_t pos = buffer_end;
+            while (pos > 0 && buffer[pos - 1] != '\n')
+                --pos;
+
+            if (pos > 0)
+            {
+                block_end = pos;
+                break;
+            }
+        }
+
+        size_t block_begin = skip_line_breaks(0, block_end);
+        return {buffer.data() + block_begin, block_end - block_begin};
+    }
+
+    //!\brief Whether the last block returned by read_block() contains the end of the stream.
+    bool is_last_block() const noexcept
+    {
+        return last_block;
+    }
+
+    /*!\brief Splits a block into at most `n` chunks of roughly equal size at line boundaries.
+     * \param[in] block The block as returned by read_block().
+     * \param[in] n     The maximal number of chunks.
+     * \param[out] chunks The chunks; cleared before filling. Empty chunks are not emitted.
+     */
+    static void split(std::span<char_t const> const block, size_t const n, std::vector<std::span<char_t const>> & chunks)
+    {
+        chunks.clear();
+        size_t const chunk_count = std::max<size_t>(n, 1u);
+        size_t const chunk_size = (block.size() + chunk_count - 1) / chunk_count;
+        char_t const * const block_end = block.data() + block.size();
+        char_t const * chunk_begin = block.data();
+
+        while (chunk_begin != block_end)
+        {
+            char_t const * chunk_end = chunk_begin + std::min<size_t>(chunk_size, block_end - chunk_begin);
+
+            if (chunk_end != block_end)
+            {
+                // continue to the next newline and swallow all following line breaks
+                char_t const * newline = std::char_traits<char_t>::find(chunk_end, block_end - chunk_end, '\n');
+                chunk_end = (newline == nullptr) ? block_end : newline;
+
+                while (chunk_end != block_end && is_line_break(*chunk_end))
+                    ++chunk_end;
+            }
+
+            chunks.emplace_back(chunk_begin, chunk_end - chunk_begin);
+            chunk_begin = chunk_end;
+        }
+    }
+
+private:
+    //!\brief Whether the character terminates a line.
+    static constexpr bool is_line_break(char_t const c) noexcept
+    {
+        return c == '\n' || c == '\r';
+    }
+
+    //!\brief Returns the position of the first non line break character in [first, last).
+    size_t skip_line_breaks(size_t first, size_t const last) const noexcept
+    {
+        while (first < last && is_line_break(buffer[first]))
+            ++first;
+
+        return first;
+    }
+
+    //!\brief The number of bytes requested from the stream per read.
+    size_t block_size{1u << 22};
+    //!\brief The buffer holding the current block followed by the incomplete line.
+    std::vector<char_t> buffer{};
+    //!\brief The end of the current block inside the buffer.
+    size_t block_end{0};
+    //!\brief The end of the valid data inside the buffer.
+    size_t buffer_end{0};
+    //!\brief Whether the end of the stream was reached.
+    bool last_block{false};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sequence_record_scanner.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief The fields of a FASTA or FASTQ record as found by seqan3::detail::sequence_record_scanner.
+struct sequence_record_fields
+{
+    //!\brief The header line without the leading ID character, leading blanks and the line break.
+    std::string_view id{};
+    //!\brief The raw sequence lines without the trailing line breaks.
+    std::string_view sequence{};
+    //!\brief The raw quality lines without the trailing line breaks; empty for FASTA records.
+    std::string_view qualities{};
+    //!\brief The end of the record, i.e. the begin of the next record or of trailing line breaks.
+    char const * end{nullptr};
+};
+
+/*!\brief Finds the end and the fields of FASTA and FASTQ records inside a block of complete lines.
+ * \ingroup io
+ *
+ * \details
+ *
+ * Used by the readers that split blocks of seqan3::detail::record_block_reader into records themselves, e.g.
+ * seqan3::sequence_file_view_input and seqan3::paired_sequence_file_input, such that they agree on where a
+ * record ends. FASTA records may span multiple lines, FASTQ records may have multi-line sequences and qualities.
+ * The qualities of a FASTQ record end as soon as there are as many qualities as letters, such that quality lines
+ * starting with `@` are handled.
+ *
+ * A record that reaches the end of a block that is not the last one may continue in the next block; in this case
+ * `std::nullopt` is returned and the caller needs to read the next block that starts with the record.
+ */
+class sequence_record_scanner
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_record_scanner() = delete; //!< Deleted.
+    sequence_record_scanner(sequence_record_scanner const &) = default; //!< Defaulted.
+    sequence_record_scanner(sequence_record_scanner &&) = default; //!< Defaulted.
+    sequence_record_scanner & operator=(sequence_record_scanner const &) = default; //!< Defaulted.
+    sequence_record_scanner & operator=(sequence_record_scanner &&) = default; //!< Defaulted.
+    ~sequence_record_scanner() = default; //!< Defaulted.
+
+    /*!\brief Construct for a block.
+     * \param[in] block_end     The end of the block.
+     * \param[in] is_last_block Whether the block contains the end of the file.
+     */
+    sequence_record_scanner(char const * const block_end, bool const is_last_block) noexcept :
+        block_end{block_end},
+        is_last_block{is_last_block}
+    {}
+    //!\}
+
+    /*!\brief Scans the FASTA record starting at `first`.
+     * \param[in] first The begin of the record; must be before the end of the block.
+     * \returns The fields of the record or `std::nullopt` if the record may continue in the next block.
+     * \throws seqan3::parse_error If `first` is not the begin of a FASTA record.
+     */
+    std::optional<sequence_record_fields> fasta_record(char const * const first) const
+    {
+        if (*first != '>' && *first != ';')
+            throw parse_error{"Expected to be on beginning of ID, but found \"" + std::string{*first} + "\"."};
+
+        char const * id_end = find_line_break(first);
+        if (id_end == nullptr)
+        {
+            if (!is_last_block)
+                return std::nullopt;
+
+            id_end = block_end;
+        }
+
+        std::string_view const id = header_id(first, id_end);
+        char const * const sequence_begin = (id_end == block_end) ? block_end : id_end + 1;
+        char const * p = sequence_begin;
+
+        while (p != block_end && *p != '>' && *p != ';')
+        {
+            char const * const line_break = find_line_break(p);
+            p = (line_break == nullptr) ? block_end : line_break + 1;
+        }
+
+        // The next line of the following block may still belong to the sequence.
+        if (p == block_end && !is_last_block)
+            return std::nullopt;
+
+        return sequence_record_fields{id, trim_line_breaks(sequence_begin, p), std::string_view{}, p};
+    }
+
+    /*!\brief Scans the FASTQ record starting at `first`.
+     * \param[in] first The begin of the record; must be before the end of the block.
+     * \returns The fields of the record or `std::nullopt` if the record may continue in the next block.
+     * \throws seqan3::unexpected_end_of_input If the last record of the file is incomplete.
+     * \throws seqan3::parse_error If `first` is not the begin of a FASTQ record or the record has more qualities
+     *                             than letters.
+     */
+    std::optional<sequence_record_fields> fastq_record(char const * const first) const
+    {
+        if (*first != '@')
+            throw parse_error{"Expected to be on beginning of ID, but found \"" + std::string{*first} + "\"."};
+
+        char const * const id_end = next_line_break(first);
+        if (id_end == nullptr)
+            return std::nullopt;
+
+        std::string_view const id = header_id(first, id_end);
+
+        // The sequence ends at the line starting with '+'.
+        char const * const sequence_begin = id_end + 1;
+        char const * p = sequence_begin;
+        size_t sequence_length = 0;
+
+        while (p == block_end || *p != '+')
+        {
+            char const * const line_break = next_line_break(p);
+            if (line_break == nullptr)
+                return std::nullopt;
+
+            sequence_length += line_length(p, line_break);
+            p = line_break + 1;
+        }
+
+        char const * const sequence_end = p;
+        char const * const plus_line_end = next_line_break(p);
+        if (plus_line_end == nullptr)
+            return std::nullopt;
+
+        // The qualities end as soon as there are as many qualities as letters.
+        char const * const qualities_begin = plus_line_end + 1;
+        size_t qualities_length = 0;
+
+        for (p = qualities_begin; qualities_length < sequence_length;)
+        {
+            char const * line_break = (p == block_end) ? nullptr : find_line_break(p);
+
+            if (line_break == nullptr)
+            {
+                if (!is_last_block)
+                    return std::nullopt;
+                else if (p == block_end)
+                    throw unexpected_end_of_input{"The FASTQ record has fewer qualities than letters."};
+
+                line_break = block_end; // The last line of the file need not end in a line break.
+            }
+
+            qualities_length += line_length(p, line_break);
+            p = (line_break == block_end) ? block_end : line_break + 1;
+        }
+
+        if (qualities_length != sequence_length)
+            throw parse_error{"The FASTQ record \"" + std::string{id} + "\" has " + std::to_string(qualities_length) +
+                              " qualities, but " + std::to_string(sequence_length) + " letters."};
+
+        return sequence_record_fields{id,
+                                      trim_line_breaks(sequence_begin, sequence_end),
+                                      trim_line_breaks(qualities_begin, p),
+                                      p};
+    }
+
+private:
+    //!\brief Returns the position of the next line break in `[first, block_end)` or `nullptr`.
+    char const * find_line_break(char const * const first) const noexcept
+    {
+        return std::char_traits<char>::find(first, block_end - first, '\n');
+    }
+
+    /*!\brief Returns the next line break in `[first, block_end)` or `nullptr` if the line may continue.
+     * \throws seqan3::unexpected_end_of_input If the line is the incomplete end of the file.
+     */
+    char const * next_line_break(char const * const first) const
+    {
+        char const * const line_break = (first == block_end) ? nullptr : find_line_break(first);
+
+        if (line_break == nullptr && is_last_block)
+            throw unexpected_end_of_input{"The FASTQ record is incomplete."};
+
+        return line_break;
+    }
+
+    //!\brief Returns the header line from `first` to `last` without the leading ID character, blanks and `\r`.
+    static std::string_view header_id(char const * first, char const * last) noexcept
+    {
+        for (++first; first != last && (*first == ' ' || *first == '\t'); ++first)
+        {}
+
+        if (last != first && *(last - 1) == '\r')
+            --last;
+
+        return {first, static_cast<size_t>(last - first)};
+    }
+
+    //!\brief Returns the characters of `[first, last)` without trailing line breaks.
+    static std::string_view trim_line_breaks(char const * first, char const * last) noexcept
+    {
+        while (last != first && (*(last - 1) == '\n' || *(last - 1) == '\r'))
+            --last;
+
+        return {first, static_cast<size_t>(last - first)};
+    }
+
+    //!\brief The number of characters of the line `[first, line_break)` without `\r`.
+    static size_t line_length(char const * const first, char const * const line_break) noexcept
+    {
+        size_t const length = line_break - first;
+        return (length > 0 && *(line_break - 1) == '\r') ? length - 1 : length;
+    }
+
+    //!\brief The end of the block.
+    char const * block_end{nullptr};
+    //!\brief Whether the block contains the end of the file.
+    bool is_last_block{false};
+};
+
+} // namespace seqan3::detail
@@ -36,8 +36,12 @@
 #include <seqan3/io/sam_file/header.hpp>
 #include <seqan3/io/sam_file/input.hpp>
 #include <seqan3/io/sam_file/input_format_concept.hpp>
+#include <seqan3/io/sam_file/lazy_input.hpp>
+#include <seqan3/io/sam_file/lazy_record.hpp>
 #include <seqan3/io/sam_file/input_options.hpp>
 #include <seqan3/io/sam_file/output.hpp>
 #include <seqan3/io/sam_file/output_format_concept.hpp>
 #include <seqan3/io/sam_file/output_options.hpp>
 #include <seqan3/io/sam_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/sam_file/sorter.hpp>
+#include <seqan3/io/sam_file/sorter_options.hpp>
@@ -0,0 +1,198 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::bam_sequence_codec.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/detail/convert.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Bulk decoding and encoding of the 4 bit packed sequences of BAM records.
+ * \ingroup io_sam_file
+ * \tparam alphabet_type The alphabet of the (un)packed sequence; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * BAM stores two letters of seqan3::sam_dna16 per byte, the first letter in the high nibble. The codec converts
+ * whole bytes instead of single letters:
+ *
+ * * Decoding looks up both letters of a byte in a table with 256 entries, i.e. the conversion of the nibbles to
+ *   seqan3::sam_dna16 and further to `alphabet_type` via the character representation is done at compile time.
+ * * Encoding looks up the nibble of every rank of `alphabet_type` in a table and combines two letters per byte.
+ *
+ * The letters are written into pre-sized output, either a buffer or a container that is resized once.
+ */
+template <writable_alphabet alphabet_type>
+class bam_sequence_codec
+{
+private:
+    //!\brief The two letters of a packed byte.
+    using letter_pair_type = std::array<alphabet_type, 2>;
+
+    //!\brief Maps a packed byte to its two letters.
+    static constexpr std::array<letter_pair_type, 256> decode_table
+    {
+        [] () constexpr
+        {
+            constexpr auto from_dna16 = convert_through_char_representation<alphabet_type, sam_dna16>;
+
+            std::array<letter_pair_type, 256> table{};
+            for (size_t byte = 0; byte < 256; ++byte)
+                table[byte] = letter_pair_type{from_dna16[byte >> 4], from_dna16[byte & 0x0f]};
+
+            return table;
+        }()
+    };
+
+    //!\brief Maps a rank of `alphabet_type` to the rank of the corresponding seqan3::sam_dna16 letter.
+    static constexpr std::array<uint8_t, alphabet_size<alphabet_type>> encode_table
+    {
+        [] () constexpr
+        {
+            constexpr auto to_dna16 = convert_through_char_representation<sam_dna16, alphabet_type>;
+
+            std::array<uint8_t, alphabet_size<alphabet_type>> table{};
+            for (size_t rank = 0; rank < alphabet_size<alphabet_type>; ++rank)
+                table[rank] = seqan3::to_rank(to_dna16[rank]);
+
+            return table;
+        }()
+    };
+
+public:
+    /*!\brief Decodes the letters `[begin, begin + count)` of a packed sequence.
+     * \tparam output_iterator_t The type of the output iterator; must model std::output_iterator.
+     * \param[in] packed The packed sequence; must hold at least `(begin + count + 1) / 2` bytes.
+     * \param[in] begin The position of the first letter to decode.
+     * \param[in] count The number of letters to decode.
+     * \param[in] output The iterator to write the letters to.
+     * \returns The output iterator behind the last written letter.
+     */
+    template <std::output_iterator<alphabet_type> output_iterator_t>
+    static output_iterator_t decode(std::span<char const> const packed,
+                                    size_t const begin,
+                                    size_t const count,
+                                    output_iterator_t output)
+    {
+        assert(packed.size() >= (begin + count + 1) / 2);
+
+        auto byte_at = [&packed] (size_t const position)
+        {
+            return static_cast<uint8_t>(packed[position / 2]);
+        };
+
+        size_t position = begin;
+        size_t const end = begin + count;
+
+        if ((position & 1) && position < end) // Starts at a low nibble.
+        {
+            *output = decode_table[byte_at(position)][1];
+            ++output;
+            ++position;
+        }
+
+        for (; position + 1 < end; position += 2)
+        {
+            letter_pair_type const & letters = decode_table[byte_at(position)];
+            *output = letters[0];
+            ++output;
+            *output = letters[1];
+            ++output;
+        }
+
+        if (position < end) // Ends at a high nibble.
+        {
+            *output = decode_table[byte_at(position)][0];
+            ++output;
+        }
+
+        return output;
+    }
+
+    /*!\brief Decodes the letters `[begin, begin + count)` of a packed sequence and appends them to a container.
+     * \tparam container_t The type of the container; must model seqan3::sequence_container.
+     * \param[in] packed The packed sequence; must hold at least `(begin + count + 1) / 2` bytes.
+     * \param[in] begin The position of the first letter to decode.
+     * \param[in] count The number of letters to decode.
+     * \param[in,out] container The container to append the letters to.
+     *
+     * \details
+     *
+     * Containers that can be resized are resized once and the letters are written in place; otherwise the letters
+     * are appended one by one.
+     */
+    template <typename container_t>
+    static void decode_append(std::span<char const> const packed,
+                              size_t const begin,
+                              size_t const count,
+                              container_t & container)
+    {
+        if constexpr (requires { container.resize(count); } && std::ranges::random_access_range<container_t>)
+        {
+            size_t const old_size = std::ranges::size(container);
+            container.resize(old_size + count);
+            decode(packed, begin, count, std::ranges::next(std::ranges::begin(container), old_size));
+        }
+        else
+        {
+            decode(packed, begin, count, std::back_inserter(container));
+        }
+    }
+
+    /*!\brief Encodes a sequence of `count` letters into `(count + 1) / 2` bytes.
+     * \tparam input_iterator_t The type of the iterator over the letters; must model std::input_iterator.
+     * \param[in] input The iterator to the first letter.
+     * \param[in] count The number of letters to encode.
+     * \param[out] packed The buffer to write to; must hold at least `(count + 1) / 2` bytes.
+     * \returns The input iterator behind the last encoded letter.
+     *
+     * \details
+     *
+     * If `count` is odd, the low nibble of the last byte is `0`.
+     */
+    template <std::input_iterator input_iterator_t>
+    static input_iterator_t encode(input_iterator_t input, size_t const count, std::span<char> const packed)
+    {
+        assert(packed.size() >= (count + 1) / 2);
+
+        char * out = packed.data();
+
+        for (size_t i = count / 2; i > 0; --i)
+        {
+            uint8_t byte = encode_table[seqan3::to_rank(*input)] << 4;
+            ++input;
+            byte |= encode_table[seqan3::to_rank(*input)];
+            ++input;
+            *out++ = static_cast<char>(byte);
+        }
+
+        if (count & 1)
+        {
+            *out = static_cast<char>(encode_table[seqan3::to_rank(*input)] << 4);
+            ++input;
+        }
+
+        return input;
+    }
+};
+
+} // namespace seqan3::detail
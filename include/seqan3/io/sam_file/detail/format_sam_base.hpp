@@ -27,6 +27,7 @@
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/sam_file/detail/cigar.hpp>
+#include <seqan3/io/sam_file/flat_sam_tag_dictionary.hpp>
 #include <seqan3/io/sam_file/header.hpp>
 #include <seqan3/io/sam_file/input_format_concept.hpp>
 #include <seqan3/io/sam_file/input_options.hpp>
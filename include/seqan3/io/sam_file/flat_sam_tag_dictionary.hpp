@@ -0,0 +1,672 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::flat_sam_tag_dictionary.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <seqan3/core/debug_stream/detail/to_string.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/sam_tag_dictionary.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the number of bytes of a single BAM tag value (excluding the tag and the type character).
+ * \ingroup io_sam_file
+ * \param[in] type_id The BAM type character of the value, i.e. one of [AcCsSiIfZHB].
+ * \param[in] value   Pointer to the first byte of the value.
+ * \param[in] end     Pointer behind the last byte of the data.
+ * \throws seqan3::format_error if the type is unknown or the value exceeds the data.
+ */
+inline size_t bam_tag_value_size(char const type_id, char const * const value, char const * const end)
+{
+    auto element_size = [] (char const id) -> size_t
+    {
+        switch (id)
+        {
+            case 'A': case 'c': case 'C': return 1u;
+            case 's': case 'S':           return 2u;
+            case 'i': case 'I': case 'f': return 4u;
+            default:                      return 0u;
+        }
+    };
+
+    size_t const available = end - value;
+    size_t size{element_size(type_id)};
+
+    if (type_id == 'Z' || type_id == 'H') // null-terminated
+    {
+        void const * terminator = std::memchr(value, '\0', available);
+
+        if (terminator == nullptr)
+            throw format_error{"A BAM tag of type Z or H is not null-terminated."};
+
+        size = static_cast<char const *>(terminator) - value + 1u;
+    }
+    else if (type_id == 'B') // array: sub type, int32_t length, values
+    {
+        if (available < 5u || element_size(value[0]) == 0u || value[0] == 'A')
+            throw format_error{"A BAM tag of type B is corrupted."};
+
+        int32_t count{};
+        std::memcpy(&count, value + 1, sizeof(count));
+
+        if (count < 0)
+            throw format_error{"A BAM tag of type B has a negative length."};
+
+        size = 5u + static_cast<size_t>(count) * element_size(value[0]);
+    }
+    else if (size == 0u)
+    {
+        throw format_error{detail::to_string("The type of a BAM tag must be one of [A,c,C,s,S,i,I,f,Z,H,B] but '",
+                                             type_id, "' was given.")};
+    }
+
+    if (size > available)
+        throw format_error{"A BAM tag exceeds the available data."};
+
+    return size;
+}
+
+/*!\brief Decodes a single BAM tag value into a seqan3::detail::sam_tag_variant.
+ * \ingroup io_sam_file
+ * \param[in] type_id The BAM type character of the value.
+ * \param[in] value   Pointer to the first byte of the value; the value must have been validated by
+ *                    seqan3::detail::bam_tag_value_size.
+ *
+ * \details
+ *
+ * All integer types are converted to `int32_t` and byte arrays (type H) are converted from their hexadecimal
+ * representation, in the same way as seqan3::format_bam reads them into a seqan3::sam_tag_dictionary.
+ */
+inline sam_tag_variant decode_bam_tag_value(char const type_id, char const * const value)
+{
+    auto load = [] (char const * ptr, auto type_tag)
+    {
+        decltype(type_tag) result{};
+        std::memcpy(&result, ptr, sizeof(result));
+        return result;
+    };
+
+    auto load_vector = [load] (char const * ptr, auto type_tag) -> sam_tag_variant
+    {
+        using value_t = decltype(type_tag);
+        int32_t const count = load(ptr, int32_t{});
+        std::vector<value_t> result(count);
+        std::memcpy(result.data(), ptr + sizeof(int32_t), count * sizeof(value_t));
+        return result;
+    };
+
+    switch (type_id)
+    {
+        case 'A': return *value;
+        case 'c': return static_cast<int32_t>(load(value, int8_t{}));
+        case 'C': return static_cast<int32_t>(load(value, uint8_t{}));
+        case 's': return static_cast<int32_t>(load(value, int16_t{}));
+        case 'S': return static_cast<int32_t>(load(value, uint16_t{}));
+        case 'i': return load(value, int32_t{});
+        case 'I': return static_cast<int32_t>(load(value, uint32_t{}));
+        case 'f': return load(value, float{});
+        case 'Z': return std::string{value};
+        case 'H':
+        {
+            auto from_hex = [] (char const c) -> uint8_t
+            {
+                if (c >= '0' && c <= '9')
+                    return c - '0';
+                if (c >= 'A' && c <= 'F')
+                    return c - 'A' + 10;
+                if (c >= 'a' && c <= 'f')
+                    return c - 'a' + 10;
+                throw format_error{std::string{"Illegal character in hexadecimal BAM tag: "} + c};
+            };
+
+            size_t const length = std::strlen(value);
+
+            if (length % 2 != 0)
+                throw format_error{"Hexadecimal tag has an uneven number of digits!"};
+
+            std::vector<std::byte> result(length / 2);
+            for (size_t i = 0; i < result.size(); ++i)
+                result[i] = static_cast<std::byte>(from_hex(value[2 * i]) * 16 + from_hex(value[2 * i + 1]));
+
+            return result;
+        }
+        default: // 'B', validated by bam_tag_value_size
+        {
+            switch (value[0])
+            {
+                case 'c': return load_vector(value + 1, int8_t{});
+                case 'C': return load_vector(value + 1, uint8_t{});
+                case 's': return load_vector(value + 1, int16_t{});
+                case 'S': return load_vector(value + 1, uint16_t{});
+                case 'i': return load_vector(value + 1, int32_t{});
+                case 'I': return load_vector(value + 1, uint32_t{});
+                default:  return load_vector(value + 1, float{});
+            }
+        }
+    }
+}
+
+/*!\brief Appends the BAM representation of a tag (tag, type character(s) and value) to a byte buffer.
+ * \ingroup io_sam_file
+ * \param[in,out] buffer The buffer to append to.
+ * \param[in]     tag    The tag id.
+ * \param[in]     value  The value.
+ *
+ * \details
+ *
+ * Integers are stored in the smallest possible representation and byte arrays are written as hexadecimal strings.
+ */
+inline void append_bam_tag(std::vector<char> & buffer, uint16_t const tag, sam_tag_variant const & value)
+{
+    auto append = [&buffer] (auto const & arithmetic_value)
+    {
+        char const * ptr = reinterpret_cast<char const *>(&arithmetic_value);
+        buffer.insert(buffer.end(), ptr, ptr + sizeof(arithmetic_value));
+    };
+
+    buffer.push_back(static_cast<char>(tag / 256));
+    buffer.push_back(static_cast<char>(tag % 256));
+
+    std::visit([&] (auto const & arg)
+    {
+        using value_t = std::remove_cvref_t<decltype(arg)>;
+
+        if constexpr (std::same_as<value_t, int32_t>)
+        {
+            if (arg >= 0 && arg <= std::numeric_limits<uint8_t>::max())
+            {
+                buffer.push_back('C');
+                append(static_cast<uint8_t>(arg));
+            }
+            else if (arg < 0 && arg >= std::numeric_limits<int8_t>::min())
+            {
+                buffer.push_back('c');
+                append(static_cast<int8_t>(arg));
+            }
+            else if (arg >= 0 && arg <= std::numeric_limits<uint16_t>::max())
+            {
+                buffer.push_back('S');
+                append(static_cast<uint16_t>(arg));
+            }
+            else if (arg < 0 && arg >= std::numeric_limits<int16_t>::min())
+            {
+                buffer.push_back('s');
+                append(static_cast<int16_t>(arg));
+            }
+            else
+            {
+                buffer.push_back('i');
+                append(arg);
+            }
+        }
+        else if constexpr (std::same_as<value_t, char> || std::same_as<value_t, float>)
+        {
+            buffer.push_back(sam_tag_type_char[value.index()]);
+            append(arg);
+        }
+        else if constexpr (std::same_as<value_t, std::string>)
+        {
+            buffer.push_back('Z');
+            buffer.insert(buffer.end(), arg.begin(), arg.end());
+            buffer.push_back('\0');
+        }
+        else if constexpr (std::same_as<value_t, std::vector<std::byte>>)
+        {
+            constexpr char const * hex_digits = "0123456789ABCDEF";
+            buffer.push_back('H');
+
+            for (std::byte const b : arg)
+            {
+                buffer.push_back(hex_digits[std::to_integer<uint8_t>(b) / 16]);
+                buffer.push_back(hex_digits[std::to_integer<uint8_t>(b) % 16]);
+            }
+
+            buffer.push_back('\0');
+        }
+        else // numeric array
+        {
+            buffer.push_back('B');
+            buffer.push_back(sam_tag_type_char_extra[value.index()]);
+            append(static_cast<int32_t>(arg.size()));
+            char const * ptr = reinterpret_cast<char const *>(arg.data());
+            buffer.insert(buffer.end(), ptr, ptr + arg.size() * sizeof(typename value_t::value_type));
+        }
+    }, value);
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A compact SAM tag dictionary storing all tags in their binary BAM representation.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The seqan3::sam_tag_dictionary is a std::map over std::variant values, i.e. every tag of every record allocates a
+ * map node and possibly a string or vector. This class instead stores all tags of a record in a single byte buffer in
+ * the [BAM encoding](https://samtools.github.io/hts-specs/SAMv1.pdf) of the auxiliary data together with a small
+ * vector of (tag, position) pairs sorted by tag. Both buffers are reused when the dictionary is cleared, such that
+ * reading many records does not allocate at all in the steady state.
+ *
+ * Values are decoded lazily when they are accessed, i.e. get() and at() return copies. If the tags are read from a BAM
+ * file and written to a BAM file, the raw bytes are passed through without decoding or re-encoding them.
+ *
+ * To read the tags into this type, select it in the traits of seqan3::sam_file_input:
+ *
+ * \include test/snippet/io/sam_file/flat_sam_tag_dictionary.cpp
+ *
+ * The lookup interface mirrors the seqan3::sam_tag_dictionary, e.g. get<"NM"_tag>() returns the value typed as
+ * seqan3::sam_tag_type_t<"NM"_tag> and iterating over the dictionary yields pairs of the tag and the
+ * seqan3::sam_tag_dictionary::variant_type in order of the tag ids.
+ */
+class flat_sam_tag_dictionary
+{
+public:
+    //!\brief The variant type defining all valid SAM tag field types.
+    using variant_type = detail::sam_tag_variant;
+    //!\brief The (decoded) value type when iterating over the dictionary.
+    using value_type = std::pair<uint16_t, variant_type>;
+    //!\brief The size type.
+    using size_type = size_t;
+
+private:
+    //!\brief The position of a single tag inside the byte buffer.
+    struct entry
+    {
+        //!\brief The tag id.
+        uint16_t tag;
+        //!\brief The position of the two tag characters inside the buffer.
+        uint32_t offset;
+        //!\brief The number of bytes of the complete tag (tag, type and value).
+        uint32_t size;
+    };
+
+public:
+    //!\brief An input iterator over the dictionary that decodes the tags on access.
+    class iterator
+    {
+    public:
+        /*!\name Associated types
+         * \{
+         */
+        using value_type = flat_sam_tag_dictionary::value_type; //!< The decoded tag.
+        using reference = value_type; //!< Tags are decoded on access, hence the reference is a prvalue.
+        using pointer = void; //!< No pointer type.
+        using difference_type = std::ptrdiff_t; //!< The difference type.
+        using iterator_category = std::input_iterator_tag; //!< The iterator category.
+        //!\}
+
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        iterator() = default; //!< Defaulted.
+        iterator(iterator const &) = default; //!< Defaulted.
+        iterator(iterator &&) = default; //!< Defaulted.
+        iterator & operator=(iterator const &) = default; //!< Defaulted.
+        iterator & operator=(iterator &&) = default; //!< Defaulted.
+        ~iterator() = default; //!< Defaulted.
+
+        //!\brief Construct from the dictionary and a position in its index.
+        iterator(flat_sam_tag_dictionary const & dictionary, std::vector<entry>::const_iterator position) noexcept :
+            host{&dictionary}, it{position}
+        {}
+        //!\}
+
+        //!\brief Returns the decoded tag.
+        reference operator*() const
+        {
+            return {it->tag, host->decode(*it)};
+        }
+
+        //!\brief Pre-increment.
+        iterator & operator++() noexcept
+        {
+            ++it;
+            return *this;
+        }
+
+        //!\brief Post-increment.
+        iterator operator++(int) noexcept
+        {
+            iterator tmp{*this};
+            ++it;
+            return tmp;
+        }
+
+        //!\brief Compares the positions.
+        friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+        {
+            return lhs.it == rhs.it;
+        }
+
+        //!\brief Compares the positions.
+        friend bool operator!=(iterator const & lhs, iterator const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        //!\brief The dictionary.
+        flat_sam_tag_dictionary const * host{nullptr};
+        //!\brief The position in the index of the dictionary.
+        std::vector<entry>::const_iterator it{};
+    };
+
+    //!\brief Iterators are always constant, the values are decoded on access.
+    using const_iterator = iterator;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    flat_sam_tag_dictionary() = default; //!< Defaulted.
+    flat_sam_tag_dictionary(flat_sam_tag_dictionary const &) = default; //!< Defaulted.
+    flat_sam_tag_dictionary(flat_sam_tag_dictionary &&) = default; //!< Defaulted.
+    flat_sam_tag_dictionary & operator=(flat_sam_tag_dictionary const &) = default; //!< Defaulted.
+    flat_sam_tag_dictionary & operator=(flat_sam_tag_dictionary &&) = default; //!< Defaulted.
+    ~flat_sam_tag_dictionary() = default; //!< Defaulted.
+
+    //!\brief Construct from a seqan3::sam_tag_dictionary.
+    explicit flat_sam_tag_dictionary(sam_tag_dictionary const & dictionary)
+    {
+        for (auto & [tag, value] : dictionary)
+            set(tag, value);
+    }
+
+    //!\brief Converts the dictionary into a seqan3::sam_tag_dictionary.
+    explicit operator sam_tag_dictionary() const
+    {
+        sam_tag_dictionary dictionary{};
+
+        for (entry const & e : index)
+            dictionary.emplace(e.tag, decode(e));
+
+        return dictionary;
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first tag (ordered by tag id).
+    iterator begin() const noexcept
+    {
+        return {*this, index.begin()};
+    }
+
+    //!\brief Returns an iterator behind the last tag.
+    iterator end() const noexcept
+    {
+        return {*this, index.end()};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of tags.
+    size_type size() const noexcept
+    {
+        return index.size();
+    }
+
+    //!\brief Whether the dictionary contains no tags.
+    bool empty() const noexcept
+    {
+        return index.empty();
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    //!\brief Whether the dictionary contains the tag.
+    bool contains(uint16_t const tag) const noexcept
+    {
+        return find_entry(tag) != index.end();
+    }
+
+    //!\brief Returns the number of occurrences of the tag (0 or 1).
+    size_type count(uint16_t const tag) const noexcept
+    {
+        return contains(tag);
+    }
+
+    //!\brief Returns the decoded value of the tag.
+    //!\throws std::out_of_range if the dictionary does not contain the tag.
+    variant_type at(uint16_t const tag) const
+    {
+        auto it = find_entry(tag);
+
+        if (it == index.end())
+            throw std::out_of_range{"The SAM tag is not present in the dictionary."};
+
+        return decode(*it);
+    }
+
+    /*!\brief Returns the decoded value of a known SAM tag by its correct type instead of the std::variant.
+     * \tparam tag The unique tag id of a SAM tag.
+     * \throws std::out_of_range if the dictionary does not contain the tag.
+     * \throws std::bad_variant_access if the stored value does not have the type seqan3::sam_tag_type_t<tag>.
+     */
+    template <uint16_t tag>
+    //!\cond
+        requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
+    //!\endcond
+    sam_tag_type_t<tag> get() const
+    {
+        return std::get<sam_tag_type_t<tag>>(at(tag));
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Removes all tags; the memory is kept for reuse.
+    void clear() noexcept
+    {
+        buffer.clear();
+        index.clear();
+    }
+
+    //!\brief Sets the tag to the given value, replacing any previous value.
+    void set(uint16_t const tag, variant_type const & value)
+    {
+        erase(tag);
+
+        size_t const offset = buffer.size();
+        detail::append_bam_tag(buffer, tag, value);
+        index.insert(std::ranges::upper_bound(index, tag, std::ranges::less{}, &entry::tag),
+                     entry{tag, static_cast<uint32_t>(offset), static_cast<uint32_t>(buffer.size() - offset)});
+    }
+
+    //!\brief Sets a known SAM tag to the given value, replacing any previous value.
+    template <uint16_t tag>
+    //!\cond
+        requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
+    //!\endcond
+    void set(sam_tag_type_t<tag> value)
+    {
+        set(tag, variant_type{std::move(value)});
+    }
+
+    //!\brief Removes the tag and returns the number of removed tags (0 or 1).
+    size_type erase(uint16_t const tag)
+    {
+        auto it = find_entry(tag);
+
+        if (it == index.end())
+            return 0u;
+
+        entry const removed = *it;
+        buffer.erase(buffer.begin() + removed.offset, buffer.begin() + removed.offset + removed.size);
+        index.erase(it);
+
+        for (entry & e : index)
+            if (e.offset > removed.offset)
+                e.offset -= removed.size;
+
+        return 1u;
+    }
+    //!\}
+
+    /*!\name Raw BAM access
+     * \{
+     */
+    //!\brief Returns the tags in their BAM encoding (the auxiliary data of a BAM record).
+    std::span<char const> raw_bam_data() const noexcept
+    {
+        return {buffer.data(), buffer.size()};
+    }
+
+    /*!\brief Sets the tag to a value that is written in BAM encoding directly into the buffer of the dictionary.
+     * \tparam encoder_t The type of the encoder; must be invocable with `std::vector<char> &`.
+     * \param[in] tag     The tag id.
+     * \param[in] encoder Appends the type character(s) and the value of the tag in BAM encoding to the given buffer.
+     *
+     * \details
+     *
+     * Any previous value of the tag is replaced. This allows parsers to store a tag without creating a
+     * seqan3::sam_tag_dictionary::variant_type first. The encoding is not validated; if the encoder throws, the
+     * dictionary is left without the tag.
+     */
+    template <typename encoder_t>
+    //!\cond
+        requires std::invocable<encoder_t, std::vector<char> &>
+    //!\endcond
+    void set_bam_encoded(uint16_t const tag, encoder_t && encoder)
+    {
+        erase(tag);
+
+        size_t const offset = buffer.size();
+        buffer.push_back(static_cast<char>(tag / 256));
+        buffer.push_back(static_cast<char>(tag % 256));
+
+        try
+        {
+            encoder(buffer);
+        }
+        catch (...)
+        {
+            buffer.resize(offset);
+            throw;
+        }
+
+        index.insert(std::ranges::upper_bound(index, tag, std::ranges::less{}, &entry::tag),
+                     entry{tag, static_cast<uint32_t>(offset), static_cast<uint32_t>(buffer.size() - offset)});
+    }
+
+    /*!\brief Replaces the tags by the auxiliary data of a BAM record.
+     * \param[in] data The raw bytes; must model std::ranges::input_range over `char`.
+     * \throws seqan3::format_error if the data is not a valid sequence of BAM tags.
+     *
+     * \details
+     *
+     * The data is only copied and validated; the values are decoded on access.
+     */
+    template <std::ranges::input_range data_t>
+    //!\cond
+        requires std::convertible_to<std::ranges::range_reference_t<data_t>, char>
+    //!\endcond
+    void assign_raw_bam_data(data_t && data)
+    {
+        clear();
+
+        if constexpr (std::ranges::sized_range<data_t>)
+        {
+            buffer.resize(std::ranges::size(data));
+            std::ranges::copy(data, buffer.begin());
+        }
+        else
+        {
+            std::ranges::copy(data, std::back_inserter(buffer));
+        }
+
+        char const * const first = buffer.data();
+        char const * const last = first + buffer.size();
+
+        for (char const * it = first; it != last;)
+        {
+            if (last - it < 3)
+                throw format_error{"A BAM tag is truncated."};
+
+            uint16_t const tag = static_cast<uint16_t>(static_cast<uint8_t>(it[0])) * 256 +
+                                 static_cast<uint8_t>(it[1]);
+            size_t const size = 3u + detail::bam_tag_value_size(it[2], it + 3, last);
+            index.push_back(entry{tag, static_cast<uint32_t>(it - first), static_cast<uint32_t>(size)});
+            it += size;
+        }
+
+        std::ranges::stable_sort(index, std::ranges::less{}, &entry::tag);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Two dictionaries are equal if they contain the same tags with equal (decoded) values.
+    friend bool operator==(flat_sam_tag_dictionary const & lhs, flat_sam_tag_dictionary const & rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+
+        for (auto lit = lhs.begin(), rit = rhs.begin(); lit != lhs.end(); ++lit, ++rit)
+            if (*lit != *rit)
+                return false;
+
+        return true;
+    }
+
+    //!\brief Two dictionaries are equal if they contain the same tags with equal (decoded) values.
+    friend bool operator!=(flat_sam_tag_dictionary const & lhs, flat_sam_tag_dictionary const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+private:
+    //!\brief Returns the entry of the tag or the end of the index.
+    std::vector<entry>::const_iterator find_entry(uint16_t const tag) const noexcept
+    {
+        auto it = std::ranges::lower_bound(index, tag, std::ranges::less{}, &entry::tag);
+        return (it != index.end() && it->tag == tag) ? it : index.end();
+    }
+
+    //!\brief Decodes the value of an entry.
+    variant_type decode(entry const & e) const
+    {
+        return detail::decode_bam_tag_value(buffer[e.offset + 2], buffer.data() + e.offset + 3);
+    }
+
+    //!\brief The tags in their BAM encoding.
+    std::vector<char> buffer{};
+    //!\brief The position of every tag inside the buffer, sorted by tag.
+    std::vector<entry> index{};
+};
+
+} // namespace seqan3
@@ -27,6 +27,7 @@
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/sam_file/detail/bam_sequence_codec.hpp>
 #include <seqan3/io/sam_file/detail/cigar.hpp>
 #include <seqan3/io/sam_file/detail/format_sam_base.hpp>
 #include <seqan3/io/sam_file/header.hpp>
@@ -265,6 +266,8 @@ private:
     auto parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const;
 
     static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
+
+    static std::string get_tag_dict_str(flat_sam_tag_dictionary const & tag_dict);
 };
 
 //!\copydoc sam_file_input_format::read_alignment_record
@@ -435,23 +438,11 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (core.l_seq > 0) // sequence information is given
     {
-        auto seq_stream = stream_view
-                        | views::take_exactly_or_throw(core.l_seq / 2) // one too short if uneven
-                        | std::views::transform([] (char c) -> std::pair<sam_dna16, sam_dna16>
-                          {
-                              return {sam_dna16{}.assign_rank(std::min(15, static_cast<uint8_t>(c) >> 4)),
-                                      sam_dna16{}.assign_rank(std::min(15, static_cast<uint8_t>(c) & 0x0f))};
-                          });
+        size_t const packed_size = (core.l_seq + 1) / 2; // two bases are stored per byte
+        auto packed_view = stream_view | views::take_exactly_or_throw(packed_size);
 
         if constexpr (detail::decays_to_ignore_v<seq_type>)
         {
-            auto skip_sequence_bytes = [&] ()
-            {
-                detail::consume(seq_stream);
-                if (core.l_seq & 1)
-                    std::ranges::next(std::ranges::begin(stream_view));
-            };
-
             if constexpr (!detail::decays_to_ignore_v<align_type>)
             {
                 static_assert(sequence_container<std::remove_reference_t<decltype(get<1>(align))>>,
@@ -462,64 +453,31 @@ inline void format_bam::read_alignment_record(stream_type & stream,
                 {
                     assert(core.l_seq == (seq_length + offset_tmp + soft_clipping_end)); // sanity check
                     using alph_t = std::ranges::range_value_t<decltype(get<1>(align))>;
-                    constexpr auto from_dna16 = detail::convert_through_char_representation<alph_t, sam_dna16>;
-
-                    get<1>(align).reserve(seq_length);
-
-                    auto tmp_iter = std::ranges::begin(seq_stream);
-                    std::ranges::advance(tmp_iter, offset_tmp / 2); // skip soft clipped bases at the beginning
-
-                    if (offset_tmp & 1)
-                    {
-                        get<1>(align).push_back(from_dna16[to_rank(get<1>(*tmp_iter))]);
-                        ++tmp_iter;
-                        --seq_length;
-                    }
-
-                    for (size_t i = (seq_length / 2); i > 0; --i)
-                    {
-                        get<1>(align).push_back(from_dna16[to_rank(get<0>(*tmp_iter))]);
-                        get<1>(align).push_back(from_dna16[to_rank(get<1>(*tmp_iter))]);
-                        ++tmp_iter;
-                    }
 
-                    if (seq_length & 1)
-                    {
-                        get<1>(align).push_back(from_dna16[to_rank(get<0>(*tmp_iter))]);
-                        ++tmp_iter;
-                        --soft_clipping_end;
-                    }
-
-                    std::ranges::advance(tmp_iter, (soft_clipping_end + !(seq_length & 1)) / 2);
+                    string_buffer.resize(packed_size);
+                    std::ranges::copy(packed_view, string_buffer.begin());
+                    // skip soft clipped bases at the beginning and the end
+                    detail::bam_sequence_codec<alph_t>::decode_append(string_buffer, offset_tmp, seq_length,
+                                                                      get<1>(align));
                 }
                 else
                 {
-                    skip_sequence_bytes();
+                    detail::consume(packed_view);
                     get<1>(align) = std::remove_reference_t<decltype(get<1>(align))>{}; // assign empty container
                 }
             }
             else
             {
-                skip_sequence_bytes();
+                detail::consume(packed_view);
             }
         }
         else
         {
             using alph_t = std::ranges::range_value_t<decltype(seq)>;
-            constexpr auto from_dna16 = detail::convert_through_char_representation<alph_t, sam_dna16>;
-
-            for (auto [d1, d2] : seq_stream)
-            {
-                seq.push_back(from_dna16[to_rank(d1)]);
-                seq.push_back(from_dna16[to_rank(d2)]);
-            }
 
-            if (core.l_seq & 1)
-            {
-                sam_dna16 d = sam_dna16{}.assign_rank(std::min(15, static_cast<uint8_t>(*std::ranges::begin(stream_view)) >> 4));
-                seq.push_back(from_dna16[to_rank(d)]);
-                std::ranges::next(std::ranges::begin(stream_view));
-            }
+            string_buffer.resize(packed_size);
+            std::ranges::copy(packed_view, string_buffer.begin());
+            detail::bam_sequence_codec<alph_t>::decode_append(string_buffer, 0, core.l_seq, seq);
 
             if constexpr (!detail::decays_to_ignore_v<align_type>)
             {
@@ -542,8 +500,15 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     assert(remaining_bytes >= 0);
     auto tags_view = stream_view | views::take_exactly_or_throw(remaining_bytes);
 
-    while (tags_view.size() > 0)
-        read_field(tags_view, tag_dict);
+    if constexpr (std::same_as<tag_dict_type, flat_sam_tag_dictionary>)
+    {
+        tag_dict.assign_raw_bam_data(tags_view); // the tags are decoded on access
+    }
+    else
+    {
+        while (tags_view.size() > 0)
+            read_field(tags_view, tag_dict);
+    }
 
     // DONE READING - wrap up
     // -------------------------------------------------------------------------------------------------------------
@@ -563,19 +528,23 @@ inline void format_bam::read_alignment_record(stream_type & stream,
             }
             else
             {
-                auto it = tag_dict.find("CG"_tag);
-
-                if (it == tag_dict.end())
+                if (tag_dict.count("CG"_tag) == 0)
                     throw format_error{detail::to_string("The cigar string '", offset_tmp, "S", ref_length,
                                    "N' suggests that the cigar string exceeded 65535 elements and was therefore ",
                                    "stored in the optional field CG but this tag is not present in the given ",
                                    "record.")};
 
-                auto cigar_view = std::views::all(std::get<std::string>(it->second));
+                std::string cigar_str{};
+                if constexpr (std::same_as<tag_dict_type, flat_sam_tag_dictionary>)
+                    cigar_str = std::get<std::string>(tag_dict.at("CG"_tag));
+                else
+                    cigar_str = std::move(std::get<std::string>(tag_dict.at("CG"_tag)));
+
+                auto cigar_view = std::views::all(cigar_str);
                 std::tie(tmp_cigar_vector, ref_length, seq_length) = parse_cigar(cigar_view);
                 offset_tmp = soft_clipping_end = 0;
                 transfer_soft_clipping_to(tmp_cigar_vector, offset_tmp, soft_clipping_end);
-                tag_dict.erase(it); // remove redundant information
+                tag_dict.erase("CG"_tag); // remove redundant information
 
                 if constexpr (!detail::decays_to_ignore_v<align_type>)
                 {
@@ -685,8 +654,9 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
                   "2) a std::integral or std::optional<std::integral>, and "
                   "3) a std::integral.");
 
-    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
-                  "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary> ||
+                  std::same_as<std::remove_cvref_t<tag_dict_type>, flat_sam_tag_dictionary>,
+                  "The tag_dict object must be of type seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.");
 
     if constexpr (detail::decays_to_ignore_v<header_type>)
     {
@@ -768,10 +738,13 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
 
         if (cigar_vector.size() >= (1 << 16)) // must be written into the sam tag CG
         {
-            tag_dict["CG"_tag] = detail::get_cigar_string(cigar_vector);
+            if constexpr (std::same_as<std::remove_cvref_t<tag_dict_type>, flat_sam_tag_dictionary>)
+                tag_dict.set("CG"_tag, detail::get_cigar_string(cigar_vector));
+            else
+                tag_dict["CG"_tag] = detail::get_cigar_string(cigar_vector);
             cigar_vector.resize(2);
             cigar_vector[0] = cigar{static_cast<uint32_t>(std::ranges::distance(seq)), 'S'_cigar_operation};
-            cigar_vector[1] = cigar{static_cast<uint32_t>(std::ranges::distance(get<1>(align))), 'N'_cigar_operation};
+            cigar_vector[1] = cigar{static_cast<uint32_t>(ref_length), 'N'_cigar_operation};
         }
 
         std::string tag_dict_binary_str = get_tag_dict_str(tag_dict);
@@ -803,7 +776,7 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
         auto check_and_assign_id_to = [&header] ([[maybe_unused]] auto & id_source,
                                                  [[maybe_unused]] auto & id_target)
         {
-            using id_t = std::remove_reference_t<decltype(id_source)>;
+            using id_t = std::remove_cvref_t<decltype(id_source)>;
 
             if constexpr (!detail::decays_to_ignore_v<id_t>)
             {
@@ -884,19 +857,10 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
 
         // write seq (bit-compressed: sam_dna16 characters go into one byte)
         using alph_t = std::ranges::range_value_t<seq_type>;
-        constexpr auto to_dna16 = detail::convert_through_char_representation<sam_dna16, alph_t>;
 
-        auto sit = std::ranges::begin(seq);
-        for (int32_t sidx = 0; sidx < ((core.l_seq & 1) ? core.l_seq - 1 : core.l_seq); ++sidx, ++sit)
-        {
-            uint8_t compressed_chr = to_rank(to_dna16[to_rank(*sit)]) << 4;
-            ++sidx, ++sit;
-            compressed_chr |= to_rank(to_dna16[to_rank(*sit)]);
-            stream_it = static_cast<char>(compressed_chr);
-        }
-
-        if (core.l_seq & 1) // write one more
-            stream_it = static_cast<char>(to_rank(to_dna16[to_rank(*sit)]) << 4);
+        string_buffer.resize((core.l_seq + 1) / 2);
+        detail::bam_sequence_codec<alph_t>::encode(std::ranges::begin(seq), core.l_seq, string_buffer);
+        stream_it.write_range(string_buffer);
 
         // write qual
         if (std::ranges::empty(qual))
@@ -1243,4 +1207,18 @@ inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_d
     return result;
 }
 
+/*!\brief Returns the BAM representation of the seqan3::flat_sam_tag_dictionary.
+ * \param[in] tag_dict The tag dictionary to print.
+ *
+ * \details
+ *
+ * The dictionary already stores the tags in their binary BAM representation, e.g. tags that have been read from a
+ * BAM file are passed through unchanged.
+ */
+inline std::string format_bam::get_tag_dict_str(flat_sam_tag_dictionary const & tag_dict)
+{
+    auto data = tag_dict.raw_bam_data();
+    return std::string{data.data(), data.size()};
+}
+
 } // namespace seqan3
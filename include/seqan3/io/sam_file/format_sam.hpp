@@ -14,6 +14,7 @@
 
 #include <seqan3/std/algorithm>
 #include <seqan3/std/concepts>
+#include <cstring>
 #include <iterator>
 #include <seqan3/std/ranges>
 #include <string>
@@ -245,8 +246,35 @@ private:
     //!\brief An empty dummy container to pass to align_format.write() such that an empty field is written.
     static constexpr std::string_view dummy{};
 
+    /*!\brief Holds the default header; copies hold a new empty header, because seqan3::sam_file_header is not
+     *        copyable.
+     *
+     * \details
+     *
+     * The header is only a placeholder when reading SAM as a sequence file, so a copy of the format never needs its
+     * content. This keeps seqan3::format_sam copyable member-wise, e.g. for one format copy per parsing thread.
+     */
+    struct default_header_holder
+    {
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        default_header_holder() = default; //!< Defaulted.
+        //!\brief Copy construction creates an empty header.
+        default_header_holder(default_header_holder const &) : default_header_holder{} {}
+        //!\brief Copy assignment keeps the own header.
+        default_header_holder & operator=(default_header_holder const &) noexcept { return *this; }
+        default_header_holder(default_header_holder &&) = default; //!< Defaulted.
+        default_header_holder & operator=(default_header_holder &&) = default; //!< Defaulted.
+        ~default_header_holder() = default; //!< Defaulted.
+        //!\}
+
+        //!\brief The default header for the alignment format.
+        sam_file_header<> header{};
+    };
+
     //!\brief The default header for the alignment format.
-    sam_file_header<> default_header{};
+    default_header_holder default_header{};
 
     //!\brief Tracks whether reference information (\@SR tag) were found in the SAM header
     bool ref_info_present_in_header{false};
@@ -278,14 +306,17 @@ private:
     template <typename stream_view_type>
     void read_field(stream_view_type && stream_view, sam_tag_dictionary & target);
 
+    template <typename stream_view_type>
+    void read_field(stream_view_type && stream_view, flat_sam_tag_dictionary & target);
+
     template <typename stream_it_t, std::ranges::forward_range field_type>
     void write_range_or_asterisk(stream_it_t & stream_it, field_type && field_value);
 
     template <typename stream_it_t>
     void write_range_or_asterisk(stream_it_t & stream_it, char const * const field_value);
 
-    template <typename stream_it_t>
-    void write_tag_fields(stream_it_t & stream, sam_tag_dictionary const & tag_dict, char const separator);
+    template <typename stream_it_t, typename tag_dict_type>
+    void write_tag_fields(stream_it_t & stream, tag_dict_type const & tag_dict, char const separator);
 };
 
 //!\copydoc sequence_file_input_format::read_sequence_record
@@ -305,7 +336,7 @@ inline void format_sam::read_sequence_record(stream_type & stream,
     if constexpr (seq_qual_combined)
     {
         tmp_qual.clear();
-        read_alignment_record(stream, align_options, std::ignore, default_header, sequence, tmp_qual, id,
+        read_alignment_record(stream, align_options, std::ignore, default_header.header, sequence, tmp_qual, id,
                               std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
                               std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore);
 
@@ -314,7 +345,7 @@ inline void format_sam::read_sequence_record(stream_type & stream,
     }
     else
     {
-        read_alignment_record(stream, align_options, std::ignore, default_header, sequence, qualities, id,
+        read_alignment_record(stream, align_options, std::ignore, default_header.header, sequence, qualities, id,
                               std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore,
                               std::ignore, std::ignore, std::ignore, std::ignore, std::ignore, std::ignore);
     }
@@ -621,7 +652,8 @@ inline void format_sam::read_alignment_record(stream_type & stream,
             if (!ref_id_tmp.empty())
             {
                 assert(header.ref_dict.count(ref_id_tmp) != 0); // taken care of in check_and_assign_ref_id()
-                ref_idx = header.ref_dict[ref_id_tmp];          // get index for reference sequence
+                // use find() instead of operator[] since records may be parsed concurrently (read-only access)
+                ref_idx = header.ref_dict.find(ref_id_tmp)->second; // get index for reference sequence
             }
         }
 
@@ -741,8 +773,9 @@ inline void format_sam::write_alignment_record(stream_type & stream,
         static_assert(!detail::decays_to_ignore_v<header_type>,
                       "If you give indices as mate reference id information the header must also be present.");
 
-    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
-                  "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary> ||
+                  std::same_as<std::remove_cvref_t<tag_dict_type>, flat_sam_tag_dictionary>,
+                  "The tag_dict object must be of type seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.");
 
     // ---------------------------------------------------------------------
     // logical Requirements
@@ -1094,6 +1127,156 @@ inline void format_sam::read_field(stream_view_type && stream_view, sam_tag_dict
     }
 }
 
+/*!\brief Reads a single optional tag field into the seqan3::flat_sam_tag_dictionary.
+ * \tparam stream_view_type   The type of the stream as a view.
+ *
+ * \param[in, out] stream_view  The stream view to iterate over.
+ * \param[in, out] target       The seqan3::flat_sam_tag_dictionary to store the tag information.
+ *
+ * \throws seqan3::format_error if any unexpected character or format is encountered.
+ */
+template <typename stream_view_type>
+inline void format_sam::read_field(stream_view_type && stream_view, flat_sam_tag_dictionary & target)
+{
+    // The tag is encoded as in BAM directly into the buffer of the dictionary, see seqan3::flat_sam_tag_dictionary.
+    uint16_t tag = static_cast<uint16_t>(*std::ranges::begin(stream_view)) << 8;
+    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+    tag += static_cast<uint16_t>(*std::ranges::begin(stream_view));
+    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+    std::ranges::next(std::ranges::begin(stream_view)); // skip ':'
+    char type_id = *std::ranges::begin(stream_view);
+    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+    std::ranges::next(std::ranges::begin(stream_view)); // skip ':'
+
+    switch (type_id)
+    {
+        case 'A' : // char
+        {
+            target.set(tag, static_cast<char>(*std::ranges::begin(stream_view)));
+            std::ranges::next(std::ranges::begin(stream_view)); // skip char that has been read
+            break;
+        }
+        case 'i' : // int32_t, stored in the smallest BAM integer type
+        {
+            int32_t tmp;
+            read_field(stream_view, tmp);
+            target.set(tag, tmp);
+            break;
+        }
+        case 'f' : // float
+        {
+            float tmp;
+            read_field(stream_view, tmp);
+            target.set(tag, tmp);
+            break;
+        }
+        case 'Z' : // string, stored null-terminated
+        {
+            target.set_bam_encoded(tag, [&] (std::vector<char> & buffer)
+            {
+                buffer.push_back('Z');
+                std::ranges::copy(stream_view, std::back_inserter(buffer));
+                buffer.push_back('\0');
+            });
+            break;
+        }
+        case 'H' : // byte array, stored as null-terminated upper case hex string
+        {
+            target.set_bam_encoded(tag, [&] (std::vector<char> & buffer)
+            {
+                constexpr char hex_digits[] = "0123456789ABCDEF";
+                std::byte value;
+
+                buffer.push_back('H');
+
+                while (std::ranges::begin(stream_view) != ranges::end(stream_view)) // not fully consumed yet
+                {
+                    try
+                    {
+                        read_field(stream_view | views::take_exactly_or_throw(2), value);
+                    }
+                    catch (std::exception const & e)
+                    {
+                        throw format_error{"Hexadecimal tag has an uneven number of digits!"};
+                    }
+
+                    buffer.push_back(hex_digits[std::to_integer<uint8_t>(value) >> 4]);
+                    buffer.push_back(hex_digits[std::to_integer<uint8_t>(value) & 0xF]);
+                }
+
+                buffer.push_back('\0');
+            });
+            break;
+        }
+        case 'B' : // Array. Value type depends on second char [cCsSiIf]
+        {
+            char array_value_type_id = *std::ranges::begin(stream_view);
+            std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+            std::ranges::next(std::ranges::begin(stream_view)); // skip first ','
+
+            // Writes 'B', the value type id, the number of values and the raw values.
+            auto read_array = [&] (auto value)
+            {
+                target.set_bam_encoded(tag, [&] (std::vector<char> & buffer)
+                {
+                    buffer.push_back('B');
+                    buffer.push_back(array_value_type_id);
+
+                    size_t const count_position = buffer.size();
+                    buffer.resize(buffer.size() + sizeof(int32_t));
+                    int32_t count{};
+
+                    while (std::ranges::begin(stream_view) != ranges::end(stream_view)) // not fully consumed yet
+                    {
+                        read_field(stream_view | views::take_until(is_char<','>), value);
+                        buffer.resize(buffer.size() + sizeof(value));
+                        std::memcpy(buffer.data() + buffer.size() - sizeof(value), &value, sizeof(value));
+                        ++count;
+
+                        if (is_char<','>(*std::ranges::begin(stream_view)))
+                            std::ranges::next(std::ranges::begin(stream_view)); // skip ','
+                    }
+
+                    std::memcpy(buffer.data() + count_position, &count, sizeof(count));
+                });
+            };
+
+            switch (array_value_type_id)
+            {
+                case 'c' : // int8_t
+                    read_array(int8_t{});
+                    break;
+                case 'C' : // uint8_t
+                    read_array(uint8_t{});
+                    break;
+                case 's' : // int16_t
+                    read_array(int16_t{});
+                    break;
+                case 'S' : // uint16_t
+                    read_array(uint16_t{});
+                    break;
+                case 'i' : // int32_t
+                    read_array(int32_t{});
+                    break;
+                case 'I' : // uint32_t
+                    read_array(uint32_t{});
+                    break;
+                case 'f' : // float
+                    read_array(float{});
+                    break;
+                default:
+                    throw format_error{std::string("The first character in the numerical ") +
+                                       "id of a SAM tag must be one of [cCsSiIf] but '" + array_value_type_id +
+                                       "' was given."};
+            }
+            break;
+        }
+        default:
+            throw format_error{std::string("The second character in the numerical id of a "
+                               "SAM tag must be one of [A,i,Z,H,B,f] but '") + type_id + "' was given."};
+    }
+}
+
 /*!\brief Writes a field value to the stream.
  * \tparam stream_it_t The stream iterator type.
  * \tparam field_type  The type of the field value. Must model std::ranges::forward_range.
@@ -1131,13 +1314,14 @@ inline void format_sam::write_range_or_asterisk(stream_it_t & stream_it, char co
 
 /*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
  * \tparam stream_it_t      The stream iterator's type.
+ * \tparam tag_dict_type    seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
  *
  * \param[in,out] stream_it The stream iterator to print to.
  * \param[in]     tag_dict  The tag dictionary to print.
  * \param[in]     separator The field separator to append.
  */
-template <typename stream_it_t>
-inline void format_sam::write_tag_fields(stream_it_t & stream_it, sam_tag_dictionary const & tag_dict, char const separator)
+template <typename stream_it_t, typename tag_dict_type>
+inline void format_sam::write_tag_fields(stream_it_t & stream_it, tag_dict_type const & tag_dict, char const separator)
 {
     auto const stream_variant_fn = [&stream_it] (auto && arg) // helper to print an std::variant
     {
@@ -1186,7 +1370,7 @@ inline void format_sam::write_tag_fields(stream_it_t & stream_it, sam_tag_dictio
         }
     };
 
-    for (auto & [tag, variant] : tag_dict)
+    for (auto && [tag, variant] : tag_dict) // the flat dictionary decodes the values on access
     {
         *stream_it = separator;
 
@@ -12,12 +12,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <seqan3/std/concepts>
+#include <exception>
 #include <seqan3/std/filesystem>
 #include <fstream>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -30,9 +34,12 @@
 #include <seqan3/alphabet/quality/qualified.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/read_ahead_istream.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/record_block_reader.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/sam_file/format_bam.hpp>
+#include <seqan3/io/sam_file/flat_sam_tag_dictionary.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
 #include <seqan3/io/sam_file/input_format_concept.hpp>
 #include <seqan3/io/sam_file/record.hpp>
@@ -41,6 +48,7 @@
 #include <seqan3/range/decorator/gap_decorator.hpp>
 #include <seqan3/range/views/repeat_n.hpp>
 #include <seqan3/range/views/slice.hpp>
+#include <seqan3/utility/parallel/detail/worker_pool.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
 #include <seqan3/utility/type_traits/detail/transformation_trait_or.hpp>
@@ -108,6 +116,13 @@ namespace seqan3
  *            manually configured in order to allow for automatic type deduction from reference information input on
  *            construction.
  */
+/*!\typedef using tag_dictionary
+ * \brief The type of seqan3::field::tags; either seqan3::sam_tag_dictionary or seqan3::flat_sam_tag_dictionary.
+ *
+ * \details
+ *
+ * This member is optional, seqan3::sam_tag_dictionary is used if it is not defined.
+ */
 //!\}
 //!\cond
 template <typename t>
@@ -213,9 +228,37 @@ struct sam_file_input_default_traits
 
     //!\brief The type of the reference identifiers is deduced on construction.
     using ref_ids                               = ref_ids_t;
+
+    //!\brief The type of the SAM tag dictionary is seqan3::sam_tag_dictionary.
+    using tag_dictionary                        = sam_tag_dictionary;
     //!\}
 };
 
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\brief Exposes `traits_t::tag_dictionary` as member `type` if it is defined.
+//!\ingroup io_sam_file
+template <typename traits_t>
+struct sam_file_input_tag_dictionary
+{};
+
+//!\cond
+template <typename traits_t>
+    requires requires { typename traits_t::tag_dictionary; }
+struct sam_file_input_tag_dictionary<traits_t>
+{
+    using type = typename traits_t::tag_dictionary;
+};
+//!\endcond
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
 // ---------------------------------------------------------------------------------------------------------------------
 // sam_file_input
 // ---------------------------------------------------------------------------------------------------------------------
@@ -428,6 +471,10 @@ public:
     using cigar_type               = std::vector<cigar>;
     //!\brief The type of field::mate is fixed to std::tuple<ref_id_type, ref_offset_type, int32_t>).
     using mate_type                = std::tuple<ref_id_type, ref_offset_type, int32_t>;
+    //!\brief The type of field::tags (default: seqan3::sam_tag_dictionary, see `traits_type::tag_dictionary`).
+    using tag_dictionary_type      = detail::transformation_trait_or_t<
+                                         detail::sam_file_input_tag_dictionary<traits_type>,
+                                         sam_tag_dictionary>;
     //!\brief The type of field::evalue is fixed to double.
     using e_value_type             = double;
     //!\brief The type of field::bitscore is fixed to double.
@@ -461,7 +508,7 @@ public:
                                   quality_type,
                                   flag_type,
                                   mate_type,
-                                  sam_tag_dictionary,
+                                  tag_dictionary_type,
                                   e_value_type,
                                   bitscore_type,
                                   header_type *>;
@@ -758,6 +805,7 @@ public:
         // buffer first record
         if (!first_record_was_read)
         {
+            start_read_ahead();
             read_next_record();
             first_record_was_read = true;
         }
@@ -832,6 +880,7 @@ public:
         // make sure header is read
         if (!first_record_was_read)
         {
+            start_read_ahead();
             read_next_record();
             first_record_was_read = true;
         }
@@ -853,6 +902,9 @@ protected:
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
+        if (secondary_stream.get() == primary_stream.get()) // an uncompressed file can be read ahead directly
+            plain_file_path = filename;
+
         detail::set_format(format, filename);
     }
 
@@ -895,6 +947,9 @@ protected:
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
 
+    //!\brief The path of the file if it was opened by filename and is not compressed; empty otherwise.
+    std::filesystem::path plain_file_path{};
+
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
     //!\brief File is one position behind the last record.
@@ -953,9 +1008,214 @@ protected:
     }
     //!\}
 
+    /*!\name Parallel parsing
+     * \{
+     */
+    //!\brief The format type that supports parallel parsing.
+    using parallel_format_type = detail::sam_file_input_format_exposer<format_sam>;
+
+    //!\brief The state needed to parse blocks of SAM records concurrently (see seqan3::sam_file_input_options).
+    struct parallel_parsing_state
+    {
+        //!\brief Creates the threads for parsing the chunks.
+        explicit parallel_parsing_state(size_t const thread_count) : workers{thread_count}
+        {}
+
+        //!\brief The threads parsing the chunks together with the calling thread; reused for all blocks.
+        detail::worker_pool workers;
+        //!\brief Reads blocks of complete lines from the (decompressed) stream.
+        detail::record_block_reader<stream_char_type> block_reader{};
+        //!\brief The current block split into one chunk per thread.
+        std::vector<std::span<stream_char_type const>> chunks{};
+        //!\brief One format object per thread (the formats keep parsing buffers).
+        std::vector<parallel_format_type> formats{};
+        //!\brief The parsed records per chunk; the records are reused across blocks.
+        std::vector<std::vector<record_type>> records{};
+        //!\brief The number of valid records per chunk.
+        std::vector<size_t> record_counts{};
+        //!\brief An exception thrown while parsing the respective chunk; rethrown after its valid records.
+        std::vector<std::exception_ptr> errors{};
+        //!\brief The chunk containing the next record to hand out.
+        size_t current_chunk{0};
+        //!\brief The position of the next record to hand out in the current chunk.
+        size_t current_record{0};
+    };
+
+    //!\brief The parallel parsing state; only set if parallel parsing is active.
+    std::unique_ptr<parallel_parsing_state> parallel_state{nullptr};
+
+    /*!\brief Activates parallel parsing after the header was read if requested and possible.
+     *
+     * \details
+     *
+     * Records can only be parsed concurrently if the header is never modified while parsing, i.e. if reference
+     * information is available. Otherwise, unknown reference ids are appended to the header.
+     */
+    void init_parallel_parsing()
+    {
+        if constexpr (list_traits::contains<format_sam, valid_formats>)
+        {
+            if (options.thread_count < 2u || !std::holds_alternative<parallel_format_type>(format))
+                return;
+
+            if (std::same_as<typename traits_type::ref_sequences, ref_info_not_given> && header_ptr->ref_id_info.empty())
+                return;
+
+            parallel_state = std::make_unique<parallel_parsing_state>(options.thread_count);
+            parallel_state->formats.resize(options.thread_count, std::get<parallel_format_type>(format));
+        }
+    }
+
+    //!\brief Reads the next block from the stream and parses its chunks concurrently.
+    void parse_next_block()
+    {
+        parallel_parsing_state & state = *parallel_state;
+
+        auto block = state.block_reader.read_block(*secondary_stream);
+        detail::record_block_reader<stream_char_type>::split(block, state.formats.size(), state.chunks);
+
+        size_t const chunk_count = state.chunks.size();
+        if (state.records.size() < chunk_count)
+            state.records.resize(chunk_count);
+        state.record_counts.assign(chunk_count, 0u);
+        state.errors.assign(chunk_count, nullptr);
+        state.current_chunk = 0u;
+        state.current_record = 0u;
+
+        auto parse_chunk = [this, &state] (size_t const chunk_id)
+        {
+            try
+            {
+                // The records are parsed directly from the block, no data is copied into a stream buffer.
+                detail::memory_istreambuf<stream_char_type> chunk_buffer{state.chunks[chunk_id]};
+                std::basic_istream<stream_char_type> chunk_stream{&chunk_buffer};
+                std::vector<record_type> & records = state.records[chunk_id];
+                size_t & record_count = state.record_counts[chunk_id];
+
+                while (!chunk_buffer.exhausted())
+                {
+                    if (record_count == records.size())
+                        records.emplace_back();
+
+                    record_type & record = records[record_count];
+                    record.clear();
+                    detail::get_or_ignore<field::header_ptr>(record) = header_ptr.get();
+                    read_record(chunk_stream, state.formats[chunk_id], record);
+                    ++record_count;
+                }
+            }
+            catch (...)
+            {
+                state.errors[chunk_id] = std::current_exception();
+            }
+        };
+
+        state.workers.run(chunk_count, parse_chunk);
+    }
+
+    //!\brief Moves the next record of the parsed block into the record buffer, parsing a new block if needed.
+    void read_next_record_parallel()
+    {
+        parallel_parsing_state & state = *parallel_state;
+
+        for (;;)
+        {
+            if (state.current_chunk == state.chunks.size())
+            {
+                parse_next_block();
+
+                if (state.chunks.empty())
+                {
+                    record_buffer.clear();
+                    at_end = true;
+                    return;
+                }
+            }
+
+            if (state.current_record < state.record_counts[state.current_chunk])
+                break;
+
+            // all records of this chunk have been handed out
+            std::exception_ptr error = std::exchange(state.errors[state.current_chunk], nullptr);
+            ++state.current_chunk;
+            state.current_record = 0u;
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        // swap instead of move to reuse the memory of the previous record
+        std::swap(record_buffer, state.records[state.current_chunk][state.current_record]);
+        ++state.current_record;
+    }
+    //!\}
+
+    /*!\brief Reads a single record from `stream` with the format `f` into `record`.
+     * \details `record` may be any seqan3::record, the fields that it does not contain are skipped by the format.
+     */
+    template <typename stream_t, typename format_t, typename record_t>
+    void read_record(stream_t & stream, format_t & f, record_t & record)
+    {
+        auto call_read_func = [&] (auto & ref_seq_info)
+        {
+            f.read_alignment_record(stream,
+                                    options,
+                                    ref_seq_info,
+                                    *header_ptr,
+                                    detail::get_or_ignore<field::seq>(record),
+                                    detail::get_or_ignore<field::qual>(record),
+                                    detail::get_or_ignore<field::id>(record),
+                                    detail::get_or_ignore<field::offset>(record),
+                                    detail::get_or_ignore<field::ref_seq>(record),
+                                    detail::get_or_ignore<field::ref_id>(record),
+                                    detail::get_or_ignore<field::ref_offset>(record),
+                                    detail::get_or_ignore<field::alignment>(record),
+                                    detail::get_or_ignore<field::cigar>(record),
+                                    detail::get_or_ignore<field::flag>(record),
+                                    detail::get_or_ignore<field::mapq>(record),
+                                    detail::get_or_ignore<field::mate>(record),
+                                    detail::get_or_ignore<field::tags>(record),
+                                    detail::get_or_ignore<field::evalue>(record),
+                                    detail::get_or_ignore<field::bit_score>(record));
+        };
+
+        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+            call_read_func(*reference_sequences_ptr);
+        else
+            call_read_func(std::ignore);
+    }
+
+    //!\brief Replaces the secondary stream by a stream that reads ahead on a background thread, if requested.
+    void start_read_ahead()
+    {
+        if (options.read_ahead_buffer_count == 0u)
+            return;
+
+        using read_ahead_stream_t = detail::read_ahead_istream<stream_char_type>;
+        size_t const buffer_size = std::max<size_t>(options.read_ahead_buffer_size, 1u);
+
+        if (plain_file_path.empty())
+            secondary_stream = stream_ptr_t{new read_ahead_stream_t{std::move(secondary_stream),
+                                                                    buffer_size,
+                                                                    options.read_ahead_buffer_count},
+                                            stream_deleter_default};
+        else
+            secondary_stream = stream_ptr_t{new read_ahead_stream_t{std::move(secondary_stream),
+                                                                    plain_file_path,
+                                                                    buffer_size,
+                                                                    options.read_ahead_buffer_count},
+                                            stream_deleter_default};
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
+        if (parallel_state != nullptr)
+        {
+            read_next_record_parallel();
+            return;
+        }
+
         // clear the record
         record_buffer.clear();
         detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
@@ -968,38 +1228,12 @@ protected:
             return;
         }
 
-        auto call_read_func = [this] (auto & ref_seq_info)
-        {
-            std::visit([&] (auto & f)
-            {
-                f.read_alignment_record(*secondary_stream,
-                                        options,
-                                        ref_seq_info,
-                                        *header_ptr,
-                                        detail::get_or_ignore<field::seq>(record_buffer),
-                                        detail::get_or_ignore<field::qual>(record_buffer),
-                                        detail::get_or_ignore<field::id>(record_buffer),
-                                        detail::get_or_ignore<field::offset>(record_buffer),
-                                        detail::get_or_ignore<field::ref_seq>(record_buffer),
-                                        detail::get_or_ignore<field::ref_id>(record_buffer),
-                                        detail::get_or_ignore<field::ref_offset>(record_buffer),
-                                        detail::get_or_ignore<field::alignment>(record_buffer),
-                                        detail::get_or_ignore<field::cigar>(record_buffer),
-                                        detail::get_or_ignore<field::flag>(record_buffer),
-                                        detail::get_or_ignore<field::mapq>(record_buffer),
-                                        detail::get_or_ignore<field::mate>(record_buffer),
-                                        detail::get_or_ignore<field::tags>(record_buffer),
-                                        detail::get_or_ignore<field::evalue>(record_buffer),
-                                        detail::get_or_ignore<field::bit_score>(record_buffer));
-            }, format);
-        };
-
         assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f) { read_record(*secondary_stream, f, record_buffer); }, format);
 
-        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
-            call_read_func(*reference_sequences_ptr);
-        else
-            call_read_func(std::ignore);
+        // the header is parsed together with the first record
+        if (!first_record_was_read)
+            init_parallel_parsing();
     }
 
     //!\brief Befriend iterator so it can access the buffers.
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -22,7 +24,30 @@ namespace seqan3
 template <typename sequence_legal_alphabet>
 struct sam_file_input_options
 {
-    // options to define
+    /*!\brief The number of threads used to parse SAM records [default: 1, i.e. sequential parsing].
+     *
+     * \details
+     *
+     * If greater than one, seqan3::format_sam reads large blocks from the stream and parses them concurrently
+     * directly from memory; the records are still returned in file order. This requires reference information, i.e.
+     * either `@SQ` lines in the header or reference sequences given on construction, since otherwise new reference
+     * ids would need to be added to the header while reading. If this is not the case, the file is read sequentially.
+     * The option has no effect on other formats.
+     */
+    size_t thread_count{1u};
+
+    /*!\brief The number of buffers that a background thread fills ahead of the parser [default: 0, i.e. no read-ahead].
+     *
+     * \details
+     *
+     * If greater than zero, a background thread reads (and, for compressed files, decompresses) the file into this
+     * many buffers of size #read_ahead_buffer_size, while the records are parsed from the previously filled buffer.
+     * At least two buffers are needed to overlap reading and parsing. The options must be set before the first record
+     * is read; the header of seqan3::sam_file_lazy_input is always read without read-ahead.
+     */
+    size_t read_ahead_buffer_count{0u};
+    //!\brief The size in bytes of each read-ahead buffer, see #read_ahead_buffer_count.
+    size_t read_ahead_buffer_size{4u * 1024u * 1024u};
 };
 
 } // namespace seqan3
@@ -0,0 +1,444 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sam_file_lazy_input.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <seqan3/std/filesystem>
+#include <istream>
+#include <seqan3/std/span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include <seqan3/io/detail/in_file_iterator.hpp>
+#include <seqan3/io/detail/record_block_reader.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/lazy_record.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A SAM/BAM input file whose records are decoded on access.
+ * \ingroup io_sam_file
+ * \tparam traits_type_   An auxiliary type that defines certain member types and constants, must model
+ *                        seqan3::sam_file_input_traits.
+ * \tparam valid_formats_ A seqan3::type_list of the selectable formats; only seqan3::format_sam and
+ *                        seqan3::format_bam are supported.
+ * \implements std::ranges::input_range
+ *
+ * \details
+ *
+ * seqan3::sam_file_input decodes all selected fields of every record when it is read, including the construction of
+ * the alignment. Tools that only inspect a few fields of most records, e.g. to skip unmapped or secondary
+ * alignments, do not need this. This file provides the records as seqan3::sam_lazy_record, which only stores the raw
+ * record, i.e. the line of a SAM file or the alignment block of a BAM file. The flag, the mapping quality and the
+ * positions are read directly from the raw record when they are accessed; all other fields are decoded by the
+ * format of the file on access. The field types are the same as for seqan3::sam_file_input with the same traits.
+ *
+ * The header is read on construction. Files are opened, decompressed and the format is selected as for
+ * seqan3::sam_file_input, and reference information can be given in the same way.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sam_file/sam_file_lazy_input.cpp
+ */
+template <typename traits_type_ = sam_file_input_default_traits<>,
+          detail::type_list_of_sam_file_input_formats valid_formats_ = type_list<format_sam, format_bam>>
+class sam_file_lazy_input : private sam_file_input<traits_type_, fields<field::header_ptr>, valid_formats_>
+{
+private:
+    //!\brief The file that provides the streams, the formats and the reference information.
+    using base_t = sam_file_input<traits_type_, fields<field::header_ptr>, valid_formats_>;
+
+    static_assert(list_traits::size<valid_formats_> ==
+                  list_traits::count<format_sam, valid_formats_> + list_traits::count<format_bam, valid_formats_>,
+                  "The seqan3::sam_file_lazy_input only supports seqan3::format_sam and seqan3::format_bam.");
+
+public:
+    /*!\name Template arguments
+     * \brief Exposed as member types for public access.
+     * \{
+     */
+    //!\brief A traits type that defines aliases and template for storage of the fields.
+    using traits_type      = traits_type_;
+    //!\brief A seqan3::type_list with the possible formats.
+    using valid_formats    = valid_formats_;
+    //!\brief Character type of the stream(s).
+    using stream_char_type = char;
+    //!\}
+
+    /*!\name Field types and record type
+     * \brief The types of the decoded fields, see seqan3::sam_file_input.
+     * \{
+     */
+    using typename base_t::sequence_type;
+    using typename base_t::id_type;
+    using typename base_t::offset_type;
+    using typename base_t::ref_sequence_type;
+    using typename base_t::ref_id_type;
+    using typename base_t::ref_offset_type;
+    using typename base_t::alignment_type;
+    using typename base_t::cigar_type;
+    using typename base_t::mapq_type;
+    using typename base_t::quality_type;
+    using typename base_t::flag_type;
+    using typename base_t::mate_type;
+    using typename base_t::tag_dictionary_type;
+    using typename base_t::header_type;
+
+    //!\brief The type of the records.
+    using record_type = sam_lazy_record<sam_file_lazy_input>;
+    //!\}
+
+    /*!\name Range associated types
+     * \brief The types necessary to facilitate the behaviour of an input range (used in record-wise reading).
+     * \{
+     */
+    //!\brief The value_type is the \ref record_type.
+    using value_type        = record_type;
+    //!\brief The reference type.
+    using reference         = record_type &;
+    //!\brief The const_reference type is void, because files are not const-iterable.
+    using const_reference   = void;
+    //!\brief An unsigned integer type, usually std::size_t.
+    using size_type         = size_t;
+    //!\brief A signed integer type, usually std::ptrdiff_t.
+    using difference_type   = std::make_signed_t<size_t>;
+    //!\brief The iterator type of this view (an input iterator).
+    using iterator          = detail::in_file_iterator<sam_file_lazy_input>;
+    //!\brief The const iterator type is void, because files are not const-iterable.
+    using const_iterator    = void;
+    //!\brief The type returned by end().
+    using sentinel          = std::default_sentinel_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_file_lazy_input() = delete; //!< Deleted.
+    sam_file_lazy_input(sam_file_lazy_input const &) = delete; //!< Deleted, because the records refer to it.
+    sam_file_lazy_input(sam_file_lazy_input &&) = delete; //!< Deleted, because the records refer to it.
+    sam_file_lazy_input & operator=(sam_file_lazy_input const &) = delete; //!< Deleted.
+    sam_file_lazy_input & operator=(sam_file_lazy_input &&) = delete; //!< Deleted.
+    ~sam_file_lazy_input() = default; //!< Defaulted.
+
+    /*!\brief Opens the given file and reads the header.
+     * \param[in] filename Path to the file you wish to open; may be compressed.
+     * \throws seqan3::file_open_error If the file could not be opened, e.g. non-existent, non-readable, unknown format.
+     * \throws seqan3::format_error If the header is invalid.
+     */
+    explicit sam_file_lazy_input(std::filesystem::path filename) :
+        base_t{std::move(filename)}
+    {
+        read_header();
+    }
+
+    /*!\brief Reads the header from the given stream with the specified format.
+     * \tparam stream_t    The stream type; must model seqan3::input_stream.
+     * \tparam file_format The format of the file in the stream; must model seqan3::sam_file_input_format.
+     * \param[in] stream     The stream to operate on; may be compressed and must outlive this object.
+     * \param[in] format_tag The file format tag.
+     * \throws seqan3::format_error If the header is invalid.
+     */
+    template <input_stream stream_t, sam_file_input_format file_format>
+    //!\cond
+        requires std::same_as<typename std::remove_reference_t<stream_t>::char_type, stream_char_type>
+    //!\endcond
+    sam_file_lazy_input(stream_t & stream, file_format const & format_tag) :
+        base_t{stream, format_tag}
+    {
+        read_header();
+    }
+
+    /*!\brief Opens the given file with additional reference information and reads the header.
+     * \param[in] filename      Path to the file you wish to open; may be compressed.
+     * \param[in] ref_ids       A range containing the reference ids that correspond to the SAM/BAM file.
+     * \param[in] ref_sequences A range containing the reference sequences that correspond to the SAM/BAM file.
+     * \throws seqan3::file_open_error If the file could not be opened, e.g. non-existent, non-readable, unknown format.
+     * \throws seqan3::format_error If the header is invalid.
+     *
+     * \details
+     *
+     * The reference information is used to construct the alignment, see seqan3::sam_file_input.
+     */
+    sam_file_lazy_input(std::filesystem::path filename,
+                        typename traits_type::ref_ids & ref_ids,
+                        typename traits_type::ref_sequences & ref_sequences) :
+        base_t{std::move(filename), ref_ids, ref_sequences}
+    {
+        read_header();
+    }
+
+    /*!\brief Reads the header from the given stream with the specified format and additional reference information.
+     * \tparam stream_t    The stream type; must model seqan3::input_stream.
+     * \tparam file_format The format of the file in the stream; must model seqan3::sam_file_input_format.
+     * \param[in] stream        The stream to operate on; may be compressed and must outlive this object.
+     * \param[in] ref_ids       A range containing the reference ids that correspond to the SAM/BAM file.
+     * \param[in] ref_sequences A range containing the reference sequences that correspond to the SAM/BAM file.
+     * \param[in] format_tag    The file format tag.
+     * \throws seqan3::format_error If the header is invalid.
+     */
+    template <input_stream stream_t, sam_file_input_format file_format>
+    //!\cond
+        requires std::same_as<typename std::remove_reference_t<stream_t>::char_type, stream_char_type>
+    //!\endcond
+    sam_file_lazy_input(stream_t & stream,
+                        typename traits_type::ref_ids & ref_ids,
+                        typename traits_type::ref_sequences & ref_sequences,
+                        file_format const & format_tag) :
+        base_t{stream, ref_ids, ref_sequences, format_tag}
+    {
+        read_header();
+    }
+    //!\}
+
+    /*!\name Range interface
+     * \brief Provides functions for record based reading of the file.
+     * \{
+     */
+    /*!\brief Returns an iterator to current position in the file.
+     * \throws seqan3::unexpected_end_of_input If the first record is incomplete.
+     */
+    iterator begin()
+    {
+        if (!first_record_was_read)
+        {
+            this->start_read_ahead();
+            read_next_record();
+            first_record_was_read = true;
+        }
+
+        return {*this};
+    }
+
+    //!\brief Returns a sentinel for comparison with iterator.
+    sentinel end() noexcept
+    {
+        return {};
+    }
+
+    //!\brief Return the record we are currently at in the file.
+    reference front()
+    {
+        return *begin();
+    }
+    //!\}
+
+    //!\brief The options are public and its members can be set directly.
+    using base_t::options;
+
+    //!\brief Access the file's header; it is read on construction.
+    header_type & header() noexcept
+    {
+        return *this->header_ptr;
+    }
+
+private:
+    //!\brief Befriend the record so it can decode its fields.
+    friend record_type;
+
+    //!\brief The buffer for the current record.
+    record_type record_buffer{};
+    //!\brief Whether the first record was read.
+    bool first_record_was_read{false};
+    //!\brief Whether the file is one position behind the last record.
+    bool at_end{false};
+    //!\brief Whether the file is a BAM file.
+    bool binary{false};
+
+    //!\brief Reads the header with the format of the file.
+    void read_header()
+    {
+        static_assert(!std::is_move_constructible_v<sam_file_lazy_input> &&
+                      !std::is_move_assignable_v<sam_file_lazy_input>,
+                      "The records store a pointer to the file, so the file must not be movable.");
+
+        std::basic_istream<stream_char_type> & stream = *this->secondary_stream;
+        std::string & bytes = record_buffer.bytes;
+
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+            binary = std::holds_alternative<detail::sam_file_input_format_exposer<format_bam>>(this->format);
+
+        record_buffer.file = this;
+        record_buffer.binary = binary;
+        bytes.clear();
+
+        if (binary) // magic string, header text and reference information
+        {
+            if (!read_bytes(stream, 2 * sizeof(int32_t), true)) // empty file
+                return;
+
+            if (std::string_view{bytes}.substr(0, 4) != std::string_view{"BAM\1"})
+                throw format_error{"File is not in BAM format."};
+
+            read_bytes(stream, read_int32(4) + sizeof(int32_t)); // header text and n_ref
+
+            for (int32_t n_ref = read_int32(bytes.size() - sizeof(int32_t)); n_ref > 0; --n_ref)
+            {
+                read_bytes(stream, sizeof(int32_t)); // l_name
+                read_bytes(stream, read_int32(bytes.size() - sizeof(int32_t)) + sizeof(int32_t)); // name and l_ref
+            }
+        }
+        else // all lines starting with '@'
+        {
+            std::string line{};
+
+            while (stream.peek() == '@' && std::getline(stream, line))
+            {
+                bytes.append(line);
+                bytes.push_back('\n');
+            }
+
+            if (bytes.empty())
+                return;
+        }
+
+        // The format parses the header and stops because no record follows.
+        detail::memory_istreambuf<stream_char_type> buffer{std::span<char const>{bytes.data(), bytes.size()}};
+        std::basic_istream<stream_char_type> header_stream{&buffer};
+        typename base_t::record_type header_record{};
+        std::visit([&] (auto & f) { this->read_record(header_stream, f, header_record); }, this->format);
+    }
+
+    //!\brief Reads the raw bytes of the next record into the record buffer or sets `at_end`.
+    void read_next_record()
+    {
+        std::basic_istream<stream_char_type> & stream = *this->secondary_stream;
+        std::string & bytes = record_buffer.bytes;
+        bytes.clear();
+        record_buffer.reset_decoded_fields();
+
+        if (binary)
+        {
+            if (!read_bytes(stream, sizeof(int32_t), true))
+            {
+                at_end = true;
+                return;
+            }
+
+            int32_t const block_size = read_int32(0);
+
+            if (block_size < 32) // the fixed size fields of a record have 32 bytes
+                throw format_error{"[CORRUPTED BAM FILE] The alignment block is too short."};
+
+            read_bytes(stream, block_size);
+        }
+        else
+        {
+            do
+            {
+                if (!std::getline(stream, bytes))
+                {
+                    at_end = true;
+                    return;
+                }
+            } while (bytes.empty());
+
+            bytes.push_back('\n');
+        }
+    }
+
+    /*!\brief Appends `count` bytes of the stream to the record buffer.
+     * \param[in] stream The stream to read from.
+     * \param[in] count The number of bytes to read.
+     * \param[in] may_be_at_end Whether it is valid that the stream is at its end.
+     * \returns `false` if the stream was at its end and `may_be_at_end` is set, `true` otherwise.
+     * \throws seqan3::unexpected_end_of_input If the stream ends before `count` bytes were read.
+     */
+    bool read_bytes(std::basic_istream<stream_char_type> & stream, size_t const count, bool const may_be_at_end = false)
+    {
+        std::string & bytes = record_buffer.bytes;
+        size_t const old_size = bytes.size();
+
+        bytes.resize(old_size + count);
+        stream.read(bytes.data() + old_size, count);
+
+        if (static_cast<size_t>(stream.gcount()) == count)
+            return true;
+
+        if (may_be_at_end && stream.gcount() == 0)
+        {
+            bytes.resize(old_size);
+            return false;
+        }
+
+        throw unexpected_end_of_input{"The BAM file ended in the middle of a record."};
+    }
+
+    //!\brief Returns the integer at the given position of the record buffer.
+    int32_t read_int32(size_t const position) const noexcept
+    {
+        int32_t value{};
+        std::memcpy(&value, record_buffer.bytes.data() + position, sizeof(value));
+        return value;
+    }
+
+    /*!\brief Decodes a single field of a raw record with the format of the file.
+     * \tparam field_id The field to decode.
+     * \param[in] bytes The raw record.
+     * \returns The decoded field.
+     */
+    template <field field_id>
+    auto decode_field(std::string_view const bytes)
+    {
+        // The formats only compute the soft clipping at the front while parsing the CIGAR string.
+        using field_ids_t = std::conditional_t<field_id == field::offset,
+                                               fields<field::offset, field::cigar>,
+                                               fields<field_id>>;
+        using field_types_t = detail::select_types_with_ids_t<typename base_t::field_types,
+                                                              typename base_t::field_ids,
+                                                              field_ids_t>;
+
+        record<field_types_t, field_ids_t> decoded{};
+        detail::memory_istreambuf<stream_char_type> buffer{std::span<char const>{bytes.data(), bytes.size()}};
+        std::basic_istream<stream_char_type> record_stream{&buffer};
+        std::visit([&] (auto & f) { this->read_record(record_stream, f, decoded); }, this->format);
+
+        return std::move(get<field_id>(decoded));
+    }
+
+    //!\brief Befriend iterator so it can access the buffers.
+    friend iterator;
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::sam_file_lazy_input
+ * \{
+ */
+//!\brief Deduce file_format, and default the rest.
+template <input_stream stream_type, sam_file_input_format file_format>
+sam_file_lazy_input(stream_type & stream, file_format const &)
+    -> sam_file_lazy_input<typename sam_file_input<>::traits_type, // actually use the default
+                           type_list<file_format>>;
+
+//!\brief Deduce ref_sequences_t and ref_ids_t, default the rest.
+template <std::ranges::forward_range ref_ids_t, std::ranges::forward_range ref_sequences_t>
+sam_file_lazy_input(std::filesystem::path path, ref_ids_t &, ref_sequences_t &)
+    -> sam_file_lazy_input<sam_file_input_default_traits<std::remove_reference_t<ref_sequences_t>,
+                                                         std::remove_reference_t<ref_ids_t>>>;
+
+//!\brief Deduce ref_sequences_t and ref_ids_t, and file format.
+template <input_stream stream_type,
+          std::ranges::forward_range ref_ids_t,
+          std::ranges::forward_range ref_sequences_t,
+          sam_file_input_format file_format>
+sam_file_lazy_input(stream_type & stream, ref_ids_t &, ref_sequences_t &, file_format const &)
+    -> sam_file_lazy_input<sam_file_input_default_traits<std::remove_reference_t<ref_sequences_t>,
+                                                         std::remove_reference_t<ref_ids_t>>,
+                           type_list<file_format>>;
+//!\}
+
+} // namespace seqan3
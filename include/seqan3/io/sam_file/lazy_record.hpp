@@ -0,0 +1,381 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sam_lazy_record.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/charconv>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <seqan3/std/ranges>
+#include <string>
+#include <string_view>
+
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/record.hpp>
+#include <seqan3/io/sam_file/sam_flag.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A SAM/BAM record that stores the raw record and decodes the fields on access.
+ * \ingroup io_sam_file
+ * \tparam file_type The type of the file that reads the record, i.e. a specialisation of seqan3::sam_file_lazy_input.
+ *
+ * \details
+ *
+ * This is the record type of seqan3::sam_file_lazy_input. It stores the raw bytes of the record, i.e. the line of a
+ * SAM file or the alignment block of a BAM file, and provides the same member functions as seqan3::sam_record.
+ * Nothing is decoded when the record is read:
+ *
+ * * id(), flag(), mapping_quality(), reference_id(), reference_position(), mate_reference_id(), mate_position() and
+ *   template_length() only read the respective integers of the BAM record or parse the respective column of the SAM
+ *   line. They are cheap enough to filter records, e.g. to skip unmapped or secondary alignments.
+ * * sequence(), base_qualities(), sequence_position(), cigar_sequence(), alignment() and tags() parse the raw record
+ *   with the format of the file when they are called for the first time. The decoded field is cached in the record,
+ *   such that subsequent calls return a reference to it, until the file moves on to the next record. The types of the
+ *   fields are those of the file, e.g. seqan3::sam_file_lazy_input::sequence_type.
+ *
+ * Records can be copied and remain valid after the file has moved on to the next record; the copies keep the fields
+ * that were decoded so far. The decoding member functions use the format and the header of the file, so the file must
+ * outlive the records and the fields of different records must not be decoded concurrently. A record must not be
+ * accessed concurrently either, since decoding a field modifies its cache.
+ */
+template <typename file_type>
+class sam_lazy_record
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_lazy_record() = default; //!< Defaulted.
+    sam_lazy_record(sam_lazy_record const &) = default; //!< Defaulted.
+    sam_lazy_record(sam_lazy_record &&) = default; //!< Defaulted.
+    sam_lazy_record & operator=(sam_lazy_record const &) = default; //!< Defaulted.
+    sam_lazy_record & operator=(sam_lazy_record &&) = default; //!< Defaulted.
+    ~sam_lazy_record() = default; //!< Defaulted.
+    //!\}
+
+    /*!\name Fields that are read directly
+     * \{
+     */
+    //!\brief The identifier; refers to the raw record. (SAM Column ID: QNAME)
+    std::string_view id() const
+    {
+        std::string_view name{};
+
+        if (binary)
+        {
+            uint8_t const name_size = read_binary<uint8_t>(l_read_name_position);
+
+            if (name_size == 0u || id_position + name_size > bytes.size())
+                throw format_error{"[CORRUPTED BAM FILE] The read name exceeds the alignment block."};
+
+            name = std::string_view{bytes}.substr(id_position, name_size - 1u); // without the '\0'
+        }
+        else
+        {
+            name = sam_column(0);
+        }
+
+        return (name == "*") ? std::string_view{} : name;
+    }
+
+    //!\brief The alignment flag. (SAM Column ID: FLAG)
+    sam_flag flag() const
+    {
+        if (binary)
+            return sam_flag{read_binary<uint16_t>(flag_position)};
+        else
+            return sam_flag{parse_number<uint16_t>(sam_column(1))};
+    }
+
+    //!\brief The mapping quality of the alignment, usually a Phred-scaled score. (SAM Column ID: MAPQ)
+    uint8_t mapping_quality() const
+    {
+        if (binary)
+            return read_binary<uint8_t>(mapq_position);
+        else
+            return parse_number<uint8_t>(sam_column(4));
+    }
+
+    /*!\brief The index of the reference sequence in the header; empty for unmapped reads. (SAM Column ID: RNAME)
+     * \throws seqan3::format_error if the reference is not known.
+     */
+    std::optional<int32_t> reference_id() const
+    {
+        if (binary)
+        {
+            int32_t const index = read_binary<int32_t>(ref_id_position);
+
+            if (index < -1 || index >= static_cast<int32_t>(std::ranges::size(file->header().ref_ids())))
+                throw format_error{"[CORRUPTED BAM FILE] Reference id index '" + std::to_string(index) +
+                                   "' is not in range of header.ref_ids()."};
+
+            return (index == -1) ? std::nullopt : std::optional<int32_t>{index};
+        }
+        else
+        {
+            return sam_reference_id<field::ref_id>(sam_column(2));
+        }
+    }
+
+    /*!\brief The 0-based position of the alignment in the reference; empty for unmapped reads.
+     *        (SAM Column ID: POS)
+     */
+    std::optional<int32_t> reference_position() const
+    {
+        int32_t const position = binary ? read_binary<int32_t>(position_position)
+                                        : parse_number<int32_t>(sam_column(3)) - 1; // SAM is 1-based
+
+        if (position < -1)
+            throw format_error{"No negative values are allowed for field::ref_offset."};
+
+        return (position == -1) ? std::nullopt : std::optional<int32_t>{position};
+    }
+
+    /*!\brief The index of the reference sequence of the mate in the header. (SAM Column ID: RNEXT)
+     *
+     * \details
+     *
+     * If `RNEXT` is `=`, it returns the same as seqan3::sam_lazy_record::reference_id.
+     */
+    std::optional<int32_t> mate_reference_id() const
+    {
+        if (binary)
+        {
+            int32_t const index = read_binary<int32_t>(mate_ref_id_position);
+            return (index < 0) ? std::nullopt : std::optional<int32_t>{index};
+        }
+
+        std::string_view const name = sam_column(6);
+        return (name == "=") ? sam_reference_id<field::mate>(sam_column(2)) : sam_reference_id<field::mate>(name);
+    }
+
+    //!\brief The 0-based position of the mate in its reference; empty if the mate is unmapped. (SAM Column ID: PNEXT)
+    std::optional<int32_t> mate_position() const
+    {
+        int32_t const position = binary ? read_binary<int32_t>(mate_position_position)
+                                        : parse_number<int32_t>(sam_column(7)) - 1; // SAM is 1-based
+
+        if (position < -1)
+            throw format_error{"No negative values are allowed at the mate mapping position."};
+
+        return (position == -1) ? std::nullopt : std::optional<int32_t>{position};
+    }
+
+    //!\brief The observed template length. (SAM Column ID: TLEN)
+    int32_t template_length() const
+    {
+        if (binary)
+            return read_binary<int32_t>(template_length_position);
+        else
+            return parse_number<int32_t>(sam_column(8));
+    }
+
+    //!\brief A pointer to the seqan3::sam_file_header object of the file.
+    auto * header_ptr() const
+    {
+        return &file->header();
+    }
+    //!\}
+
+    /*!\name Fields that are decoded on access
+     * \brief The references are valid until the record is modified, e.g. when the file moves on to the next record.
+     * \{
+     */
+    //!\brief The sequence as seqan3::sam_file_lazy_input::sequence_type. (SAM Column ID: SEQ)
+    typename file_type::sequence_type const & sequence() const
+    {
+        return decoded<field::seq>(sequence_cache);
+    }
+
+    //!\brief The qualities as seqan3::sam_file_lazy_input::quality_type. (SAM Column ID: QUAL)
+    typename file_type::quality_type const & base_qualities() const
+    {
+        return decoded<field::qual>(qualities_cache);
+    }
+
+    //!\brief The number of soft clipped bases at the begin of the sequence (seqan3::field::offset).
+    typename file_type::offset_type const & sequence_position() const
+    {
+        return decoded<field::offset>(offset_cache);
+    }
+
+    //!\brief The cigar vector (std::vector<seqan3::cigar>) representing the alignment. (SAM Column ID: CIGAR)
+    typename file_type::cigar_type const & cigar_sequence() const
+    {
+        return decoded<field::cigar>(cigar_cache);
+    }
+
+    //!\brief The alignment, constructed from the CIGAR string and the reference information of the file.
+    typename file_type::alignment_type const & alignment() const
+    {
+        return decoded<field::alignment>(alignment_cache);
+    }
+
+    //!\brief The optional tags as seqan3::sam_file_lazy_input::tag_dictionary_type.
+    typename file_type::tag_dictionary_type const & tags() const
+    {
+        return decoded<field::tags>(tags_cache);
+    }
+    //!\}
+
+    /*!\brief The raw record.
+     *
+     * \details
+     *
+     * For BAM files, this is the alignment block including the leading `block_size`. For SAM files, this is the line
+     * including the line break.
+     */
+    std::string_view raw_record() const noexcept
+    {
+        return bytes;
+    }
+
+private:
+    /*!\name Positions of the fixed size fields in the raw BAM record (including the leading block_size)
+     * \{
+     */
+    static constexpr size_t ref_id_position{4u};            //!< refID
+    static constexpr size_t position_position{8u};          //!< pos
+    static constexpr size_t l_read_name_position{12u};      //!< l_read_name
+    static constexpr size_t mapq_position{13u};             //!< mapq
+    static constexpr size_t flag_position{18u};             //!< flag
+    static constexpr size_t mate_ref_id_position{24u};      //!< next_refID
+    static constexpr size_t mate_position_position{28u};    //!< next_pos
+    static constexpr size_t template_length_position{32u};  //!< tlen
+    static constexpr size_t id_position{36u};               //!< read_name
+    //!\}
+
+    //!\brief The raw record.
+    std::string bytes{};
+    /*!\brief The file that read the record.
+     *
+     * \details
+     *
+     * seqan3::sam_file_lazy_input can neither be copied nor moved, so this pointer stays valid as long as the file
+     * exists.
+     */
+    file_type * file{nullptr};
+    //!\brief Whether the record is a BAM record.
+    bool binary{false};
+
+    /*!\name Decoded fields
+     * \brief Empty until the respective field is accessed for the first time.
+     * \{
+     */
+    mutable std::optional<typename file_type::sequence_type> sequence_cache{};   //!< field::seq
+    mutable std::optional<typename file_type::quality_type> qualities_cache{};   //!< field::qual
+    mutable std::optional<typename file_type::offset_type> offset_cache{};       //!< field::offset
+    mutable std::optional<typename file_type::cigar_type> cigar_cache{};         //!< field::cigar
+    mutable std::optional<typename file_type::alignment_type> alignment_cache{}; //!< field::alignment
+    mutable std::optional<typename file_type::tag_dictionary_type> tags_cache{}; //!< field::tags
+    //!\}
+
+    //!\brief Decodes the field into the cache unless it was decoded before.
+    template <field field_id, typename field_type>
+    field_type const & decoded(std::optional<field_type> & cache) const
+    {
+        if (!cache.has_value())
+            cache.emplace(file->template decode_field<field_id>(bytes));
+
+        return *cache;
+    }
+
+    //!\brief Discards the decoded fields; called by the file before it reads the next record into this record.
+    void reset_decoded_fields() noexcept
+    {
+        sequence_cache.reset();
+        qualities_cache.reset();
+        offset_cache.reset();
+        cigar_cache.reset();
+        alignment_cache.reset();
+        tags_cache.reset();
+    }
+
+    //!\brief Reads a fixed size field of the raw BAM record.
+    template <typename number_type>
+    number_type read_binary(size_t const position) const noexcept
+    {
+        number_type value{};
+        std::memcpy(&value, bytes.data() + position, sizeof(value));
+        return value;
+    }
+
+    //!\brief Returns the column with the given index of the SAM line.
+    std::string_view sam_column(size_t const index) const
+    {
+        std::string_view line{bytes};
+
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+            line.remove_suffix(1);
+
+        size_t begin{0u};
+        for (size_t column = 0; column < index; ++column)
+        {
+            begin = line.find('\t', begin);
+
+            if (begin == std::string_view::npos)
+                throw format_error{"[CORRUPTED SAM FILE] The record has less than " + std::to_string(index + 1) +
+                                   " columns."};
+            ++begin;
+        }
+
+        return line.substr(begin, line.find('\t', begin) - begin);
+    }
+
+    //!\brief Parses a numeric column of the SAM line.
+    template <typename number_type>
+    static number_type parse_number(std::string_view const column)
+    {
+        number_type value{};
+        std::from_chars_result const result = std::from_chars(column.data(), column.data() + column.size(), value);
+
+        if (result.ec != std::errc{} || result.ptr != column.data() + column.size())
+            throw format_error{"[CORRUPTED SAM FILE] The string '" + std::string{column} +
+                               "' could not be cast into an integer."};
+
+        return value;
+    }
+
+    /*!\brief Looks up the reference name of the SAM line in the header.
+     * \tparam field_id The field that contains the reference id if the name is not found in the header.
+     *
+     * \details
+     *
+     * Names that are not in the header are passed to the format by decoding `field_id`, which either appends the name
+     * to the header or throws, as if the record was read by seqan3::sam_file_input.
+     */
+    template <field field_id>
+    std::optional<int32_t> sam_reference_id(std::string_view const name) const
+    {
+        if (name == "*")
+            return std::nullopt;
+
+        auto & header = file->header();
+        using reference_name_type = std::ranges::range_value_t<decltype(header.ref_ids())>;
+
+        if (auto it = header.ref_dict.find(reference_name_type{name.begin(), name.end()}); it != header.ref_dict.end())
+            return it->second;
+
+        if constexpr (field_id == field::mate)
+            return std::get<0>(file->template decode_field<field::mate>(bytes));
+        else
+            return file->template decode_field<field::ref_id>(bytes);
+    }
+
+    //!\brief Befriend the file that fills the record.
+    friend file_type;
+};
+
+} // namespace seqan3
@@ -12,15 +12,21 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <seqan3/std/filesystem>
+#include <exception>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <seqan3/std/ranges>
 #include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
 
+#include <seqan3/io/detail/memory_ostreambuf.hpp>
 #include <seqan3/io/detail/misc_output.hpp>
 #include <seqan3/io/detail/out_file_iterator.hpp>
 #include <seqan3/io/detail/record.hpp>
@@ -34,6 +40,7 @@
 #include <seqan3/io/sam_file/output_options.hpp>
 #include <seqan3/io/sam_file/sam_flag.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/utility/parallel/detail/worker_pool.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
 
@@ -240,8 +247,24 @@ public:
     sam_file_output(sam_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     sam_file_output & operator=(sam_file_output &&) = default;
-    //!\brief Destructor is defaulted.
-    ~sam_file_output() = default;
+    /*!\brief Destructor; creates the compression stream if nothing has been written, such that an empty compressed
+     *        file is still valid.
+     *
+     * \details
+     *
+     * Errors cannot be reported from the destructor. If the compression stream of an empty file cannot be created,
+     * e.g. because no thread can be started, the file is left empty.
+     */
+    ~sam_file_output()
+    {
+        try
+        {
+            if (primary_stream) // not moved from
+                init_secondary_stream();
+        }
+        catch (...)
+        {}
+    }
 
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
@@ -280,8 +303,15 @@ public:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for writing."};
 
-        // possibly add intermediate compression stream
-        secondary_stream = detail::make_secondary_ostream(*primary_stream, filename);
+        // possibly add intermediate compression stream; it is created on first write (see init_secondary_stream())
+        // such that the compression options can still be set after construction
+        compressed_filename = filename;
+
+        if (!detail::strip_compression_extension(filename))
+        {
+            compressed_filename.clear();
+            secondary_stream = stream_ptr_t{&*primary_stream, stream_deleter_noop};
+        }
 
         // initialise format handler or throw if format is not found
         detail::set_format(format, filename);
@@ -486,25 +516,8 @@ public:
         requires detail::record_like<record_t>
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
-
-        write_record(detail::get_or<field::header_ptr>(r, nullptr),
-                     detail::get_or<field::seq>(r, std::string_view{}),
-                     detail::get_or<field::qual>(r, std::string_view{}),
-                     detail::get_or<field::id>(r, std::string_view{}),
-                     detail::get_or<field::offset>(r, 0u),
-                     detail::get_or<field::ref_seq>(r, std::string_view{}),
-                     detail::get_or<field::ref_id>(r, std::ignore),
-                     detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
-                     detail::get_or<field::alignment>(r, default_align_t{}),
-                     detail::get_or<field::cigar>(r, std::vector<cigar>{}),
-                     detail::get_or<field::flag>(r, sam_flag::none),
-                     detail::get_or<field::mapq>(r, 0u),
-                     detail::get_or<field::mate>(r, default_mate_t{}),
-                     detail::get_or<field::tags>(r, sam_tag_dictionary{}),
-                     detail::get_or<field::evalue>(r, 0u),
-                     detail::get_or<field::bit_score>(r, 0u));
+        init_secondary_stream();
+        encode_record(*secondary_stream, format, std::forward<record_t>(r));
     }
 
     /*!\brief           Write a record in form of a std::tuple to the file.
@@ -534,26 +547,8 @@ public:
         requires tuple_like<tuple_t> && (!detail::record_like<tuple_t>)
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
-
-        // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
-        write_record(detail::get_or<selected_field_ids::index_of(field::header_ptr)>(t, nullptr),
-                     detail::get_or<selected_field_ids::index_of(field::seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::qual)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::id)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::offset)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::ref_seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::ref_id)>(t, std::ignore),
-                     detail::get_or<selected_field_ids::index_of(field::ref_offset)>(t, std::optional<int32_t>{}),
-                     detail::get_or<selected_field_ids::index_of(field::alignment)>(t, default_align_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::cigar)>(t, std::vector<cigar>{}),
-                     detail::get_or<selected_field_ids::index_of(field::flag)>(t, sam_flag::none),
-                     detail::get_or<selected_field_ids::index_of(field::mapq)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::mate)>(t, default_mate_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::tags)>(t, sam_tag_dictionary{}),
-                     detail::get_or<selected_field_ids::index_of(field::evalue)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::bit_score)>(t, 0u));
+        init_secondary_stream();
+        encode_record(*secondary_stream, format, std::forward<tuple_t>(t));
     }
 
     /*!\brief            Write a record to the file by passing individual fields.
@@ -594,6 +589,9 @@ public:
      *
      * This function simply iterates over the argument and calls push_back() on each element.
      *
+     * If seqan3::sam_file_output_options::thread_count is greater than one and the range is a sized random access
+     * range, the records are encoded concurrently and appended to the file in the order of the range.
+     *
      * ### Complexity
      *
      * Linear in the number of records.
@@ -612,6 +610,15 @@ public:
         requires std::ranges::input_range<rng_t> && tuple_like<std::ranges::range_reference_t<rng_t>>
     //!\endcond
     {
+        if constexpr (std::ranges::random_access_range<rng_t> && std::ranges::sized_range<rng_t>)
+        {
+            if (options.thread_count > 1u)
+            {
+                write_range_parallel(range);
+                return *this;
+            }
+        }
+
         for (auto && record : range)
             push_back(std::forward<decltype(record)>(record));
         return *this;
@@ -675,6 +682,7 @@ public:
      */
     std::basic_ostream<stream_char_type> & get_stream()
     {
+        init_secondary_stream();
         return *secondary_stream;
     }
     //!\endcond
@@ -718,6 +726,21 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief The file name including the compression extension until the compression stream has been created.
+    std::filesystem::path compressed_filename{};
+
+    //!\brief Creates the compression stream with the compression options on first use.
+    void init_secondary_stream()
+    {
+        if (compressed_filename.empty())
+            return;
+
+        secondary_stream = detail::make_secondary_ostream(*primary_stream,
+                                                          compressed_filename,
+                                                          options.compression_thread_count,
+                                                          options.compression_level);
+        compressed_filename.clear();
+    }
 
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
@@ -761,40 +784,273 @@ protected:
         }
     }
 
+    /*!\brief Writes a seqan3::record or a tuple of the selected fields to the given stream.
+     * \param[in,out] stream The stream to write to.
+     * \param[in,out] f The format variant to write with; the formats track whether the header was written.
+     * \param[in] r The record or tuple to write.
+     */
+    template <typename record_t>
+    void encode_record(std::basic_ostream<stream_char_type> & stream, format_type & f, record_t && r)
+    {
+        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
+        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+
+        if constexpr (detail::record_like<record_t>)
+        {
+            write_record(stream,
+                         f,
+                         detail::get_or<field::header_ptr>(r, nullptr),
+                         detail::get_or<field::seq>(r, std::string_view{}),
+                         detail::get_or<field::qual>(r, std::string_view{}),
+                         detail::get_or<field::id>(r, std::string_view{}),
+                         detail::get_or<field::offset>(r, 0u),
+                         detail::get_or<field::ref_seq>(r, std::string_view{}),
+                         detail::get_or<field::ref_id>(r, std::ignore),
+                         detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
+                         detail::get_or<field::alignment>(r, default_align_t{}),
+                         detail::get_or<field::cigar>(r, std::vector<cigar>{}),
+                         detail::get_or<field::flag>(r, sam_flag::none),
+                         detail::get_or<field::mapq>(r, 0u),
+                         detail::get_or<field::mate>(r, default_mate_t{}),
+                         detail::get_or<field::tags>(r, sam_tag_dictionary{}),
+                         detail::get_or<field::evalue>(r, 0u),
+                         detail::get_or<field::bit_score>(r, 0u));
+        }
+        else
+        {
+            // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
+            write_record(stream,
+                         f,
+                         detail::get_or<selected_field_ids::index_of(field::header_ptr)>(r, nullptr),
+                         detail::get_or<selected_field_ids::index_of(field::seq)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::qual)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::id)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::offset)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::ref_seq)>(r, std::string_view{}),
+                         detail::get_or<selected_field_ids::index_of(field::ref_id)>(r, std::ignore),
+                         detail::get_or<selected_field_ids::index_of(field::ref_offset)>(r, std::optional<int32_t>{}),
+                         detail::get_or<selected_field_ids::index_of(field::alignment)>(r, default_align_t{}),
+                         detail::get_or<selected_field_ids::index_of(field::cigar)>(r, std::vector<cigar>{}),
+                         detail::get_or<selected_field_ids::index_of(field::flag)>(r, sam_flag::none),
+                         detail::get_or<selected_field_ids::index_of(field::mapq)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::mate)>(r, default_mate_t{}),
+                         detail::get_or<selected_field_ids::index_of(field::tags)>(r, sam_tag_dictionary{}),
+                         detail::get_or<selected_field_ids::index_of(field::evalue)>(r, 0u),
+                         detail::get_or<selected_field_ids::index_of(field::bit_score)>(r, 0u));
+        }
+    }
+
     //!\brief Write record to format.
     template <typename record_header_ptr_t, typename ...pack_type>
-    void write_record(record_header_ptr_t && record_header_ptr, pack_type && ...remainder)
+    void write_record(std::basic_ostream<stream_char_type> & stream,
+                      format_type & f,
+                      record_header_ptr_t && record_header_ptr,
+                      pack_type && ...remainder)
     {
         static_assert((sizeof...(pack_type) == 15), "Wrong parameter list passed to write_record.");
 
-        assert(!format.valueless_by_exception());
+        assert(!f.valueless_by_exception());
 
-        std::visit([&] (auto & f)
+        std::visit([&] (auto & format_)
         {
             // use header from record if explicitly given, e.g. file_output = file_input
             if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
             {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         *record_header_ptr,
-                                         std::forward<pack_type>(remainder)...);
+                format_.write_alignment_record(stream,
+                                               options,
+                                               *record_header_ptr,
+                                               std::forward<pack_type>(remainder)...);
             }
             else if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
             {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         std::ignore,
-                                         std::forward<pack_type>(remainder)...);
+                format_.write_alignment_record(stream,
+                                               options,
+                                               std::ignore,
+                                               std::forward<pack_type>(remainder)...);
             }
             else
             {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         *header_ptr,
-                                         std::forward<pack_type>(remainder)...);
+                format_.write_alignment_record(stream,
+                                               options,
+                                               *header_ptr,
+                                               std::forward<pack_type>(remainder)...);
+            }
+        }, f);
+    }
+
+    /*!\name Parallel encoding
+     * \{
+     */
+    //!\brief The number of records that are encoded into one chunk.
+    static constexpr size_t records_per_chunk{4096u};
+
+    //!\brief The state needed to encode chunks of records concurrently (see seqan3::sam_file_output_options).
+    struct parallel_encoding_state
+    {
+        //!\brief Creates the threads for encoding the chunks.
+        explicit parallel_encoding_state(size_t const thread_count) :
+            workers{thread_count},
+            buffers(2u * thread_count),
+            valid_sizes(2u * thread_count),
+            errors(2u * thread_count)
+        {}
+
+        /*!\brief The number of chunks that are encoded or wait to be written at the same time.
+         *
+         * \details
+         *
+         * Chunk `i` uses slot `i % slot_count()` and is only encoded after chunk `i - slot_count()` was written.
+         */
+        size_t slot_count() const noexcept
+        {
+            return buffers.size();
+        }
+
+        //!\brief The threads encoding the chunks together with the calling thread; reused for all ranges.
+        detail::worker_pool workers;
+        //!\brief One format object per slot (the formats keep encoding buffers).
+        std::vector<format_type> formats{};
+        //!\brief The encoded records per slot.
+        std::vector<detail::memory_ostreambuf<stream_char_type>> buffers;
+        //!\brief The number of bytes of the respective buffer that belong to completely encoded records.
+        std::vector<size_t> valid_sizes;
+        //!\brief An exception thrown while encoding the chunk of the respective slot.
+        std::vector<std::exception_ptr> errors;
+        //!\brief Whether the chunk of the respective slot is encoded and waits to be written.
+        std::vector<bool> encoded{};
+
+        //!\brief Protects the members below and the flags of `encoded`.
+        std::mutex mutex{};
+        //!\brief Signals that a chunk was written, i.e. its slot can be reused.
+        std::condition_variable chunk_written{};
+        //!\brief The chunk that is appended to the file next.
+        size_t next_chunk{0u};
+        //!\brief Whether a thread is currently appending chunks to the file.
+        bool writing{false};
+        //!\brief The first exception in the order of the records; no further chunks are encoded or written.
+        std::exception_ptr error{nullptr};
+    };
+
+    //!\brief The state of the parallel encoding; created on the first use.
+    std::unique_ptr<parallel_encoding_state> parallel_state{nullptr};
+
+    /*!\brief Encodes the records of a random access range concurrently and appends them to the file in order.
+     * \param[in] range The records to write.
+     *
+     * \details
+     *
+     * The range is split into chunks of `records_per_chunk` records, which are encoded by the persistent threads of a
+     * seqan3::detail::worker_pool, each with its own copy of the format into its own memory buffer. The thread that
+     * finishes the chunk that is next in the order of the range appends it and all following chunks that are already
+     * encoded to the (possibly compressing) stream, while the other threads continue to encode the next chunks. If a
+     * record cannot be encoded, all records before it are written and the exception is rethrown.
+     */
+    template <typename rng_t>
+    void write_range_parallel(rng_t & range)
+    {
+        size_t const record_count = std::ranges::size(range);
+
+        if (record_count == 0u)
+            return;
+
+        init_secondary_stream();
+        auto records = std::ranges::begin(range);
+
+        // The formats write the header together with the first record, the copies then only write records.
+        encode_record(*secondary_stream, format, records[0]);
+
+        if (parallel_state == nullptr || parallel_state->workers.thread_count() != options.thread_count)
+            parallel_state = std::make_unique<parallel_encoding_state>(options.thread_count);
+
+        parallel_encoding_state & state = *parallel_state;
+        state.formats.assign(state.slot_count(), format);
+        state.encoded.assign(state.slot_count(), false);
+        state.next_chunk = 0u;
+        state.writing = false;
+        state.error = nullptr;
+
+        size_t const chunk_count = (record_count - 1u + records_per_chunk - 1u) / records_per_chunk;
+
+        // Appends the encoded chunks in order, starting with state.next_chunk; the lock is released while writing.
+        auto write_chunks = [&] (std::unique_lock<std::mutex> & lock)
+        {
+            state.writing = true;
+
+            for (size_t slot = state.next_chunk % state.slot_count();
+                 !state.error && state.next_chunk < chunk_count && state.encoded[slot];
+                 slot = state.next_chunk % state.slot_count())
+            {
+                lock.unlock();
+
+                std::exception_ptr chunk_error{state.errors[slot]};
+                try
+                {
+                    secondary_stream->write(state.buffers[slot].written().data(), state.valid_sizes[slot]);
+                }
+                catch (...)
+                {
+                    chunk_error = std::current_exception();
+                }
+
+                lock.lock();
+                state.encoded[slot] = false;
+                state.error = chunk_error;
+                ++state.next_chunk;
+                state.chunk_written.notify_all();
+            }
+
+            state.writing = false;
+        };
+
+        auto encode_chunk = [&] (size_t const chunk_id)
+        {
+            size_t const slot = chunk_id % state.slot_count();
+
+            {
+                std::unique_lock lock{state.mutex};
+                state.chunk_written.wait(lock, [&] ()
+                {
+                    return state.error || chunk_id < state.next_chunk + state.slot_count();
+                });
+
+                if (state.error)
+                    return;
+            }
+
+            state.buffers[slot].clear();
+            state.valid_sizes[slot] = 0u;
+            state.errors[slot] = nullptr;
+
+            try
+            {
+                std::basic_ostream<stream_char_type> chunk_stream{&state.buffers[slot]};
+                size_t const chunk_begin = 1u + chunk_id * records_per_chunk;
+                size_t const chunk_end = std::min(record_count, chunk_begin + records_per_chunk);
+
+                for (size_t i = chunk_begin; i < chunk_end; ++i)
+                {
+                    encode_record(chunk_stream, state.formats[slot], records[i]);
+                    state.valid_sizes[slot] = state.buffers[slot].written().size();
+                }
+            }
+            catch (...)
+            {
+                state.errors[slot] = std::current_exception();
             }
-        }, format);
+
+            std::unique_lock lock{state.mutex};
+            state.encoded[slot] = true;
+
+            if (!state.writing)
+                write_chunks(lock);
+        };
+
+        state.workers.run(chunk_count, encode_chunk);
+
+        if (state.error)
+            std::rethrow_exception(std::exchange(state.error, nullptr));
     }
+    //!\}
 
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
+#include <seqan3/io/detail/compression_level.hpp>
 
 namespace seqan3
 {
@@ -39,6 +42,38 @@ struct sam_file_output_options
      * `false`.
      */
     bool sam_require_header = true;
+
+    /*!\brief The number of threads used to compress BGZF output, i.e. BAM files and files ending in ".gz" or ".bgzf".
+     *
+     * \details
+     *
+     * The default of 0 uses seqan3::contrib::bgzf_thread_count (the number of hardware threads). The compression
+     * stream is created on the first write, so this member can be set directly after constructing the file.
+     */
+    size_t compression_thread_count = 0;
+
+    /*!\brief The compression level of BGZF output in [0, 9].
+     *
+     * \details
+     *
+     * Level 0 stores the data uncompressed (but still BGZF framed) and level 1 (the default) is the fastest level
+     * that actually compresses; these are good choices for intermediate files. Higher levels produce smaller files
+     * at the cost of (considerably) more time. Like the compression_thread_count it must be set before the first
+     * write.
+     */
+    int compression_level = detail::default_compression_level;
+
+    /*!\brief The number of threads used to encode records when a range of records is written.
+     *
+     * \details
+     *
+     * If it is greater than one, assigning a sized random access range of records to the file (e.g. a std::vector
+     * of records) encodes the records concurrently into memory buffers, which are appended to the file in the order
+     * of the range. This is independent of the compression_thread_count, which parallelises the compression of the
+     * encoded records. Single records written via push_back() and other ranges are always encoded by the calling
+     * thread.
+     */
+    size_t thread_count = 1;
 };
 
 } // namespace seqan3
@@ -0,0 +1,622 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sam_file_sorter.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cstdint>
+#include <cstring>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <random>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/io/detail/memory_ostreambuf.hpp>
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/misc_output.hpp>
+#include <seqan3/io/detail/record_like.hpp>
+#include <seqan3/io/detail/safe_filesystem_entry.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/io/sam_file/sorter_options.hpp>
+#include <seqan3/utility/parallel/detail/worker_pool.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Writes records to a BAM file sorted by coordinate, spilling to temporary files if the memory is exhausted.
+ * \ingroup io_sam_file
+ * \tparam selected_field_ids_ A seqan3::fields type with the list and order of fields in the records;
+ *                             see seqan3::sam_file_output.
+ * \tparam ref_ids_type        The type of range over reference sequence names; must model std::ranges::forward_range.
+ *
+ * \details
+ *
+ * The sorter accepts records like seqan3::sam_file_output and writes them to a BAM file sorted by reference id and
+ * position, i.e. in the order required for `SO:coordinate`. Unmapped records without a reference id are written
+ * last. Records that compare equal keep the order in which they were pushed (the sort is stable).
+ *
+ * The records are encoded with seqan3::format_bam when they are pushed and kept in memory until their size
+ * exceeds seqan3::sam_file_sorter_options::memory_limit. The records in memory are then sorted with
+ * seqan3::sam_file_sorter_options::thread_count threads and written as a BGZF compressed run to a temporary
+ * directory. finish() writes the file: if no run was written, the records are sorted and written directly;
+ * otherwise all runs are merged, in multiple passes if there are more than
+ * seqan3::sam_file_sorter_options::merge_fan_in runs. The header of the file has its sorting set to "coordinate".
+ *
+ * The file is written by finish() or, at the latest, by the destructor. Callers must call finish() explicitly to
+ * learn about errors, because the destructor cannot report them. If writing the file fails, the incomplete file is
+ * removed in both cases, such that it cannot be mistaken for a complete BAM file.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sam_file/sam_file_sorter.cpp
+ */
+template <detail::fields_specialisation selected_field_ids_ = typename sam_file_output<>::selected_field_ids,
+          std::ranges::forward_range ref_ids_type = std::deque<std::string>>
+class sam_file_sorter
+{
+public:
+    //!\brief A seqan3::fields list with the fields selected for the record.
+    using selected_field_ids = selected_field_ids_;
+
+private:
+    //!\brief The file that encodes the records into memory.
+    using encoder_type = sam_file_output<selected_field_ids, type_list<format_bam>, ref_ids_type>;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_file_sorter() = delete; //!< Deleted.
+    sam_file_sorter(sam_file_sorter const &) = delete; //!< Deleted.
+    sam_file_sorter(sam_file_sorter &&) = delete; //!< Deleted, because the encoder refers to the buffer.
+    sam_file_sorter & operator=(sam_file_sorter const &) = delete; //!< Deleted.
+    sam_file_sorter & operator=(sam_file_sorter &&) = delete; //!< Deleted.
+
+    /*!\brief Writes the file if finish() was not called.
+     *
+     * \details
+     *
+     * Errors cannot be reported from the destructor. If writing the file fails, the incomplete file is removed (see
+     * finish()). Call finish() explicitly to handle errors.
+     */
+    ~sam_file_sorter()
+    {
+        try
+        {
+            finish();
+        }
+        catch (...)
+        {}
+    }
+
+    /*!\brief Opens the output file and initialises the header with the given reference information.
+     * \tparam ref_ids_type_    The type of range over reference names; must be the same as `ref_ids_type` after
+     *                          removing the reference.
+     * \tparam ref_lengths_type The type of range over reference lengths; must model std::ranges::forward_range.
+     * \param[in] filename    The path of the BAM file to write; must end in ".bam".
+     * \param[in] ref_ids     The names of the reference sequences.
+     * \param[in] ref_lengths The lengths of the reference sequences (same order as ref_ids).
+     * \param[in] fields_tag  A seqan3::fields tag. [optional]
+     * \throws seqan3::file_open_error If the file could not be opened or does not end in ".bam".
+     */
+    template <typename ref_ids_type_, std::ranges::forward_range ref_lengths_type>
+    //!\cond
+        requires std::same_as<std::remove_reference_t<ref_ids_type_>, ref_ids_type>
+    //!\endcond
+    sam_file_sorter(std::filesystem::path filename,
+                    ref_ids_type_ && ref_ids,
+                    ref_lengths_type && ref_lengths,
+                    selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
+        filename{std::move(filename)},
+        encoder{buffer_stream, std::forward<ref_ids_type_>(ref_ids), ref_lengths, format_bam{}, selected_field_ids{}}
+    {
+        if (this->filename.extension() != ".bam")
+            throw file_open_error{"The sorted file must be a BAM file, i.e. end in \".bam\"."};
+
+        file.open(this->filename, std::ios_base::out | std::ios::binary);
+
+        if (!file.good())
+            throw file_open_error{"Could not open file " + this->filename.string() + " for writing."};
+    }
+    //!\}
+
+    /*!\name Pushing records
+     * \{
+     */
+    /*!\brief Adds a seqan3::record or a tuple of the selected fields, see seqan3::sam_file_output::push_back.
+     * \param[in] r The record to add.
+     * \throws seqan3::format_error If the record cannot be encoded.
+     * \throws seqan3::file_open_error If a run cannot be written.
+     */
+    template <typename record_t>
+    void push_back(record_t && r)
+    //!\cond
+        requires detail::record_like<record_t> || tuple_like<record_t>
+    //!\endcond
+    {
+        size_t record_offset = buffer.written().size();
+
+        if (header_bytes.empty())
+        {
+            push_first(std::forward<record_t>(r));
+            record_offset = header_bytes.size();
+        }
+        else
+        {
+            encoder.push_back(std::forward<record_t>(r));
+        }
+
+        entries.push_back(entry{sort_key(record_offset), record_offset});
+
+        if (buffer.written().size() >= options.memory_limit)
+            spill();
+    }
+
+    //!\brief Adds a record given as individual fields, see seqan3::sam_file_output::emplace_back.
+    template <typename arg_t, typename ...arg_types>
+    void emplace_back(arg_t && arg, arg_types && ... args)
+    {
+        push_back(std::tie(arg, args...));
+    }
+
+    //!\brief Adds all records of the range.
+    template <typename rng_t>
+    sam_file_sorter & operator=(rng_t && range)
+    //!\cond
+        requires std::ranges::input_range<rng_t> && tuple_like<std::ranges::range_reference_t<rng_t>>
+    //!\endcond
+    {
+        for (auto && record : range)
+            push_back(std::forward<decltype(record)>(record));
+        return *this;
+    }
+    //!\}
+
+    /*!\brief Sorts the remaining records, merges the runs and writes the file; does nothing if called again.
+     * \throws seqan3::io_error If a run cannot be read or the file cannot be written.
+     *
+     * \details
+     *
+     * If an error occurs, the incomplete file is removed before the exception is rethrown. Calling finish() again
+     * after an error does nothing.
+     */
+    void finish()
+    {
+        if (finished)
+            return;
+
+        finished = true;
+
+        try
+        {
+            write_file();
+        }
+        catch (...)
+        {
+            file.close();
+            std::error_code error{};
+            std::filesystem::remove(filename, error); // best effort, the original error is more relevant
+            run_directory.reset();
+            throw;
+        }
+    }
+
+    //!\brief The options are public and its members can be set directly.
+    sam_file_sorter_options options{};
+
+    //!\brief Access the header, see seqan3::sam_file_output::header; it can be modified before the first record.
+    auto & header()
+    {
+        return encoder.header();
+    }
+
+private:
+    //!\brief Sorts the remaining records, merges the runs and writes the file.
+    void write_file()
+    {
+        std::filesystem::path compressed_filename = filename;
+        auto stream = detail::make_secondary_ostream(file,
+                                                     compressed_filename,
+                                                     options.thread_count,
+                                                     options.compression_level);
+
+        if (run_count == 0u)
+        {
+            sort_entries();
+            stream->write(header_bytes.data(), header_bytes.size());
+            write_entries(*stream);
+        }
+        else
+        {
+            if (!entries.empty())
+                spill();
+
+            merge_runs(*stream);
+        }
+
+        stream.reset(); // flushes the compression stream
+        file.close();
+
+        if (file.fail())
+            throw io_error{"Could not write the file " + filename.string() + "."};
+
+        run_directory.reset();
+    }
+
+    //!\brief The sort key and the position of an encoded record in the buffer.
+    struct entry
+    {
+        //!\brief The reference id (as unsigned value, i.e. -1 is last) and the position + 1.
+        uint64_t key;
+        //!\brief The position of the record in the buffer; breaks ties such that the order is stable.
+        size_t offset;
+
+        //!\brief Compares by key and offset.
+        bool operator<(entry const & rhs) const noexcept
+        {
+            return std::tie(key, offset) < std::tie(rhs.key, rhs.offset);
+        }
+    };
+
+    //!\brief The path of the output file.
+    std::filesystem::path filename;
+    //!\brief The output file.
+    std::ofstream file{};
+
+    //!\brief The encoded records.
+    detail::memory_ostreambuf<char> buffer{};
+    //!\brief The stream of the encoder, writes to the buffer.
+    std::ostream buffer_stream{&buffer};
+    //!\brief Encodes the records into the buffer.
+    encoder_type encoder;
+    //!\brief The encoded BAM header (including the magic string and the references); written with the first record.
+    std::string header_bytes{};
+    //!\brief The records in the buffer.
+    std::vector<entry> entries{};
+    //!\brief The threads sorting the entries together with the calling thread; created on the first sort.
+    std::unique_ptr<detail::worker_pool> sort_workers{nullptr};
+
+    //!\brief The directory of the runs; removed on destruction.
+    std::optional<detail::safe_filesystem_entry> run_directory{};
+    //!\brief The path of the run directory.
+    std::filesystem::path run_directory_path{};
+    //!\brief The number of runs written.
+    size_t run_count{0u};
+    //!\brief Whether finish() was called.
+    bool finished{false};
+
+    //!\brief Returns the integer at the given position of the buffer.
+    static int32_t read_int32(char const * data) noexcept
+    {
+        int32_t value{};
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    //!\brief Returns the sort key of an encoded record, i.e. the reference id as unsigned value and the position + 1.
+    static uint64_t sort_key(char const * record) noexcept
+    {
+        uint32_t const ref_id = static_cast<uint32_t>(read_int32(record + 4)); // -1 becomes the largest value
+        uint32_t const position = static_cast<uint32_t>(read_int32(record + 8) + 1);
+        return (static_cast<uint64_t>(ref_id) << 32) | position;
+    }
+
+    //!\overload
+    uint64_t sort_key(size_t const offset) const noexcept
+    {
+        return sort_key(buffer.written().data() + offset);
+    }
+
+    /*!\brief Encodes the first record, which is preceded by the header, with the sorting set to "coordinate".
+     *
+     * \details
+     *
+     * The header is the one of the record if the record has a seqan3::field::header_ptr, otherwise the header of the
+     * sorter. Its sorting is only changed while the record is encoded.
+     */
+    template <typename record_t>
+    void push_first(record_t && r)
+    {
+        auto header_ptr = [&r] ()
+        {
+            if constexpr (detail::record_like<record_t>)
+                return detail::get_or<field::header_ptr>(r, nullptr);
+            else
+                return detail::get_or<selected_field_ids::index_of(field::header_ptr)>(r, nullptr);
+        }();
+
+        auto encode_with_coordinate_sorting = [&] (auto & header)
+        {
+            std::string sorting = std::exchange(header.sorting, "coordinate");
+
+            try
+            {
+                encoder.push_back(std::forward<record_t>(r));
+            }
+            catch (...)
+            {
+                header.sorting = std::move(sorting);
+                throw;
+            }
+
+            header.sorting = std::move(sorting);
+        };
+
+        if constexpr (std::same_as<decltype(header_ptr), std::nullptr_t>)
+            encode_with_coordinate_sorting(encoder.header());
+        else
+            encode_with_coordinate_sorting(*header_ptr);
+
+        // magic string, l_text, text, n_ref and the references (l_name, name, l_ref)
+        char const * data = buffer.written().data();
+        size_t header_size = 8u + read_int32(data + 4);
+        for (int32_t n_ref = read_int32(data + header_size), i = 0; i < n_ref; ++i)
+            header_size += 4u + read_int32(data + header_size + 4u) + 4u;
+        header_size += 4u; // n_ref
+
+        header_bytes.assign(data, header_size);
+    }
+
+    //!\brief Sorts the entries with up to seqan3::sam_file_sorter_options::thread_count threads.
+    void sort_entries()
+    {
+        // Every thread sorts a part, then neighbouring parts are merged in parallel until one part is left.
+        size_t const part_count = std::clamp<size_t>(entries.size() / 1024u, 1u, std::max<size_t>(options.thread_count,
+                                                                                                   1u));
+        std::vector<size_t> bounds(part_count + 1u);
+        for (size_t part = 0; part <= part_count; ++part)
+            bounds[part] = entries.size() * part / part_count;
+
+        size_t const thread_count = std::max<size_t>(options.thread_count, 1u);
+        if (sort_workers == nullptr || sort_workers->thread_count() != thread_count)
+            sort_workers = std::make_unique<detail::worker_pool>(thread_count);
+
+        sort_workers->run(part_count, [&] (size_t const part)
+        {
+            std::sort(entries.begin() + bounds[part], entries.begin() + bounds[part + 1u]);
+        });
+
+        while (bounds.size() > 2u)
+        {
+            sort_workers->run((bounds.size() - 1u) / 2u, [&] (size_t const pair)
+            {
+                std::inplace_merge(entries.begin() + bounds[2u * pair],
+                                   entries.begin() + bounds[2u * pair + 1u],
+                                   entries.begin() + bounds[2u * pair + 2u]);
+            });
+
+            std::vector<size_t> merged_bounds{};
+            for (size_t i = 0; i < bounds.size(); i += 2u)
+                merged_bounds.push_back(bounds[i]);
+            if (merged_bounds.back() != bounds.back())
+                merged_bounds.push_back(bounds.back());
+
+            bounds = std::move(merged_bounds);
+        }
+    }
+
+    //!\brief Writes the records in the order of the entries.
+    void write_entries(std::ostream & stream)
+    {
+        char const * data = buffer.written().data();
+
+        for (entry const & e : entries)
+            stream.write(data + e.offset, sizeof(int32_t) + read_int32(data + e.offset));
+    }
+
+    //!\brief Returns the path of the run with the given index.
+    std::filesystem::path run_path(size_t const run) const
+    {
+        return run_directory_path / ("run_" + std::to_string(run) + ".bgzf");
+    }
+
+    //!\brief Creates a unique directory for the runs.
+    void create_run_directory()
+    {
+        std::filesystem::path const tmp_directory = options.tmp_directory.empty()
+                                                  ? std::filesystem::temp_directory_path()
+                                                  : options.tmp_directory;
+        std::random_device random{};
+
+        for (size_t attempt = 0; attempt < 100u; ++attempt)
+        {
+            run_directory_path = tmp_directory / ("seqan3_sort_" + std::to_string(random()));
+
+            if (std::filesystem::create_directory(run_directory_path))
+            {
+                run_directory.emplace(run_directory_path);
+                return;
+            }
+        }
+
+        throw file_open_error{"Could not create a temporary directory in " + tmp_directory.string() + "."};
+    }
+
+    //!\brief Sorts the records in memory and writes them to a new run.
+    void spill()
+    {
+        if (!run_directory)
+            create_run_directory();
+
+        sort_entries();
+        write_run([this] (std::ostream & stream) { write_entries(stream); });
+
+        buffer.clear();
+        entries.clear();
+    }
+
+    /*!\brief Writes a new run with the given callable and returns its index.
+     * \param[in] write A callable that writes the records to the given (compressing) stream.
+     */
+    template <typename write_t>
+    size_t write_run(write_t && write)
+    {
+        size_t const run = run_count++;
+        std::filesystem::path path = run_path(run);
+        std::ofstream run_file{path, std::ios_base::out | std::ios::binary};
+
+        if (!run_file.good())
+            throw file_open_error{"Could not open file " + path.string() + " for writing."};
+
+        {
+            auto stream = detail::make_secondary_ostream(run_file,
+                                                         path,
+                                                         options.thread_count,
+                                                         detail::default_compression_level);
+            write(*stream);
+        }
+
+        return run;
+    }
+
+    //!\brief Reads the records of a run one by one.
+    struct run_reader
+    {
+        //!\brief The run file.
+        std::ifstream file;
+        //!\brief The decompression stream.
+        std::unique_ptr<std::istream, std::function<void(std::istream *)>> stream{nullptr, [] (std::istream *) {}};
+        //!\brief The current record.
+        std::string record{};
+
+        //!\brief Reads the next record; returns false at the end of the run.
+        bool read_next()
+        {
+            record.resize(sizeof(int32_t));
+            stream->read(record.data(), sizeof(int32_t));
+
+            if (stream->gcount() == 0)
+                return false;
+
+            int32_t const block_size = read_int32(record.data());
+
+            if (stream->gcount() != sizeof(int32_t) || block_size < 0)
+                throw io_error{"A temporary file of the sorter is corrupted."};
+
+            record.resize(sizeof(int32_t) + block_size);
+            stream->read(record.data() + sizeof(int32_t), block_size);
+
+            if (stream->gcount() != block_size)
+                throw io_error{"A temporary file of the sorter is corrupted."};
+
+            return true;
+        }
+    };
+
+    /*!\brief Merges all runs into the given stream, which receives the header first.
+     *
+     * \details
+     *
+     * As long as there are more than seqan3::sam_file_sorter_options::merge_fan_in runs, consecutive groups of runs
+     * are merged into new runs, which replace the group in the order of the runs. The merged runs are removed.
+     */
+    void merge_runs(std::ostream & stream)
+    {
+        size_t const fan_in = std::max<size_t>(options.merge_fan_in, 2u);
+        std::vector<size_t> runs(run_count);
+        std::iota(runs.begin(), runs.end(), 0u);
+
+        while (runs.size() > fan_in)
+        {
+            std::vector<size_t> merged_runs{};
+
+            for (size_t first = 0; first < runs.size(); first += fan_in)
+            {
+                std::span<size_t const> group{runs.data() + first, std::min(fan_in, runs.size() - first)};
+
+                if (group.size() == 1u)
+                {
+                    merged_runs.push_back(group[0]);
+                    continue;
+                }
+
+                merged_runs.push_back(write_run([&] (std::ostream & run_stream) { merge_group(group, run_stream); }));
+
+                for (size_t const run : group)
+                    std::filesystem::remove(run_path(run));
+            }
+
+            runs = std::move(merged_runs);
+        }
+
+        stream.write(header_bytes.data(), header_bytes.size());
+        merge_group(runs, stream);
+    }
+
+    /*!\brief Merges the given runs into the given stream.
+     * \param[in] runs The indices of the runs; records with the same key keep the order of this list.
+     * \param[in] stream The stream to write the records to.
+     */
+    void merge_group(std::span<size_t const> const runs, std::ostream & stream)
+    {
+        std::vector<run_reader> readers(runs.size());
+        // The position in the list breaks ties, such that records with the same key keep the order of the runs.
+        using queue_entry = std::pair<uint64_t, size_t>;
+        std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<queue_entry>> queue{};
+
+        for (size_t i = 0; i < runs.size(); ++i)
+        {
+            std::filesystem::path path = run_path(runs[i]);
+            readers[i].file.open(path, std::ios_base::in | std::ios::binary);
+
+            if (!readers[i].file.good())
+                throw io_error{"Could not open the temporary file " + path.string() + "."};
+
+            readers[i].stream = detail::make_secondary_istream(readers[i].file, path);
+
+            if (readers[i].read_next())
+                queue.emplace(sort_key(readers[i].record.data()), i);
+        }
+
+        while (!queue.empty())
+        {
+            size_t const i = queue.top().second;
+            queue.pop();
+
+            stream.write(readers[i].record.data(), readers[i].record.size());
+
+            if (readers[i].read_next())
+                queue.emplace(sort_key(readers[i].record.data()), i);
+        }
+    }
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::sam_file_sorter
+ * \{
+ */
+//!\brief Deduces ref_ids_type from input, selected_field_ids is set to the default.
+template <std::ranges::forward_range ref_ids_type, std::ranges::forward_range ref_lengths_type>
+sam_file_sorter(std::filesystem::path, ref_ids_type &&, ref_lengths_type &&)
+    -> sam_file_sorter<typename sam_file_output<>::selected_field_ids, std::remove_reference_t<ref_ids_type>>;
+
+//!\brief Deduces selected_field_ids and ref_ids_type from input.
+template <std::ranges::forward_range ref_ids_type,
+          std::ranges::forward_range ref_lengths_type,
+          detail::fields_specialisation selected_field_ids>
+sam_file_sorter(std::filesystem::path, ref_ids_type &&, ref_lengths_type &&, selected_field_ids const &)
+    -> sam_file_sorter<selected_field_ids, std::remove_reference_t<ref_ids_type>>;
+//!\}
+
+} // namespace seqan3
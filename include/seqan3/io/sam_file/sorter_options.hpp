@@ -0,0 +1,63 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sam_file_sorter_options.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <seqan3/std/filesystem>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+//!\brief The options of seqan3::sam_file_sorter.
+//!\ingroup io_sam_file
+struct sam_file_sorter_options
+{
+    /*!\brief The number of bytes of encoded records that are kept in memory.
+     *
+     * \details
+     *
+     * If the records exceed this limit, they are sorted and written to a temporary file (a "run"). The runs are
+     * merged when the sorter is finished. The records are stored in BAM encoding, i.e. the memory usage is roughly
+     * the size of the uncompressed BAM records plus 16 bytes per record.
+     */
+    size_t memory_limit = 768ull * 1024ull * 1024ull;
+
+    //!\brief The number of threads used to sort the records in memory and to compress the runs and the output.
+    size_t thread_count = 1;
+
+    /*!\brief The maximal number of runs that are merged at once.
+     *
+     * \details
+     *
+     * Every run that is merged is read through its own decompression stream. If more runs were written, consecutive
+     * groups of this many runs are first merged into larger runs, until at most this many runs are left for the
+     * final merge. Values smaller than 2 are treated as 2.
+     */
+    size_t merge_fan_in = 64;
+
+    //!\brief The BGZF compression level in [0, 9] of the output; the runs are always compressed with level 1.
+    int compression_level = 6;
+
+    /*!\brief The directory for the temporary files.
+     *
+     * \details
+     *
+     * If empty (the default), std::filesystem::temp_directory_path() is used. The sorter creates a unique
+     * subdirectory for its runs, which is removed when the sorter is finished or destroyed.
+     */
+    std::filesystem::path tmp_directory{};
+};
+
+} // namespace seqan3
@@ -19,8 +19,14 @@
  * \see \ref tutorial_sequence_file
  */
 
+#include <seqan3/io/sequence_file/fasta_index.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/io/sequence_file/paired_input.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
+#include <seqan3/io/sequence_file/record_view.hpp>
+#include <seqan3/io/sequence_file/view_input.hpp>
@@ -0,0 +1,456 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::fasta_index.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/charconv>
+#include <cstdint>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <iostream>
+#include <seqan3/std/span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A single line of a FASTA index (`.fai`), i.e. the layout of one record in the FASTA file.
+ * \ingroup sequence_file
+ */
+struct fasta_index_entry
+{
+    //!\brief The ID of the record, i.e. the header line up to the first whitespace.
+    std::string id{};
+    //!\brief The number of letters of the sequence.
+    uint64_t length{};
+    //!\brief The byte offset of the first letter of the sequence in the (uncompressed) file.
+    uint64_t offset{};
+    //!\brief The number of letters per sequence line.
+    uint64_t line_bases{};
+    //!\brief The number of bytes per sequence line including the line break.
+    uint64_t line_width{};
+
+    /*!\brief Returns the byte offset of the letter at the given position of the sequence.
+     * \param[in] position The position of the letter; must be smaller than seqan3::fasta_index_entry::length.
+     */
+    uint64_t offset_of(uint64_t const position) const noexcept
+    {
+        return offset + position / line_bases * line_width + position % line_bases;
+    }
+
+    //!\brief Compares all members.
+    friend bool operator==(fasta_index_entry const & lhs, fasta_index_entry const & rhs) noexcept
+    {
+        return lhs.id == rhs.id &&
+               lhs.length == rhs.length &&
+               lhs.offset == rhs.offset &&
+               lhs.line_bases == rhs.line_bases &&
+               lhs.line_width == rhs.line_width;
+    }
+
+    //!\brief Compares all members.
+    friend bool operator!=(fasta_index_entry const & lhs, fasta_index_entry const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/*!\brief The index of a FASTA file in the `.fai` format of `samtools faidx`.
+ * \ingroup sequence_file
+ *
+ * \details
+ *
+ * The index stores for every record the length of the sequence, the byte offset of the sequence and the length of
+ * the sequence lines. This requires that all lines of a sequence, except for the last one, have the same length.
+ * With this information every letter of a sequence can be located in the file without reading the preceding records,
+ * see seqan3::indexed_fasta_file.
+ *
+ * The index is either read from an existing `.fai` file or built in a single pass over the FASTA file. Compressed
+ * files are indexed by their uncompressed content, which can only be accessed randomly for BGZF compressed files.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sequence_file/fasta_index.cpp
+ */
+class fasta_index
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fasta_index() = default; //!< Defaulted.
+    fasta_index(fasta_index const &) = default; //!< Defaulted.
+    fasta_index(fasta_index &&) = default; //!< Defaulted.
+    fasta_index & operator=(fasta_index const &) = default; //!< Defaulted.
+    fasta_index & operator=(fasta_index &&) = default; //!< Defaulted.
+    ~fasta_index() = default; //!< Defaulted.
+    //!\}
+
+    /*!\name Building the index
+     * \{
+     */
+    /*!\brief Indexes the FASTA records of the given stream in a single pass.
+     * \param[in] fasta_stream The stream to read the FASTA file from.
+     * \throws seqan3::parse_error If the lines of a sequence have different lengths or if an ID occurs twice.
+     *
+     * \details
+     *
+     * The offsets are relative to the current position of the stream. Empty lines are only allowed at the end of a
+     * sequence. Both `\n` and `\r\n` line breaks are supported, but must not be mixed within a sequence.
+     */
+    static fasta_index build(std::istream & fasta_stream)
+    {
+        fasta_index index{};
+        record_builder builder{index};
+        std::vector<char> buffer(1 << 16);
+
+        for (std::streamsize chunk_size{};
+             (chunk_size = fasta_stream.rdbuf()->sgetn(buffer.data(), buffer.size())) > 0;)
+        {
+            builder.consume(std::span<char const>{buffer.data(), static_cast<size_t>(chunk_size)});
+        }
+
+        builder.finish();
+        return index;
+    }
+
+    /*!\brief Indexes the given FASTA file in a single pass.
+     * \param[in] fasta_path The path to the FASTA file; may be compressed.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::parse_error If the lines of a sequence have different lengths or if an ID occurs twice.
+     */
+    static fasta_index build(std::filesystem::path const & fasta_path)
+    {
+        std::ifstream file_stream{fasta_path, std::ios_base::in | std::ios::binary};
+
+        if (!file_stream.is_open())
+            throw file_open_error{"Could not open file " + fasta_path.string() + " for reading."};
+
+        std::filesystem::path file_name{fasta_path};
+        auto stream = detail::make_secondary_istream(file_stream, file_name);
+        return build(*stream);
+    }
+    //!\}
+
+    /*!\name Reading and writing the .fai file
+     * \{
+     */
+    /*!\brief Reads an index in the `.fai` format.
+     * \param[in] fai_stream The stream to read from.
+     * \throws seqan3::parse_error If a line does not consist of five tab separated fields or if an ID occurs twice.
+     */
+    static fasta_index read(std::istream & fai_stream)
+    {
+        fasta_index index{};
+
+        for (std::string line{}; std::getline(fai_stream, line);)
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (line.empty())
+                continue;
+
+            std::string_view remaining{line};
+            auto next_field = [&] ()
+            {
+                size_t const tab_position = remaining.find('\t');
+                std::string_view const field = remaining.substr(0, tab_position);
+                remaining.remove_prefix(tab_position == std::string_view::npos ? remaining.size() : tab_position + 1);
+                return field;
+            };
+
+            auto next_number = [&] ()
+            {
+                std::string_view const field = next_field();
+                uint64_t number{};
+                auto [ptr, errc] = std::from_chars(field.data(), field.data() + field.size(), number);
+
+                if (errc != std::errc{} || ptr != field.data() + field.size() || field.empty())
+                    throw parse_error{"Invalid number \"" + std::string{field} + "\" in the FASTA index line \"" +
+                                      line + "\"."};
+
+                return number;
+            };
+
+            fasta_index_entry entry{};
+            entry.id = next_field();
+            entry.length = next_number();
+            entry.offset = next_number();
+            entry.line_bases = next_number();
+            entry.line_width = next_number();
+
+            if (!remaining.empty())
+                throw parse_error{"The FASTA index line \"" + line + "\" has more than five fields."};
+
+            if (entry.length > 0 && (entry.line_bases == 0 || entry.line_width < entry.line_bases))
+                throw parse_error{"Invalid line lengths in the FASTA index line \"" + line + "\"."};
+
+            index.push_back(std::move(entry));
+        }
+
+        return index;
+    }
+
+    /*!\brief Reads the given `.fai` file.
+     * \param[in] fai_path The path to the index file.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::parse_error If the file is not a valid FASTA index.
+     */
+    static fasta_index read(std::filesystem::path const & fai_path)
+    {
+        std::ifstream fai_stream{fai_path};
+
+        if (!fai_stream.is_open())
+            throw file_open_error{"Could not open file " + fai_path.string() + " for reading."};
+
+        return read(fai_stream);
+    }
+
+    /*!\brief Writes the index in the `.fai` format.
+     * \param[in] fai_stream The stream to write to.
+     */
+    void write(std::ostream & fai_stream) const
+    {
+        for (fasta_index_entry const & entry : index_entries)
+        {
+            fai_stream << entry.id << '\t' << entry.length << '\t' << entry.offset << '\t'
+                       << entry.line_bases << '\t' << entry.line_width << '\n';
+        }
+    }
+
+    /*!\brief Writes the index to the given `.fai` file.
+     * \param[in] fai_path The path to the index file; usually the path of the FASTA file with `.fai` appended.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     */
+    void write(std::filesystem::path const & fai_path) const
+    {
+        std::ofstream fai_stream{fai_path};
+
+        if (!fai_stream.is_open())
+            throw file_open_error{"Could not open file " + fai_path.string() + " for writing."};
+
+        write(fai_stream);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    //!\brief Returns the entries in the order of the records in the FASTA file.
+    std::vector<fasta_index_entry> const & entries() const noexcept
+    {
+        return index_entries;
+    }
+
+    //!\brief Returns the number of records.
+    size_t size() const noexcept
+    {
+        return index_entries.size();
+    }
+
+    /*!\brief Returns the entry of the record at the given position.
+     * \param[in] record_index The position of the record in the FASTA file.
+     * \throws std::out_of_range If `record_index` is not smaller than the number of records.
+     */
+    fasta_index_entry const & operator[](size_t const record_index) const
+    {
+        if (record_index >= index_entries.size())
+            throw std::out_of_range{"The FASTA index has no record " + std::to_string(record_index) + "."};
+
+        return index_entries[record_index];
+    }
+
+    /*!\brief Returns the position of the record with the given ID.
+     * \param[in] id The ID of the record.
+     * \throws std::out_of_range If the FASTA index has no record with the given ID.
+     */
+    size_t position_of(std::string_view const id) const
+    {
+        if (auto it = id_to_position.find(std::string{id}); it != id_to_position.end())
+            return it->second;
+
+        throw std::out_of_range{"The FASTA index has no record with the ID \"" + std::string{id} + "\"."};
+    }
+    //!\}
+
+    //!\brief Compares the entries.
+    friend bool operator==(fasta_index const & lhs, fasta_index const & rhs) noexcept
+    {
+        return lhs.index_entries == rhs.index_entries;
+    }
+
+private:
+    /*!\brief Appends an entry and registers its ID.
+     * \throws seqan3::parse_error If the ID occurs twice.
+     */
+    void push_back(fasta_index_entry entry)
+    {
+        if (!id_to_position.emplace(entry.id, index_entries.size()).second)
+            throw parse_error{"The ID \"" + entry.id + "\" occurs more than once in the FASTA file."};
+
+        index_entries.push_back(std::move(entry));
+    }
+
+    //!\brief Collects the entries while the FASTA file is read in chunks.
+    class record_builder
+    {
+    public:
+        //!\brief Constructs the builder appending to the given index.
+        explicit record_builder(fasta_index & index) : index{index}
+        {}
+
+        //!\brief Processes the next chunk of the file.
+        void consume(std::span<char const> const chunk)
+        {
+            for (char const c : chunk)
+            {
+                if (in_header)
+                {
+                    if (c == '\n')
+                    {
+                        in_header = false;
+                        at_line_begin = true;
+                        entry.offset = file_offset + 1;
+                    }
+                    else if (in_id && (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f'))
+                    {
+                        in_id = false;
+                    }
+                    else if (in_id)
+                    {
+                        entry.id.push_back(c);
+                    }
+                }
+                else
+                {
+                    if (at_line_begin)
+                    {
+                        if (c == '>')
+                        {
+                            finish();
+                            has_record = true;
+                            in_header = true;
+                            in_id = true;
+                            ++file_offset;
+                            continue;
+                        }
+
+                        at_line_begin = false;
+                        line_begin = file_offset;
+                        line_bases = 0;
+                    }
+
+                    if (c == '\n')
+                    {
+                        finish_line(file_offset + 1 - line_begin, true);
+                        at_line_begin = true;
+                    }
+                    else if (c != '\r')
+                    {
+                        ++line_bases;
+                    }
+                }
+
+                ++file_offset;
+            }
+        }
+
+        //!\brief Finishes the current line and record.
+        void finish()
+        {
+            if (!at_line_begin && !in_header)
+            {
+                finish_line(file_offset - line_begin, false);
+                at_line_begin = true;
+            }
+
+            if (in_header)
+                entry.offset = file_offset;
+
+            if (has_record)
+                index.push_back(std::move(entry));
+
+            entry = fasta_index_entry{};
+            has_record = false;
+            line_count = 0;
+            has_short_line = false;
+        }
+
+    private:
+        //!\brief Checks the line lengths of the current sequence.
+        void finish_line(uint64_t const line_width, bool const has_line_break)
+        {
+            if (!has_record)
+            {
+                if (line_bases > 0)
+                    throw parse_error{"The FASTA file has sequence data before the first header."};
+
+                return;
+            }
+
+            if (line_count++ == 0 && line_bases > 0)
+            {
+                entry.line_bases = line_bases;
+                entry.line_width = has_line_break ? line_width : line_bases + 1;
+            }
+            else if (line_bases > 0)
+            {
+                if (has_short_line || line_bases > entry.line_bases ||
+                    (has_line_break && line_bases == entry.line_bases && line_width != entry.line_width))
+                {
+                    throw parse_error{"The sequence of \"" + entry.id + "\" has lines of different lengths. "
+                                      "Only the last line of a sequence may be shorter."};
+                }
+            }
+
+            has_short_line = has_short_line || line_bases < entry.line_bases || line_bases == 0;
+            entry.length += line_bases;
+        }
+
+        //!\brief The index the entries are appended to.
+        fasta_index & index;
+        //!\brief The entry of the current record.
+        fasta_index_entry entry{};
+        //!\brief The offset of the current character.
+        uint64_t file_offset{};
+        //!\brief The offset of the first character of the current line.
+        uint64_t line_begin{};
+        //!\brief The number of letters of the current line.
+        uint64_t line_bases{};
+        //!\brief The number of finished sequence lines of the current record.
+        uint64_t line_count{};
+        //!\brief Whether the current record has a line that is shorter than the first one.
+        bool has_short_line{false};
+        //!\brief Whether a header was read.
+        bool has_record{false};
+        //!\brief Whether the current character belongs to a header line.
+        bool in_header{false};
+        //!\brief Whether the current character belongs to the ID in the header line.
+        bool in_id{false};
+        //!\brief Whether the current character is the first of a line.
+        bool at_line_begin{true};
+    };
+
+    //!\brief The entries in the order of the records.
+    std::vector<fasta_index_entry> index_entries{};
+    //!\brief Maps the IDs to the positions of the entries.
+    std::unordered_map<std::string, size_t> id_to_position{};
+};
+
+} // namespace seqan3
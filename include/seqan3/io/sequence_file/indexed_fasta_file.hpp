@@ -0,0 +1,358 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::indexed_fasta_file.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <memory>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/detail/magic_header.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+#include <seqan3/utility/detail/to_little_endian.hpp>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief Maps the uncompressed offsets of a BGZF file to the virtual offsets of the seqan3::contrib::bgzf_istream.
+ * \ingroup sequence_file
+ *
+ * \details
+ *
+ * A virtual offset consists of the offset of the compressed block in the file (upper 48 bits) and the offset within
+ * the uncompressed block (lower 16 bits). The table stores the compressed and uncompressed offset of every block and
+ * is built by reading only the header and the trailing size field of every block, i.e. without decompressing it.
+ * This is the same information that is stored in the `.gzi` file of `bgzip`.
+ */
+class bgzf_block_table
+{
+public:
+    /*!\brief Reads the block boundaries of the BGZF file.
+     * \param[in] compressed_stream The stream of the compressed file.
+     * \throws seqan3::parse_error If a block header is invalid.
+     */
+    static bgzf_block_table scan(std::istream & compressed_stream)
+    {
+        bgzf_block_table table{};
+        std::array<char, bgzf_compression::magic_header.size()> header{};
+        uint64_t compressed_offset{};
+        uint64_t uncompressed_offset{};
+
+        compressed_stream.clear();
+        compressed_stream.seekg(0);
+
+        while (compressed_stream.read(header.data(), header.size()))
+        {
+            if (!bgzf_compression::validate_header(std::span{header}))
+                throw parse_error{"Invalid BGZF block header at offset " + std::to_string(compressed_offset) + "."};
+
+            uint16_t block_size_minus_one{};
+            std::memcpy(&block_size_minus_one, header.data() + 16, sizeof(uint16_t));
+            uint64_t const block_size = to_little_endian(block_size_minus_one) + 1u;
+
+            // The last four bytes of a block are the size of the uncompressed data.
+            uint32_t uncompressed_size{};
+            compressed_stream.seekg(compressed_offset + block_size - sizeof(uint32_t));
+            if (!compressed_stream.read(reinterpret_cast<char *>(&uncompressed_size), sizeof(uint32_t)))
+                throw parse_error{"Truncated BGZF block at offset " + std::to_string(compressed_offset) + "."};
+
+            table.blocks.push_back({compressed_offset, uncompressed_offset});
+            compressed_offset += block_size;
+            uncompressed_offset += to_little_endian(uncompressed_size);
+        }
+
+        compressed_stream.clear();
+        return table;
+    }
+
+    /*!\brief Returns the virtual offset of the given uncompressed offset.
+     * \param[in] uncompressed_offset The offset in the uncompressed data.
+     */
+    uint64_t virtual_offset(uint64_t const uncompressed_offset) const noexcept
+    {
+        // The last block that starts at or before the offset; empty blocks are skipped by taking the last one.
+        auto it = std::ranges::upper_bound(blocks, uncompressed_offset, std::less<>{}, &block::uncompressed_offset);
+        assert(it != blocks.begin());
+        --it;
+
+        return (it->compressed_offset << 16) | (uncompressed_offset - it->uncompressed_offset);
+    }
+
+private:
+    //!\brief The offsets of a single block.
+    struct block
+    {
+        //!\brief The offset of the block in the compressed file.
+        uint64_t compressed_offset;
+        //!\brief The offset of the first uncompressed byte of the block.
+        uint64_t uncompressed_offset;
+    };
+
+    //!\brief The blocks in the order of the file.
+    std::vector<block> blocks{};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A FASTA file that provides random access to subsequences via a seqan3::fasta_index.
+ * \ingroup sequence_file
+ * \tparam alphabet_type The alphabet of the returned sequences; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * In contrast to seqan3::sequence_file_input, which reads the records sequentially, this file seeks directly to the
+ * requested interval of a sequence. Only the bytes of the interval including the contained line breaks are read, such
+ * that the cost of a fetch is independent of the position of the record in the file.
+ *
+ * The index is read from the `.fai` file next to the FASTA file (`<file>.fai`, as written by `samtools faidx` or by
+ * seqan3::fasta_index::write). If there is no such file, the index is built when opening the file.
+ *
+ * BGZF compressed files (e.g. created by `bgzip`) are supported if zlib is available. The block boundaries are read
+ * when opening the file. Other compressed files cannot be accessed randomly and are rejected.
+ *
+ * The characters are converted with seqan3::assign_char_to, i.e. invalid characters are not reported.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sequence_file/indexed_fasta_file.cpp
+ */
+template <writable_alphabet alphabet_type = dna5>
+class indexed_fasta_file
+{
+public:
+    //!\brief The type of the returned sequences.
+    using sequence_type = std::vector<alphabet_type>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    indexed_fasta_file() = delete; //!< Deleted.
+    indexed_fasta_file(indexed_fasta_file const &) = delete; //!< Deleted, because the file stream cannot be copied.
+    indexed_fasta_file(indexed_fasta_file &&) = default; //!< Defaulted.
+    indexed_fasta_file & operator=(indexed_fasta_file const &) = delete; //!< Deleted.
+    indexed_fasta_file & operator=(indexed_fasta_file &&) = default; //!< Defaulted.
+    ~indexed_fasta_file() = default; //!< Defaulted.
+
+    /*!\brief Opens the FASTA file and reads or builds its index.
+     * \param[in] fasta_path The path to the (possibly BGZF compressed) FASTA file.
+     * \throws seqan3::file_open_error If the file cannot be opened or is not accessible randomly.
+     * \throws seqan3::parse_error If the index cannot be read or built.
+     */
+    explicit indexed_fasta_file(std::filesystem::path const & fasta_path) :
+        indexed_fasta_file{fasta_path, load_index(fasta_path)}
+    {}
+
+    /*!\brief Opens the FASTA file with the given index.
+     * \param[in] fasta_path The path to the (possibly BGZF compressed) FASTA file.
+     * \param[in] index The index of the FASTA file.
+     * \throws seqan3::file_open_error If the file cannot be opened or is not accessible randomly.
+     */
+    indexed_fasta_file(std::filesystem::path const & fasta_path, fasta_index index) :
+        fai{std::move(index)},
+        file_stream{std::make_unique<std::ifstream>(fasta_path, std::ios_base::in | std::ios::binary)}
+    {
+        if (!file_stream->is_open())
+            throw file_open_error{"Could not open file " + fasta_path.string() + " for reading."};
+
+        std::array<char, detail::bgzf_compression::magic_header.size()> magic_number{};
+        file_stream->read(magic_number.data(), magic_number.size());
+        bool const is_complete = file_stream->gcount() == static_cast<std::streamsize>(magic_number.size());
+
+        if (is_complete && detail::bgzf_compression::validate_header(std::span{magic_number}))
+        {
+        #ifdef SEQAN3_HAS_ZLIB
+            block_table = detail::bgzf_block_table::scan(*file_stream);
+            bgzf_stream = std::make_unique<contrib::bgzf_istream>(*file_stream);
+            is_bgzf = true;
+        #else
+            throw file_open_error{"Trying to read from a bgzf file, but no ZLIB available."};
+        #endif
+        }
+        else if (file_stream->gcount() >= 3 &&
+                 std::ranges::equal(std::span{magic_number}.first(3), detail::gz_compression::magic_header))
+        {
+            throw file_open_error{"The file " + fasta_path.string() + " is compressed, but not in the BGZF format. "
+                                  "Only uncompressed and BGZF compressed FASTA files can be accessed randomly."};
+        }
+    }
+    //!\}
+
+    //!\brief Returns the index of the file.
+    fasta_index const & index() const noexcept
+    {
+        return fai;
+    }
+
+    /*!\name Fetching subsequences
+     * \{
+     */
+    /*!\brief Reads the interval `[begin, end)` of the sequence of the record with the given ID.
+     * \param[in] id The ID of the record.
+     * \param[in] begin The position of the first letter.
+     * \param[in] end The position behind the last letter.
+     * \returns The letters in `[begin, end)`.
+     * \throws std::out_of_range If there is no record with the given ID or the interval exceeds the sequence.
+     * \throws seqan3::unexpected_end_of_input If the file is shorter than specified by the index.
+     */
+    sequence_type fetch(std::string_view const id, uint64_t const begin, uint64_t const end)
+    {
+        return fetch(fai.position_of(id), begin, end);
+    }
+
+    /*!\brief Reads the interval `[begin, end)` of the sequence of the record at the given position.
+     * \param[in] record_index The position of the record in the file.
+     * \param[in] begin The position of the first letter.
+     * \param[in] end The position behind the last letter.
+     * \returns The letters in `[begin, end)`.
+     * \throws std::out_of_range If there is no record at the given position or the interval exceeds the sequence.
+     * \throws seqan3::unexpected_end_of_input If the file is shorter than specified by the index.
+     */
+    sequence_type fetch(size_t const record_index, uint64_t const begin, uint64_t const end)
+    {
+        sequence_type sequence{};
+        fetch(sequence, record_index, begin, end);
+        return sequence;
+    }
+
+    /*!\brief Reads the interval `[begin, end)` of the sequence of the record at the given position into `sequence`.
+     * \param[out] sequence The sequence to overwrite; its memory is reused.
+     * \param[in] record_index The position of the record in the file.
+     * \param[in] begin The position of the first letter.
+     * \param[in] end The position behind the last letter.
+     * \throws std::out_of_range If there is no record at the given position or the interval exceeds the sequence.
+     * \throws seqan3::unexpected_end_of_input If the file is shorter than specified by the index.
+     *
+     * \details
+     *
+     * Use this overload to avoid allocations when fetching many intervals.
+     */
+    void fetch(sequence_type & sequence, size_t const record_index, uint64_t const begin, uint64_t const end)
+    {
+        fasta_index_entry const & entry = fai[record_index];
+
+        if (begin > end || end > entry.length)
+            throw std::out_of_range{"The interval [" + std::to_string(begin) + ", " + std::to_string(end) + ") "
+                                    "exceeds the sequence \"" + entry.id + "\" of length " +
+                                    std::to_string(entry.length) + "."};
+
+        sequence.resize(end - begin);
+
+        if (begin == end)
+            return;
+
+        uint64_t const first_byte = entry.offset_of(begin);
+        buffer.resize(entry.offset_of(end - 1) + 1 - first_byte);
+
+        std::istream & stream = seek(first_byte);
+        stream.read(buffer.data(), buffer.size());
+
+        if (stream.gcount() != static_cast<std::streamsize>(buffer.size()))
+            throw unexpected_end_of_input{"The FASTA file ends before the sequence \"" + entry.id + "\"."};
+
+        // Copy the letters line by line and skip the line breaks.
+        uint64_t const line_break_size = entry.line_width - entry.line_bases;
+        char const * chars = buffer.data();
+        alphabet_type * output = sequence.data();
+        alphabet_type * const output_end = output + sequence.size();
+
+        for (uint64_t column = begin % entry.line_bases; output != output_end; column = 0)
+        {
+            uint64_t const count = std::min<uint64_t>(entry.line_bases - column, output_end - output);
+
+            for (char const * const line_end = chars + count; chars != line_end; ++chars, ++output)
+                *output = char_table[static_cast<unsigned char>(*chars)];
+
+            chars += line_break_size;
+        }
+    }
+    //!\}
+
+private:
+    /*!\brief Reads the `.fai` file next to the FASTA file or builds the index.
+     * \param[in] fasta_path The path to the FASTA file.
+     */
+    static fasta_index load_index(std::filesystem::path const & fasta_path)
+    {
+        std::filesystem::path fai_path{fasta_path};
+        fai_path += ".fai";
+
+        if (std::filesystem::exists(fai_path))
+            return fasta_index::read(fai_path);
+
+        return fasta_index::build(fasta_path);
+    }
+
+    //!\brief Moves the stream to the given offset of the uncompressed file and returns it.
+    std::istream & seek(uint64_t const uncompressed_offset)
+    {
+    #ifdef SEQAN3_HAS_ZLIB
+        if (is_bgzf)
+        {
+            bgzf_stream->clear();
+            bgzf_stream->seekg(block_table.virtual_offset(uncompressed_offset));
+            return *bgzf_stream;
+        }
+    #endif
+
+        file_stream->clear();
+        file_stream->seekg(uncompressed_offset);
+        return *file_stream;
+    }
+
+    //!\brief Maps every character to the letter assigned by seqan3::assign_char_to.
+    static inline std::array<alphabet_type, 256> const char_table = [] ()
+    {
+        std::array<alphabet_type, 256> table{};
+
+        for (size_t i = 0; i < table.size(); ++i)
+            assign_char_to(static_cast<char>(i), table[i]);
+
+        return table;
+    }();
+
+    //!\brief The index of the file.
+    fasta_index fai{};
+    //!\brief The stream of the file.
+    std::unique_ptr<std::ifstream> file_stream{};
+    //!\brief The raw bytes of the current interval.
+    std::string buffer{};
+    //!\brief Whether the file is BGZF compressed.
+    bool is_bgzf{false};
+    //!\brief The block boundaries of a BGZF compressed file.
+    detail::bgzf_block_table block_table{};
+#ifdef SEQAN3_HAS_ZLIB
+    //!\brief The decompressing stream of a BGZF compressed file.
+    std::unique_ptr<contrib::bgzf_istream> bgzf_stream{};
+#endif
+};
+
+} // namespace seqan3
@@ -12,9 +12,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <seqan3/std/filesystem>
 #include <fstream>
+#include <seqan3/std/ranges>
 #include <string>
 #include <variant>
 #include <vector>
@@ -28,6 +30,7 @@
 #include <seqan3/core/detail/pack_algorithm.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/read_ahead_istream.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
@@ -37,7 +40,9 @@
 #include <seqan3/io/sequence_file/format_genbank.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/record.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/range/views/get.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
 
 namespace seqan3
@@ -380,6 +385,8 @@ public:
                                                                                   field_ids,
                                                                                   selected_field_ids>,
                                                   selected_field_ids>;
+    //!\brief The type of a batch of records stored as struct-of-arrays, see read_batch().
+    using batch_type            = sequence_record_batch<id_type, sequence_type, quality_type>;
     //!\}
 
     /*!\name Range associated types
@@ -450,6 +457,10 @@ public:
         // possibly add intermediate compression stream
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
 
+        // an uncompressed file can be read ahead directly from the file
+        if (secondary_stream.get() == primary_stream.get())
+            plain_file_path = filename;
+
         // initialise format handler or throw if format is not found
         detail::set_format(format, filename);
     }
@@ -535,6 +546,7 @@ public:
         // buffer first record
         if (!first_record_was_read)
         {
+            start_read_ahead();
             read_next_record();
             first_record_was_read = true;
         }
@@ -589,6 +601,56 @@ public:
     }
     //!\}
 
+    /*!\brief Reads the next records into a batch stored as struct-of-arrays.
+     * \param[in,out] batch The batch that is cleared and filled; its memory is reused.
+     * \param[in]     count The maximal number of records read.
+     * \returns The number of records read, i.e. `batch.size()`; `0` if the file is at end.
+     *
+     * \details
+     *
+     * The records are parsed into the internal record buffer, whose containers keep their memory, and appended to
+     * the concatenated IDs, sequences and qualities of the batch. Once the batch has reached its largest size, no
+     * memory is allocated per record. If field::seq_qual is selected, the sequence and the qualities are stored
+     * separately; fields that are not selected are stored as empty elements.
+     *
+     * The batch starts at the record that begin() points to, afterwards begin() points to the record following the
+     * batch, i.e. record-wise and batch-wise reading can be mixed.
+     *
+     * \include test/snippet/io/sequence_file/sequence_file_input_read_batch.cpp
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the records read.
+     *
+     * ### Exceptions
+     *
+     * Throws seqan3::format_error if a record could not be read. The batch then contains the records read before.
+     */
+    size_type read_batch(batch_type & batch, size_type const count)
+    {
+        batch.clear();
+        batch.reserve(count);
+
+        for (auto it = begin(); batch.size() < count && it != end(); ++it)
+        {
+            if constexpr (selected_field_ids::contains(field::seq_qual))
+            {
+                auto const & sequence_qualities = get<field::seq_qual>(record_buffer);
+                batch.sequences.push_back(sequence_qualities | views::get<0>);
+                batch.base_qualities.push_back(sequence_qualities | views::get<1>);
+            }
+            else
+            {
+                append_to_batch<field::seq>(batch.sequences);
+                append_to_batch<field::qual>(batch.base_qualities);
+            }
+
+            append_to_batch<field::id>(batch.ids);
+        }
+
+        return batch.size();
+    }
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
                              selected_field_ids::contains(field::seq_qual)> options;
@@ -620,6 +682,9 @@ protected:
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
 
+    //!\brief The path of the file if it was opened by filename and is not compressed; empty otherwise.
+    std::filesystem::path plain_file_path{};
+
     //!\brief Tracks whether the very first record is buffered when calling begin().
     bool first_record_was_read{false};
     //!\brief File is at position 1 behind the last record.
@@ -632,6 +697,38 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief Replaces the secondary stream by a stream that reads ahead on a background thread, if requested.
+    void start_read_ahead()
+    {
+        if (options.read_ahead_buffer_count == 0u)
+            return;
+
+        using read_ahead_stream_t = detail::read_ahead_istream<stream_char_type>;
+        size_t const buffer_size = std::max<size_t>(options.read_ahead_buffer_size, 1u);
+
+        if (plain_file_path.empty())
+            secondary_stream = stream_ptr_t{new read_ahead_stream_t{std::move(secondary_stream),
+                                                                    buffer_size,
+                                                                    options.read_ahead_buffer_count},
+                                            stream_deleter_default};
+        else
+            secondary_stream = stream_ptr_t{new read_ahead_stream_t{std::move(secondary_stream),
+                                                                    plain_file_path,
+                                                                    buffer_size,
+                                                                    options.read_ahead_buffer_count},
+                                            stream_deleter_default};
+    }
+
+    //!\brief Appends the field `field_id` of the buffered record or an empty element if it is not selected.
+    template <field field_id, typename concatenated_t>
+    void append_to_batch(concatenated_t & concatenated)
+    {
+        if constexpr (selected_field_ids::contains(field_id))
+            concatenated.push_back(get<field_id>(record_buffer));
+        else
+            concatenated.push_back(std::views::empty<std::ranges::range_value_t<typename concatenated_t::value_type>>);
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
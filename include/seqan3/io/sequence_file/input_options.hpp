@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -28,6 +30,20 @@ struct sequence_file_input_options
     bool truncate_ids = false;
     //!\brief Read the complete_header into the seqan3::field::id for embl or genbank format.
     bool embl_genbank_complete_header = false;
+
+    /*!\brief The number of buffers that a background thread fills ahead of the parser [default: 0, i.e. no read-ahead].
+     *
+     * \details
+     *
+     * If greater than zero, a background thread reads the file into this many buffers of size
+     * #read_ahead_buffer_size, while the records are parsed from the previously filled buffer. Compressed files are
+     * decompressed on the background thread; uncompressed files opened by filename are read directly with `pread`.
+     * At least two buffers are needed to overlap reading and parsing. The options must be set before the first record
+     * is read.
+     */
+    size_t read_ahead_buffer_count = 0;
+    //!\brief The size in bytes of each read-ahead buffer, see #read_ahead_buffer_count.
+    size_t read_ahead_buffer_size = 4 * 1024 * 1024;
 };
 
 } // namespace seqan3
@@ -238,8 +238,24 @@ public:
     sequence_file_output(sequence_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     sequence_file_output & operator=(sequence_file_output &&) = default;
-    //!\brief Destructor is defaulted.
-    ~sequence_file_output() = default;
+    /*!\brief Destructor; creates the compression stream if nothing has been written, such that an empty compressed
+     *        file is still valid.
+     *
+     * \details
+     *
+     * Errors cannot be reported from the destructor. If the compression stream of an empty file cannot be created,
+     * e.g. because no thread can be started, the file is left empty.
+     */
+    ~sequence_file_output()
+    {
+        try
+        {
+            if (primary_stream) // not moved from
+                init_secondary_stream();
+        }
+        catch (...)
+        {}
+    }
 
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
@@ -267,8 +283,15 @@ public:
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for writing."};
 
-        // possibly add intermediate compression stream
-        secondary_stream = detail::make_secondary_ostream(*primary_stream, filename);
+        // possibly add intermediate compression stream; it is created on first write (see init_secondary_stream())
+        // such that the compression options can still be set after construction
+        compressed_filename = filename;
+
+        if (!detail::strip_compression_extension(filename))
+        {
+            compressed_filename.clear();
+            secondary_stream = stream_ptr_t{&*primary_stream, stream_deleter_noop};
+        }
 
         // initialise format handler or throw if format is not found
         detail::set_format(format, filename);
@@ -556,6 +579,7 @@ public:
      */
     std::basic_ostream<stream_char_type> & get_stream()
     {
+        init_secondary_stream();
         return *secondary_stream;
     }
     //!\endcond
@@ -579,6 +603,21 @@ protected:
     stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
     //!\brief The secondary stream is a compression layer on the primary or just points to the primary (no compression).
     stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+    //!\brief The file name including the compression extension until the compression stream has been created.
+    std::filesystem::path compressed_filename{};
+
+    //!\brief Creates the compression stream with the compression options on first use.
+    void init_secondary_stream()
+    {
+        if (compressed_filename.empty())
+            return;
+
+        secondary_stream = detail::make_secondary_ostream(*primary_stream,
+                                                          compressed_filename,
+                                                          options.compression_thread_count,
+                                                          options.compression_level);
+        compressed_filename.clear();
+    }
 
     //!\brief Type of the format, an std::variant over the `valid_formats`.
     using format_type = typename detail::variant_from_tags<valid_formats,
@@ -600,6 +639,8 @@ protected:
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
         assert(!format.valueless_by_exception());
+        init_secondary_stream();
+
         std::visit([&] (auto & f)
         {
             if constexpr (!detail::decays_to_ignore_v<seq_qual_t>)
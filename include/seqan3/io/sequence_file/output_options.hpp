@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
+#include <seqan3/io/detail/compression_level.hpp>
 
 namespace seqan3
 {
@@ -40,6 +43,26 @@ struct sequence_file_output_options
 
     //!\brief Complete header given for embl or genbank
     bool        embl_genbank_complete_header  = false;
+
+    /*!\brief The number of threads used to compress BGZF output, i.e. BAM files and files ending in ".gz" or ".bgzf".
+     *
+     * \details
+     *
+     * The default of 0 uses seqan3::contrib::bgzf_thread_count (the number of hardware threads). The compression
+     * stream is created on the first write, so this member can be set directly after constructing the file.
+     */
+    size_t      compression_thread_count = 0;
+
+    /*!\brief The compression level of BGZF output in [0, 9].
+     *
+     * \details
+     *
+     * Level 0 stores the data uncompressed (but still BGZF framed) and level 1 (the default) is the fastest level
+     * that actually compresses; these are good choices for intermediate files. Higher levels produce smaller files
+     * at the cost of (considerably) more time. Like the compression_thread_count it must be set before the first
+     * write.
+     */
+    int         compression_level = detail::default_compression_level;
 };
 
 } // namespace seqan3
@@ -0,0 +1,562 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::paired_sequence_file_input.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <seqan3/std/span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <seqan3/io/detail/in_file_iterator.hpp>
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/read_ahead_istream.hpp>
+#include <seqan3/io/detail/record_block_reader.hpp>
+#include <seqan3/io/detail/sequence_record_scanner.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/io/sequence_file/paired_input_options.hpp>
+#include <seqan3/utility/parallel/detail/worker_pool.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Reads paired-end FASTA/FASTQ files in lock-step and provides batches of record pairs.
+ * \ingroup sequence_file
+ * \tparam traits_type_       An auxiliary type that defines certain member types and constants, must model
+ *                            seqan3::sequence_file_input_traits.
+ * \tparam selected_field_ids_ A seqan3::fields type with the list and order of desired record entries; all fields
+ *                            must be in seqan3::sequence_file_input::field_ids.
+ * \implements std::ranges::input_range
+ *
+ * \details
+ *
+ * The mates are either read from two files (e.g. `R1.fastq.gz` and `R2.fastq.gz`) or from one interleaved file in
+ * which each record is directly followed by its mate. The range elements are batches, i.e. std::vector of
+ * std::pair of records of the seqan3::sequence_file_input with the same template arguments, which can be passed to
+ * batch interfaces like seqan3::align_pairwise or seqan3::search after projecting the sequences.
+ *
+ * Each file is read in large blocks that are split into records on the calling thread. The records of a batch
+ * are then parsed concurrently by seqan3::format_fasta or seqan3::format_fastq if
+ * seqan3::paired_sequence_file_input_options::thread_count is greater than one; the threads are created on the first
+ * call to begin() and reused for all batches. The records are split with the same scanner as
+ * seqan3::sequence_file_view_input uses. The format is detected from the
+ * first character of each file. Files may be compressed; with the read-ahead options, both files are read and
+ * decompressed concurrently on background threads.
+ *
+ * By default, the read names of the mates are checked to be equal, see
+ * seqan3::paired_sequence_file_input_options::check_read_names. If the files contain a different number of records,
+ * seqan3::unexpected_end_of_input is thrown.
+ *
+ * The batch is reused, i.e. its records are overwritten when the iterator is incremented.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sequence_file/paired_sequence_file_input.cpp
+ */
+template <sequence_file_input_traits traits_type_ = sequence_file_input_default_traits_dna,
+          detail::fields_specialisation selected_field_ids_ = fields<field::seq, field::id, field::qual>>
+class paired_sequence_file_input
+{
+public:
+    /*!\name Template arguments
+     * \brief Exposed as member types for public access.
+     * \{
+     */
+    //!\brief A traits type that defines aliases and template for storage of the fields.
+    using traits_type        = traits_type_;
+    //!\brief A seqan3::fields list with the fields selected for the record.
+    using selected_field_ids = selected_field_ids_;
+    //!\brief The formats that can be read.
+    using valid_formats      = type_list<format_fasta, format_fastq>;
+    //!\brief Character type of the stream(s).
+    using stream_char_type   = char;
+    //!\}
+
+    //!\brief The type of the records, identical to the record type of seqan3::sequence_file_input.
+    using record_type = typename sequence_file_input<traits_type,
+                                                     selected_field_ids,
+                                                     valid_formats>::record_type;
+    //!\brief The type of a batch of record pairs.
+    using batch_type  = std::vector<std::pair<record_type, record_type>>;
+
+    /*!\name Range associated types
+     * \brief The types necessary to facilitate the behaviour of an input range (used in batch-wise reading).
+     * \{
+     */
+    //!\brief The value_type is the \ref batch_type.
+    using value_type        = batch_type;
+    //!\brief The reference type.
+    using reference         = batch_type &;
+    //!\brief The const_reference type is void, because files are not const-iterable.
+    using const_reference   = void;
+    //!\brief An unsigned integer type, usually std::size_t.
+    using size_type         = size_t;
+    //!\brief A signed integer type, usually std::ptrdiff_t.
+    using difference_type   = std::make_signed_t<size_t>;
+    //!\brief The iterator type of this view (an input iterator).
+    using iterator          = detail::in_file_iterator<paired_sequence_file_input>;
+    //!\brief The const iterator type is void, because files are not const-iterable.
+    using const_iterator    = void;
+    //!\brief The type returned by end().
+    using sentinel          = std::default_sentinel_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    paired_sequence_file_input() = delete; //!< Deleted.
+    paired_sequence_file_input(paired_sequence_file_input const &) = delete; //!< Deleted.
+    paired_sequence_file_input(paired_sequence_file_input &&) = default; //!< Defaulted.
+    paired_sequence_file_input & operator=(paired_sequence_file_input const &) = delete; //!< Deleted.
+    paired_sequence_file_input & operator=(paired_sequence_file_input &&) = default; //!< Defaulted.
+    ~paired_sequence_file_input() = default; //!< Defaulted.
+
+    /*!\brief Opens the files of the first and the second mates.
+     * \param[in] first_filename  The path of the file with the first mates; may be compressed.
+     * \param[in] second_filename The path of the file with the second mates; may be compressed.
+     * \param[in] fields_tag      A seqan3::fields tag. [optional]
+     * \throws seqan3::file_open_error If one of the files cannot be opened.
+     */
+    paired_sequence_file_input(std::filesystem::path const & first_filename,
+                               std::filesystem::path const & second_filename,
+                               selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
+        readers(2u)
+    {
+        readers[0].open(first_filename);
+        readers[1].open(second_filename);
+    }
+
+    /*!\brief Opens an interleaved file, in which each record is directly followed by its mate.
+     * \param[in] filename   The path of the interleaved file; may be compressed.
+     * \param[in] fields_tag A seqan3::fields tag. [optional]
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     */
+    explicit paired_sequence_file_input(std::filesystem::path const & filename,
+                                        selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) =
+                                            selected_field_ids{}) :
+        readers(1u)
+    {
+        readers[0].open(filename);
+    }
+
+    /*!\brief Reads the first and the second mates from the given streams.
+     * \param[in] first_stream  The stream with the first mates; may be compressed and must outlive this object.
+     * \param[in] second_stream The stream with the second mates; may be compressed and must outlive this object.
+     * \param[in] fields_tag    A seqan3::fields tag. [optional]
+     */
+    paired_sequence_file_input(std::istream & first_stream,
+                               std::istream & second_stream,
+                               selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
+        readers(2u)
+    {
+        readers[0].open(first_stream);
+        readers[1].open(second_stream);
+    }
+
+    /*!\brief Reads an interleaved stream, in which each record is directly followed by its mate.
+     * \param[in] stream     The interleaved stream; may be compressed and must outlive this object.
+     * \param[in] fields_tag A seqan3::fields tag. [optional]
+     */
+    explicit paired_sequence_file_input(std::istream & stream,
+                                        selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) =
+                                            selected_field_ids{}) :
+        readers(1u)
+    {
+        readers[0].open(stream);
+    }
+    //!\}
+
+    /*!\name Range interface
+     * \brief Provides functions for batch-wise reading of the files.
+     * \{
+     */
+    /*!\brief Returns an iterator to the current batch.
+     * \throws seqan3::parse_error If a record is invalid or the read names of a pair do not match.
+     * \throws seqan3::unexpected_end_of_input If a record is incomplete or a file has fewer records than the other.
+     */
+    iterator begin()
+    {
+        // buffer first batch
+        if (!first_record_was_read)
+        {
+            for (mate_reader & reader : readers)
+                reader.start_read_ahead(options.read_ahead_buffer_size, options.read_ahead_buffer_count);
+
+            if (options.thread_count > 1u)
+                workers = std::make_unique<detail::worker_pool>(options.thread_count);
+
+            read_next_record();
+            first_record_was_read = true;
+        }
+
+        return {*this};
+    }
+
+    //!\brief Returns a sentinel for comparison with iterator.
+    sentinel end() noexcept
+    {
+        return {};
+    }
+
+    //!\brief Return the batch we are currently at in the files.
+    reference front()
+    {
+        return *begin();
+    }
+    //!\}
+
+    //!\brief The options are public and its members can be set directly.
+    paired_sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
+                                       selected_field_ids::contains(field::seq_qual)> options;
+
+private:
+    //!\brief The type of the stream pointers. Allows dynamically setting ownership management.
+    using stream_ptr_t = std::unique_ptr<std::istream, std::function<void(std::istream *)>>;
+    //!\brief Stream deleter that does nothing (no ownership assumed).
+    static void stream_deleter_noop(std::istream *) {}
+    //!\brief Stream deleter with default behaviour (ownership assumed).
+    static void stream_deleter_default(std::istream * ptr) { delete ptr; }
+
+    //!\brief The number of bytes that are read at once from each file.
+    static constexpr size_t block_size = 1u << 22;
+
+    //!\brief The raw records of one mate of a batch.
+    struct raw_batch
+    {
+        //!\brief The characters of the records.
+        std::vector<char> text{};
+        //!\brief The end position of each record in the text.
+        std::vector<size_t> ends{};
+        //!\brief Whether the records are FASTQ records.
+        bool is_fastq{false};
+
+        //!\brief Returns the characters of the records `[first, last)`.
+        std::span<char const> records(size_t const first, size_t const last) const noexcept
+        {
+            size_t const text_begin = (first == 0u) ? 0u : ends[first - 1];
+            return {text.data() + text_begin, ends[last - 1] - text_begin};
+        }
+
+        //!\brief Returns the characters of the `i`-th record.
+        std::string_view record(size_t const i) const noexcept
+        {
+            std::span<char const> const characters = records(i, i + 1u);
+            return {characters.data(), characters.size()};
+        }
+    };
+
+    //!\brief Reads one file in blocks and splits the blocks into records.
+    class mate_reader
+    {
+    public:
+        //!\brief Opens the given file.
+        void open(std::filesystem::path const & filename)
+        {
+            primary_stream = stream_ptr_t{new std::ifstream{filename, std::ios_base::in | std::ios::binary},
+                                          stream_deleter_default};
+
+            if (!primary_stream->good())
+                throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+            std::filesystem::path file_name{filename};
+            secondary_stream = detail::make_secondary_istream(*primary_stream, file_name);
+
+            if (secondary_stream.get() == primary_stream.get()) // an uncompressed file can be read ahead directly
+                plain_file_path = filename;
+        }
+
+        //!\brief Reads from the given stream.
+        void open(std::istream & stream)
+        {
+            secondary_stream = detail::make_secondary_istream(stream);
+        }
+
+        //!\brief Replaces the stream by a stream that reads ahead on a background thread, if requested.
+        void start_read_ahead(size_t const buffer_size, size_t const buffer_count)
+        {
+            if (buffer_count == 0u)
+                return;
+
+            using read_ahead_stream_t = detail::read_ahead_istream<char>;
+            size_t const size = std::max<size_t>(buffer_size, 1u);
+
+            if (plain_file_path.empty())
+                secondary_stream = stream_ptr_t{new read_ahead_stream_t{std::move(secondary_stream),
+                                                                        size,
+                                                                        buffer_count},
+                                                stream_deleter_default};
+            else
+                secondary_stream = stream_ptr_t{new read_ahead_stream_t{std::move(secondary_stream),
+                                                                        plain_file_path,
+                                                                        size,
+                                                                        buffer_count},
+                                                stream_deleter_default};
+        }
+
+        /*!\brief Appends the next record to the given batch.
+         * \returns `false` if there are no more records.
+         * \throws seqan3::parse_error If the file is neither a FASTA nor a FASTQ file or a record does not start with
+         *                             the ID character of the format.
+         * \throws seqan3::unexpected_end_of_input If the last record of a FASTQ file is incomplete.
+         */
+        bool read_record(raw_batch & batch)
+        {
+            for (;;)
+            {
+                while (position != block_end && (*position == '\n' || *position == '\r'))
+                    ++position;
+
+                if (position == block_end)
+                {
+                    if (block_reader.is_last_block())
+                        return false;
+
+                    load_block(position);
+                    continue;
+                }
+
+                if (format == file_format::unknown)
+                {
+                    if (*position == '>' || *position == ';')
+                        format = file_format::fasta;
+                    else if (*position == '@')
+                        format = file_format::fastq;
+                    else
+                        throw parse_error{"Expected a FASTA ('>') or FASTQ ('@') record, but found \"" +
+                                          std::string{*position} + "\"."};
+                }
+
+                detail::sequence_record_scanner const scanner{block_end, block_reader.is_last_block()};
+                std::optional<detail::sequence_record_fields> const fields =
+                    (format == file_format::fasta) ? scanner.fasta_record(position) : scanner.fastq_record(position);
+
+                if (!fields.has_value()) // the record continues in the next block
+                {
+                    load_block(position);
+                    continue;
+                }
+
+                char const * const end = fields->end;
+                batch.text.insert(batch.text.end(), position, end);
+                batch.ends.push_back(batch.text.size());
+                batch.is_fastq = (format == file_format::fastq);
+                position = end;
+                return true;
+            }
+        }
+
+    private:
+        //!\brief The detected format of the file.
+        enum struct file_format : uint8_t
+        {
+            unknown, //!< No record was read yet.
+            fasta,   //!< The file is a FASTA file.
+            fastq    //!< The file is a FASTQ file.
+        };
+
+        //!\brief The file stream if constructed from a filename.
+        stream_ptr_t primary_stream{nullptr, stream_deleter_noop};
+        //!\brief The (decompressing) stream that the blocks are read from.
+        stream_ptr_t secondary_stream{nullptr, stream_deleter_noop};
+        //!\brief The path of the file if it was opened by filename and is not compressed; empty otherwise.
+        std::filesystem::path plain_file_path{};
+        //!\brief Reads the blocks from the secondary stream.
+        detail::record_block_reader<char> block_reader{block_size};
+        //!\brief The end of the current block.
+        char const * block_end{nullptr};
+        //!\brief The current position in the block.
+        char const * position{nullptr};
+        //!\brief The detected format.
+        file_format format{file_format::unknown};
+
+        //!\brief Reads the next block and keeps the characters from `unconsumed` on.
+        void load_block(char const * const unconsumed)
+        {
+            std::span<char const> const block = block_reader.read_block(*secondary_stream, block_end - unconsumed);
+            position = block.data();
+            block_end = block.data() + block.size();
+        }
+    };
+
+    //!\brief The readers of the files; only one for interleaved files.
+    std::vector<mate_reader> readers{};
+    //!\brief The raw records of the first and the second mates of the current batch.
+    std::array<raw_batch, 2> raw_batches{};
+    //!\brief The number of pairs read before the current batch.
+    size_t pair_count{0};
+    //!\brief The threads that parse the batches; held by pointer, because the pool cannot be moved.
+    std::unique_ptr<detail::worker_pool> workers{nullptr};
+
+    //!\brief The current batch.
+    batch_type record_buffer{};
+    //!\brief Tracks whether the very first batch is buffered when calling begin().
+    bool first_record_was_read{false};
+    //!\brief File is at position 1 behind the last batch.
+    bool at_end{false};
+
+    //!\brief Returns the read name of a raw record, i.e. the ID up to the first whitespace without `/1` or `/2`.
+    static std::string_view read_name(std::string_view const record) noexcept
+    {
+        size_t const name_begin = std::min(record.find_first_not_of(" \t", 1u), record.size());
+        std::string_view name = record.substr(name_begin, record.find_first_of(" \t\r\n", name_begin) - name_begin);
+
+        if (name.size() >= 2u && name[name.size() - 2u] == '/' && (name.back() == '1' || name.back() == '2'))
+            name.remove_suffix(2u);
+
+        return name;
+    }
+
+    //!\brief Reads a single record from `stream` with the format `f` into `record`.
+    template <typename format_t>
+    void read_record(std::istream & stream, format_t & f, record_type & record)
+    {
+        if constexpr (selected_field_ids::contains(field::seq_qual))
+        {
+            f.read_sequence_record(stream,
+                                   options,
+                                   detail::get_or_ignore<field::seq_qual>(record),
+                                   detail::get_or_ignore<field::id>(record),
+                                   detail::get_or_ignore<field::seq_qual>(record));
+        }
+        else
+        {
+            f.read_sequence_record(stream,
+                                   options,
+                                   detail::get_or_ignore<field::seq>(record),
+                                   detail::get_or_ignore<field::id>(record),
+                                   detail::get_or_ignore<field::qual>(record));
+        }
+    }
+
+    //!\brief Parses the pairs `[first, last)` of the batch and checks their read names.
+    void parse_pairs(size_t const first, size_t const last)
+    {
+        for (size_t mate = 0; mate < 2u; ++mate)
+        {
+            // The records are parsed directly from the batch, no data is copied into a stream buffer.
+            detail::memory_istreambuf<char> buffer{raw_batches[mate].records(first, last)};
+            std::istream stream{&buffer};
+            detail::sequence_file_input_format_exposer<format_fasta> fasta{};
+            detail::sequence_file_input_format_exposer<format_fastq> fastq{};
+
+            for (size_t i = first; i < last; ++i)
+            {
+                record_type & record = (mate == 0u) ? record_buffer[i].first : record_buffer[i].second;
+                record.clear();
+
+                if (raw_batches[mate].is_fastq)
+                    read_record(stream, fastq, record);
+                else
+                    read_record(stream, fasta, record);
+            }
+        }
+
+        if (!options.check_read_names)
+            return;
+
+        for (size_t i = first; i < last; ++i)
+        {
+            std::string_view const first_name = read_name(raw_batches[0].record(i));
+            std::string_view const second_name = read_name(raw_batches[1].record(i));
+
+            if (first_name != second_name)
+                throw parse_error{"The read names of pair " + std::to_string(pair_count + i + 1u) +
+                                  " do not match: \"" + std::string{first_name} + "\" and \"" +
+                                  std::string{second_name} + "\"."};
+        }
+    }
+
+    //!\brief Reads the next batch of pairs into the record buffer or sets `at_end`.
+    void read_next_record()
+    {
+        pair_count += record_buffer.size();
+
+        for (raw_batch & batch : raw_batches)
+        {
+            batch.text.clear();
+            batch.ends.clear();
+        }
+
+        size_t const batch_size = std::max<size_t>(options.batch_size, 1u);
+
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            bool const has_first = readers[0].read_record(raw_batches[0]);
+            bool const has_second = readers.back().read_record(raw_batches[1]);
+
+            if (has_first != has_second)
+            {
+                if (readers.size() == 1u)
+                    throw unexpected_end_of_input{"The interleaved file has an odd number of records."};
+
+                throw unexpected_end_of_input{has_first ? "The second file has fewer records than the first file."
+                                                        : "The first file has fewer records than the second file."};
+            }
+
+            if (!has_first)
+                break;
+        }
+
+        size_t const pair_number = raw_batches[0].ends.size();
+        record_buffer.resize(pair_number);
+
+        if (pair_number == 0u)
+        {
+            at_end = true;
+            return;
+        }
+
+        // parse the pairs in chunks of roughly equal size
+        size_t const thread_count = (workers == nullptr) ? 1u : workers->thread_count();
+        size_t const chunk_count = std::min(thread_count, pair_number);
+        std::vector<std::exception_ptr> errors(chunk_count);
+
+        auto parse_chunk = [&] (size_t const chunk_id)
+        {
+            try
+            {
+                parse_pairs(chunk_id * pair_number / chunk_count, (chunk_id + 1u) * pair_number / chunk_count);
+            }
+            catch (...)
+            {
+                errors[chunk_id] = std::current_exception();
+            }
+        };
+
+        if (workers == nullptr)
+            parse_chunk(0u);
+        else
+            workers->run(chunk_count, parse_chunk);
+
+        // report the first error in file order
+        for (std::exception_ptr & error : errors)
+            if (error)
+                std::rethrow_exception(error);
+    }
+
+    //!\brief Befriend iterator so it can access the buffers.
+    friend iterator;
+};
+
+} // namespace seqan3
@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::paired_sequence_file_input_options.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/io/sequence_file/input_options.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The options of seqan3::paired_sequence_file_input.
+ * \ingroup sequence_file
+ * \tparam sequence_legal_alphabet The sequence legal alphabet exposed as type trait to the format.
+ * \tparam seq_qual_combined Trait that exposes to the format whether seq and qual arguments are actually the
+ * same/combined.
+ *
+ * \details
+ *
+ * The members of seqan3::sequence_file_input_options apply to both files; the read-ahead options configure a
+ * background thread per file, such that two compressed files are decompressed concurrently.
+ */
+template <typename sequence_legal_alphabet, bool seq_qual_combined>
+struct paired_sequence_file_input_options : public sequence_file_input_options<sequence_legal_alphabet,
+                                                                               seq_qual_combined>
+{
+    //!\brief The maximal number of record pairs per batch.
+    size_t batch_size = 10000;
+
+    /*!\brief The number of threads used to parse the records of a batch.
+     * \details The threads are created on the first call to begin(), later changes have no effect.
+     */
+    size_t thread_count = 1;
+
+    /*!\brief Whether the read names of the mates are checked to be equal [default: true].
+     *
+     * \details
+     *
+     * The read name is the ID up to the first whitespace, without a trailing `/1` or `/2`. A mismatch raises
+     * seqan3::parse_error.
+     */
+    bool check_read_names = true;
+};
+
+} // namespace seqan3
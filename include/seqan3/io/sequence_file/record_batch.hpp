@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_record_batch.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/range/container/concatenated_sequences.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A batch of sequence records stored as struct-of-arrays.
+ * \ingroup sequence_file
+ * \tparam id_type       The type of a single ID, e.g. std::string.
+ * \tparam sequence_type The type of a single sequence, e.g. std::vector<seqan3::dna5>.
+ * \tparam quality_type  The type of a single quality sequence, e.g. std::vector<seqan3::phred42>.
+ *
+ * \details
+ *
+ * The IDs, sequences and qualities of all records are each stored in one seqan3::concatenated_sequences, i.e. in
+ * one contiguous container per field. The i-th record consists of the i-th element of #ids, #sequences and
+ * #base_qualities; fields that were not read are stored as empty elements, such that all members have the same
+ * size.
+ *
+ * The batch is filled by seqan3::sequence_file_input::read_batch. It is cleared, but keeps its memory, when it is
+ * filled again, such that no memory is allocated once the batch has reached its largest size.
+ *
+ * \include test/snippet/io/sequence_file/sequence_file_input_read_batch.cpp
+ */
+template <typename id_type, typename sequence_type, typename quality_type>
+struct sequence_record_batch
+{
+    //!\brief The IDs of the records.
+    concatenated_sequences<id_type> ids{};
+    //!\brief The sequences of the records.
+    concatenated_sequences<sequence_type> sequences{};
+    //!\brief The qualities of the records.
+    concatenated_sequences<quality_type> base_qualities{};
+
+    //!\brief Returns the number of records.
+    size_t size() const noexcept
+    {
+        return ids.size();
+    }
+
+    //!\brief Checks whether the batch contains no records.
+    bool empty() const noexcept
+    {
+        return ids.empty();
+    }
+
+    //!\brief Removes all records, but keeps the allocated memory.
+    void clear() noexcept
+    {
+        ids.clear();
+        sequences.clear();
+        base_qualities.clear();
+    }
+
+    //!\brief Reserves memory for the delimiters of `count` records.
+    void reserve(size_t const count)
+    {
+        ids.reserve(count);
+        sequences.reserve(count);
+        base_qualities.reserve(count);
+    }
+};
+
+} // namespace seqan3
@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_record_view.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/ranges>
+#include <string_view>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A sequence record that refers to the characters of the file instead of owning its fields.
+ * \ingroup sequence_file
+ * \tparam alphabet_type The alphabet of the sequence; must model seqan3::writable_alphabet.
+ * \tparam quality_alphabet_type The alphabet of the qualities; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * This is the record type of seqan3::sequence_file_view_input. The fields are views into the memory mapped file or
+ * the block buffer of the file and are only valid as long as the file provides them, see
+ * seqan3::sequence_file_view_input for details.
+ *
+ * The raw characters are accessible via sequence_chars() and base_quality_chars(). They still contain the line
+ * breaks of multi-line records. The members sequence() and base_qualities() return lazy views that skip the line
+ * breaks (and for sequences also digits, as seqan3::format_fasta does) and convert the characters to letters on
+ * access. Copy the views into a container if the record has to outlive the file buffer.
+ *
+ * The characters are not validated, i.e. invalid characters are converted as by seqan3::assign_char_to.
+ */
+template <writable_alphabet alphabet_type = dna5, writable_alphabet quality_alphabet_type = phred42>
+class sequence_record_view
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr sequence_record_view() = default; //!< Defaulted.
+    constexpr sequence_record_view(sequence_record_view const &) = default; //!< Defaulted.
+    constexpr sequence_record_view(sequence_record_view &&) = default; //!< Defaulted.
+    constexpr sequence_record_view & operator=(sequence_record_view const &) = default; //!< Defaulted.
+    constexpr sequence_record_view & operator=(sequence_record_view &&) = default; //!< Defaulted.
+    ~sequence_record_view() = default; //!< Defaulted.
+
+    /*!\brief Constructs the record from the characters of its fields.
+     * \param[in] id The ID, i.e. the header line without the leading `>` or `@` and the line break.
+     * \param[in] sequence The raw characters of the sequence.
+     * \param[in] qualities The raw characters of the qualities; empty for FASTA records.
+     */
+    constexpr sequence_record_view(std::string_view const id,
+                                   std::string_view const sequence,
+                                   std::string_view const qualities) noexcept :
+        id_chars{id},
+        sequence_characters{sequence},
+        quality_characters{qualities}
+    {}
+    //!\}
+
+    //!\brief The ID of the record.
+    constexpr std::string_view id() const noexcept
+    {
+        return id_chars;
+    }
+
+    //!\brief The raw characters of the sequence including the line breaks of multi-line records.
+    constexpr std::string_view sequence_chars() const noexcept
+    {
+        return sequence_characters;
+    }
+
+    //!\brief The raw characters of the qualities including the line breaks of multi-line records.
+    constexpr std::string_view base_quality_chars() const noexcept
+    {
+        return quality_characters;
+    }
+
+    //!\brief A lazy view over the letters of the sequence.
+    auto sequence() const
+    {
+        return sequence_characters | std::views::filter(!(is_space || is_digit))
+                                   | views::char_to<alphabet_type>;
+    }
+
+    //!\brief A lazy view over the qualities.
+    auto base_qualities() const
+    {
+        return quality_characters | std::views::filter(!is_space)
+                                  | views::char_to<quality_alphabet_type>;
+    }
+
+private:
+    //!\brief The ID.
+    std::string_view id_chars{};
+    //!\brief The raw sequence.
+    std::string_view sequence_characters{};
+    //!\brief The raw qualities.
+    std::string_view quality_characters{};
+};
+
+} // namespace seqan3
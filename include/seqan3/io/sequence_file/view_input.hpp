@@ -0,0 +1,287 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_file_view_input.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <seqan3/std/span>
+#include <string>
+#include <string_view>
+
+#include <seqan3/io/detail/in_file_iterator.hpp>
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/record_block_reader.hpp>
+#include <seqan3/io/detail/sequence_record_scanner.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_file/record_view.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A FASTA/FASTQ input file whose records refer to the file content instead of copying it.
+ * \ingroup sequence_file
+ * \tparam alphabet_type The alphabet of the sequences; must model seqan3::writable_alphabet.
+ * \tparam quality_alphabet_type The alphabet of the qualities; must model seqan3::writable_alphabet.
+ * \implements std::ranges::input_range
+ *
+ * \details
+ *
+ * seqan3::sequence_file_input copies the ID, the sequence and the qualities of every record into the containers of
+ * its record buffer. Tools that only inspect the records, e.g. to filter or count them, do not need these copies.
+ * This file provides the records as seqan3::sequence_record_view, which only stores the positions of the fields in
+ * the file content. The sequence and the qualities are converted lazily when they are accessed.
+ *
+ * Uncompressed files that are opened by name are memory mapped and the records stay valid as long as the file
+ * object exists. Compressed files and streams are read in large blocks of complete records into a reusable buffer
+ * (see `block_size`); in this case a record is only valid until the iterator is incremented, because the next
+ * block may overwrite the buffer.
+ *
+ * The format (FASTA or FASTQ) is detected from the first character of the file. FASTA records may span multiple
+ * lines, FASTQ records may have multi-line sequences and qualities.
+ *
+ * ### Example
+ *
+ * \include test/snippet/io/sequence_file/sequence_file_view_input.cpp
+ */
+template <writable_alphabet alphabet_type = dna5, writable_alphabet quality_alphabet_type = phred42>
+class sequence_file_view_input
+{
+public:
+    //!\brief The type of the records.
+    using record_type = sequence_record_view<alphabet_type, quality_alphabet_type>;
+
+    /*!\name Range associated types
+     * \brief The types necessary to facilitate the behaviour of an input range (used in record-wise reading).
+     * \{
+     */
+    //!\brief The value_type is the \ref record_type.
+    using value_type        = record_type;
+    //!\brief The reference type.
+    using reference         = record_type &;
+    //!\brief The const_reference type is void, because files are not const-iterable.
+    using const_reference   = void;
+    //!\brief An unsigned integer type, usually std::size_t.
+    using size_type         = size_t;
+    //!\brief A signed integer type, usually std::ptrdiff_t.
+    using difference_type   = std::make_signed_t<size_t>;
+    //!\brief The iterator type of this view (an input iterator).
+    using iterator          = detail::in_file_iterator<sequence_file_view_input>;
+    //!\brief The const iterator type is void, because files are not const-iterable.
+    using const_iterator    = void;
+    //!\brief The type returned by end().
+    using sentinel          = std::default_sentinel_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_file_view_input() = delete; //!< Deleted.
+    sequence_file_view_input(sequence_file_view_input const &) = delete; //!< Deleted, because the records refer to it.
+    sequence_file_view_input(sequence_file_view_input &&) = delete; //!< Deleted, because the records refer to it.
+    sequence_file_view_input & operator=(sequence_file_view_input const &) = delete; //!< Deleted.
+    sequence_file_view_input & operator=(sequence_file_view_input &&) = delete; //!< Deleted.
+    ~sequence_file_view_input() = default; //!< Defaulted.
+
+    /*!\brief Opens the given file.
+     * \param[in] filename The path of the FASTA or FASTQ file; may be compressed.
+     * \param[in] block_size The number of bytes that are read at once if the file cannot be memory mapped.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     *
+     * \details
+     *
+     * Uncompressed files are memory mapped, compressed files are decompressed into the block buffer.
+     */
+    explicit sequence_file_view_input(std::filesystem::path const & filename, size_t const block_size = 1u << 22) :
+        block_reader{block_size}
+    {
+        primary_stream = std::make_unique<std::ifstream>(filename, std::ios_base::in | std::ios::binary);
+
+        if (!primary_stream->good())
+            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+        std::filesystem::path file_name{filename};
+        secondary_stream = detail::make_secondary_istream(*primary_stream, file_name);
+
+        if (secondary_stream.get() == primary_stream.get()) // The file is not compressed.
+        {
+            secondary_stream.reset();
+            primary_stream.reset();
+            mapped_file = detail::memory_mapped_file{filename};
+            std::span<char const> const content = mapped_file.chars();
+            block_begin = content.data();
+            block_end = content.data() + content.size();
+            position = block_begin;
+        }
+    }
+
+    /*!\brief Reads from the given stream.
+     * \param[in] stream The stream to read the FASTA or FASTQ file from; may be compressed.
+     * \param[in] block_size The number of bytes that are read at once.
+     *
+     * \details
+     *
+     * The stream must outlive this object.
+     */
+    explicit sequence_file_view_input(std::istream & stream, size_t const block_size = 1u << 22) :
+        secondary_stream{detail::make_secondary_istream(stream)},
+        block_reader{block_size}
+    {}
+    //!\}
+
+    /*!\name Range interface
+     * \brief Provides functions for record based reading of the file.
+     * \{
+     */
+    /*!\brief Returns an iterator to current position in the file.
+     * \throws seqan3::parse_error If the first record is not a FASTA or FASTQ record.
+     * \throws seqan3::unexpected_end_of_input If the first record is incomplete.
+     */
+    iterator begin()
+    {
+        // buffer first record
+        if (!first_record_was_read)
+        {
+            read_next_record();
+            first_record_was_read = true;
+        }
+
+        return {*this};
+    }
+
+    //!\brief Returns a sentinel for comparison with iterator.
+    sentinel end() noexcept
+    {
+        return {};
+    }
+
+    //!\brief Return the record we are currently at in the file.
+    reference front()
+    {
+        return *begin();
+    }
+    //!\}
+
+    //!\brief Whether the file is memory mapped, i.e. the records stay valid as long as the file object exists.
+    bool is_memory_mapped() const noexcept
+    {
+        return secondary_stream == nullptr;
+    }
+
+private:
+    //!\brief The detected format of the file.
+    enum struct file_format : uint8_t
+    {
+        unknown, //!< No record was read yet.
+        fasta,   //!< The file is a FASTA file.
+        fastq    //!< The file is a FASTQ file.
+    };
+
+    //!\brief Reads the next record into the record buffer or sets `at_end`.
+    void read_next_record()
+    {
+        for (;;)
+        {
+            while (position != block_end && (*position == '\n' || *position == '\r'))
+                ++position;
+
+            if (position == block_end)
+            {
+                if (is_last_block())
+                {
+                    at_end = true;
+                    return;
+                }
+
+                load_block(position);
+                continue;
+            }
+
+            if (format == file_format::unknown)
+            {
+                if (*position == '>' || *position == ';')
+                    format = file_format::fasta;
+                else if (*position == '@')
+                    format = file_format::fastq;
+                else
+                    throw parse_error{"Expected a FASTA ('>') or FASTQ ('@') record, but found \"" +
+                                      std::string{*position} + "\"."};
+            }
+
+            detail::sequence_record_scanner const scanner{block_end, is_last_block()};
+            std::optional<detail::sequence_record_fields> const fields =
+                (format == file_format::fasta) ? scanner.fasta_record(position) : scanner.fastq_record(position);
+
+            if (fields.has_value())
+            {
+                record_buffer = record_type{fields->id, fields->sequence, fields->qualities};
+                position = fields->end;
+                return;
+            }
+
+            // The record may continue in the next block.
+            assert(!is_last_block());
+            load_block(position);
+        }
+    }
+
+    //!\brief Whether the current block contains the end of the file.
+    bool is_last_block() const noexcept
+    {
+        return secondary_stream == nullptr || block_reader.is_last_block();
+    }
+
+    //!\brief Reads the next block and keeps the characters from `unconsumed` on.
+    void load_block(char const * const unconsumed)
+    {
+        std::span<char const> const block = block_reader.read_block(*secondary_stream, block_end - unconsumed);
+        block_begin = block.data();
+        block_end = block.data() + block.size();
+        position = block_begin;
+    }
+
+    //!\brief The file stream if the file is read in blocks.
+    std::unique_ptr<std::ifstream> primary_stream{};
+    //!\brief The (decompressing) stream if the file is read in blocks.
+    std::unique_ptr<std::istream, std::function<void(std::istream *)>> secondary_stream{nullptr,
+                                                                                         [] (std::istream *) {}};
+    //!\brief The memory mapped file if the file is not compressed.
+    detail::memory_mapped_file mapped_file{};
+    //!\brief Reads the blocks from the secondary stream.
+    detail::record_block_reader<char> block_reader{};
+    //!\brief The begin of the current block.
+    char const * block_begin{nullptr};
+    //!\brief The end of the current block.
+    char const * block_end{nullptr};
+    //!\brief The current position in the block.
+    char const * position{nullptr};
+    //!\brief The detected format.
+    file_format format{file_format::unknown};
+
+    //!\brief The current record.
+    record_type record_buffer{};
+    //!\brief Tracks whether the very first record is buffered when calling begin().
+    bool first_record_was_read{false};
+    //!\brief File is at position 1 behind the last record.
+    bool at_end{false};
+
+    //!\brief Befriend iterator so it can access the buffers.
+    friend iterator;
+};
+
+} // namespace seqan3
@@ -14,6 +14,7 @@
 
 #include <seqan3/range/container/all.hpp>
 #include <seqan3/range/decorator/all.hpp>
+#include <seqan3/range/translate_frames.hpp>
 #include <seqan3/range/views/all.hpp>
 
 /*!\defgroup range Range
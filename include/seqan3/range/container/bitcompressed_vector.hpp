@@ -12,13 +12,20 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <sdsl/int_vector.hpp>
 
 #include <seqan3/alphabet/detail/alphabet_proxy.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/utility/math.hpp>
 #include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/range/detail/packed_word_operations.hpp>
 #include <seqan3/range/detail/random_access_iterator.hpp>
 #include <seqan3/range/views/to_char.hpp>
 #include <seqan3/range/views/to_rank.hpp>
@@ -765,6 +772,18 @@ public:
         auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it}
                | views::convert<value_type>
                | views::to_rank;
+
+        if constexpr (std::sized_sentinel_for<end_iterator_type, begin_iterator_type> && bits_per_letter > 0)
+        {
+            if (pos == cend()) // Appending: pack the letters directly into the words instead of one by one.
+            {
+                size_type const old_size = size();
+                data.resize(old_size + std::ranges::distance(begin_it, end_it));
+                detail::packed_word_operations<bits_per_letter>::write_range(data.data(), old_size, v);
+                return begin() + pos_as_num;
+            }
+        }
+
         data.insert(data.begin() + pos_as_num, std::ranges::begin(v), std::ranges::end(v));
 
         return begin() + pos_as_num;
@@ -1036,4 +1055,149 @@ public:
     //!\endcond
 };
 
+/*!\name Bulk operations
+ * \brief Operations on seqan3::bitcompressed_vector that process the packed 64 bit words at once.
+ * \relates seqan3::bitcompressed_vector
+ *
+ * \details
+ *
+ * These operations work directly on the packed words instead of accessing every letter through the
+ * reference proxy. If the number of bits per letter divides 64, e.g. for seqan3::dna4 or seqan3::dna15,
+ * whole words are processed at once, otherwise the letters are extracted one after another from the words.
+ * \{
+ */
+
+/*!\brief Reverse complements the sequence in place.
+ * \tparam alphabet_type The alphabet of the sequence; must model seqan3::nucleotide_alphabet.
+ * \param[in,out] sequence The sequence to reverse complement.
+ *
+ * \details
+ *
+ * Equivalent to `sequence = sequence | std::views::reverse | seqan3::views::complement`, but reverses the letters
+ * within a word in registers and complements a whole word with a single XOR if the complement of every rank is the rank
+ * with all bits flipped, e.g. for seqan3::dna4 and seqan3::rna4.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of words.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <writable_semialphabet alphabet_type>
+//!\cond
+    requires std::regular<alphabet_type> && nucleotide_alphabet<alphabet_type>
+//!\endcond
+void reverse_complement(bitcompressed_vector<alphabet_type> & sequence) noexcept
+{
+    constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_type>);
+
+    static std::array<uint64_t, alphabet_size<alphabet_type>> const complement_ranks = []
+    {
+        std::array<uint64_t, alphabet_size<alphabet_type>> ranks{};
+        for (size_t rank = 0; rank < ranks.size(); ++rank)
+            ranks[rank] = seqan3::to_rank(seqan3::complement(assign_rank_to(rank, alphabet_type{})));
+        return ranks;
+    }();
+
+    detail::packed_word_operations<bits_per_letter>::reverse_complement(sequence.raw_data().data(),
+                                                                        sequence.size(),
+                                                                        complement_ranks);
+}
+
+/*!\brief Counts the positions at which two sequences have different letters.
+ * \tparam alphabet_type The alphabet of the sequences.
+ * \param[in] lhs The first sequence.
+ * \param[in] rhs The second sequence.
+ * \returns The number of positions `i < std::min(lhs.size(), rhs.size())` with `lhs[i] != rhs[i]`.
+ *
+ * \details
+ *
+ * For sequences of the same length this is the Hamming distance. If the number of bits per letter divides 64, the
+ * XOR of two words is folded to a single bit per letter and counted with one popcount per word.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of words.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <writable_semialphabet alphabet_type>
+//!\cond
+    requires std::regular<alphabet_type>
+//!\endcond
+size_t count_mismatches(bitcompressed_vector<alphabet_type> const & lhs,
+                        bitcompressed_vector<alphabet_type> const & rhs) noexcept
+{
+    constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_type>);
+
+    if constexpr (bits_per_letter == 0)
+        return 0u;
+    else
+        return detail::packed_word_operations<bits_per_letter>::count_mismatches(lhs.raw_data().data(),
+                                                                                 rhs.raw_data().data(),
+                                                                                 std::min(lhs.size(), rhs.size()));
+}
+
+/*!\brief Computes the hash values of all k-mers of the sequence.
+ * \tparam alphabet_type The alphabet of the sequence.
+ * \param[in] sequence The sequence.
+ * \param[in] k The length of the k-mers.
+ * \returns The hash value of every k-mer in the order of the sequence; empty if `k` is zero or larger than the
+ *          sequence.
+ * \throws std::invalid_argument if the hash values cannot be represented in `uint64_t`, i.e.
+ *         \f$k>\frac{64}{\log_2\sigma}\f$ with alphabet size \f$\sigma\f$.
+ *
+ * \details
+ *
+ * The hash values are identical to the ones of `sequence | seqan3::views::kmer_hash(seqan3::ungapped{k})`, but the
+ * letters are shifted out of the packed words instead of being accessed through the reference proxy.
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the sequence.
+ */
+template <writable_semialphabet alphabet_type>
+//!\cond
+    requires std::regular<alphabet_type>
+//!\endcond
+std::vector<size_t> kmer_hashes(bitcompressed_vector<alphabet_type> const & sequence, size_t const k)
+{
+    constexpr size_t bits_per_letter = detail::ceil_log2(alphabet_size<alphabet_type>);
+    constexpr size_t sigma = alphabet_size<alphabet_type>;
+    using operations_t = detail::packed_word_operations<std::max<size_t>(bits_per_letter, 1u)>;
+
+    if (k > (64 / std::log2(sigma)))
+        throw std::invalid_argument{"The chosen k/alphabet combination is not valid. "
+                                    "The alphabet or k must be reduced."};
+
+    std::vector<size_t> hashes{};
+    if (k == 0 || sequence.size() < k)
+        return hashes;
+
+    hashes.reserve(sequence.size() - k + 1);
+
+    uint64_t const * words = sequence.raw_data().data();
+    size_t const roll_factor = pow(sigma, k - 1);
+    size_t hash_value{0};
+    size_t position{0};
+
+    operations_t::for_each_rank(words, 0u, sequence.size(), [&] (uint64_t const rank)
+    {
+        if (position >= k)
+            hash_value -= operations_t::read(words, position - k) * roll_factor;
+
+        hash_value = hash_value * sigma + rank;
+
+        if (++position >= k)
+            hashes.push_back(hash_value);
+    });
+
+    return hashes;
+}
+//!\}
+
 } // namespace seqan3
@@ -0,0 +1,604 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::packed_sequences.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cstring>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <seqan3/std/iterator>
+#include <limits>
+#include <memory>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/range/detail/elias_fano_sequence.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/utility/math.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A random access iterator over the letters of a seqan3::packed_sequences.
+ * \ingroup container
+ * \tparam alphabet_type The alphabet of the packed letters.
+ * \implements std::random_access_iterator
+ *
+ * \details
+ *
+ * The letters are stored in 64 bit words with seqan3::detail::packed_letter_iterator::letters_per_word many letters
+ * per word. A letter is never split across two words, such that reading a letter requires only a single shift and
+ * mask. The iterator does not refer to the container but only to the packed words, so it stays valid as long as the
+ * words are valid.
+ */
+template <writable_semialphabet alphabet_type>
+class packed_letter_iterator
+{
+public:
+    //!\brief The number of bits of a single letter.
+    static constexpr size_t bits_per_letter = std::max<size_t>(ceil_log2(alphabet_size<alphabet_type>), 1u);
+    //!\brief The number of letters stored in a single word.
+    static constexpr size_t letters_per_word = 64u / bits_per_letter;
+
+    static_assert(bits_per_letter <= 32, "The alphabet must be representable in at most 32 bits.");
+
+    /*!\name Associated types
+     * \{
+     */
+    using difference_type = std::ptrdiff_t; //!< Type for distances between iterators.
+    using value_type = alphabet_type; //!< Value type of the letters.
+    using reference = alphabet_type; //!< The letters are decoded on access and returned by value.
+    using pointer = void; //!< There is no pointer type.
+    using iterator_category = std::random_access_iterator_tag; //!< The legacy iterator category.
+    using iterator_concept = std::random_access_iterator_tag; //!< The iterator concept.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr packed_letter_iterator() noexcept = default; //!< Defaulted.
+    constexpr packed_letter_iterator(packed_letter_iterator const &) noexcept = default; //!< Defaulted.
+    constexpr packed_letter_iterator(packed_letter_iterator &&) noexcept = default; //!< Defaulted.
+    constexpr packed_letter_iterator & operator=(packed_letter_iterator const &) noexcept = default; //!< Defaulted.
+    constexpr packed_letter_iterator & operator=(packed_letter_iterator &&) noexcept = default; //!< Defaulted.
+    ~packed_letter_iterator() noexcept = default; //!< Defaulted.
+
+    /*!\brief Constructs the iterator pointing to the letter at the given position.
+     * \param[in] words The packed words.
+     * \param[in] position The position of the letter.
+     */
+    constexpr packed_letter_iterator(uint64_t const * words, size_t const position) noexcept :
+        words{words},
+        position{position}
+    {}
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    //!\brief Returns the letter the iterator points to.
+    constexpr reference operator*() const noexcept
+    {
+        uint64_t const word = words[position / letters_per_word];
+        uint64_t const rank = (word >> ((position % letters_per_word) * bits_per_letter)) & letter_mask;
+        return assign_rank_to(rank, alphabet_type{});
+    }
+
+    //!\brief Returns the letter at the given offset.
+    constexpr reference operator[](difference_type const offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Pre-increment.
+    constexpr packed_letter_iterator & operator++() noexcept
+    {
+        ++position;
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    constexpr packed_letter_iterator operator++(int) noexcept
+    {
+        packed_letter_iterator tmp{*this};
+        ++position;
+        return tmp;
+    }
+
+    //!\brief Pre-decrement.
+    constexpr packed_letter_iterator & operator--() noexcept
+    {
+        --position;
+        return *this;
+    }
+
+    //!\brief Post-decrement.
+    constexpr packed_letter_iterator operator--(int) noexcept
+    {
+        packed_letter_iterator tmp{*this};
+        --position;
+        return tmp;
+    }
+
+    //!\brief Forward this iterator.
+    constexpr packed_letter_iterator & operator+=(difference_type const offset) noexcept
+    {
+        position += offset;
+        return *this;
+    }
+
+    //!\brief Decrement iterator by offset.
+    constexpr packed_letter_iterator & operator-=(difference_type const offset) noexcept
+    {
+        position -= offset;
+        return *this;
+    }
+
+    //!\brief Returns an iterator that is advanced by offset.
+    constexpr packed_letter_iterator operator+(difference_type const offset) const noexcept
+    {
+        return packed_letter_iterator{*this} += offset;
+    }
+
+    //!\brief Returns an iterator that is advanced by offset.
+    friend constexpr packed_letter_iterator operator+(difference_type const offset,
+                                                      packed_letter_iterator const & it) noexcept
+    {
+        return it + offset;
+    }
+
+    //!\brief Returns an iterator that is decremented by offset.
+    constexpr packed_letter_iterator operator-(difference_type const offset) const noexcept
+    {
+        return packed_letter_iterator{*this} -= offset;
+    }
+
+    //!\brief Returns the distance between two iterators.
+    constexpr difference_type operator-(packed_letter_iterator const & rhs) const noexcept
+    {
+        return static_cast<difference_type>(position) - static_cast<difference_type>(rhs.position);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Checks whether `*this` is equal to `rhs`.
+    constexpr bool operator==(packed_letter_iterator const & rhs) const noexcept
+    {
+        return position == rhs.position;
+    }
+
+    //!\brief Checks whether `*this` is not equal to `rhs`.
+    constexpr bool operator!=(packed_letter_iterator const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    //!\brief Checks whether `*this` is less than `rhs`.
+    constexpr bool operator<(packed_letter_iterator const & rhs) const noexcept
+    {
+        return position < rhs.position;
+    }
+
+    //!\brief Checks whether `*this` is greater than `rhs`.
+    constexpr bool operator>(packed_letter_iterator const & rhs) const noexcept
+    {
+        return position > rhs.position;
+    }
+
+    //!\brief Checks whether `*this` is less than or equal to `rhs`.
+    constexpr bool operator<=(packed_letter_iterator const & rhs) const noexcept
+    {
+        return position <= rhs.position;
+    }
+
+    //!\brief Checks whether `*this` is greater than or equal to `rhs`.
+    constexpr bool operator>=(packed_letter_iterator const & rhs) const noexcept
+    {
+        return position >= rhs.position;
+    }
+    //!\}
+
+private:
+    //!\brief The mask of a single letter.
+    static constexpr uint64_t letter_mask = (1ull << bits_per_letter) - 1u;
+
+    //!\brief The packed words.
+    uint64_t const * words{nullptr};
+    //!\brief The position of the letter.
+    size_t position{};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief An immutable collection of sequences that are stored bit-packed and can be memory mapped from a file.
+ * \tparam alphabet_type The alphabet of the sequences; must model seqan3::writable_semialphabet and std::regular.
+ * \implements std::ranges::random_access_range
+ * \implements std::ranges::sized_range
+ * \ingroup container
+ *
+ * \details
+ *
+ * This container stores a collection of sequences similar to seqan3::concatenated_sequences, but packs the letters
+ * into as few bits as possible, e.g. 2 bits for seqan3::dna4 and 4 bits for seqan3::dna15, and stores the begin
+ * positions of the sequences in the compressed Elias-Fano representation, which needs roughly
+ * \f$ 2 + \log_2(\overline{l}) \f$ bits per sequence for an average sequence length \f$ \overline{l} \f$.
+ *
+ * The complete collection lives in a single contiguous buffer of 64 bit words. The buffer can be written to a file with
+ * seqan3::packed_sequences::store and opened again with seqan3::packed_sequences::map, which maps the file read-only
+ * into memory. Mapping a file does not read the sequences, only the pages that are accessed are loaded by the
+ * operating system, such that large reference collections are available immediately and can be shared by multiple
+ * processes. On platforms without `mmap` the file is read into memory instead.
+ *
+ * An element of the collection is a std::ranges::subrange over the decoded letters. The letters are returned by value,
+ * hence the collection and its elements are read-only. Copying the collection is cheap, because all copies share the
+ * same buffer.
+ *
+ * The file format stores the words in the byte order of the machine and can only be mapped on machines with the
+ * same byte order. The alphabet size is validated when opening the file.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/container/packed_sequences.cpp
+ *
+ * ### Thread safety
+ *
+ * This container is immutable after construction and can be read from multiple threads concurrently.
+ */
+template <writable_semialphabet alphabet_type>
+//!\cond
+    requires std::regular<alphabet_type>
+//!\endcond
+class packed_sequences
+{
+private:
+    //!\brief The iterator over the letters.
+    using letter_iterator = detail::packed_letter_iterator<alphabet_type>;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief A sequence of the collection, i.e. a read-only range over the decoded letters.
+    using value_type = std::ranges::subrange<letter_iterator, letter_iterator, std::ranges::subrange_kind::sized>;
+    //!\brief The sequences are returned by value.
+    using reference = value_type;
+    //!\brief The sequences are returned by value.
+    using const_reference = value_type;
+    //!\brief The iterator type of this container (a random access iterator).
+    using iterator = detail::random_access_iterator<packed_sequences const>;
+    //!\brief The const iterator type of this container (a random access iterator).
+    using const_iterator = iterator;
+    //!\brief A signed integer type (usually std::ptrdiff_t)
+    using difference_type = std::ptrdiff_t;
+    //!\brief An unsigned integer type (usually std::size_t)
+    using size_type = size_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Constructs an empty collection.
+    packed_sequences() : packed_sequences{std::views::empty<std::vector<alphabet_type>>}
+    {}
+    packed_sequences(packed_sequences const &) = default; //!< Defaulted.
+    packed_sequences(packed_sequences &&) = default; //!< Defaulted.
+    packed_sequences & operator=(packed_sequences const &) = default; //!< Defaulted.
+    packed_sequences & operator=(packed_sequences &&) = default; //!< Defaulted.
+    ~packed_sequences() = default; //!< Defaulted.
+
+    /*!\brief Packs the given sequences.
+     * \tparam sequences_t The type of the sequences; must model std::ranges::input_range over
+     *                     std::ranges::input_range whose elements are convertible to `alphabet_type`.
+     * \param[in] sequences The sequences to pack.
+     *
+     * \details
+     *
+     * The sequences are read in a single pass.
+     *
+     * ### Complexity
+     *
+     * Linear in the total number of letters.
+     */
+    template <std::ranges::input_range sequences_t>
+    //!\cond
+        requires (!std::same_as<std::remove_cvref_t<sequences_t>, packed_sequences>) &&
+                 std::ranges::input_range<std::ranges::range_reference_t<sequences_t>> &&
+                 std::convertible_to<std::ranges::range_reference_t<std::ranges::range_reference_t<sequences_t>>,
+                                     alphabet_type>
+    //!\endcond
+    explicit packed_sequences(sequences_t && sequences)
+    {
+        std::vector<uint64_t> letters{};
+        std::vector<uint64_t> delimiters{0u};
+        uint64_t total_length{};
+
+        for (auto && sequence : sequences)
+        {
+            for (alphabet_type const letter : sequence)
+            {
+                if (total_length % letters_per_word == 0)
+                    letters.push_back(0u);
+
+                letters.back() |= static_cast<uint64_t>(to_rank(letter))
+                                  << ((total_length % letters_per_word) * bits_per_letter);
+                ++total_length;
+            }
+
+            delimiters.push_back(total_length);
+        }
+
+        auto buffer = std::make_shared<std::vector<uint64_t>>();
+        buffer->reserve(header_size + letters.size() + delimiters.size() / 4u + 16u);
+        buffer->resize(header_size, 0u);
+        (*buffer)[0] = magic;
+        (*buffer)[1] = format_version;
+        (*buffer)[2] = alphabet_size<alphabet_type>;
+        (*buffer)[3] = bits_per_letter;
+        (*buffer)[4] = letters.size();
+        buffer->insert(buffer->end(), letters.begin(), letters.end());
+        detail::elias_fano_sequence::encode(*buffer, delimiters);
+
+        std::span<uint64_t const> const words{*buffer};
+        storage = std::shared_ptr<uint64_t const>{std::move(buffer), words.data()};
+        initialise(words);
+    }
+    //!\}
+
+    /*!\name Persistence
+     * \{
+     */
+    /*!\brief Writes the collection to the given file.
+     * \param[in] file_path The path of the file; an existing file is overwritten.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::io_error if the file cannot be written.
+     */
+    void store(std::filesystem::path const & file_path) const
+    {
+        std::ofstream file{file_path, std::ios::binary | std::ios::trunc};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + file_path.string() + " for writing."};
+
+        file.write(reinterpret_cast<char const *>(storage.get()), word_count * sizeof(uint64_t));
+        file.close();
+
+        if (file.fail())
+            throw io_error{"Could not write the packed sequences to " + file_path.string() + "."};
+    }
+
+    /*!\brief Opens a collection that was written with seqan3::packed_sequences::store.
+     * \param[in] file_path The path of the file.
+     * \returns A read-only collection over the memory mapped file.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     * \throws seqan3::format_error if the file does not contain packed sequences of this alphabet.
+     *
+     * \details
+     *
+     * The file is mapped read-only and unmapped when the last copy of the returned collection is destroyed.
+     * The file must not be modified while it is mapped.
+     */
+    static packed_sequences map(std::filesystem::path const & file_path)
+    {
+        packed_sequences result{uninitialised_tag{}};
+        detail::memory_mapped_file const file{file_path};
+        size_t const size_in_bytes = file.size();
+
+        if (size_in_bytes == 0 || size_in_bytes % sizeof(uint64_t) != 0)
+            throw format_error{"The file " + file_path.string() + " does not contain packed sequences."};
+
+        result.storage = std::shared_ptr<uint64_t const>{file.owner(), static_cast<uint64_t const *>(file.data())};
+
+        std::span<uint64_t const> const words{result.storage.get(), size_in_bytes / sizeof(uint64_t)};
+
+        try
+        {
+            result.initialise(words);
+        }
+        catch (std::invalid_argument const & error)
+        {
+            throw format_error{"The file " + file_path.string() + " does not contain valid packed sequences: " +
+                               error.what()};
+        }
+
+        return result;
+    }
+
+    //!\brief Returns the number of bytes occupied by the collection, i.e. the size of the stored file.
+    size_t memory_footprint() const noexcept
+    {
+        return word_count * sizeof(uint64_t);
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the container.
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this};
+    }
+
+    //!\brief Returns an iterator to the element following the last element of the container.
+    const_iterator end() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, size()};
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Return the i-th element.
+     * \param i The element to retrieve.
+     * \returns A range over the letters of the i-th sequence.
+     *
+     * \details
+     *
+     * Accessing an element for which !(i < size()) holds leads to undefined behaviour.
+     *
+     * ### Complexity
+     *
+     * Constant, i.e. independent of the number of sequences and letters.
+     */
+    const_reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return const_reference{letter_iterator{letters.data(), delimiters[i]},
+                               letter_iterator{letters.data(), delimiters[i + 1]},
+                               delimiters[i + 1] - delimiters[i]};
+    }
+
+    /*!\brief Return the i-th element.
+     * \param i The element to retrieve.
+     * \throws std::out_of_range If you access an element behind the last.
+     * \returns A range over the letters of the i-th sequence.
+     */
+    const_reference at(size_type const i) const
+    {
+        if (i >= size())
+            throw std::out_of_range{"Trying to access element behind the last in packed_sequences."};
+        return (*this)[i];
+    }
+
+    //!\brief Return the first element. Calling front on an empty container is undefined.
+    const_reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\brief Return the last element. Calling back on an empty container is undefined.
+    const_reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+
+    //!\brief Returns a range over the concatenation of all sequences.
+    const_reference concat() const noexcept
+    {
+        size_t const total_length = delimiters[size()];
+        return const_reference{letter_iterator{letters.data(), 0u},
+                               letter_iterator{letters.data(), total_length},
+                               total_length};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Checks whether the container is empty.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    //!\brief Returns the number of elements in the container.
+    size_type size() const noexcept
+    {
+        return delimiters.size() - 1;
+    }
+
+    //!\brief Returns the maximum number of elements the container is able to hold due to system or library
+    //!       implementation limitations.
+    size_type max_size() const noexcept
+    {
+        return std::numeric_limits<size_type>::max() - 1;
+    }
+    //!\}
+
+private:
+    //!\brief The number of bits of a single letter.
+    static constexpr size_t bits_per_letter = letter_iterator::bits_per_letter;
+    //!\brief The number of letters stored in a single word.
+    static constexpr size_t letters_per_word = letter_iterator::letters_per_word;
+    //!\brief Identifies the file format ("SQ3PACK" followed by a zero byte in little endian byte order).
+    static constexpr uint64_t magic = 0x004b434150335153ull;
+    //!\brief The version of the file format.
+    static constexpr uint64_t format_version = 1u;
+    //!\brief The number of words of the header.
+    static constexpr size_t header_size = 5;
+
+    //!\brief Tag to construct a collection without a buffer.
+    struct uninitialised_tag
+    {};
+
+    //!\brief Constructs a collection without a buffer.
+    explicit packed_sequences(uninitialised_tag)
+    {}
+
+    /*!\brief Validates the header and sets up the letters and delimiters.
+     * \param[in] words The complete buffer.
+     * \throws std::invalid_argument if the buffer does not contain valid packed sequences of this alphabet.
+     */
+    void initialise(std::span<uint64_t const> const words)
+    {
+        if (words.size() < header_size || words[0] != magic)
+            throw std::invalid_argument{"Unknown file signature or byte order."};
+        if (words[1] != format_version)
+            throw std::invalid_argument{"Unsupported format version " + std::to_string(words[1]) + "."};
+        if (words[2] != alphabet_size<alphabet_type> || words[3] != bits_per_letter)
+            throw std::invalid_argument{"The sequences were stored with a different alphabet."};
+        if (words[4] > words.size() - header_size)
+            throw std::invalid_argument{"The letters are truncated."};
+
+        letters = words.subspan(header_size, words[4]);
+        delimiters = detail::elias_fano_sequence{words.subspan(header_size + letters.size())};
+
+        if (delimiters.size() == 0 || delimiters[0] != 0u ||
+            delimiters[delimiters.size() - 1] > letters.size() * letters_per_word)
+        {
+            throw std::invalid_argument{"The sequence delimiters are corrupted."};
+        }
+
+        word_count = header_size + letters.size() + delimiters.word_count();
+    }
+
+    //!\brief The buffer; either owned by a std::vector or a memory mapped file.
+    std::shared_ptr<uint64_t const> storage{};
+    //!\brief The packed letters within the buffer.
+    std::span<uint64_t const> letters{};
+    //!\brief The begin positions of the sequences and the total length within the buffer.
+    detail::elias_fano_sequence delimiters{};
+    //!\brief The number of words of the buffer that belong to the collection.
+    size_t word_count{};
+};
+
+} // namespace seqan3
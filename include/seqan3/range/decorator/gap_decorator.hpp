@@ -14,9 +14,9 @@
 #pragma once
 
 #include <limits>
-#include <set>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alphabet/concept.hpp>
@@ -62,11 +62,13 @@ namespace seqan3
  *
  * ### Implementation details
  *
- * This decorator stores a std::set over tuples of `(pos, cumulative_size)` where every entry represents one
+ * This decorator stores a sorted std::vector over tuples of `(pos, cumulative_size)` where every entry represents one
  * contiguous stretch of gaps. `pos` is the (virtual) insert position in the underlying range and `cumulative_size`
  * is the length of that contiguous stretch of gaps plus the length of all preceding elements.
- * Resolving random access requires logarithmic access into the set and inserting or removing a gap symbol additionally
- * entails updating all subsequent elements in the set to preserve correct cumulative sizes.
+ * Resolving random access requires a binary search over the anchors and inserting or removing a gap symbol
+ * additionally entails updating all subsequent anchors to preserve correct cumulative sizes.
+ * Since the anchors are stored contiguously, the binary search and the update are cache friendly and, in contrast to
+ * a node based tree, the update is a single linear pass over the memory without any rebalancing.
  *
  * ### The seqan3::gap_decorator::iterator type
  *
@@ -153,7 +155,7 @@ public:
     size_type size() const
     {
         if (anchors.size())
-            return anchors.rbegin()->second + ungapped_view.size();
+            return anchors.back().second + ungapped_view.size();
 
         return ungapped_view.size();
     }
@@ -169,7 +171,7 @@ public:
      * ### Complexity
      *
      * Average and worst case (insertion before last gap): \f$O(k)\f$,
-     * Best case (back insertion): \f$O(\log k)\f$.
+     * Best case (back insertion): \f$O(\log k)\f$ (amortised).
      */
     iterator insert_gap(const_iterator const it, size_type const count = 1)
     {
@@ -179,35 +181,24 @@ public:
         size_type const pos = it - begin();
         assert(pos <= size());
 
-        set_iterator_type it_set = anchors.upper_bound(anchor_gap_t{pos, bound_dummy});
+        anchor_iterator_type it_anchor = upper_anchor(pos);
 
-        if (it_set == anchors.begin()) // will also catch if anchors is empty since begin() == end()
+        if (it_anchor == anchors.begin()) // will also catch if anchors is empty since begin() == end()
         {
-            anchors.emplace_hint(anchors.begin(), anchor_gap_t{pos, count});
+            it_anchor = anchors.insert(it_anchor, anchor_gap_t{pos, count});
         }
         else // there are gaps before pos
         {
-            --it_set;
-            auto gap_len{it_set->second};
-            if (it_set != anchors.begin())
-                gap_len -= (*(std::prev(it_set))).second;
+            --it_anchor;
 
-            if (it_set->first + gap_len >= pos) // extend existing gap
-            {
-                anchor_gap_t gap{it_set->first, it_set->second + count};
-                it_set = anchors.erase(it_set);
-                anchors.insert(it_set, gap);
-            }
-            else                                  // insert new gap
-            {
-                anchor_gap_t gap{pos, it_set->second + count};
-                ++it_set;
-                anchors.insert(it_set, gap);
-            }
+            if (it_anchor->first + gap_length(it_anchor) >= pos) // extend existing gap
+                it_anchor->second += count;
+            else                                                 // insert new gap
+                it_anchor = anchors.insert(std::next(it_anchor), anchor_gap_t{pos, it_anchor->second + count});
         }
 
-        // post-processing: reverse update of succeeding gaps
-        rupdate(pos, count);
+        // post-processing: update of succeeding gaps
+        increase(std::next(it_anchor), count);
         return iterator{*this, pos};
     }
 
@@ -248,7 +239,7 @@ public:
     {
         size_type const pos1 = first - begin();
         size_type const pos2 = last - begin();
-        set_iterator_type it = anchors.upper_bound(anchor_gap_t{pos1, bound_dummy}); // first element greater than pos1
+        anchor_iterator_type it = upper_anchor(pos1); // first element greater than pos1
 
         if (it == anchors.begin())
             throw gap_erase_failure{"There is no gap to erase in range [" + std::to_string(pos1) + "," +
@@ -270,14 +261,12 @@ public:
         // case 2: gap to be deleted in tail or larger than 1 (equiv. to shift tail left, i.e. pos remains unchanged)
         else
         {
-            anchor_gap_t gap{it->first, it->second - pos2 + pos1};
-            it = anchors.erase(it);
-            it = anchors.insert(it, gap); // amortized constant because of hint
+            it->second -= pos2 - pos1;
             ++it; // update node after the current
         }
 
-        // post-processing: forward update of succeeding gaps
-        update(it, pos2 - pos1);
+        // post-processing: update of succeeding gaps
+        decrease(it, pos2 - pos1);
 
         return iterator{*this, pos1};
     }
@@ -484,17 +473,39 @@ private:
     //!\brief The gap type as a tuple storing position and accumulated gap lengths.
     using anchor_gap_t = typename std::pair<size_t, size_t>;
 
-    //!\brief The type of set to store the anchor gaps.
-    using anchor_set_type = std::set<anchor_gap_t>;
+    //!\brief The type of the sorted vector to store the anchor gaps.
+    using anchor_vector_type = std::vector<anchor_gap_t>;
 
-    //!\brief The iterator type for an anchor set.
-    using set_iterator_type = typename anchor_set_type::iterator;
+    //!\brief The iterator type for the anchor vector.
+    using anchor_iterator_type = typename anchor_vector_type::iterator;
 
-    //!\brief The maximum value is needed for a correct search with upper_bound() in the anchor set.
+    //!\brief The const iterator type for the anchor vector.
+    using anchor_const_iterator_type = typename anchor_vector_type::const_iterator;
+
+    //!\brief The maximum value is needed for a correct search with upper_bound() in the anchor vector.
     constexpr static size_t bound_dummy{std::numeric_limits<size_t>::max()};
 
+    /*!\brief Returns an iterator to the first anchor gap whose (virtual) position is greater than \p pos.
+     * \param[in] pos The (virtual) position to search for.
+     *
+     * \details
+     *
+     * ### Complexity
+     * Logarithmic in the number of gaps.
+     */
+    anchor_iterator_type upper_anchor(size_type const pos)
+    {
+        return std::upper_bound(anchors.begin(), anchors.end(), anchor_gap_t{pos, bound_dummy});
+    }
+
+    //!\copydoc upper_anchor()
+    anchor_const_iterator_type upper_anchor(size_type const pos) const
+    {
+        return std::upper_bound(anchors.begin(), anchors.end(), anchor_gap_t{pos, bound_dummy});
+    }
+
     /*!\brief Helper function to compute the length of the gap indicated by the input iterator.
-     * \param[in] it    Iterator over the internal gap set.
+     * \param[in] it    Iterator over the internal anchor vector.
      * \returns The gap length corresponding to the gap pointed at by \p it.
      *
      * \details
@@ -505,60 +516,56 @@ private:
      * ### Exceptions
      * Strong exception guarantee.
      */
-    size_type gap_length(set_iterator_type it) const
+    size_type gap_length(anchor_const_iterator_type it) const
     {
         return (it == anchors.begin()) ? it->second : it->second - (*std::prev(it)).second;
     }
 
-    /*!\brief Update all anchor gaps after the indicated position by adding an offset.
-     * \param[in] pos    Gap index after which to perform the update.
+    /*!\brief Update all anchor gaps starting with the indicated one by adding an offset.
+     * \param[in] it     Iterator pointing to the first anchor gap to update.
      * \param[in] offset Offset to be added to the virtual gap positions and its accumulators.
      *
      * \details
      *
-     * In order to avoid key conflicts when inserting into anchors, the
-     * update is done in reverse manner excluding the indicated gap.
+     * The order of the anchors is not affected, hence the update is done in place.
      *
      * ### Complexity
      * Linear in the number of gaps.
      */
-    void rupdate(size_type const pos, size_type const offset)
+    void increase(anchor_iterator_type it, size_type const offset)
     {
-        for (auto it = std::prev(anchors.end(), 1); it->first > pos;)
+        for (; it != anchors.end(); ++it)
         {
-            anchors.emplace_hint(it, anchor_gap_t{it->first + offset, it->second + offset});
-            anchors.erase(*it--);
+            it->first += offset;
+            it->second += offset;
         }
     }
 
-    /*!\brief Update all anchor gaps after indicated position by substracting an offset.
-     * \param[in] it     Iterator pointing to the first anchor node to update.
+    /*!\brief Update all anchor gaps starting with the indicated one by substracting an offset.
+     * \param[in] it     Iterator pointing to the first anchor gap to update.
      * \param[in] offset Offset to be removed from the virtual gap positions and its accumulators.
      *
      * \details
      *
-     * In order to avoid key conflicts when inserting into anchors, the
-     * decreasing is done in a forward manner excluding the indicated gap.
+     * The order of the anchors is not affected, hence the update is done in place.
      *
      * ### Complexity
      * Linear in the number of gaps.
      */
-    void update(set_iterator_type it, size_type const offset)
+    void decrease(anchor_iterator_type it, size_type const offset)
     {
-        while (it != anchors.end())
+        for (; it != anchors.end(); ++it)
         {
-            anchor_gap_t gap{it->first - offset, it->second - offset};
-            it = anchors.erase(it);
-            it = anchors.insert(it, gap);
-            ++it;
+            it->first -= offset;
+            it->second -= offset;
         }
     }
 
     //!\brief Stores a (copy of a) view to the ungapped, underlying sequence.
     ungapped_view_type ungapped_view{};
 
-    //!\brief Set storing the anchor gaps.
-    anchor_set_type anchors{};
+    //!\brief Sorted vector storing the anchor gaps.
+    anchor_vector_type anchors{};
 };
 
 /*!\name Type deduction guides
@@ -609,24 +616,24 @@ protected:
     //!\brief Stores the position (incl. gaps) where the last (consecutive) gap that is still before the current
     //!       iterator position ends.
     typename gap_decorator::size_type left_gap_end{0};
-    //!\brief A pointer to the current anchor gap node. Note that the current tuple value at position 0 is the
+    //!\brief A pointer to the current anchor gap. Note that the current tuple value at position 0 is the
     //!       start of the right gap that is still behind the current iterator position.
-    typename gap_decorator::set_iterator_type anchor_set_it{};
+    typename gap_decorator::anchor_const_iterator_type anchor_it{};
     //!\brief Caches whether the iterator points to a gap (true) or not (false).
     bool is_at_gap{true};
 
-    //!\brief A helper function that performs the random access into the anchor set, updating all member variables.
+    //!\brief A helper function that performs the random access into the anchor vector, updating all member variables.
     void jump(typename gap_decorator::size_type const new_pos)
     {
         assert(new_pos <= host->size());
         pos = new_pos;
 
-        anchor_set_it = host->anchors.upper_bound(anchor_gap_t{pos, host->bound_dummy});
+        anchor_it = host->upper_anchor(pos);
         ungapped_view_pos = pos;
 
-        if (anchor_set_it != host->anchors.begin())
+        if (anchor_it != host->anchors.begin())
         {
-            typename gap_decorator::set_iterator_type prev{std::prev(anchor_set_it)};
+            typename gap_decorator::anchor_const_iterator_type prev{std::prev(anchor_it)};
             size_type gap_len{prev->second};
 
             if (prev != host->anchors.begin())
@@ -637,7 +644,7 @@ protected:
         }
 
         if (ungapped_view_pos != static_cast<int64_t>(host->ungapped_view.size()) &&
-            pos >= left_gap_end && (anchor_set_it == host->anchors.end() || pos < anchor_set_it->first))
+            pos >= left_gap_end && (anchor_it == host->anchors.end() || pos < anchor_it->first))
             is_at_gap = false;
         else
             is_at_gap = true;
@@ -671,13 +678,13 @@ public:
 
     //!\brief Construct from seqan3::gap_decorator and initialising to first position.
     explicit gap_decorator_iterator(gap_decorator const & host_) :
-        host(&host_), anchor_set_it{host_.anchors.begin()}
+        host(&host_), anchor_it{host_.anchors.begin()}
     {
         if (host_.anchors.size() && (*host_.anchors.begin()).first == 0) // there are gaps at the very front
         {
             --ungapped_view_pos; // set ungapped_view_pos to -1 so operator++ works without an extra if-branch.
-            left_gap_end = anchor_set_it->second;
-            ++anchor_set_it;
+            left_gap_end = anchor_it->second;
+            ++anchor_it;
         }
         else
         {
@@ -704,7 +711,7 @@ public:
         if (pos < left_gap_end) // we stay within the preceding gap stretch
             return *this;
 
-        if (anchor_set_it == host->anchors.end() || pos < anchor_set_it->first)
+        if (anchor_it == host->anchors.end() || pos < anchor_it->first)
         {   // proceed within the view since we are right of the previous gap but didn't arrive at the right gap yet
             ++ungapped_view_pos;
             if (ungapped_view_pos != static_cast<int64_t>(host->ungapped_view.size()))
@@ -712,9 +719,9 @@ public:
         }
         else
         {   // we arrived at the right gap and have to update the variables. ungapped_view_pos remains unchanged.
-            left_gap_end = anchor_set_it->first + anchor_set_it->second -
-                            ((anchor_set_it != host->anchors.begin()) ? (std::prev(anchor_set_it))->second : 0);
-            ++anchor_set_it;
+            left_gap_end = anchor_it->first + anchor_it->second -
+                            ((anchor_it != host->anchors.begin()) ? (std::prev(anchor_it))->second : 0);
+            ++anchor_it;
             is_at_gap = true;
 
             if (left_gap_end == host->size()) // very last gap
@@ -759,11 +766,11 @@ public:
 
         if (pos < left_gap_end)
         {   // there was no gap before but we arrive at the left gap and have to update the variables.
-            (anchor_set_it != host->anchors.begin()) ? --anchor_set_it : anchor_set_it;
+            (anchor_it != host->anchors.begin()) ? --anchor_it : anchor_it;
 
-            if (anchor_set_it != host->anchors.begin())
+            if (anchor_it != host->anchors.begin())
             {
-                auto prev = std::prev(anchor_set_it);
+                auto prev = std::prev(anchor_it);
                 left_gap_end = prev->first + prev->second -
                                ((prev != host->anchors.begin()) ? std::prev(prev)->second : 0);
             }
@@ -773,7 +780,7 @@ public:
             }
             is_at_gap = true;
         }
-        else if (anchor_set_it == host->anchors.end() || pos < anchor_set_it->first)
+        else if (anchor_it == host->anchors.end() || pos < anchor_it->first)
         {   // we are neither at the left nor right gap
             --ungapped_view_pos;
             is_at_gap = false;
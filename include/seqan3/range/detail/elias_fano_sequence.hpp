@@ -0,0 +1,235 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::elias_fano_sequence.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <seqan3/std/bit>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/utility/math.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only view over a monotonically increasing integer sequence in the Elias-Fano representation.
+ * \ingroup range
+ *
+ * \details
+ *
+ * The Elias-Fano representation stores \f$ n \f$ non-decreasing values of a universe \f$ u \f$ in
+ * \f$ 2 + \lceil\log_2(u / n)\rceil \f$ bits per value. Every value is split into its \f$ l \f$ lower bits, which are
+ * stored in a packed array, and its upper bits, which are stored in unary coding in a bit vector.
+ * Accessing the i-th value selects the i-th set bit in the upper bit vector. To make the select fast, the position of
+ * every 256-th set bit is sampled.
+ *
+ * This class does not own the encoded words. The words are generated with
+ * seqan3::detail::elias_fano_sequence::encode and can be stored in a file and memory mapped later on.
+ * The encoding occupies seqan3::detail::elias_fano_sequence::word_count() many words and starts with a small header:
+ *
+ * | word | content                              |
+ * |------|--------------------------------------|
+ * | 0    | number of values \f$ n \f$           |
+ * | 1    | number of lower bits \f$ l \f$       |
+ * | 2    | number of words of the lower bits    |
+ * | 3    | number of words of the upper bits    |
+ * | 4    | number of select samples             |
+ */
+class elias_fano_sequence
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr elias_fano_sequence() = default; //!< Defaulted.
+    constexpr elias_fano_sequence(elias_fano_sequence const &) = default; //!< Defaulted.
+    constexpr elias_fano_sequence(elias_fano_sequence &&) = default; //!< Defaulted.
+    constexpr elias_fano_sequence & operator=(elias_fano_sequence const &) = default; //!< Defaulted.
+    constexpr elias_fano_sequence & operator=(elias_fano_sequence &&) = default; //!< Defaulted.
+    ~elias_fano_sequence() = default; //!< Defaulted.
+
+    /*!\brief Constructs the view over encoded words.
+     * \param[in] words The words starting with the encoding generated by seqan3::detail::elias_fano_sequence::encode.
+     * \throws std::invalid_argument if the words do not contain a valid encoding.
+     *
+     * \details
+     *
+     * The words must stay valid as long as this view is used. Additional words after the encoding are ignored.
+     */
+    explicit elias_fano_sequence(std::span<uint64_t const> words)
+    {
+        if (words.size() < header_size)
+            throw std::invalid_argument{"The Elias-Fano encoding is truncated."};
+
+        count = words[0];
+        low_bits = words[1];
+        size_t const low_words = words[2];
+        size_t const high_words = words[3];
+        size_t const sample_count = words[4];
+
+        if (low_bits >= 64u || sample_count != (count + sample_rate - 1) / sample_rate ||
+            low_words != (count * low_bits + 63u) / 64u ||
+            words.size() - header_size < low_words + high_words + sample_count)
+        {
+            throw std::invalid_argument{"The Elias-Fano encoding is corrupted."};
+        }
+
+        low = words.data() + header_size;
+        high = low + low_words;
+        samples = high + high_words;
+        total_words = header_size + low_words + high_words + sample_count;
+    }
+    //!\}
+
+    /*!\brief Appends the encoding of the given values to the buffer.
+     * \param[in,out] buffer The buffer to append the encoded words to.
+     * \param[in] values The non-decreasing values to encode.
+     * \throws std::invalid_argument if the values are not sorted.
+     */
+    static void encode(std::vector<uint64_t> & buffer, std::span<uint64_t const> values)
+    {
+        size_t const n = values.size();
+        uint64_t const universe = (n == 0) ? 0u : values.back();
+        size_t const l = (n == 0 || universe <= n) ? 0u : floor_log2(universe / n);
+        size_t const low_words = (n * l + 63u) / 64u;
+        size_t const high_words = (n + (universe >> l) + 64u) / 64u;
+        size_t const sample_count = (n + sample_rate - 1) / sample_rate;
+
+        size_t const offset = buffer.size();
+        buffer.resize(offset + header_size + low_words + high_words + sample_count, 0u);
+
+        uint64_t * header = buffer.data() + offset;
+        header[0] = n;
+        header[1] = l;
+        header[2] = low_words;
+        header[3] = high_words;
+        header[4] = sample_count;
+
+        uint64_t * low_data = header + header_size;
+        uint64_t * high_data = low_data + low_words;
+        uint64_t * sample_data = high_data + high_words;
+        uint64_t const low_mask = (l == 0) ? 0u : (~0ull >> (64u - l));
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (i > 0 && values[i] < values[i - 1])
+                throw std::invalid_argument{"The values of an Elias-Fano sequence must be sorted."};
+
+            write_bits(low_data, i * l, l, values[i] & low_mask);
+
+            size_t const high_position = (values[i] >> l) + i;
+            high_data[high_position / 64u] |= 1ull << (high_position % 64u);
+
+            if (i % sample_rate == 0)
+                sample_data[i / sample_rate] = high_position;
+        }
+    }
+
+    //!\brief Returns the number of stored values.
+    size_t size() const noexcept
+    {
+        return count;
+    }
+
+    //!\brief Returns the number of words occupied by the encoding.
+    size_t word_count() const noexcept
+    {
+        return total_words;
+    }
+
+    /*!\brief Returns the i-th value.
+     * \param[in] i The position of the value; must be smaller than seqan3::detail::elias_fano_sequence::size().
+     */
+    uint64_t operator[](size_t const i) const noexcept
+    {
+        assert(i < count);
+
+        uint64_t const upper = select(i) - i;
+        return (upper << low_bits) | read_bits(low, i * low_bits, low_bits);
+    }
+
+private:
+    //!\brief The number of words of the header.
+    static constexpr size_t header_size = 5;
+    //!\brief Every sample_rate-th set bit of the upper bits is sampled.
+    static constexpr size_t sample_rate = 256;
+
+    //!\brief Returns the position of the i-th set bit in the upper bits.
+    size_t select(size_t i) const noexcept
+    {
+        size_t const sampled_position = samples[i / sample_rate];
+        i %= sample_rate;
+
+        size_t word_position = sampled_position / 64u;
+        uint64_t word = high[word_position] & (~0ull << (sampled_position % 64u));
+
+        for (size_t ones = std::popcount(word); i >= ones; ones = std::popcount(word))
+        {
+            i -= ones;
+            word = high[++word_position];
+        }
+
+        for (; i > 0; --i) // Clear the lowest set bits until the i-th set bit is the lowest one.
+            word &= word - 1u;
+
+        return word_position * 64u + std::countr_zero(word);
+    }
+
+    //!\brief Reads `width` many bits starting at the given bit position.
+    static uint64_t read_bits(uint64_t const * data, size_t const bit_position, size_t const width) noexcept
+    {
+        if (width == 0)
+            return 0u;
+
+        size_t const word_position = bit_position / 64u;
+        size_t const shift = bit_position % 64u;
+        uint64_t const mask = ~0ull >> (64u - width);
+        uint64_t value = data[word_position] >> shift;
+
+        if (shift + width > 64u)
+            value |= data[word_position + 1] << (64u - shift);
+
+        return value & mask;
+    }
+
+    //!\brief Writes the lowest `width` many bits of value at the given bit position into zero initialised words.
+    static void write_bits(uint64_t * data, size_t const bit_position, size_t const width, uint64_t const value) noexcept
+    {
+        if (width == 0)
+            return;
+
+        size_t const word_position = bit_position / 64u;
+        size_t const shift = bit_position % 64u;
+        data[word_position] |= value << shift;
+
+        if (shift + width > 64u)
+            data[word_position + 1] |= value >> (64u - shift);
+    }
+
+    //!\brief The number of values.
+    size_t count{};
+    //!\brief The number of lower bits per value.
+    size_t low_bits{};
+    //!\brief The number of words of the encoding.
+    size_t total_words{};
+    //!\brief The packed lower bits.
+    uint64_t const * low{nullptr};
+    //!\brief The upper bits in unary coding.
+    uint64_t const * high{nullptr};
+    //!\brief The positions of every sample_rate-th set bit in the upper bits.
+    uint64_t const * samples{nullptr};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,328 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::packed_word_operations.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <cstdint>
+#include <seqan3/std/bit>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3::detail
+{
+
+/*!\brief Bulk operations on sequences of letters that are packed into 64 bit words.
+ * \ingroup range
+ * \tparam bits_per_letter The number of bits of a single letter; must be in the range [1, 64].
+ *
+ * \details
+ *
+ * The letters are stored in the layout of the `sdsl::int_vector`, i.e. the i-th letter occupies the bits
+ * `[i * bits_per_letter, (i + 1) * bits_per_letter)` of the bit sequence formed by the words, starting at the least
+ * significant bit of the first word. If `bits_per_letter` does not divide 64, a letter may span two words.
+ *
+ * If `bits_per_letter` divides 64, the operations process complete words at once, e.g. 32 letters of seqan3::dna4.
+ * Otherwise they fall back to processing one letter at a time, but still work directly on the words.
+ */
+template <size_t bits_per_letter>
+class packed_word_operations
+{
+public:
+    static_assert(bits_per_letter > 0 && bits_per_letter <= 64, "A letter must occupy between 1 and 64 bits.");
+
+    //!\brief Whether the letters never span two words.
+    static constexpr bool is_word_aligned = 64 % bits_per_letter == 0;
+    //!\brief The number of letters in a single word if the letters are word aligned.
+    static constexpr size_t letters_per_word = 64 / bits_per_letter;
+    //!\brief The mask of the lowest letter.
+    static constexpr uint64_t letter_mask = (bits_per_letter == 64) ? ~0ull : (1ull << bits_per_letter) - 1u;
+
+    //!\brief Returns the number of words needed to store `size` many letters.
+    static constexpr size_t word_count(size_t const size) noexcept
+    {
+        return (size * bits_per_letter + 63u) / 64u;
+    }
+
+    /*!\brief Returns the rank of the letter at the given position.
+     * \param[in] words The packed words.
+     * \param[in] position The position of the letter.
+     */
+    static constexpr uint64_t read(uint64_t const * words, size_t const position) noexcept
+    {
+        size_t const bit_position = position * bits_per_letter;
+        size_t const shift = bit_position % 64u;
+        uint64_t value = words[bit_position / 64u] >> shift;
+
+        if constexpr (!is_word_aligned)
+        {
+            if (shift + bits_per_letter > 64u)
+                value |= words[bit_position / 64u + 1] << (64u - shift);
+        }
+
+        return value & letter_mask;
+    }
+
+    /*!\brief Overwrites the letter at the given position.
+     * \param[in,out] words The packed words.
+     * \param[in] position The position of the letter.
+     * \param[in] rank The new rank of the letter; must be representable in `bits_per_letter` bits.
+     */
+    static constexpr void write(uint64_t * words, size_t const position, uint64_t const rank) noexcept
+    {
+        assert((rank & ~letter_mask) == 0u);
+
+        size_t const bit_position = position * bits_per_letter;
+        size_t const shift = bit_position % 64u;
+        uint64_t & word = words[bit_position / 64u];
+        word = (word & ~(letter_mask << shift)) | (rank << shift);
+
+        if constexpr (!is_word_aligned)
+        {
+            if (shift + bits_per_letter > 64u)
+            {
+                uint64_t & next_word = words[bit_position / 64u + 1];
+                size_t const written_bits = 64u - shift;
+                next_word = (next_word & ~(letter_mask >> written_bits)) | (rank >> written_bits);
+            }
+        }
+    }
+
+    /*!\brief Packs the given ranks into the words starting at the given position.
+     * \tparam rank_range_t The type of the ranks; must model std::ranges::input_range over unsigned integers.
+     * \param[in,out] words The packed words; must be large enough to hold all letters.
+     * \param[in] position The position of the first written letter.
+     * \param[in] ranks The ranks to write; each must be representable in `bits_per_letter` bits.
+     *
+     * \details
+     *
+     * The letters are collected in a register and every word is written only once. The letters before `position` and
+     * the bits after the last written letter are left unchanged.
+     */
+    template <std::ranges::input_range rank_range_t>
+    static constexpr void write_range(uint64_t * words, size_t const position, rank_range_t && ranks) noexcept
+    {
+        size_t const bit_position = position * bits_per_letter;
+        uint64_t * word = words + bit_position / 64u;
+        size_t offset = bit_position % 64u;
+        uint64_t buffer = (offset == 0u) ? 0u : (*word & ((1ull << offset) - 1u));
+
+        for (auto && rank_value : ranks)
+        {
+            uint64_t const rank = static_cast<uint64_t>(rank_value);
+            assert((rank & ~letter_mask) == 0u);
+
+            buffer |= rank << offset;
+            offset += bits_per_letter;
+
+            if (offset >= 64u)
+            {
+                *word++ = buffer;
+                offset -= 64u;
+                buffer = (offset == 0u) ? 0u : rank >> (bits_per_letter - offset);
+            }
+        }
+
+        if (offset > 0u)
+            *word = buffer | (*word & ~((1ull << offset) - 1u));
+    }
+
+    /*!\brief Calls the given function with the rank of every letter in `[begin_position, end_position)`.
+     * \param[in] words The packed words.
+     * \param[in] begin_position The position of the first letter.
+     * \param[in] end_position The position behind the last letter.
+     * \param[in] on_rank The function that is called with every rank in order.
+     *
+     * \details
+     *
+     * Every word is loaded only once and the letters are shifted out of a register.
+     */
+    template <typename on_rank_t>
+    static constexpr void for_each_rank(uint64_t const * words,
+                                        size_t const begin_position,
+                                        size_t const end_position,
+                                        on_rank_t && on_rank)
+    {
+        if (begin_position >= end_position)
+            return;
+
+        size_t const bit_position = begin_position * bits_per_letter;
+        uint64_t const * word = words + bit_position / 64u;
+        size_t available_bits = 64u - bit_position % 64u;
+        uint64_t buffer = *word >> (bit_position % 64u);
+
+        for (size_t position = begin_position; position < end_position; ++position)
+        {
+            uint64_t rank{};
+
+            if (available_bits >= bits_per_letter)
+            {
+                rank = buffer & letter_mask;
+                buffer = (bits_per_letter == 64u) ? 0u : buffer >> (bits_per_letter % 64u);
+                available_bits -= bits_per_letter;
+            }
+            else // The letter spans two words or the current word is exhausted, so the next word belongs to it.
+            {
+                uint64_t const next_word = *++word;
+                size_t const missing_bits = bits_per_letter - available_bits;
+                rank = (buffer | (next_word << available_bits)) & letter_mask;
+                buffer = (missing_bits == 64u) ? 0u : next_word >> missing_bits;
+                available_bits = 64u - missing_bits;
+            }
+
+            on_rank(rank);
+        }
+    }
+
+    /*!\brief Reverses the order of the letters within a single word.
+     * \param[in] word The word to reverse.
+     *
+     * \details
+     *
+     * Swaps neighbouring blocks of letters with doubling block sizes, i.e. needs \f$ \log_2(64 / bits) \f$ steps.
+     */
+    static constexpr uint64_t reverse_letters(uint64_t word) noexcept
+    //!\cond
+        requires is_word_aligned
+    //!\endcond
+    {
+        for (size_t block = bits_per_letter; block < 64u; block *= 2u)
+        {
+            uint64_t const low_blocks = ~0ull / ((1ull << block) + 1u); // Every other block of `block` bits.
+            word = ((word >> block) & low_blocks) | ((word & low_blocks) << block);
+        }
+
+        return word;
+    }
+
+    /*!\brief Reverses the letters and replaces every letter by its complement in place.
+     * \param[in,out] words The packed words.
+     * \param[in] size The number of letters.
+     * \param[in] complement_ranks The complement rank of every rank.
+     *
+     * \details
+     *
+     * If the letters are word aligned, the order of the words is reversed and the letters within every word are
+     * reversed and complemented in registers. Afterwards, the bit sequence is shifted by the unused bits of the last
+     * word. If the complement of every rank equals the rank with all bits flipped (e.g. for seqan3::dna4), the
+     * complement is computed for a whole word by a single XOR.
+     * The bits behind the last letter in the last word are set to zero.
+     */
+    static constexpr void reverse_complement(uint64_t * words,
+                                             size_t const size,
+                                             std::span<uint64_t const> const complement_ranks) noexcept
+    {
+        if (size == 0u)
+            return;
+
+        if constexpr (is_word_aligned && bits_per_letter < 64u)
+        {
+            size_t const used_words = word_count(size);
+            size_t const unused_bits = used_words * 64u - size * bits_per_letter;
+            bool const is_xor_complement = std::ranges::all_of(std::views::iota(size_t{0}, complement_ranks.size()),
+                                                               [&] (size_t const rank)
+            {
+                return complement_ranks[rank] == (rank ^ letter_mask);
+            });
+
+            std::reverse(words, words + used_words);
+
+            for (size_t i = 0; i < used_words; ++i)
+            {
+                uint64_t word = reverse_letters(words[i]);
+
+                if (is_xor_complement)
+                {
+                    word = ~word;
+                }
+                else
+                {
+                    uint64_t complemented{};
+                    for (size_t shift = 0; shift < 64u; shift += bits_per_letter)
+                    {
+                        uint64_t const rank = (word >> shift) & letter_mask;
+                        complemented |= ((rank < complement_ranks.size()) ? complement_ranks[rank] : 0u) << shift;
+                    }
+                    word = complemented;
+                }
+
+                words[i] = word;
+            }
+
+            // The unused bits of the former last word are now at the beginning.
+            if (unused_bits > 0u)
+            {
+                for (size_t i = 0; i + 1 < used_words; ++i)
+                    words[i] = (words[i] >> unused_bits) | (words[i + 1] << (64u - unused_bits));
+
+                words[used_words - 1] >>= unused_bits;
+            }
+        }
+        else
+        {
+            for (size_t left = 0, right = size - 1; left < right; ++left, --right)
+            {
+                uint64_t const left_rank = read(words, left);
+                write(words, left, complement_ranks[read(words, right)]);
+                write(words, right, complement_ranks[left_rank]);
+            }
+
+            if (size % 2u == 1u)
+                write(words, size / 2u, complement_ranks[read(words, size / 2u)]);
+        }
+    }
+
+    /*!\brief Counts the positions with different letters.
+     * \param[in] lhs The first packed words.
+     * \param[in] rhs The second packed words.
+     * \param[in] size The number of compared letters.
+     *
+     * \details
+     *
+     * If the letters are word aligned, the XOR of two words is folded such that the lowest bit of every letter is set
+     * iff the letters differ. These bits are counted with a single popcount per word.
+     */
+    static constexpr size_t count_mismatches(uint64_t const * lhs, uint64_t const * rhs, size_t const size) noexcept
+    {
+        size_t mismatches = 0;
+
+        if constexpr (is_word_aligned)
+        {
+            constexpr uint64_t lowest_letter_bits = ~0ull / letter_mask;
+
+            auto count_word = [] (uint64_t difference) -> size_t
+            {
+                for (size_t shift = 1; shift < bits_per_letter; shift *= 2u)
+                    difference |= difference >> shift;
+
+                return std::popcount(difference & lowest_letter_bits);
+            };
+
+            size_t const full_words = size / letters_per_word;
+            for (size_t i = 0; i < full_words; ++i)
+                mismatches += count_word(lhs[i] ^ rhs[i]);
+
+            if (size_t const remaining_bits = (size % letters_per_word) * bits_per_letter; remaining_bits > 0u)
+                mismatches += count_word((lhs[full_words] ^ rhs[full_words]) & ((1ull << remaining_bits) - 1u));
+        }
+        else
+        {
+            for (size_t i = 0; i < size; ++i)
+                mismatches += read(lhs, i) != read(rhs, i);
+        }
+
+        return mismatches;
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,264 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author agent <agent AT local>
+ * \brief Provides seqan3::translate_frames.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <cstdint>
+#include <seqan3/std/bit>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/aminoacid/translation.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna15.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
+#include <seqan3/alphabet/nucleotide/rna5.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/views/translate.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Translates all selected frames of a nucleotide sequence in a single pass.
+ * \ingroup range
+ * \tparam nucl_t The nucleotide alphabet of the input sequences; must model seqan3::nucleotide_alphabet.
+ * \tparam gc The genetic code used for the translation.
+ *
+ * \details
+ *
+ * The nucleotides are first converted to their ranks in the alphabet of the translation table (seqan3::dna4,
+ * seqan3::dna5 or seqan3::dna15) and to the ranks of their complements. Afterwards every codon is packed into a
+ * single index into a flattened translation table, e.g. a 6 bit index for seqan3::dna4, which fits into the L1 cache.
+ * Every frame is written sequentially into the output buffer, while the codons are read with a fixed stride from
+ * the rank buffers. The codon indices do not depend on each other and there are no branches in the inner loops.
+ */
+template <nucleotide_alphabet nucl_t, genetic_code gc>
+class frame_translator
+{
+private:
+    //!\brief The alphabet of the translation table that is used for `nucl_t`.
+    using table_alphabet_t = std::conditional_t<std::same_as<nucl_t, dna4> || std::same_as<nucl_t, rna4>, dna4,
+                             std::conditional_t<std::same_as<nucl_t, dna5> || std::same_as<nucl_t, rna5>, dna5,
+                                                dna15>>;
+
+    //!\brief The size of the translation table alphabet.
+    static constexpr size_t sigma = alphabet_size<table_alphabet_t>;
+
+    //!\brief Converts a letter to the translation table alphabet.
+    static constexpr uint8_t table_rank(nucl_t const letter) noexcept
+    {
+        // The rna alphabets have the same ranks as the corresponding dna alphabets.
+        if constexpr (std::same_as<nucl_t, table_alphabet_t> || std::same_as<nucl_t, rna4> ||
+                      std::same_as<nucl_t, rna5> || std::same_as<nucl_t, rna15>)
+            return seqan3::to_rank(letter);
+        else
+            return seqan3::to_rank(static_cast<dna15>(letter));
+    }
+
+    //!\brief The translation table flattened to the codon index `r1 * sigma^2 + r2 * sigma + r3`.
+    static constexpr std::array<aa27, sigma * sigma * sigma> codon_table = [] ()
+    {
+        std::array<aa27, sigma * sigma * sigma> table{};
+
+        for (size_t i = 0; i < sigma; ++i)
+            for (size_t j = 0; j < sigma; ++j)
+                for (size_t k = 0; k < sigma; ++k)
+                    table[(i * sigma + j) * sigma + k] = translation_table<table_alphabet_t, gc>::VALUE[i][j][k];
+
+        return table;
+    }();
+
+    //!\brief Maps the rank of a letter to the rank of the letter and its complement in the table alphabet.
+    static inline std::array<std::array<uint8_t, 2>, alphabet_size<nucl_t>> const letter_table = [] ()
+    {
+        std::array<std::array<uint8_t, 2>, alphabet_size<nucl_t>> table{};
+
+        for (size_t rank = 0; rank < alphabet_size<nucl_t>; ++rank)
+        {
+            nucl_t const letter = assign_rank_to(rank, nucl_t{});
+            table[rank] = {table_rank(letter), table_rank(complement(letter))};
+        }
+
+        return table;
+    }();
+
+public:
+    /*!\brief Appends the selected frames of the sequence to the given collection.
+     * \tparam urng_t The type of the sequence; must model std::ranges::input_range over `nucl_t`.
+     * \param[in,out] output The collection to append the translated frames to.
+     * \param[in] sequence The nucleotide sequence.
+     * \param[in] tf The selected frames.
+     *
+     * \details
+     *
+     * The frames are appended in the same order as by seqan3::views::translate, i.e. first the selected forward frames
+     * and then the selected reverse frames, each ordered by their offset.
+     */
+    template <std::ranges::input_range urng_t>
+    void operator()(concatenated_sequences<std::vector<aa27>> & output,
+                    urng_t && sequence,
+                    translation_frames const tf)
+    {
+        forward_ranks.clear();
+        complement_ranks.clear();
+
+        if constexpr (std::ranges::sized_range<urng_t>)
+        {
+            forward_ranks.reserve(std::ranges::size(sequence));
+            complement_ranks.reserve(std::ranges::size(sequence));
+        }
+
+        for (auto && letter : sequence)
+        {
+            std::array<uint8_t, 2> const ranks = letter_table[seqan3::to_rank(static_cast<nucl_t>(letter))];
+            forward_ranks.push_back(ranks[0]);
+            complement_ranks.push_back(ranks[1]);
+        }
+
+        size_t const sequence_size = forward_ranks.size();
+        auto && [values, delimiters] = output.raw_data();
+        size_t output_size = values.size();
+
+        std::array<size_t, 6> frame_begin{};
+        for (size_t frame = 0; frame < 6; ++frame)
+        {
+            if (is_selected(tf, frame))
+            {
+                frame_begin[frame] = output_size;
+                output_size += frame_size(sequence_size, frame % 3);
+                delimiters.push_back(output_size);
+            }
+        }
+
+        values.resize(output_size);
+
+        uint8_t const * fwd = forward_ranks.data();
+        uint8_t const * rev = complement_ranks.data();
+
+        for (size_t frame = 0; frame < 6; ++frame)
+        {
+            if (!is_selected(tf, frame))
+                continue;
+
+            aa27 * out = values.data() + frame_begin[frame];
+            size_t const offset = frame % 3;
+            size_t const codon_count = frame_size(sequence_size, offset);
+
+            if (frame < 3) // The k-th codon of a forward frame starts at position 3k + offset.
+            {
+                for (size_t k = 0, position = offset; k < codon_count; ++k, position += 3)
+                    out[k] = codon_table[(fwd[position] * sigma + fwd[position + 1]) * sigma + fwd[position + 2]];
+            }
+            else // The k-th codon of a reverse frame is the reverse complement of the codon ending at n - 1 - 3k - offset.
+            {
+                for (size_t k = 0, position = sequence_size - offset; k < codon_count; ++k, position -= 3)
+                    out[k] = codon_table[(rev[position - 1] * sigma + rev[position - 2]) * sigma + rev[position - 3]];
+            }
+        }
+    }
+
+private:
+    //!\brief Whether the frame with the given index (FWD_FRAME_0, ..., REV_FRAME_2) is selected.
+    static constexpr bool is_selected(translation_frames const tf, size_t const frame) noexcept
+    {
+        return (static_cast<uint8_t>(tf) >> frame) & 1u;
+    }
+
+    //!\brief The number of codons of a frame with the given offset.
+    static constexpr size_t frame_size(size_t const sequence_size, size_t const offset) noexcept
+    {
+        return (std::max(sequence_size, offset) - offset) / 3;
+    }
+
+    //!\brief The ranks of the sequence in the table alphabet.
+    std::vector<uint8_t> forward_ranks{};
+    //!\brief The ranks of the complemented sequence in the table alphabet.
+    std::vector<uint8_t> complement_ranks{};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Translates a nucleotide sequence or a collection of nucleotide sequences into the selected frames at once.
+ * \ingroup range
+ * \tparam gc The genetic code used for the translation.
+ * \tparam urng_t The type of the input; must model std::ranges::input_range over a seqan3::nucleotide_alphabet or
+ *                over std::ranges::input_range over a seqan3::nucleotide_alphabet.
+ * \param[in] urange The sequence or the collection of sequences to translate.
+ * \param[in] tf The frames that should be translated.
+ * \returns A seqan3::concatenated_sequences with the translated frames.
+ *
+ * \details
+ *
+ * This is the eager counterpart of seqan3::views::translate (single sequence) and seqan3::views::translate_join
+ * (collection of sequences) and produces the same frames in the same order. Instead of translating every amino acid
+ * on access, all selected frames of a sequence are computed in a single pass over its codons and are stored in one
+ * contiguous buffer. Use this function if the translated sequences are accessed more than once, e.g. when searching
+ * nucleotide reads in a protein database.
+ *
+ * ### Complexity
+ *
+ * Linear in the total length of the input.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/translate_frames.cpp
+ */
+template <genetic_code gc = genetic_code::canonical, std::ranges::input_range urng_t>
+//!\cond
+    requires nucleotide_alphabet<std::ranges::range_reference_t<urng_t>> ||
+             (std::ranges::input_range<std::ranges::range_reference_t<urng_t>> &&
+              nucleotide_alphabet<std::ranges::range_reference_t<std::ranges::range_reference_t<urng_t>>>)
+//!\endcond
+concatenated_sequences<std::vector<aa27>> translate_frames(urng_t && urange,
+                                                           translation_frames const tf = translation_frames::SIX_FRAME)
+{
+    concatenated_sequences<std::vector<aa27>> output{};
+
+    if constexpr (nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>)
+    {
+        using nucl_t = std::remove_cvref_t<std::ranges::range_reference_t<urng_t>>;
+
+        detail::frame_translator<nucl_t, gc>{}(output, std::forward<urng_t>(urange), tf);
+    }
+    else
+    {
+        using nucl_t = std::remove_cvref_t<std::ranges::range_reference_t<std::ranges::range_reference_t<urng_t>>>;
+
+        // Every selected frame has at most a third of the sequence length.
+        if constexpr (std::ranges::forward_range<urng_t> &&
+                      std::ranges::sized_range<std::ranges::range_reference_t<urng_t>>)
+        {
+            size_t const frame_count = std::popcount(static_cast<uint8_t>(tf));
+            size_t total_size = 0;
+            for (auto && sequence : urange)
+                total_size += std::ranges::size(sequence) / 3;
+
+            output.concat_reserve(total_size * frame_count);
+        }
+
+        detail::frame_translator<nucl_t, gc> translator{};
+        for (auto && sequence : urange)
+            translator(output, sequence, tf);
+    }
+
+    return output;
+}
+
+} // namespace seqan3
@@ -12,7 +12,11 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
+#include <vector>
+
 #include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/search/detail/search_common.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/search_result.hpp>
@@ -69,9 +73,9 @@ protected:
      * The result is independent from the search modus (all, single_best, all_best, strata).
      */
     template <typename index_cursor_t, typename query_index_t, typename callback_t>
-    void make_results(std::vector<index_cursor_t> internal_hits, query_index_t idx, callback_t && callback)
+    void make_results(std::vector<index_cursor_t> & internal_hits, query_index_t idx, callback_t && callback)
     {
-        return make_results_impl(std::move(internal_hits), idx, std::forward<callback_t>(callback));
+        return make_results_impl(internal_hits, idx, std::forward<callback_t>(callback));
     }
 
     /*!\brief Invokes the callback on each seqan3::search_result after calling locate on each cursor.
@@ -88,19 +92,41 @@ protected:
      *
      * This function is used for all search modi except single_best (which are all, all_best, and strata).
      *
+     * Cursors with the same suffix array interval and depth locate the same text positions. Since the suffix array
+     * intervals of cursors with the same depth are either equal or disjoint, such duplicates are removed before
+     * calling locate by sorting the cursors by depth and interval.
      * The text positions are sorted and made unique by position before invoking the callback on them.
+     *
+     * The results are collected in a seqan3::detail::reusable_search_buffer, s.t. no memory is allocated once the
+     * buffers of the calling thread are large enough. `internal_hits` is reordered in place.
      */
     template <typename index_cursor_t, typename query_index_t, typename callback_t>
     //!\cond
         requires search_traits_type::output_requires_locate_call &&
                  (!search_traits_type::search_single_best_hit)
     //!\endcond
-    void make_results(std::vector<index_cursor_t> internal_hits, query_index_t idx, callback_t && callback)
+    void make_results(std::vector<index_cursor_t> & internal_hits, query_index_t idx, callback_t && callback)
     {
-        std::vector<search_result_type> results{};
-        results.reserve(internal_hits.size()); // expect at least as many text positions as cursors, possibly more
+        auto interval_key = [] (auto const & cursor)
+        {
+            return std::pair{cursor.query_length(), cursor.suffix_array_interval().begin_position};
+        };
+
+        std::sort(internal_hits.begin(), internal_hits.end(), [&] (auto const & lhs, auto const & rhs)
+        {
+            return interval_key(lhs) < interval_key(rhs);
+        });
+
+        internal_hits.erase(std::unique(internal_hits.begin(), internal_hits.end(), [&] (auto const & lhs,
+                                                                                         auto const & rhs)
+        {
+            return interval_key(lhs) == interval_key(rhs);
+        }), internal_hits.end());
+
+        reusable_search_buffer<std::vector<search_result_type>> result_buffer{};
+        std::vector<search_result_type> & results = result_buffer.get();
 
-        make_results_impl(std::move(internal_hits), idx, [&results] (auto && search_result)
+        make_results_impl(internal_hits, idx, [&] (auto && search_result)
         {
             results.push_back(std::move(search_result));
         });
@@ -138,7 +164,7 @@ private:
      * via the `search_traits_type::output_[...]` trait (e.g. `search_traits_type::output_query_id`).
      */
     template <typename index_cursor_t, typename query_index_t, typename callback_t>
-    void make_results_impl(std::vector<index_cursor_t> internal_hits,
+    void make_results_impl(std::vector<index_cursor_t> const & internal_hits,
                            [[maybe_unused]] query_index_t idx,
                            callback_t && callback)
     {
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <seqan3/core/platform.hpp>
 
@@ -45,4 +48,76 @@ struct search_param
     }
 };
 
+/*!\brief A scratch buffer of a search algorithm that reuses the storage of earlier queries on the same thread.
+ * \ingroup search
+ * \tparam buffer_t The type of the buffer, e.g. std::vector; must be default constructible and movable and must
+ *                  provide clear().
+ *
+ * \details
+ *
+ * Every thread keeps a list of buffers that are currently not used. On construction, a buffer is taken from the list
+ * of the calling thread (or created if the list is empty) and on destruction it is cleared and put back, such that
+ * its memory is reused by the next query on this thread. This works independently of how the search algorithm is
+ * copied, e.g. once per query by the parallel execution handler.
+ *
+ * A search started from a callback on the same thread, while the buffer is still in use, takes another buffer from
+ * the list, i.e. nested searches never share a buffer.
+ */
+template <typename buffer_t>
+class reusable_search_buffer
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Not copyable or movable, because the buffer is returned to the thread that took it.
+     * \{
+     */
+    reusable_search_buffer(reusable_search_buffer const &) = delete; //!< Deleted.
+    reusable_search_buffer(reusable_search_buffer &&) = delete; //!< Deleted.
+    reusable_search_buffer & operator=(reusable_search_buffer const &) = delete; //!< Deleted.
+    reusable_search_buffer & operator=(reusable_search_buffer &&) = delete; //!< Deleted.
+
+    //!\brief Takes an unused buffer of the calling thread.
+    reusable_search_buffer()
+    {
+        std::vector<buffer_t> & buffers = unused_buffers();
+
+        if (!buffers.empty())
+        {
+            buffer = std::move(buffers.back());
+            buffers.pop_back();
+        }
+    }
+
+    //!\brief Clears the buffer and returns it to the calling thread.
+    ~reusable_search_buffer()
+    {
+        buffer.clear();
+
+        try
+        {
+            unused_buffers().push_back(std::move(buffer));
+        }
+        catch (...) // the storage is simply released if it cannot be kept
+        {}
+    }
+    //!\}
+
+    //!\brief Returns the buffer.
+    buffer_t & get() noexcept
+    {
+        return buffer;
+    }
+
+private:
+    //!\brief Returns the buffers of the calling thread that are currently not used.
+    static std::vector<buffer_t> & unused_buffers() noexcept
+    {
+        thread_local std::vector<buffer_t> buffers{};
+        return buffers;
+    }
+
+    //!\brief The buffer.
+    buffer_t buffer{};
+};
+
 } // namespace seqan3::detail
@@ -12,10 +12,17 @@
 
 #pragma once
 
+#include <seqan3/std/algorithm>
+#include <memory>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_scheme_generator.hpp>
 #include <seqan3/search/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
@@ -68,12 +75,15 @@ public:
      *
      * \details
      *
-     * Initialises the stratum value from the configuration if it was set by the user.
+     * Initialises the stratum value from the configuration if it was set by the user and creates the cache for the
+     * search schemes which is shared between all copies of this algorithm.
      */
     search_scheme_algorithm(configuration_t const & cfg, index_t const & index) : policies_t{cfg}...
     {
         stratum = cfg.get_or(search_cfg::hit_strata{0}).stratum;
         index_ptr = std::addressof(index);
+        search_scheme_cache_ptr =
+            std::make_shared<search_scheme_cache>(alphabet_size<typename index_t::alphabet_type>, index.size());
     }
     //!\}
 
@@ -109,16 +119,18 @@ public:
         auto error_state = this->max_error_counts(query); // see policy_max_error
 
         // construct internal delegate for collecting hits for later filtering (if necessary)
-        std::vector<typename index_t::cursor_type> internal_hits{};
-        auto on_hit_delegate = [&internal_hits] (auto const & it)
+        // The buffer reuses the storage of the previous queries on this thread.
+        reusable_search_buffer<std::vector<typename index_t::cursor_type>> hit_buffer{};
+        std::vector<typename index_t::cursor_type> & hits = hit_buffer.get();
+        auto on_hit_delegate = [&hits] (auto const & it)
         {
-            internal_hits.push_back(it);
+            hits.push_back(it);
         };
 
-        perform_search_by_hit_strategy(internal_hits, query, error_state, on_hit_delegate);
+        perform_search_by_hit_strategy(hits, query, error_state, on_hit_delegate);
 
         // Invoke the callback on the generated result.
-        this->make_results(std::move(internal_hits), query_idx, callback); // see policy_search_result_builder
+        this->make_results(hits, query_idx, callback); // see policy_search_result_builder
     }
 
 private:
@@ -128,6 +140,39 @@ private:
     //!\brief The stratum value if set.
     uint8_t stratum{};
 
+    /*!\brief The search schemes optimised for the index and the query lengths.
+     *
+     * \details
+     *
+     * The algorithm is copied for every query when executed in parallel, hence the cache is shared between all copies.
+     */
+    std::shared_ptr<search_scheme_cache> search_scheme_cache_ptr{};
+
+    /*!\brief The cached search scheme of the previous query and its error count and query length.
+     *
+     * \details
+     *
+     * Consecutive queries mostly have the same length, such that the shared cache does not need to be locked.
+     */
+    std::tuple<search_scheme_cache::entry const *, uint8_t, size_t> previous_entry{nullptr, 0, 0};
+
+    //!\brief Holds the search scheme if it could not be stored in the full shared cache.
+    search_scheme_cache::entry uncached_entry{};
+
+    //!\brief Returns the search scheme with block information for the given error count and query length.
+    search_scheme_cache::entry const & get_search_scheme(uint8_t const max_error, size_t const query_length)
+    {
+        auto & [entry_ptr, error, length] = previous_entry;
+        if (entry_ptr != nullptr && error == max_error && length == query_length)
+            return *entry_ptr;
+
+        search_scheme_cache::entry const & entry = search_scheme_cache_ptr->get(0, max_error, query_length,
+                                                                                uncached_entry);
+        // The uncached entry is not remembered, because a copy of this algorithm would point to it.
+        previous_entry = {(&entry == &uncached_entry) ? nullptr : &entry, max_error, query_length};
+        return entry;
+    }
+
     // forward declaration
     template <bool abort_on_hit, typename query_t, typename delegate_t>
     inline void search_algo_bi(query_t & query, search_param const error_left, delegate_t && delegate);
@@ -637,6 +682,52 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
     }
 }
 
+/*!\brief Searches a query sequence in a bidirectional index using search schemes with precomputed block information.
+ * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
+ * \tparam index_t          index_t::cursor_type must model seqan3::detail::template_specialisation_of
+ *                          a seqan3::bi_fm_index_cursor.
+ * \tparam query_t          Must model std::ranges::random_access_range over the index's alphabet.
+ * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index         String index built on the text that will be searched.
+ * \param[in] query         Query sequence to be searched in the index.
+ * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] block_info    The cumulative block lengths and starting positions of each search for the length of
+ *                          `query`, see seqan3::detail::search_scheme_block_info.
+ * \param[in] delegate      Function that is called on every hit.
+ *
+ * \details
+ *
+ * In contrast to the overload without `block_info`, the blocks do not need to be of (almost) equal length and the
+ * block information is not recomputed for every query.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking the delegate also has a
+ * strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
+inline void search_ss(index_t const & index, query_t & query, search_param const error_left,
+                      search_scheme_dyn_type const & search_scheme,
+                      std::vector<std::tuple<std::vector<size_t>, size_t>> const & block_info,
+                      delegate_t && delegate)
+{
+    for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
+    {
+        auto const & [blocks_length, start_pos] = block_info[search_id];
+
+        bool const hit = search_ss<abort_on_hit>(index.cursor(), query, start_pos, start_pos + 1, 0, 0, true,
+                                                 search_scheme[search_id], blocks_length, error_left, delegate);
+
+        if (abort_on_hit && hit)
+            return;
+    }
+}
+
 /*!\brief Searches a query sequence in a bidirectional index.
  * \tparam abort_on_hit    If the flag is set, the search aborts on the first hit.
  * \tparam query_t         Must model std::ranges::random_access_range over the index's alphabet.
@@ -645,6 +736,12 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
  * \param[in] error_left   Number of errors left for matching the remaining suffix of the query sequence.
  * \param[in] delegate     Function that is called on every hit.
  *
+ * \details
+ *
+ * The search scheme and its block lengths are generated for the number of errors and the length of the query
+ * (see seqan3::detail::search_scheme_generator) and cached for subsequent queries. If the generated search scheme is
+ * not disjoint, the same cursor might be found by multiple searches and is only reported once.
+ *
  * ### Complexity
  *
  * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
@@ -661,24 +758,41 @@ inline void search_scheme_algorithm<configuration_t, index_t, policies_t...>::se
     search_param const error_left,
     delegate_t && delegate)
 {
-    switch (error_left.total)
+    auto const & [search_scheme, block_info, disjoint] = get_search_scheme(error_left.total,
+                                                                           std::ranges::size(query));
+
+    if (disjoint)
+    {
+        search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, block_info, delegate);
+    }
+    else
     {
-        case 0:
-            search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 0>, delegate);
-            break;
-        case 1:
-            search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 1>, delegate);
-            break;
-        case 2:
-            search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 2>, delegate);
-            break;
-        case 3:
-            search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 3>, delegate);
-            break;
-        default:
-            auto const & search_scheme{compute_ss(0, error_left.total)};
-            search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, delegate);
-            break;
+        reusable_search_buffer<std::vector<typename index_t::cursor_type>> reported_hit_buffer{};
+        std::vector<typename index_t::cursor_type> & reported_hits = reported_hit_buffer.get();
+        search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, block_info, [&] (auto const & cur)
+        {
+            reported_hits.push_back(cur);
+        });
+
+        // Cursors of the same depth and suffix array interval are equal, see policy_search_result_builder.
+        auto interval_key = [] (auto const & cursor)
+        {
+            return std::pair{cursor.query_length(), cursor.suffix_array_interval().begin_position};
+        };
+
+        std::sort(reported_hits.begin(), reported_hits.end(), [&] (auto const & lhs, auto const & rhs)
+        {
+            return interval_key(lhs) < interval_key(rhs);
+        });
+
+        auto const unique_end = std::unique(reported_hits.begin(), reported_hits.end(), [&] (auto const & lhs,
+                                                                                              auto const & rhs)
+        {
+            return interval_key(lhs) == interval_key(rhs);
+        });
+
+        for (auto it = reported_hits.begin(); it != unique_end; ++it)
+            delegate(*it);
     }
 }
 //!\}
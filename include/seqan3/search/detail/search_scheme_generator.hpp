@@ -0,0 +1,713 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author agent <agent AT local>
+ * \brief Provides the runtime generation of (near-)optimal search schemes and their block lengths.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/search/detail/search_scheme_precomputed.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup search
+ * \{
+ */
+
+/*!\brief Converts a precomputed optimum search scheme into a seqan3::detail::search_scheme_dyn_type.
+ * \tparam min_error Lower bound of errors.
+ * \tparam max_error Upper bound of errors.
+ */
+template <uint8_t min_error, uint8_t max_error>
+inline search_scheme_dyn_type optimum_search_scheme_dyn()
+{
+    search_scheme_dyn_type scheme{};
+    for (auto const & search : optimum_search_scheme<min_error, max_error>)
+    {
+        scheme.push_back(search_dyn{{search.pi.begin(), search.pi.end()},
+                                    {search.l.begin(), search.l.end()},
+                                    {search.u.begin(), search.u.end()}});
+    }
+    return scheme;
+}
+
+/*!\brief Returns the precomputed optimum search scheme for the given error bounds if there is one.
+ * \tparam current_min_error The lower error bound of the currently probed precomputed search scheme.
+ * \tparam current_max_error The upper error bound of the currently probed precomputed search scheme.
+ * \param[in] min_error Lower bound of errors.
+ * \param[in] max_error Upper bound of errors.
+ * \returns The optimum search scheme or std::nullopt if no search scheme was precomputed for the error bounds.
+ */
+template <uint8_t current_min_error = 0, uint8_t current_max_error = 0>
+inline std::optional<search_scheme_dyn_type> optimum_search_scheme_dyn(uint8_t const min_error,
+                                                                       uint8_t const max_error)
+{
+    if (min_error == current_min_error && max_error == current_max_error)
+        return optimum_search_scheme_dyn<current_min_error, current_max_error>();
+
+    if constexpr (current_min_error < current_max_error)
+        return optimum_search_scheme_dyn<current_min_error + 1, current_max_error>(min_error, max_error);
+    else if constexpr (current_max_error < 3)
+        return optimum_search_scheme_dyn<0, current_max_error + 1>(min_error, max_error);
+    else
+        return std::nullopt;
+}
+
+/*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
+ *        starting position of the first block in the query sequence.
+ * \param[in] search_scheme Search scheme that will be used for searching.
+ * \param[in] blocks_length The length of each block of the query from left to right.
+ * \returns A range of pairs containing for each search the cumulative lengths of blocks and the starting position
+ *          in the query.
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::search_scheme_block_info the blocks do not need to be of (almost) equal length.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of searches times the number of blocks.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline std::vector<std::tuple<std::vector<size_t>, size_t>>
+search_scheme_block_info(search_scheme_dyn_type const & search_scheme, std::vector<size_t> const & blocks_length)
+{
+    std::vector<std::tuple<std::vector<size_t>, size_t>> result(search_scheme.size());
+
+    for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
+    {
+        auto const & search = search_scheme[search_id];
+        auto & [search_blocks_length, start_pos] = result[search_id];
+
+        start_pos = 0;
+        search_blocks_length.resize(search.blocks());
+        search_blocks_length[0] = blocks_length[search.pi[0] - 1];
+        for (uint8_t i = 1; i < search.blocks(); ++i)
+        {
+            search_blocks_length[i] = blocks_length[search.pi[i] - 1] + search_blocks_length[i - 1];
+            if (search.pi[i] < search.pi[0])
+                start_pos += search_blocks_length[i] - search_blocks_length[i - 1];
+        }
+    }
+
+    return result;
+}
+
+/*!\brief Generates (near-)optimal search schemes and block lengths for arbitrary error bounds at runtime.
+ *
+ * \details
+ *
+ * The quality of a search scheme is measured by the expected number of nodes of the conceptual suffix tree that are
+ * visited when searching a random query in a random text of length `text_length` over an alphabet of size `sigma`
+ * (see Kianfar et al., Optimum Search Schemes for Approximate String Matching Using Bidirectional FM-Index, 2018).
+ * Only substitutions are taken into account for the estimation since they dominate the number of visited nodes.
+ *
+ * For error bounds with a precomputed optimum search scheme (seqan3::detail::optimum_search_scheme) this scheme is
+ * used as a candidate. Additionally, for `max_error + 1` and `max_error + 2` blocks a greedy heuristic starts with
+ * a (trivially correct) pigeonhole search scheme, i.e. one search starting in every block, and repeatedly applies the
+ * local modification (removing a search, lowering an upper bound or raising a lower bound) that decreases the
+ * expected number of nodes the most while all error distributions are still covered. Afterwards the block lengths of
+ * each candidate are optimised and the candidate with the least expected number of nodes is chosen.
+ */
+class search_scheme_generator
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    search_scheme_generator() = default; //!< Defaulted.
+    search_scheme_generator(search_scheme_generator const &) = default; //!< Defaulted.
+    search_scheme_generator(search_scheme_generator &&) = default; //!< Defaulted.
+    search_scheme_generator & operator=(search_scheme_generator const &) = default; //!< Defaulted.
+    search_scheme_generator & operator=(search_scheme_generator &&) = default; //!< Defaulted.
+    ~search_scheme_generator() = default; //!< Defaulted.
+
+    /*!\brief Constructs the generator for a given alphabet size and text length.
+     * \param[in] sigma The size of the alphabet of the text.
+     * \param[in] text_length The length of the (concatenated) text that is searched.
+     */
+    search_scheme_generator(size_t const sigma, size_t const text_length) :
+        sigma{std::max<size_t>(sigma, 2u)},
+        text_length{text_length}
+    {}
+    //!\}
+
+    /*!\brief Generates a search scheme for the given error bounds and query length.
+     * \param[in] min_error Lower bound of errors.
+     * \param[in] max_error Upper bound of errors.
+     * \param[in] query_length The length of the queries the search scheme is optimised for.
+     * \returns A search scheme covering all error distributions with at least `min_error` and at most `max_error`
+     *          errors.
+     *
+     * \details
+     *
+     * The searches are sorted by their upper bounds, s.t. easy to compute searches come first. This improves the
+     * running time of algorithms that abort after the first hit.
+     */
+    search_scheme_dyn_type generate(uint8_t const min_error, uint8_t const max_error, size_t const query_length) const
+    {
+        search_scheme_dyn_type best_scheme{{{1}, {min_error}, {max_error}}}; // trivial backtracking
+        double best_cost = expected_node_count(best_scheme, optimal_blocks_length(best_scheme, query_length));
+        bool best_disjoint{true};
+
+        // Disjoint search schemes never report the same hit twice, hence they are preferred if the expected number of
+        // nodes is (almost) the same.
+        auto probe = [&] (search_scheme_dyn_type && scheme)
+        {
+            if (scheme.empty() || scheme[0].blocks() > query_length)
+                return;
+
+            double const cost = expected_node_count(scheme, optimal_blocks_length(scheme, query_length));
+            bool const disjoint = is_disjoint(scheme, min_error, max_error);
+            double const tolerance = (disjoint && !best_disjoint) ? -tie_tolerance : tie_tolerance;
+
+            if (cost < best_cost * (1.0 - tolerance))
+            {
+                best_cost = cost;
+                best_disjoint = disjoint;
+                best_scheme = std::move(scheme);
+            }
+        };
+
+        if (max_error > 0)
+        {
+            if (auto precomputed = optimum_search_scheme_dyn(min_error, max_error); precomputed)
+                probe(std::move(*precomputed));
+
+            probe(greedy_search_scheme(min_error, max_error, max_error + 1, query_length));
+            probe(greedy_search_scheme(min_error, max_error, max_error + 2, query_length));
+        }
+
+        return best_scheme;
+    }
+
+    /*!\brief Computes the block lengths that minimise the expected number of visited nodes of a search scheme.
+     * \param[in] search_scheme The search scheme to compute the block lengths for.
+     * \param[in] query_length The length of the query.
+     * \returns The length of each block of the query from left to right.
+     *
+     * \details
+     *
+     * Starting from blocks of (almost) equal length, characters are moved between blocks as long as this decreases
+     * the expected number of nodes. The step size starts at half the average block length and is halved whenever no
+     * improvement is possible. If the query is shorter than the number of blocks, the (almost) equal distribution is
+     * returned as is.
+     */
+    std::vector<size_t> optimal_blocks_length(search_scheme_dyn_type const & search_scheme,
+                                              size_t const query_length) const
+    {
+        size_t const blocks = search_scheme[0].blocks();
+        std::vector<size_t> blocks_length(blocks, query_length / blocks);
+        for (size_t block = 0; block < query_length % blocks; ++block)
+            ++blocks_length[block];
+
+        if (query_length < blocks || blocks == 1)
+            return blocks_length;
+
+        double best_cost = expected_node_count(search_scheme, blocks_length);
+        for (size_t step = std::max<size_t>(query_length / (2 * blocks), 1u); step > 0; step /= 2)
+        {
+            for (bool improved = true; improved;)
+            {
+                improved = false;
+                for (size_t from = 0; from < blocks; ++from)
+                {
+                    for (size_t to = 0; to < blocks; ++to)
+                    {
+                        if (from == to || blocks_length[from] <= step)
+                            continue;
+
+                        blocks_length[from] -= step;
+                        blocks_length[to] += step;
+
+                        if (double const cost = expected_node_count(search_scheme, blocks_length);
+                            cost < best_cost * (1.0 - epsilon))
+                        {
+                            best_cost = cost;
+                            improved = true;
+                        }
+                        else // revert
+                        {
+                            blocks_length[from] += step;
+                            blocks_length[to] -= step;
+                        }
+                    }
+                }
+            }
+        }
+
+        return blocks_length;
+    }
+
+    /*!\brief Returns the expected number of visited nodes when searching with a search scheme.
+     * \param[in] search_scheme The search scheme.
+     * \param[in] blocks_length The length of each block of the query from left to right.
+     */
+    double expected_node_count(search_scheme_dyn_type const & search_scheme,
+                               std::vector<size_t> const & blocks_length) const
+    {
+        return std::accumulate(search_scheme.begin(), search_scheme.end(), 0.0, [&] (double sum, auto const & search)
+        {
+            return sum + expected_node_count(search, blocks_length);
+        });
+    }
+
+    /*!\brief Returns the expected number of visited nodes when searching with a single search.
+     * \param[in] search The search of a search scheme.
+     * \param[in] blocks_length The length of each block of the query from left to right.
+     *
+     * \details
+     *
+     * For each depth the number of strings that are enumerated with a given number of mismatches is multiplied with
+     * the probability that a string of this length occurs in the text, i.e. \f$1 - (1 - \sigma^{-depth})^n\f$.
+     */
+    double expected_node_count(search_dyn const & search, std::vector<size_t> const & blocks_length) const
+    {
+        // strings_with_errors[e] is the number of strings of the current depth with exactly e mismatches.
+        std::vector<double> strings_with_errors(search.u.back() + 1, 0.0);
+        strings_with_errors[0] = 1.0;
+
+        double node_count{0.0};
+        double inverse_sigma_power{1.0};
+
+        for (uint8_t block = 0; block < search.blocks(); ++block)
+        {
+            uint8_t const upper = search.u[block];
+            size_t const length = blocks_length[search.pi[block] - 1];
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                for (uint8_t errors = upper; errors > 0; --errors)
+                    strings_with_errors[errors] += (sigma - 1) * strings_with_errors[errors - 1];
+
+                inverse_sigma_power /= sigma;
+                double const occurrence_probability = -std::expm1(-(text_length * inverse_sigma_power));
+                node_count += occurrence_probability * std::accumulate(strings_with_errors.begin(),
+                                                                       strings_with_errors.begin() + upper + 1,
+                                                                       0.0);
+            }
+
+            // Strings with too few errors at the end of a block are not extended any further.
+            for (uint8_t errors = 0; errors < search.l[block]; ++errors)
+                strings_with_errors[errors] = 0.0;
+        }
+
+        return node_count;
+    }
+
+    /*!\brief Checks whether a search enumerates a given error distribution.
+     * \param[in] search The search of a search scheme.
+     * \param[in] distribution The number of errors in each block of the query from left to right.
+     */
+    static bool covers(search_dyn const & search, std::vector<uint8_t> const & distribution) noexcept
+    {
+        uint8_t errors{0};
+        for (uint8_t block = 0; block < search.blocks(); ++block)
+        {
+            errors += distribution[search.pi[block] - 1];
+            if (errors < search.l[block] || errors > search.u[block])
+                return false;
+        }
+        return true;
+    }
+
+    /*!\brief Returns all error distributions over `blocks` blocks with at least `min_error` and at most `max_error`
+     *        errors in total.
+     * \param[in] min_error Lower bound of errors.
+     * \param[in] max_error Upper bound of errors.
+     * \param[in] blocks The number of blocks.
+     */
+    static std::vector<std::vector<uint8_t>> error_distributions(uint8_t const min_error,
+                                                                 uint8_t const max_error,
+                                                                 uint8_t const blocks)
+    {
+        std::vector<std::vector<uint8_t>> result{};
+        std::vector<uint8_t> distribution(blocks, 0);
+
+        // Enumerate all distributions with at most max_error errors like an odometer.
+        for (;;)
+        {
+            uint8_t const total = std::accumulate(distribution.begin(), distribution.end(), 0u);
+            if (total >= min_error)
+                result.push_back(distribution);
+
+            uint8_t block = 0;
+            for (; block < blocks; ++block)
+            {
+                if (std::accumulate(distribution.begin() + block, distribution.end(), 0u) < max_error)
+                {
+                    ++distribution[block];
+                    std::fill(distribution.begin(), distribution.begin() + block, 0);
+                    break;
+                }
+            }
+
+            if (block == blocks)
+                return result;
+        }
+    }
+
+    /*!\brief Returns `true` if every error distribution is enumerated by exactly one search of the search scheme.
+     * \param[in] search_scheme The search scheme.
+     * \param[in] min_error Lower bound of errors.
+     * \param[in] max_error Upper bound of errors.
+     */
+    static bool is_disjoint(search_scheme_dyn_type const & search_scheme,
+                            uint8_t const min_error,
+                            uint8_t const max_error)
+    {
+        for (auto const & distribution : error_distributions(min_error, max_error, search_scheme[0].blocks()))
+        {
+            if (std::ranges::count_if(search_scheme, [&] (auto const & s) { return covers(s, distribution); }) != 1)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    //!\brief Relative improvement below which a modification is not considered to be an improvement.
+    static constexpr double epsilon{1e-9};
+    //!\brief Relative difference of the expected number of nodes below which two search schemes are considered equal.
+    static constexpr double tie_tolerance{1e-3};
+
+    /*!\brief Computes a search scheme with a given number of blocks by greedily tightening a pigeonhole scheme.
+     * \param[in] min_error Lower bound of errors.
+     * \param[in] max_error Upper bound of errors.
+     * \param[in] blocks The number of blocks; must be greater than `max_error`.
+     * \param[in] query_length The length of the query the expected number of nodes is computed for.
+     */
+    search_scheme_dyn_type greedy_search_scheme(uint8_t const min_error,
+                                                uint8_t const max_error,
+                                                uint8_t const blocks,
+                                                size_t const query_length) const
+    {
+        if (query_length < blocks)
+            return {};
+
+        // Start with a search beginning in every block, extending it to the right first and to the left first.
+        // Since there are more blocks than errors, at least one block is free of errors for every distribution.
+        search_scheme_dyn_type scheme{};
+        for (uint8_t start = 1; start <= blocks; ++start)
+        {
+            for (bool right_first : {true, false})
+            {
+                if ((right_first && start == blocks) || (!right_first && start == 1))
+                    continue;
+
+                search_dyn search{{start}, std::vector<uint8_t>(blocks, 0), std::vector<uint8_t>(blocks, max_error)};
+                for (uint8_t block = start + 1; right_first && block <= blocks; ++block)
+                    search.pi.push_back(block);
+                for (uint8_t block = start - 1; block >= 1; --block)
+                    search.pi.push_back(block);
+                for (uint8_t block = start + 1; !right_first && block <= blocks; ++block)
+                    search.pi.push_back(block);
+
+                search.l.back() = min_error;
+                search.u.front() = 0;
+                scheme.push_back(std::move(search));
+            }
+        }
+
+        std::vector<size_t> uniform_length(blocks, query_length / blocks);
+        for (size_t block = 0; block < query_length % blocks; ++block)
+            ++uniform_length[block];
+
+        auto const distributions = error_distributions(min_error, max_error, blocks);
+
+        std::vector<std::vector<bool>> covered(scheme.size(), std::vector<bool>(distributions.size()));
+        std::vector<uint8_t> cover_count(distributions.size(), 0);
+        std::vector<double> cost(scheme.size());
+        std::vector<bool> removed(scheme.size(), false);
+
+        for (size_t s = 0; s < scheme.size(); ++s)
+        {
+            cost[s] = expected_node_count(scheme[s], uniform_length);
+            for (size_t d = 0; d < distributions.size(); ++d)
+            {
+                covered[s][d] = covers(scheme[s], distributions[d]);
+                cover_count[d] += covered[s][d];
+            }
+        }
+
+        // A modification of search `s`; std::nullopt denotes the removal of the search.
+        struct modification
+        {
+            size_t s;
+            std::optional<search_dyn> search;
+            double gain;
+            bool reduces_overlap;
+        };
+
+        // A modification is valid if every distribution that is not covered anymore is covered by another search.
+        auto evaluate = [&] (modification & mod)
+        {
+            bool valid{true};
+            mod.reduces_overlap = false;
+            for (size_t d = 0; valid && d < distributions.size(); ++d)
+            {
+                if (covered[mod.s][d] && !(mod.search && covers(*mod.search, distributions[d])))
+                {
+                    valid = cover_count[d] > 1;
+                    mod.reduces_overlap = true;
+                }
+            }
+            return valid;
+        };
+
+        auto apply = [&] (modification & mod)
+        {
+            for (size_t d = 0; d < distributions.size(); ++d)
+            {
+                bool const now_covered = mod.search && covers(*mod.search, distributions[d]);
+                cover_count[d] -= covered[mod.s][d] && !now_covered;
+                covered[mod.s][d] = now_covered;
+            }
+
+            if (mod.search)
+            {
+                scheme[mod.s] = std::move(*mod.search);
+                cost[mod.s] -= mod.gain;
+            }
+            else
+            {
+                removed[mod.s] = true;
+            }
+        };
+
+        // First phase: decrease the expected number of nodes. Second phase: make the search scheme disjoint if
+        // possible, s.t. no hit is reported twice, while not increasing the expected number of nodes.
+        for (bool reduce_overlap : {false, true})
+        {
+            for (;;)
+            {
+                std::vector<modification> candidates{};
+
+                for (size_t s = 0; s < scheme.size(); ++s)
+                {
+                    if (removed[s])
+                        continue;
+
+                    candidates.push_back(modification{s, std::nullopt, cost[s], false});
+
+                    auto const & search = scheme[s];
+                    for (uint8_t block = 0; block < blocks; ++block)
+                    {
+                        if (search.u[block] > search.l[block] && (block == 0 || search.u[block - 1] < search.u[block]))
+                        {
+                            search_dyn tightened{search};
+                            --tightened.u[block];
+                            double const gain = cost[s] - expected_node_count(tightened, uniform_length);
+                            candidates.push_back(modification{s, std::move(tightened), gain, false});
+                        }
+
+                        if (search.l[block] < search.u[block] &&
+                            (block + 1 == blocks || search.l[block] < search.l[block + 1]))
+                        {
+                            search_dyn tightened{search};
+                            ++tightened.l[block];
+                            double const gain = cost[s] - expected_node_count(tightened, uniform_length);
+                            candidates.push_back(modification{s, std::move(tightened), gain, false});
+                        }
+                    }
+                }
+
+                std::stable_sort(candidates.begin(), candidates.end(), [] (auto const & lhs, auto const & rhs)
+                {
+                    return lhs.gain > rhs.gain;
+                });
+
+                auto it = std::ranges::find_if(candidates, [&] (auto & mod)
+                {
+                    if (!reduce_overlap && mod.gain <= cost[mod.s] * epsilon)
+                        return false;
+                    if (reduce_overlap && mod.gain < 0.0)
+                        return false;
+                    return evaluate(mod) && (!reduce_overlap || mod.reduces_overlap);
+                });
+
+                if (it == candidates.end())
+                    break;
+
+                apply(*it);
+            }
+
+            if (std::ranges::all_of(cover_count, [] (uint8_t const count) { return count <= 1; }))
+                break;
+        }
+
+        search_scheme_dyn_type result{};
+        for (size_t s = 0; s < scheme.size(); ++s)
+            if (!removed[s])
+                result.push_back(std::move(scheme[s]));
+
+        // Easy to compute searches come first.
+        std::stable_sort(result.begin(), result.end(), [] (auto const & lhs, auto const & rhs)
+        {
+            return std::tie(lhs.u, lhs.l) < std::tie(rhs.u, rhs.l);
+        });
+
+        return result;
+    }
+
+    //!\brief The size of the alphabet.
+    size_t sigma{4};
+    //!\brief The length of the text.
+    size_t text_length{};
+};
+
+/*!\brief A thread-safe cache of generated search schemes and their block information.
+ *
+ * \details
+ *
+ * The structure of the search scheme only depends on the error bounds and roughly on the query length. It is hence
+ * computed once for every combination of error bounds and query lengths rounded down to a multiple of 16 (exact for
+ * query lengths below 32). The block lengths are optimised for every query length individually.
+ *
+ * At most `max_entry_count` search schemes with block lengths are cached. Once the cache is full, the search schemes
+ * for further query lengths are computed into a buffer of the caller, see get(). References to cached entries stay
+ * valid for the lifetime of the cache.
+ */
+class search_scheme_cache
+{
+public:
+    //!\brief A search scheme with the block information for a specific query length.
+    struct entry
+    {
+        //!\brief The search scheme.
+        search_scheme_dyn_type search_scheme;
+        //!\brief The cumulative block lengths and start positions of each search, see search_scheme_block_info.
+        std::vector<std::tuple<std::vector<size_t>, size_t>> block_info;
+        //!\brief Whether every error distribution is covered by exactly one search.
+        bool disjoint;
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \brief Instances of this class are not copyable.
+     * \{
+     */
+    search_scheme_cache() = delete; //!< Deleted.
+    search_scheme_cache(search_scheme_cache const &) = delete; //!< Deleted.
+    search_scheme_cache(search_scheme_cache &&) = delete; //!< Deleted.
+    search_scheme_cache & operator=(search_scheme_cache const &) = delete; //!< Deleted.
+    search_scheme_cache & operator=(search_scheme_cache &&) = delete; //!< Deleted.
+    ~search_scheme_cache() = default; //!< Defaulted.
+
+    /*!\brief Constructs the cache for a given alphabet size and text length.
+     * \param[in] sigma The size of the alphabet of the text.
+     * \param[in] text_length The length of the (concatenated) text that is searched.
+     * \param[in] max_entry_count The maximal number of cached search schemes with block lengths.
+     */
+    search_scheme_cache(size_t const sigma, size_t const text_length, size_t const max_entry_count = 1024) :
+        generator{sigma, text_length},
+        max_entry_count{max_entry_count}
+    {}
+    //!\}
+
+    /*!\brief Returns the search scheme and block information for the given error bounds and query length.
+     * \param[in] min_error Lower bound of errors.
+     * \param[in] max_error Upper bound of errors.
+     * \param[in] query_length The length of the query.
+     * \param[in,out] uncached The entry that is filled and returned if the cache is full.
+     * \returns A reference to the cached entry or to `uncached`.
+     *
+     * \details
+     *
+     * ### Thread safety
+     *
+     * Concurrent calls are safe if they pass different `uncached` entries. If two threads request the same missing
+     * entry concurrently, it might be computed twice, but only one result is stored.
+     */
+    entry const & get(uint8_t const min_error, uint8_t const max_error, size_t const query_length, entry & uncached)
+    {
+        auto const entry_key = std::tuple{min_error, max_error, query_length};
+        {
+            std::shared_lock read_lock{mutex};
+            if (auto it = entries.find(entry_key); it != entries.end())
+                return *it->second;
+        }
+
+        size_t const shape_length = (query_length < 32) ? query_length : query_length / 16 * 16;
+        auto const shape_key = std::tuple{min_error, max_error, shape_length};
+        std::shared_ptr<shape const> scheme_shape{};
+        {
+            std::shared_lock read_lock{mutex};
+            if (auto it = shapes.find(shape_key); it != shapes.end())
+                scheme_shape = it->second;
+        }
+
+        if (!scheme_shape)
+        {
+            search_scheme_dyn_type scheme = generator.generate(min_error, max_error, shape_length);
+            bool const disjoint = search_scheme_generator::is_disjoint(scheme, min_error, max_error);
+
+            std::unique_lock write_lock{mutex};
+            scheme_shape = shapes.try_emplace(shape_key,
+                                              std::make_shared<shape const>(shape{std::move(scheme), disjoint}))
+                                 .first->second;
+        }
+
+        auto new_entry = std::make_unique<entry>();
+        new_entry->search_scheme = scheme_shape->search_scheme;
+        new_entry->block_info =
+            search_scheme_block_info(new_entry->search_scheme,
+                                     generator.optimal_blocks_length(new_entry->search_scheme, query_length));
+        new_entry->disjoint = scheme_shape->disjoint;
+
+        std::unique_lock write_lock{mutex};
+        if (auto it = entries.find(entry_key); it != entries.end())
+            return *it->second;
+
+        if (entries.size() < max_entry_count)
+            return *entries.emplace(entry_key, std::move(new_entry)).first->second;
+
+        write_lock.unlock();
+        uncached = std::move(*new_entry);
+        return uncached;
+    }
+
+private:
+    //!\brief A search scheme independent of the exact query length.
+    struct shape
+    {
+        //!\brief The search scheme.
+        search_scheme_dyn_type search_scheme;
+        //!\brief Whether every error distribution is covered by exactly one search.
+        bool disjoint;
+    };
+
+    //!\brief The generator of the search schemes.
+    search_scheme_generator generator;
+    //!\brief The maximal number of cached search schemes with block lengths.
+    size_t max_entry_count{};
+    //!\brief Protects the maps below.
+    std::shared_mutex mutex{};
+    //!\brief The search schemes by error bounds and rounded query length.
+    std::map<std::tuple<uint8_t, uint8_t, size_t>, std::shared_ptr<shape const>> shapes{};
+    //!\brief The search schemes with block information by error bounds and exact query length.
+    std::map<std::tuple<uint8_t, uint8_t, size_t>, std::unique_ptr<entry const>> entries{};
+};
+
+//!\}
+
+} // namespace seqan3::detail
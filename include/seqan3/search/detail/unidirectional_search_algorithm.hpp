@@ -115,15 +115,17 @@ public:
         auto error_state = this->max_error_counts(query); // see policy_max_error
 
         // construct internal delegate for collecting hits for later filtering (if necessary)
-        std::vector<typename index_t::cursor_type> internal_hits{};
-        delegate = [&internal_hits] (auto const & it)
+        // The buffer reuses the storage of the previous queries on this thread.
+        reusable_search_buffer<std::vector<typename index_t::cursor_type>> hit_buffer{};
+        std::vector<typename index_t::cursor_type> & hits = hit_buffer.get();
+        delegate = [&hits] (auto const & it)
         {
-            internal_hits.push_back(it);
+            hits.push_back(it);
         };
 
-        perform_search_by_hit_strategy(internal_hits, query, error_state);
+        perform_search_by_hit_strategy(hits, query, error_state);
 
-        this->make_results(std::move(internal_hits), query_idx, callback); // see policy_search_result_builder
+        this->make_results(hits, query_idx, callback); // see policy_search_result_builder
     }
 
 private:
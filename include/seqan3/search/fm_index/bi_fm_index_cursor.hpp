@@ -849,6 +849,28 @@ public:
         return cur;
     }
 
+    /*!\brief Returns the half-open suffix array interval of the index of the original text.
+     * \returns A seqan3::suffix_array_interval contains the half-open interval.
+     *
+     * \details
+     *
+     * The interval is the same as the one of the unidirectional cursor returned by to_fwd_cursor().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    seqan3::suffix_array_interval suffix_array_interval() const noexcept
+    {
+        assert(index != nullptr);
+
+        return {fwd_lb, fwd_rb + 1};
+    }
+
     /*!\brief Returns the searched query.
      * \tparam text_t The type of the text used to build the index; must model std::ranges::input_range.
      * \param[in] text Text that was used to build the index.
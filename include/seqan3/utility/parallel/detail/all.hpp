@@ -15,3 +15,4 @@
 #include <seqan3/utility/parallel/detail/latch.hpp>
 #include <seqan3/utility/parallel/detail/reader_writer_manager.hpp>
 #include <seqan3/utility/parallel/detail/spin_delay.hpp>
+#include <seqan3/utility/parallel/detail/worker_pool.hpp>
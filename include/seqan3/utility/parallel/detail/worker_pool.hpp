@@ -0,0 +1,222 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::worker_pool.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <seqan3/std/concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace seqan3::detail
+{
+
+/*!\brief A set of persistent threads that repeatedly execute a number of indexed tasks together with the caller.
+ * \ingroup parallel
+ *
+ * \details
+ *
+ * The threads are created once on construction and wait for work between the calls to run(), such that short
+ * rounds of work, e.g. parsing the chunks of a block of records, do not pay for the creation of threads.
+ * The calling thread takes part in the execution, i.e. a pool for `thread_count` threads creates
+ * `thread_count - 1` threads.
+ */
+class worker_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Not copyable or movable, because the threads refer to the pool.
+     * \{
+     */
+    worker_pool() = delete; //!< Deleted.
+    worker_pool(worker_pool const &) = delete; //!< Deleted.
+    worker_pool(worker_pool &&) = delete; //!< Deleted.
+    worker_pool & operator=(worker_pool const &) = delete; //!< Deleted.
+    worker_pool & operator=(worker_pool &&) = delete; //!< Deleted.
+
+    //!\brief Stops and joins all threads.
+    ~worker_pool()
+    {
+        stop();
+    }
+
+    /*!\brief Creates `thread_count - 1` threads.
+     * \param[in] thread_count The number of threads executing the tasks, including the caller of run().
+     */
+    explicit worker_pool(size_t const thread_count)
+    {
+        try
+        {
+            for (size_t i = 1; i < thread_count; ++i)
+                threads.emplace_back([this] () { wait_for_tasks(); });
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+    //!\}
+
+    //!\brief Returns the number of threads executing the tasks, including the caller of run().
+    size_t thread_count() const noexcept
+    {
+        return threads.size() + 1u;
+    }
+
+    /*!\brief Invokes `task(i)` for every `i` in `[0, task_count)` and returns when all tasks have finished.
+     * \tparam task_t The type of the task; must be invocable with a `size_t`.
+     * \param[in] task_count The number of tasks.
+     * \param[in] task The task to invoke.
+     *
+     * \details
+     *
+     * The tasks are executed by the threads of the pool and the calling thread in arbitrary order.
+     *
+     * ### Exceptions
+     *
+     * If a task throws, the remaining tasks are still executed and the first exception is rethrown.
+     *
+     * ### Thread safety
+     *
+     * run() must not be called concurrently on the same pool.
+     */
+    template <typename task_t>
+    //!\cond
+        requires std::invocable<task_t &, size_t>
+    //!\endcond
+    void run(size_t const task_count, task_t && task)
+    {
+        if (task_count == 0u)
+            return;
+
+        {
+            std::lock_guard lock{mutex};
+            current_task = std::ref(task);
+            next_task = 0u;
+            total_tasks = task_count;
+            pending_tasks = task_count;
+            error = nullptr;
+            ++round;
+        }
+
+        work_available.notify_all();
+        execute_tasks();
+
+        std::unique_lock lock{mutex};
+        work_finished.wait(lock, [&] () { return pending_tasks == 0u; });
+        current_task = nullptr;
+
+        if (error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+
+private:
+    //!\brief The loop of the threads, which execute the tasks of every new round until the pool is stopped.
+    void wait_for_tasks()
+    {
+        size_t seen_round = 0u;
+
+        for (;;)
+        {
+            {
+                std::unique_lock lock{mutex};
+                work_available.wait(lock, [&] () { return stopped || round != seen_round; });
+
+                if (stopped)
+                    return;
+
+                seen_round = round;
+            }
+
+            execute_tasks();
+        }
+    }
+
+    //!\brief Stops and joins all threads.
+    void stop()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopped = true;
+        }
+
+        work_available.notify_all();
+
+        for (auto & thread : threads)
+            thread.join();
+    }
+
+    //!\brief Executes tasks of the current round until none is left.
+    void execute_tasks()
+    {
+        for (;;)
+        {
+            size_t task_id{};
+            {
+                std::lock_guard lock{mutex};
+                if (next_task == total_tasks)
+                    return;
+
+                task_id = next_task++;
+            }
+
+            std::exception_ptr task_error{nullptr};
+
+            try
+            {
+                current_task(task_id);
+            }
+            catch (...)
+            {
+                task_error = std::current_exception();
+            }
+
+            std::lock_guard lock{mutex};
+            if (task_error && !error)
+                error = task_error;
+
+            if (--pending_tasks == 0u)
+                work_finished.notify_one();
+        }
+    }
+
+    //!\brief The threads of the pool.
+    std::vector<std::thread> threads{};
+    //!\brief Protects the members below.
+    std::mutex mutex{};
+    //!\brief Signals a new round of tasks or the destruction of the pool.
+    std::condition_variable work_available{};
+    //!\brief Signals that all tasks of the current round have finished.
+    std::condition_variable work_finished{};
+    //!\brief The task of the current round.
+    std::function<void(size_t)> current_task{};
+    //!\brief The index of the next task that is not yet started.
+    size_t next_task{};
+    //!\brief The number of tasks of the current round.
+    size_t total_tasks{};
+    //!\brief The number of tasks of the current round that have not finished.
+    size_t pending_tasks{};
+    //!\brief Counts the calls to run(); the threads wait for a new round.
+    size_t round{};
+    //!\brief The first exception thrown by a task of the current round.
+    std::exception_ptr error{nullptr};
+    //!\brief Whether the pool is being destroyed.
+    bool stopped{false};
+};
+
+} // namespace seqan3::detail
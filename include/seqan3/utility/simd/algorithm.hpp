@@ -69,6 +69,23 @@ constexpr simd_t extract_impl(simd_t const & src, uint8_t const mask)
     return dst;
 }
 
+/*!\brief Transposes the given simd vector matrix element by element.
+ * \tparam simd_t The simd vector type; must model seqan3::simd::simd_concept.
+ * \param[in,out] matrix The matrix that is transposed in place.
+ * \ingroup simd
+ */
+template <simd::simd_concept simd_t>
+constexpr void transpose_matrix_generic(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+{
+    std::array<simd_t, simd_traits<simd_t>::length> tmp{};
+
+    for (size_t i = 0; i < matrix.size(); ++i)
+        for (size_t j = 0; j < matrix.size(); ++j)
+            tmp[j][i] = matrix[i][j];
+
+    std::swap(tmp, matrix);
+}
+
 /*!\brief Upcasts the given vector into the target vector using signed extension of packed values.
  * \tparam target_simd_t The target simd type; must model seqan3::simd::simd_concept and must be a native builtin simd
  *                       type.
@@ -161,6 +178,10 @@ constexpr simd_t extract_half(simd_t const & src)
         return detail::extract_half_sse4<index>(src);
     else if constexpr (simd_traits<simd_t>::max_length == 32) // AVX2
         return detail::extract_half_avx2<index>(src);
+#if defined(__AVX512F__) || SEQAN3_SIMD_MULTIVERSIONING // The AVX512 kernels are only available in this case.
+    else if constexpr (simd_traits<simd_t>::max_length == 64) // AVX512
+        return detail::extract_half_avx512<index>(src);
+#endif
     else // Anything else
         return detail::extract_impl<2>(src, index);
 }
@@ -210,6 +231,10 @@ constexpr simd_t extract_quarter(simd_t const & src)
         return detail::extract_quarter_sse4<index>(src);
     else if constexpr (simd_traits<simd_t>::max_length == 32) // AVX2
         return detail::extract_quarter_avx2<index>(src);
+#if defined(__AVX512F__) || SEQAN3_SIMD_MULTIVERSIONING // The AVX512 kernels are only available in this case.
+    else if constexpr (simd_traits<simd_t>::max_length == 64) // AVX512
+        return detail::extract_quarter_avx512<index>(src);
+#endif
     else // Anything else
         return detail::extract_impl<4>(src, index);
 }
@@ -257,6 +282,10 @@ constexpr simd_t extract_eighth(simd_t const & src)
         return detail::extract_eighth_sse4<index>(src);
     else if constexpr (simd_traits<simd_t>::max_length == 32) // AVX2
         return detail::extract_eighth_avx2<index>(src);
+#if defined(__AVX512F__) || SEQAN3_SIMD_MULTIVERSIONING // The AVX512 kernels are only available in this case.
+    else if constexpr (simd_traits<simd_t>::max_length == 64) // AVX512
+        return detail::extract_eighth_avx512<index>(src);
+#endif
     else  // Anything else
         return detail::extract_impl<8>(src, index);
 }
@@ -364,13 +393,7 @@ constexpr simd_t load(void const * mem_addr)
 template <simd::simd_concept simd_t>
 constexpr void transpose(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
 {
-    std::array<simd_t, simd_traits<simd_t>::length> tmp{};
-
-    for (size_t i = 0; i < matrix.size(); ++i)
-        for (size_t j = 0; j < matrix.size(); ++j)
-            tmp[j][i] = matrix[i][j];
-
-    std::swap(tmp, matrix);
+    detail::transpose_matrix_generic(matrix);
 }
 
 //!\cond
@@ -385,8 +408,12 @@ constexpr void transpose(std::array<simd_t, simd_traits<simd_t>::length> & matri
         detail::transpose_matrix_sse4(matrix);
     else if constexpr (simd_traits<simd_t>::length == 32) // AVX2 implementation
         detail::transpose_matrix_avx2(matrix);
+#if defined(__AVX512F__) || SEQAN3_SIMD_MULTIVERSIONING // The AVX512 kernel is only available in this case.
+    else if constexpr (simd_traits<simd_t>::length == 64) // AVX512 implementation
+        detail::transpose_matrix_avx512(matrix);
+#endif
     else
-        transpose(matrix);
+        detail::transpose_matrix_generic(matrix);
 }
 //!\endcond
 
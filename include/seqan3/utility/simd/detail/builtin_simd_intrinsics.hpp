@@ -34,3 +34,80 @@
 #define __SSE4_1__ 1
 #define __SSE4_2__ 1
 #endif
+
+/*!\brief Whether SIMD kernels of instruction sets that are not enabled at compile time are still generated.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * If set to `1`, the AVX2 and AVX512 kernels are compiled with function specific target attributes, even if the
+ * translation unit is compiled for a lower instruction set (but at least SSE4). The instruction set is then selected at
+ * runtime, see seqan3::detail::runtime_simd_instruction_set and seqan3::detail::simd_dispatch. This allows to
+ * distribute a single binary that makes use of the widest instruction set available on the executing machine.
+ *
+ * The kernels only take and return the wide vector types by reference, and the dispatched entry points reject simd
+ * vectors as arguments and results. Hence, no wide vector crosses a function boundary by value and the calling
+ * convention of the translation unit is kept, i.e. GCC does not warn about an ABI change (`-Wpsabi`).
+ *
+ * Defaults to `1` for GCC and Clang on x86 if at least SSE4.2 is enabled and to `0` otherwise. Define the macro to `0`
+ * before including any SeqAn header to disable it.
+ */
+#ifndef SEQAN3_SIMD_MULTIVERSIONING
+#   if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__SSE4_2__)
+#       define SEQAN3_SIMD_MULTIVERSIONING 1
+#   else
+#       define SEQAN3_SIMD_MULTIVERSIONING 0
+#   endif
+#endif
+
+//!\cond
+#if SEQAN3_SIMD_MULTIVERSIONING && !((defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+                                     defined(__SSE4_2__))
+#   undef SEQAN3_SIMD_MULTIVERSIONING
+#   define SEQAN3_SIMD_MULTIVERSIONING 0
+#endif
+//!\endcond
+
+/*!\brief Whether generic code is compiled for the instruction set that is selected at runtime.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * If set to `1`, seqan3::detail::simd_invoke enters the callable through an entry point that has the target attribute
+ * of the selected instruction set and inlines all calls (`flatten`). This is needed for generic code that operates on
+ * the wide vectors outside of the kernels, e.g. the vectorised alignment, which then uses the wider vectors if the
+ * executing CPU supports them. Requires SEQAN3_SIMD_MULTIVERSIONING and an optimised build (`__OPTIMIZE__`), since
+ * the calls are not inlined otherwise.
+ *
+ * Defaults to `0`.
+ *
+ * \attention The generic code passes and returns the wide vector types by value, e.g. seqan3::simd::load. If the
+ *            translation unit is not compiled for AVX, GCC warns about the changed ABI of these types (`-Wpsabi`),
+ *            which is an error with `-Werror`. Compile with `-Wno-psabi` when enabling this option.
+ */
+#ifndef SEQAN3_SIMD_FLATTEN_DISPATCH
+#   define SEQAN3_SIMD_FLATTEN_DISPATCH 0
+#endif
+
+//!\cond
+#if SEQAN3_SIMD_FLATTEN_DISPATCH && !(SEQAN3_SIMD_MULTIVERSIONING && defined(__OPTIMIZE__))
+#   undef SEQAN3_SIMD_FLATTEN_DISPATCH
+#   define SEQAN3_SIMD_FLATTEN_DISPATCH 0
+#endif
+//!\endcond
+
+//!\brief Function attribute enabling AVX2 code generation for a kernel if AVX2 is not enabled at compile time.
+//!\ingroup simd
+#if !defined(__AVX2__) && SEQAN3_SIMD_MULTIVERSIONING
+#   define SEQAN3_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#   define SEQAN3_SIMD_TARGET_AVX2
+#endif
+
+//!\brief Function attribute enabling AVX512 code generation for a kernel if AVX512 is not enabled at compile time.
+//!\ingroup simd
+#if !(defined(__AVX512F__) && defined(__AVX512BW__)) && SEQAN3_SIMD_MULTIVERSIONING
+#   define SEQAN3_SIMD_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#else
+#   define SEQAN3_SIMD_TARGET_AVX512
+#endif
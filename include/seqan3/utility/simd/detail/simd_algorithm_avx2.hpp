@@ -35,7 +35,7 @@ constexpr simd_t load_avx2(void const * mem_addr);
  * \attention This is the implementation for AVX2 intrinsics.
  */
 template <simd::simd_concept simd_t>
-inline void transpose_matrix_avx2(std::array<simd_t, simd_traits<simd_t>::length> & matrix);
+SEQAN3_SIMD_TARGET_AVX2 inline void transpose_matrix_avx2(std::array<simd_t, simd_traits<simd_t>::length> & matrix);
 
 /*!\copydoc seqan3::detail::upcast_signed
  * \attention This is the implementation for AVX2 intrinsics.
@@ -73,31 +73,32 @@ constexpr simd_t extract_eighth_avx2(simd_t const & src);
 // implementation
 //-----------------------------------------------------------------------------
 
-#ifdef __AVX2__
+#if defined(__AVX2__) || SEQAN3_SIMD_MULTIVERSIONING
 
 namespace seqan3::detail
 {
 
+// If SEQAN3_SIMD_MULTIVERSIONING is enabled, the kernels are compiled with the AVX2 target attribute while the caller
+// might be compiled for a lower instruction set. 256 bit vectors are passed differently in this case, such that the
+// kernels only take and return them by reference.
+
 template <simd::simd_concept simd_t>
-constexpr simd_t load_avx2(void const * mem_addr)
+SEQAN3_SIMD_TARGET_AVX2 inline void load_avx2_kernel(simd_t & dst, void const * mem_addr)
 {
-    return reinterpret_cast<simd_t>(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(mem_addr)));
+    dst = reinterpret_cast<simd_t>(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(mem_addr)));
 }
 
 template <simd::simd_concept simd_t>
-inline void transpose_matrix_avx2(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+constexpr simd_t load_avx2(void const * mem_addr)
 {
-    // emulate missing _mm256_unpacklo_epi128/_mm256_unpackhi_epi128 instructions
-    auto _mm256_unpacklo_epi128 = [] (__m256i const & a, __m256i const & b)
-    {
-        return _mm256_permute2x128_si256(a, b, 0x20);
-    };
-
-    auto _mm256_unpackhi_epi128 = [] (__m256i const & a, __m256i const & b)
-    {
-        return _mm256_permute2x128_si256(a, b, 0x31);
-    };
+    simd_t dst{};
+    load_avx2_kernel(dst, mem_addr);
+    return dst;
+}
 
+template <simd::simd_concept simd_t>
+SEQAN3_SIMD_TARGET_AVX2 inline void transpose_matrix_avx2(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+{
     // A look-up table to reverse the lowest 4 bits in order to permute the transposed rows.
     static const uint8_t bit_rev[] = { 0, 8, 4,12, 2,10, 6,14, 1, 9, 5,13, 3,11, 7,15,
                                       16,24,20,28,18,26,22,30,17,25,21,29,19,27,23,31};
@@ -131,88 +132,130 @@ inline void transpose_matrix_avx2(std::array<simd_t, simd_traits<simd_t>::length
         tmp2[i]    = _mm256_unpacklo_epi64(tmp1[2*i], tmp1[2*i+1]);
         tmp2[i+16] = _mm256_unpackhi_epi64(tmp1[2*i], tmp1[2*i+1]);
     }
+    // Emulate the missing _mm256_unpacklo_epi128/_mm256_unpackhi_epi128 instructions. Note, that lambdas cannot be
+    // used here, since they would not inherit the target attribute of this function.
     for (int i = 0; i < 16; ++i)
     {
-        matrix[bit_rev[i]]    = reinterpret_cast<simd_t>(_mm256_unpacklo_epi128(tmp2[2*i],tmp2[2*i+1]));
-        matrix[bit_rev[i+16]] = reinterpret_cast<simd_t>(_mm256_unpackhi_epi128(tmp2[2*i],tmp2[2*i+1]));
+        matrix[bit_rev[i]]    = reinterpret_cast<simd_t>(_mm256_permute2x128_si256(tmp2[2*i], tmp2[2*i+1], 0x20));
+        matrix[bit_rev[i+16]] = reinterpret_cast<simd_t>(_mm256_permute2x128_si256(tmp2[2*i], tmp2[2*i+1], 0x31));
     }
 }
 
 template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
-constexpr target_simd_t upcast_signed_avx2(source_simd_t const & src)
+SEQAN3_SIMD_TARGET_AVX2 inline void upcast_signed_avx2_kernel(target_simd_t & dst, source_simd_t const & src)
 {
     __m128i const & tmp = _mm256_castsi256_si128(reinterpret_cast<__m256i const &>(src));
     if constexpr (simd_traits<source_simd_t>::length == 32) // cast from epi8 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 16) // to epi16
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepi8_epi16(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepi8_epi16(tmp));
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepi8_epi32(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepi8_epi32(tmp));
         if constexpr (simd_traits<target_simd_t>::length == 4) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepi8_epi64(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepi8_epi64(tmp));
     }
     else if constexpr (simd_traits<source_simd_t>::length == 16) // cast from epi16 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepi16_epi32(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepi16_epi32(tmp));
         if constexpr (simd_traits<target_simd_t>::length == 4) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepi16_epi64(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepi16_epi64(tmp));
     }
     else // cast from epi32 to epi64
     {
         static_assert(simd_traits<source_simd_t>::length == 8, "Expected 32 bit scalar type.");
-        return reinterpret_cast<target_simd_t>(_mm256_cvtepi32_epi64(tmp));
+        dst = reinterpret_cast<target_simd_t>(_mm256_cvtepi32_epi64(tmp));
     }
 }
 
 template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
-constexpr target_simd_t upcast_unsigned_avx2(source_simd_t const & src)
+constexpr target_simd_t upcast_signed_avx2(source_simd_t const & src)
+{
+    target_simd_t dst{};
+    upcast_signed_avx2_kernel(dst, src);
+    return dst;
+}
+
+template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
+SEQAN3_SIMD_TARGET_AVX2 inline void upcast_unsigned_avx2_kernel(target_simd_t & dst, source_simd_t const & src)
 {
     __m128i const & tmp = _mm256_castsi256_si128(reinterpret_cast<__m256i const &>(src));
     if constexpr (simd_traits<source_simd_t>::length == 32) // cast from epi8 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 16) // to epi16
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepu8_epi16(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepu8_epi16(tmp));
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepu8_epi32(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepu8_epi32(tmp));
         if constexpr (simd_traits<target_simd_t>::length == 4) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepu8_epi64(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepu8_epi64(tmp));
     }
     else if constexpr (simd_traits<source_simd_t>::length == 16) // cast from epi16 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepu16_epi32(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepu16_epi32(tmp));
         if constexpr (simd_traits<target_simd_t>::length == 4) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm256_cvtepu16_epi64(tmp));
+            dst = reinterpret_cast<target_simd_t>(_mm256_cvtepu16_epi64(tmp));
     }
     else // cast from epi32 to epi64
     {
         static_assert(simd_traits<source_simd_t>::length == 8, "Expected 32 bit scalar type.");
-        return reinterpret_cast<target_simd_t>(_mm256_cvtepu32_epi64(tmp));
+        dst = reinterpret_cast<target_simd_t>(_mm256_cvtepu32_epi64(tmp));
     }
 }
 
+template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
+constexpr target_simd_t upcast_unsigned_avx2(source_simd_t const & src)
+{
+    target_simd_t dst{};
+    upcast_unsigned_avx2_kernel(dst, src);
+    return dst;
+}
+
 template <uint8_t index, simd::simd_concept simd_t>
-constexpr simd_t extract_half_avx2(simd_t const & src)
+SEQAN3_SIMD_TARGET_AVX2 inline void extract_half_avx2_kernel(simd_t & dst, simd_t const & src)
 {
-    return reinterpret_cast<simd_t>(_mm256_castsi128_si256(
+    dst = reinterpret_cast<simd_t>(_mm256_castsi128_si256(
             _mm256_extracti128_si256(reinterpret_cast<__m256i const &>(src), index)));
 }
 
 template <uint8_t index, simd::simd_concept simd_t>
-constexpr simd_t extract_quarter_avx2(simd_t const & src)
+constexpr simd_t extract_half_avx2(simd_t const & src)
+{
+    simd_t dst{};
+    extract_half_avx2_kernel<index>(dst, src);
+    return dst;
+}
+
+template <uint8_t index, simd::simd_concept simd_t>
+SEQAN3_SIMD_TARGET_AVX2 inline void extract_quarter_avx2_kernel(simd_t & dst, simd_t const & src)
 {
-    return reinterpret_cast<simd_t>(_mm256_castsi128_si256(
+    dst = reinterpret_cast<simd_t>(_mm256_castsi128_si256(
             _mm_cvtsi64x_si128(_mm256_extract_epi64(reinterpret_cast<__m256i const &>(src), index))));
 }
 
 template <uint8_t index, simd::simd_concept simd_t>
-constexpr simd_t extract_eighth_avx2(simd_t const & src)
+constexpr simd_t extract_quarter_avx2(simd_t const & src)
 {
-    return reinterpret_cast<simd_t>(_mm256_castsi128_si256(
+    simd_t dst{};
+    extract_quarter_avx2_kernel<index>(dst, src);
+    return dst;
+}
+
+template <uint8_t index, simd::simd_concept simd_t>
+SEQAN3_SIMD_TARGET_AVX2 inline void extract_eighth_avx2_kernel(simd_t & dst, simd_t const & src)
+{
+    dst = reinterpret_cast<simd_t>(_mm256_castsi128_si256(
             _mm_cvtsi32_si128(_mm256_extract_epi32(reinterpret_cast<__m256i const &>(src), index))));
 }
 
+template <uint8_t index, simd::simd_concept simd_t>
+constexpr simd_t extract_eighth_avx2(simd_t const & src)
+{
+    simd_t dst{};
+    extract_eighth_avx2_kernel<index>(dst, src);
+    return dst;
+}
+
 } // namespace seqan3::detail
 
-#endif // __AVX2__
+#endif // defined(__AVX2__) || SEQAN3_SIMD_MULTIVERSIONING
@@ -35,7 +35,7 @@ constexpr simd_t load_avx512(void const * mem_addr);
  * \attention This is the implementation for AVX512 intrinsics.
  */
 template <simd::simd_concept simd_t>
-inline void transpose_matrix_avx512(std::array<simd_t, simd_traits<simd_t>::length> & matrix);
+SEQAN3_SIMD_TARGET_AVX512 inline void transpose_matrix_avx512(std::array<simd_t, simd_traits<simd_t>::length> & matrix);
 
 /*!\copydoc seqan3::detail::upcast_signed
  * \attention This is the implementation for AVX512 intrinsics.
@@ -73,87 +73,206 @@ constexpr simd_t extract_eighth_avx512(simd_t const & src);
 // implementation
 //-----------------------------------------------------------------------------
 
-#ifdef __AVX512F__
+#if defined(__AVX512F__) || SEQAN3_SIMD_MULTIVERSIONING
 
 namespace seqan3::detail
 {
 
+// If SEQAN3_SIMD_MULTIVERSIONING is enabled, the kernels are compiled with the AVX512 target attribute while the
+// caller might be compiled for a lower instruction set. 512 bit vectors are passed differently in this case, such that
+// the kernels only take and return them by reference.
+
+template <simd::simd_concept simd_t>
+SEQAN3_SIMD_TARGET_AVX512 inline void load_avx512_kernel(simd_t & dst, void const * mem_addr)
+{
+    dst = reinterpret_cast<simd_t>(_mm512_loadu_si512(mem_addr));
+}
+
 template <simd::simd_concept simd_t>
 constexpr simd_t load_avx512(void const * mem_addr)
 {
-    return reinterpret_cast<simd_t>(_mm512_loadu_si512(mem_addr));
+    simd_t dst{};
+    load_avx512_kernel(dst, mem_addr);
+    return dst;
 }
 
-// TODO: not implemented and used yet, if you implement it don't forget to add it to seqan3::simd::transpose
+#if SEQAN3_WORKAROUND_GCC_105593
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif // SEQAN3_WORKAROUND_GCC_105593
 template <simd::simd_concept simd_t>
-inline void transpose_matrix_avx512(std::array<simd_t, simd_traits<simd_t>::length> & matrix);
+SEQAN3_SIMD_TARGET_AVX512 inline void transpose_matrix_avx512(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+{
+    // A look-up table to reverse the lowest 4 bits in order to permute the transposed rows.
+    static const uint8_t bit_rev[] = { 0, 8, 4,12, 2,10, 6,14, 1, 9, 5,13, 3,11, 7,15,
+                                      16,24,20,28,18,26,22,30,17,25,21,29,19,27,23,31,
+                                      32,40,36,44,34,42,38,46,33,41,37,45,35,43,39,47,
+                                      48,56,52,60,50,58,54,62,49,57,53,61,51,59,55,63};
+
+    // transpose a 64x64 byte matrix
+    __m512i tmp1[64];
+    for (int i = 0; i < 32; ++i)
+    {
+        tmp1[i]    = _mm512_unpacklo_epi8(
+            reinterpret_cast<const __m512i &>(matrix[2*i]),
+            reinterpret_cast<const __m512i &>(matrix[2*i+1])
+        );
+        tmp1[i+32] = _mm512_unpackhi_epi8(
+            reinterpret_cast<const __m512i &>(matrix[2*i]),
+            reinterpret_cast<const __m512i &>(matrix[2*i+1])
+        );
+    }
+    __m512i tmp2[64];
+    for (int i = 0; i < 32; ++i)
+    {
+        tmp2[i]    = _mm512_unpacklo_epi16(tmp1[2*i], tmp1[2*i+1]);
+        tmp2[i+32] = _mm512_unpackhi_epi16(tmp1[2*i], tmp1[2*i+1]);
+    }
+    for (int i = 0; i < 32; ++i)
+    {
+        tmp1[i]    = _mm512_unpacklo_epi32(tmp2[2*i], tmp2[2*i+1]);
+        tmp1[i+32] = _mm512_unpackhi_epi32(tmp2[2*i], tmp2[2*i+1]);
+    }
+    for (int i = 0; i < 32; ++i)
+    {
+        tmp2[i]    = _mm512_unpacklo_epi64(tmp1[2*i], tmp1[2*i+1]);
+        tmp2[i+32] = _mm512_unpackhi_epi64(tmp1[2*i], tmp1[2*i+1]);
+    }
+    // Emulate the missing _mm512_unpacklo_epi128/_mm512_unpackhi_epi128 instructions, i.e. interleave the 128 bit lanes
+    // within each 256 bit half.
+    __m512i const unpack_lo_idx = _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 12, 13);
+    __m512i const unpack_hi_idx = _mm512_setr_epi64(2, 3, 10, 11, 6, 7, 14, 15);
+    for (int i = 0; i < 32; ++i)
+    {
+        tmp1[i]    = _mm512_permutex2var_epi64(tmp2[2*i], unpack_lo_idx, tmp2[2*i+1]);
+        tmp1[i+32] = _mm512_permutex2var_epi64(tmp2[2*i], unpack_hi_idx, tmp2[2*i+1]);
+    }
+    // Emulate the missing _mm512_unpacklo_epi256/_mm512_unpackhi_epi256 instructions.
+    for (int i = 0; i < 32; ++i)
+    {
+        matrix[bit_rev[i]]    = reinterpret_cast<simd_t>(_mm512_shuffle_i64x2(tmp1[2*i], tmp1[2*i+1], 0x44));
+        matrix[bit_rev[i+32]] = reinterpret_cast<simd_t>(_mm512_shuffle_i64x2(tmp1[2*i], tmp1[2*i+1], 0xee));
+    }
+}
+#if SEQAN3_WORKAROUND_GCC_105593
+#pragma GCC diagnostic pop
+#endif // SEQAN3_WORKAROUND_GCC_105593
 
 template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
-constexpr target_simd_t upcast_signed_avx512(source_simd_t const & src)
+SEQAN3_SIMD_TARGET_AVX512 inline void upcast_signed_avx512_kernel(target_simd_t & dst, source_simd_t const & src)
 {
     __m512i const & tmp = reinterpret_cast<__m512i const &>(src);
     if constexpr (simd_traits<source_simd_t>::length == 64) // cast from epi8 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 32) // to epi16
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepi8_epi16(_mm512_castsi512_si256(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepi8_epi16(_mm512_castsi512_si256(tmp)));
         if constexpr (simd_traits<target_simd_t>::length == 16) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepi8_epi32(_mm512_castsi512_si128(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepi8_epi32(_mm512_castsi512_si128(tmp)));
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepi8_epi64(_mm512_castsi512_si128(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepi8_epi64(_mm512_castsi512_si128(tmp)));
     }
     else if constexpr (simd_traits<source_simd_t>::length == 32) // cast from epi16 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 16) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(tmp)));
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepi16_epi64(_mm512_castsi512_si128(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepi16_epi64(_mm512_castsi512_si128(tmp)));
     }
     else // cast from epi32 to epi64
     {
         static_assert(simd_traits<source_simd_t>::length == 16, "Expected 32 bit scalar type.");
-        return reinterpret_cast<target_simd_t>(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(tmp)));
+        dst = reinterpret_cast<target_simd_t>(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(tmp)));
     }
 }
 
 template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
-constexpr target_simd_t upcast_unsigned_avx512(source_simd_t const & src)
+constexpr target_simd_t upcast_signed_avx512(source_simd_t const & src)
+{
+    target_simd_t dst{};
+    upcast_signed_avx512_kernel(dst, src);
+    return dst;
+}
+
+template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
+SEQAN3_SIMD_TARGET_AVX512 inline void upcast_unsigned_avx512_kernel(target_simd_t & dst, source_simd_t const & src)
 {
     __m512i const & tmp = reinterpret_cast<__m512i const &>(src);
     if constexpr (simd_traits<source_simd_t>::length == 64) // cast from epi8 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 32) // to epi16
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(tmp)));
         if constexpr (simd_traits<target_simd_t>::length == 16) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepu8_epi32(_mm512_castsi512_si128(tmp)));
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepu8_epi64(_mm512_castsi512_si128(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepu8_epi64(_mm512_castsi512_si128(tmp)));
     }
     else if constexpr (simd_traits<source_simd_t>::length == 32) // cast from epi16 ...
     {
         if constexpr (simd_traits<target_simd_t>::length == 16) // to epi32
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(tmp)));
         if constexpr (simd_traits<target_simd_t>::length == 8) // to epi64
-            return reinterpret_cast<target_simd_t>(_mm512_cvtepu16_epi64(_mm512_castsi512_si128(tmp)));
+            dst = reinterpret_cast<target_simd_t>(_mm512_cvtepu16_epi64(_mm512_castsi512_si128(tmp)));
     }
     else // cast from epi32 to epi64
     {
         static_assert(simd_traits<source_simd_t>::length == 16, "Expected 32 bit scalar type.");
-        return reinterpret_cast<target_simd_t>(_mm512_cvtepu32_epi64(_mm512_castsi512_si256(tmp)));
+        dst = reinterpret_cast<target_simd_t>(_mm512_cvtepu32_epi64(_mm512_castsi512_si256(tmp)));
     }
 }
 
-// TODO: not implemented and used yet, if you implement it don't forget to add it to seqan3::detail::extract_half
+template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
+constexpr target_simd_t upcast_unsigned_avx512(source_simd_t const & src)
+{
+    target_simd_t dst{};
+    upcast_unsigned_avx512_kernel(dst, src);
+    return dst;
+}
+
 template <uint8_t index, simd::simd_concept simd_t>
-constexpr simd_t extract_half_avx512(simd_t const & src);
+SEQAN3_SIMD_TARGET_AVX512 inline void extract_half_avx512_kernel(simd_t & dst, simd_t const & src)
+{
+    dst = reinterpret_cast<simd_t>(_mm512_castsi256_si512(
+            _mm512_extracti64x4_epi64(reinterpret_cast<__m512i const &>(src), index)));
+}
 
-// TODO: not implemented and used yet, if you implement it don't forget to add it to seqan3::detail::extract_quarter
 template <uint8_t index, simd::simd_concept simd_t>
-constexpr simd_t extract_quarter_avx512(simd_t const & src);
+constexpr simd_t extract_half_avx512(simd_t const & src)
+{
+    simd_t dst{};
+    extract_half_avx512_kernel<index>(dst, src);
+    return dst;
+}
 
-// TODO: not implemented and used yet, if you implement it don't forget to add it to seqan3::detail::extract_eighth
 template <uint8_t index, simd::simd_concept simd_t>
-constexpr simd_t extract_eighth_avx512(simd_t const & src);
+SEQAN3_SIMD_TARGET_AVX512 inline void extract_quarter_avx512_kernel(simd_t & dst, simd_t const & src)
+{
+    dst = reinterpret_cast<simd_t>(_mm512_castsi128_si512(
+            _mm512_extracti32x4_epi32(reinterpret_cast<__m512i const &>(src), index)));
+}
+
+template <uint8_t index, simd::simd_concept simd_t>
+constexpr simd_t extract_quarter_avx512(simd_t const & src)
+{
+    simd_t dst{};
+    extract_quarter_avx512_kernel<index>(dst, src);
+    return dst;
+}
+
+template <uint8_t index, simd::simd_concept simd_t>
+SEQAN3_SIMD_TARGET_AVX512 inline void extract_eighth_avx512_kernel(simd_t & dst, simd_t const & src)
+{
+    __m128i const tmp = _mm512_extracti32x4_epi32(reinterpret_cast<__m512i const &>(src), index / 2);
+    dst = reinterpret_cast<simd_t>(_mm512_castsi128_si512(_mm_cvtsi64x_si128(_mm_extract_epi64(tmp, index % 2))));
+}
+
+template <uint8_t index, simd::simd_concept simd_t>
+constexpr simd_t extract_eighth_avx512(simd_t const & src)
+{
+    simd_t dst{};
+    extract_eighth_avx512_kernel<index>(dst, src);
+    return dst;
+}
 
 } // namespace seqan3::detail
 
-#endif // __AVX512F__
+#endif // defined(__AVX512F__) || SEQAN3_SIMD_MULTIVERSIONING
@@ -0,0 +1,288 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides runtime detection of the SIMD instruction set and seqan3::detail::simd_target_invoker.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <seqan3/std/concepts>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/detail/builtin_simd.hpp>
+#include <seqan3/utility/simd/detail/builtin_simd_intrinsics.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The SIMD instruction sets the builtin simd backend has dedicated kernels for.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The enumerators are ordered, i.e. a greater value denotes a superset of instructions.
+ */
+enum struct simd_instruction_set : uint8_t
+{
+    none,   //!< No SIMD instructions; the builtin simd backend is not available.
+    sse4,   //!< SSE4.1 and SSE4.2, i.e. 128 bit vectors.
+    avx2,   //!< AVX2, i.e. 256 bit vectors.
+    avx512  //!< AVX512F and AVX512BW, i.e. 512 bit vectors.
+};
+
+//!\brief The widest SIMD instruction set that is enabled at compile time.
+//!\ingroup simd
+inline constexpr simd_instruction_set compiled_simd_instruction_set = []() constexpr
+{
+    if constexpr (default_simd_max_length<builtin_simd> >= 64u)
+        return simd_instruction_set::avx512;
+    else if constexpr (default_simd_max_length<builtin_simd> == 32u)
+        return simd_instruction_set::avx2;
+    else if constexpr (default_simd_max_length<builtin_simd> == 16u)
+        return simd_instruction_set::sse4;
+    else
+        return simd_instruction_set::none;
+}();
+
+/*!\brief The widest SIMD instruction set that kernels can be generated for.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * This is seqan3::detail::simd_instruction_set::avx512 if SEQAN3_SIMD_MULTIVERSIONING is enabled and
+ * seqan3::detail::compiled_simd_instruction_set otherwise.
+ */
+inline constexpr simd_instruction_set max_simd_instruction_set =
+    (SEQAN3_SIMD_MULTIVERSIONING && compiled_simd_instruction_set != simd_instruction_set::none)
+        ? simd_instruction_set::avx512
+        : compiled_simd_instruction_set;
+
+/*!\brief The widest SIMD instruction set that generic code can be compiled for.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * This is seqan3::detail::max_simd_instruction_set if SEQAN3_SIMD_FLATTEN_DISPATCH is enabled and
+ * seqan3::detail::compiled_simd_instruction_set otherwise.
+ */
+inline constexpr simd_instruction_set max_flattened_simd_instruction_set =
+    SEQAN3_SIMD_FLATTEN_DISPATCH ? max_simd_instruction_set : compiled_simd_instruction_set;
+
+/*!\brief Returns the number of bytes of a simd vector of the given instruction set.
+ * \ingroup simd
+ * \param[in] instruction_set The instruction set.
+ * \returns The vector width in bytes or `0` for seqan3::detail::simd_instruction_set::none.
+ */
+constexpr size_t simd_instruction_set_byte_width(simd_instruction_set const instruction_set) noexcept
+{
+    switch (instruction_set)
+    {
+        case simd_instruction_set::sse4: return 16u;
+        case simd_instruction_set::avx2: return 32u;
+        case simd_instruction_set::avx512: return 64u;
+        default: return 0u;
+    }
+}
+
+/*!\brief Returns the widest SIMD instruction set that is supported by the executing CPU and for which code can be
+ *        generated.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The CPU is queried once and the result is cached for all subsequent calls. The returned instruction set is never
+ * lower than seqan3::detail::compiled_simd_instruction_set and never greater than
+ * seqan3::detail::max_simd_instruction_set.
+ *
+ * ### Thread safety
+ *
+ * Thread-safe.
+ */
+inline simd_instruction_set runtime_simd_instruction_set() noexcept
+{
+    static simd_instruction_set const instruction_set = [] ()
+    {
+        simd_instruction_set detected = compiled_simd_instruction_set;
+
+#if SEQAN3_SIMD_MULTIVERSIONING
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            detected = simd_instruction_set::avx512;
+        else if (__builtin_cpu_supports("avx2"))
+            detected = simd_instruction_set::avx2;
+#endif // SEQAN3_SIMD_MULTIVERSIONING
+
+        return std::clamp(detected, compiled_simd_instruction_set, max_simd_instruction_set);
+    }();
+
+    return instruction_set;
+}
+
+//!\cond
+#if SEQAN3_SIMD_FLATTEN_DISPATCH && !defined(__AVX2__)
+#   define SEQAN3_SIMD_DISPATCH_AVX2 __attribute__((target("avx2"), flatten))
+#else
+#   define SEQAN3_SIMD_DISPATCH_AVX2
+#endif
+
+#if SEQAN3_SIMD_FLATTEN_DISPATCH && !(defined(__AVX512F__) && defined(__AVX512BW__))
+#   define SEQAN3_SIMD_DISPATCH_AVX512 __attribute__((target("avx2,avx512f,avx512bw"), flatten))
+#else
+#   define SEQAN3_SIMD_DISPATCH_AVX512
+#endif
+
+// The entry points for the instruction sets if SEQAN3_SIMD_FLATTEN_DISPATCH is enabled. Everything that is called from
+// within is inlined and hence compiled for the respective target.
+template <typename function_t, typename ...args_t>
+SEQAN3_SIMD_DISPATCH_AVX2 inline decltype(auto) simd_invoke_avx2(function_t && function, args_t && ...args)
+{
+    return std::invoke(std::forward<function_t>(function), std::forward<args_t>(args)...);
+}
+
+template <typename function_t, typename ...args_t>
+SEQAN3_SIMD_DISPATCH_AVX512 inline decltype(auto) simd_invoke_avx512(function_t && function, args_t && ...args)
+{
+    return std::invoke(std::forward<function_t>(function), std::forward<args_t>(args)...);
+}
+//!\endcond
+
+/*!\brief Invokes the given callable instantiated for the given SIMD instruction set.
+ * \ingroup simd
+ * \tparam instruction_set The instruction set to invoke the callable for.
+ * \param[in] function The callable to invoke.
+ * \param[in] args The arguments to invoke the callable with.
+ * \returns The result of the invocation.
+ *
+ * \details
+ *
+ * Neither the arguments nor the result may be simd vectors, such that the calling convention is the same for all
+ * instruction sets. Within the callable, vectors that are wider than the ones of
+ * seqan3::detail::compiled_simd_instruction_set may only be passed by reference to the kernels of the builtin simd
+ * backend (e.g. seqan3::simd::transpose), which are compiled for their instruction set via target attributes.
+ * Data is moved in and out of such vectors through memory, e.g. with std::memcpy.
+ *
+ * If SEQAN3_SIMD_FLATTEN_DISPATCH is enabled and the instruction set is wider than
+ * seqan3::detail::compiled_simd_instruction_set, the callable is instead invoked via an entry point that has the
+ * respective target attribute and inlines all calls (including the callable itself), such that also generic code
+ * operating on the wide vectors is compiled for the instruction set.
+ */
+template <simd_instruction_set instruction_set, typename function_t, typename ...args_t>
+//!\cond
+    requires std::invocable<function_t, args_t...> && (!simd::simd_concept<std::remove_cvref_t<args_t>> && ...)
+//!\endcond
+inline decltype(auto) simd_invoke(function_t && function, args_t && ...args)
+{
+    static_assert(instruction_set <= max_simd_instruction_set,
+                  "Code cannot be generated for the requested instruction set.");
+    static_assert(!simd::simd_concept<std::remove_cvref_t<std::invoke_result_t<function_t, args_t...>>>,
+                  "The callable must not return a simd vector.");
+
+    if constexpr (instruction_set <= compiled_simd_instruction_set || !SEQAN3_SIMD_FLATTEN_DISPATCH)
+        return std::invoke(std::forward<function_t>(function), std::forward<args_t>(args)...);
+    else if constexpr (instruction_set == simd_instruction_set::avx2)
+        return simd_invoke_avx2(std::forward<function_t>(function), std::forward<args_t>(args)...);
+    else
+        return simd_invoke_avx512(std::forward<function_t>(function), std::forward<args_t>(args)...);
+}
+
+/*!\brief Invokes the callable with the widest SIMD instruction set supported by the executing CPU.
+ * \ingroup simd
+ * \param[in] function The callable; it is invoked with a `std::integral_constant<simd_instruction_set, is>` followed by
+ *                     the given arguments.
+ * \param[in] args The arguments to invoke the callable with.
+ * \returns The result of the invocation.
+ *
+ * \details
+ *
+ * The callable is instantiated for every instruction set between seqan3::detail::compiled_simd_instruction_set and
+ * seqan3::detail::max_simd_instruction_set and all instantiations must have the same return type. The selected
+ * instantiation is invoked via seqan3::detail::simd_invoke, such that the same restrictions apply.
+ */
+template <typename function_t, typename ...args_t>
+inline decltype(auto) simd_dispatch(function_t && function, args_t && ...args)
+{
+    using is = simd_instruction_set;
+
+    if constexpr (max_simd_instruction_set >= is::avx512 && compiled_simd_instruction_set < is::avx512)
+    {
+        if (runtime_simd_instruction_set() == is::avx512)
+            return simd_invoke<is::avx512>(std::forward<function_t>(function),
+                                           std::integral_constant<is, is::avx512>{},
+                                           std::forward<args_t>(args)...);
+    }
+
+    if constexpr (max_simd_instruction_set >= is::avx2 && compiled_simd_instruction_set < is::avx2)
+    {
+        if (runtime_simd_instruction_set() == is::avx2)
+            return simd_invoke<is::avx2>(std::forward<function_t>(function),
+                                         std::integral_constant<is, is::avx2>{},
+                                         std::forward<args_t>(args)...);
+    }
+
+    return simd_invoke<compiled_simd_instruction_set>(std::forward<function_t>(function),
+                                                      std::integral_constant<is, compiled_simd_instruction_set>{},
+                                                      std::forward<args_t>(args)...);
+}
+
+/*!\brief A function object that invokes the wrapped callable compiled for the given SIMD instruction set.
+ * \ingroup simd
+ * \tparam instruction_set The instruction set to generate code for.
+ * \tparam function_t The type of the wrapped callable.
+ *
+ * \details
+ *
+ * Used to store a callable that operates on wide simd vectors in generic code in a type-erased wrapper like
+ * std::function. The call operator forwards to seqan3::detail::simd_invoke, such that the same restrictions apply.
+ * Since the wide vectors are used outside of the kernels, the instruction set must not be wider than
+ * seqan3::detail::max_flattened_simd_instruction_set.
+ */
+template <simd_instruction_set instruction_set, typename function_t>
+class simd_target_invoker
+{
+    static_assert(instruction_set <= max_flattened_simd_instruction_set,
+                  "Generic code cannot be compiled for the requested instruction set.");
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    simd_target_invoker() = default; //!< Defaulted.
+    simd_target_invoker(simd_target_invoker const &) = default; //!< Defaulted.
+    simd_target_invoker(simd_target_invoker &&) = default; //!< Defaulted.
+    simd_target_invoker & operator=(simd_target_invoker const &) = default; //!< Defaulted.
+    simd_target_invoker & operator=(simd_target_invoker &&) = default; //!< Defaulted.
+    ~simd_target_invoker() = default; //!< Defaulted.
+
+    //!\brief Constructs the invoker from the callable.
+    explicit simd_target_invoker(function_t function) : function{std::move(function)}
+    {}
+    //!\}
+
+    //!\brief Invokes the wrapped callable with the given arguments.
+    template <typename ...args_t>
+    //!\cond
+        requires std::invocable<function_t &, args_t...>
+    //!\endcond
+    decltype(auto) operator()(args_t && ...args)
+    {
+        return simd_invoke<instruction_set>(function, std::forward<args_t>(args)...);
+    }
+
+private:
+    //!\brief The wrapped callable.
+    function_t function{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::test::comparable_bgzf.
+ * \author agent <agent AT local>
+ */
+
+#pragma once
+
+#include <sstream>
+#include <string>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+#endif
+
+namespace seqan3::test
+{
+
+/*!\brief Returns BGZF compressed data in a form that can be compared to the expected output of a test.
+ *
+ * \details
+ *
+ * The expected outputs of the tests are compressed with zlib. If BGZF blocks are compressed with libdeflate, the
+ * deflate streams differ (but are equally valid), hence the data is compared decompressed in this case.
+ */
+inline std::string comparable_bgzf(std::string const & compressed)
+{
+#if defined(SEQAN3_HAS_ZLIB) && SEQAN3_HAS_LIBDEFLATE
+    std::istringstream primary{compressed};
+    seqan3::contrib::bgzf_istream stream{primary};
+    return std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+#else // SEQAN3_HAS_LIBDEFLATE
+    return compressed;
+#endif // SEQAN3_HAS_LIBDEFLATE
+}
+
+} // namespace seqan3::test
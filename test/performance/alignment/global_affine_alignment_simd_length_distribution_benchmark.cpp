@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+// Benchmarks the vectorised alignment on sequence sets with mixed lengths. The lanes of a simd batch are only fully
+// utilised if all sequence pairs of the batch have a similar length.
+
+#ifndef NDEBUG
+inline constexpr size_t set_size = 64;
+#else
+inline constexpr size_t set_size = 4096;
+#endif // NDEBUG
+
+using sequence_t = std::vector<seqan3::dna4>;
+
+// Returns a pair of random sequences of the given length.
+inline std::pair<sequence_t, sequence_t> generate_pair(size_t const length, std::mt19937_64 & random_engine)
+{
+    seqan3::test::random_sequence_generator<sequence_t> generator{length, length / 10};
+    sequence_t first = generator(random_engine);
+    return {std::move(first), generator(random_engine)};
+}
+
+// Short reads (150 bp) where every 16th pair is a long read of the given length.
+inline auto generate_short_and_long_pairs(size_t const long_length)
+{
+    std::mt19937_64 random_engine{0};
+    std::vector<std::pair<sequence_t, sequence_t>> data{};
+
+    for (size_t i = 0; i < set_size; ++i)
+        data.push_back(generate_pair((i % 16 == 0) ? long_length : 150, random_engine));
+
+    return data;
+}
+
+// Log-normally distributed lengths between 50 and 5000 bp with the given median.
+inline auto generate_log_normal_pairs(size_t const median_length)
+{
+    std::mt19937_64 random_engine{0};
+    std::lognormal_distribution<double> length_distribution{std::log(static_cast<double>(median_length)), 0.8};
+    std::vector<std::pair<sequence_t, sequence_t>> data{};
+
+    for (size_t i = 0; i < set_size; ++i)
+    {
+        size_t const length = std::clamp<size_t>(length_distribution(random_engine), 50, 5000);
+        data.push_back(generate_pair(length, random_engine));
+    }
+
+    return data;
+}
+
+template <typename generator_t, typename ...align_configs_t>
+void seqan3_affine_mixed_lengths(benchmark::State & state, generator_t generator, align_configs_t && ...configs)
+{
+    auto data = generator(state.range(0));
+
+    int64_t total = 0;
+    auto accelerate_config = (configs | ...);
+    for (auto _ : state)
+    {
+        for (auto && res : seqan3::align_pairwise(data, accelerate_config))
+            total += res.score();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(data, accelerate_config);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+constexpr auto nt_score_scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                   seqan3::mismatch_score{-5}};
+constexpr auto affine_cfg = seqan3::align_cfg::method_global{} |
+                            seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                               seqan3::align_cfg::extension_score{-1}} |
+                            seqan3::align_cfg::scoring_scheme{nt_score_scheme} |
+                            seqan3::align_cfg::output_score{};
+
+BENCHMARK_CAPTURE(seqan3_affine_mixed_lengths,
+                  short_and_long_scalar,
+                  generate_short_and_long_pairs,
+                  affine_cfg)
+                        ->UseRealTime()
+                        ->Arg(1000)->Arg(10000);
+
+BENCHMARK_CAPTURE(seqan3_affine_mixed_lengths,
+                  short_and_long_simd,
+                  generate_short_and_long_pairs,
+                  affine_cfg,
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->Arg(1000)->Arg(10000);
+
+BENCHMARK_CAPTURE(seqan3_affine_mixed_lengths,
+                  log_normal_scalar,
+                  generate_log_normal_pairs,
+                  affine_cfg)
+                        ->UseRealTime()
+                        ->Arg(150)->Arg(500);
+
+BENCHMARK_CAPTURE(seqan3_affine_mixed_lengths,
+                  log_normal_simd,
+                  generate_log_normal_pairs,
+                  affine_cfg,
+                  seqan3::align_cfg::vectorised{})
+                        ->UseRealTime()
+                        ->Arg(150)->Arg(500);
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK_MAIN();
@@ -24,6 +24,7 @@
 #include <seqan3/io/sequence_file/output.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
+#include <seqan3/io/sequence_file/view_input.hpp>
 #include <seqan3/range/views/convert.hpp>
 #include <seqan3/test/performance/units.hpp>
 
@@ -118,6 +119,30 @@ void seqan3_dna5_istringstream_read(benchmark::State & state)
 }
 BENCHMARK(seqan3_dna5_istringstream_read);
 
+void seqan3_dna5_view_input_istringstream_read(benchmark::State & state)
+{
+    std::istringstream istream{fasta_file};
+    size_t letter_count = 0;
+
+    for (auto _ : state)
+    {
+        istream.clear();
+        istream.seekg(0, std::ios::beg);
+
+        seqan3::sequence_file_view_input fin{istream};
+        for (auto & record : fin)
+            letter_count += std::ranges::distance(record.sequence());
+    }
+
+    benchmark::DoNotOptimize(letter_count);
+
+    size_t bytes_per_run = fasta_file.size();
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(bytes_per_run);
+}
+BENCHMARK(seqan3_dna5_view_input_istringstream_read);
+
 #if __has_include(<seqan/seq_io.h>)
 
 #include <fstream>
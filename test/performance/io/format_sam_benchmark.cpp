@@ -135,6 +135,70 @@ void sam_file_read_from_disk(benchmark::State &state)
     }
 }
 
+void sam_file_read_from_stream_parallel(benchmark::State &state)
+{
+    size_t const n_queries = state.range(0);
+    size_t const thread_count = state.range(1);
+
+    // records can only be parsed in parallel if the reference information is known from the header
+    std::istringstream istream{"@SQ\tSN:reference_id\tLN:500\n" + create_sam_file_string(n_queries)};
+
+    for (auto _ : state)
+    {
+        istream.clear();
+        istream.seekg(0, std::ios::beg);
+
+        seqan3::sam_file_input fin{istream, seqan3::format_sam{}};
+        fin.options.thread_count = thread_count;
+
+        // read all records and store in internal buffer
+        auto it = fin.begin();
+        while (it != fin.end())
+            ++it;
+    }
+
+    state.SetBytesProcessed(state.iterations() * istream.str().size());
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+void bam_file_write_to_disk(benchmark::State &state)
+{
+    size_t const n_queries = state.range(0);
+    size_t const thread_count = state.range(1);
+    int const compression_level = state.range(2);
+    seqan3::test::tmp_filename file_name{"tmp.bam"};
+    auto tmp_path = file_name.get_path();
+
+    using bam_fields = seqan3::fields<seqan3::field::header_ptr, seqan3::field::id, seqan3::field::flag,
+                                      seqan3::field::ref_id, seqan3::field::ref_offset, seqan3::field::mapq,
+                                      seqan3::field::cigar, seqan3::field::offset, seqan3::field::mate,
+                                      seqan3::field::seq, seqan3::field::qual, seqan3::field::tags>;
+
+    // BAM files need the reference information in the header
+    std::string const sam_file = "@SQ\tSN:reference_id\tLN:500\n" + create_sam_file_string(n_queries);
+    std::istringstream istream{sam_file};
+    seqan3::sam_file_input fin{istream, seqan3::format_sam{}, bam_fields{}};
+
+    std::vector<typename decltype(fin)::record_type> records{};
+    for (auto & record : fin)
+        records.push_back(std::move(record));
+
+    for (auto _ : state)
+    {
+        seqan3::sam_file_output fout{tmp_path, bam_fields{}};
+        fout.options.compression_thread_count = thread_count;
+        fout.options.compression_level = compression_level;
+
+        for (auto & record : records)
+            fout.push_back(record);
+    }
+
+    // throughput is measured in terms of the SAM representation
+    state.SetBytesProcessed(state.iterations() * sam_file.size());
+    state.counters["bam_file_size"] = std::filesystem::file_size(tmp_path);
+}
+#endif // SEQAN3_HAS_ZLIB
+
 #if SEQAN3_HAS_SEQAN2
 // ============================================================================
 // seqan2 read from stream
@@ -218,6 +282,21 @@ BENCHMARK(sam_file_read_from_stream)->Arg(high_query_count);
 BENCHMARK(sam_file_read_from_disk)->Arg(low_query_count);
 BENCHMARK(sam_file_read_from_disk)->Arg(high_query_count);
 
+BENCHMARK(sam_file_read_from_stream_parallel)->Args({high_query_count, 1})
+                                            ->Args({high_query_count, 2})
+                                            ->Args({high_query_count, 4})
+                                            ->Args({high_query_count, 8});
+
+#ifdef SEQAN3_HAS_ZLIB
+// arguments: number of queries, compression threads, compression level
+BENCHMARK(bam_file_write_to_disk)->Args({high_query_count, 1, 1})
+                                 ->Args({high_query_count, 2, 1})
+                                 ->Args({high_query_count, 4, 1})
+                                 ->Args({high_query_count, 8, 1})
+                                 ->Args({high_query_count, 4, 0})
+                                 ->Args({high_query_count, 4, 6});
+#endif // SEQAN3_HAS_ZLIB
+
 #if SEQAN3_HAS_SEQAN2
 BENCHMARK(seqan2_sam_file_read_from_stream)->Arg(low_query_count);
 BENCHMARK(seqan2_sam_file_read_from_stream)->Arg(high_query_count);
@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// ============================================================================
+//  reverse complement
+// ============================================================================
+
+template <typename alphabet_t>
+void reverse_complement_per_letter(benchmark::State & state)
+{
+    auto source = seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 0);
+    seqan3::bitcompressed_vector<alphabet_t> sequence{source};
+
+    for (auto _ : state)
+    {
+        auto reverse_complement = sequence | std::views::reverse | seqan3::views::complement;
+        sequence = seqan3::bitcompressed_vector<alphabet_t>{reverse_complement};
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["letters/s"] = benchmark::Counter(state.iterations() * sequence.size(),
+                                                     benchmark::Counter::kIsRate);
+}
+
+template <typename alphabet_t>
+void reverse_complement_bulk(benchmark::State & state)
+{
+    auto source = seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 0);
+    seqan3::bitcompressed_vector<alphabet_t> sequence{source};
+
+    for (auto _ : state)
+    {
+        seqan3::reverse_complement(sequence);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["letters/s"] = benchmark::Counter(state.iterations() * sequence.size(),
+                                                     benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(reverse_complement_per_letter, seqan3::dna4);
+BENCHMARK_TEMPLATE(reverse_complement_bulk, seqan3::dna4);
+BENCHMARK_TEMPLATE(reverse_complement_per_letter, seqan3::dna5);
+BENCHMARK_TEMPLATE(reverse_complement_bulk, seqan3::dna5);
+
+// ============================================================================
+//  mismatch counting
+// ============================================================================
+
+template <typename alphabet_t>
+void count_mismatches_per_letter(benchmark::State & state)
+{
+    seqan3::bitcompressed_vector<alphabet_t> lhs{seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 0)};
+    seqan3::bitcompressed_vector<alphabet_t> rhs{seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 1)};
+
+    for (auto _ : state)
+    {
+        size_t mismatches = 0;
+        for (size_t i = 0; i < lhs.size(); ++i)
+            mismatches += lhs[i] != rhs[i];
+        benchmark::DoNotOptimize(mismatches);
+    }
+
+    state.counters["letters/s"] = benchmark::Counter(state.iterations() * lhs.size(), benchmark::Counter::kIsRate);
+}
+
+template <typename alphabet_t>
+void count_mismatches_bulk(benchmark::State & state)
+{
+    seqan3::bitcompressed_vector<alphabet_t> lhs{seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 0)};
+    seqan3::bitcompressed_vector<alphabet_t> rhs{seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 1)};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::count_mismatches(lhs, rhs));
+
+    state.counters["letters/s"] = benchmark::Counter(state.iterations() * lhs.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(count_mismatches_per_letter, seqan3::dna4);
+BENCHMARK_TEMPLATE(count_mismatches_bulk, seqan3::dna4);
+BENCHMARK_TEMPLATE(count_mismatches_per_letter, seqan3::dna5);
+BENCHMARK_TEMPLATE(count_mismatches_bulk, seqan3::dna5);
+
+// ============================================================================
+//  k-mer hashing
+// ============================================================================
+
+template <typename alphabet_t>
+void kmer_hash_view(benchmark::State & state)
+{
+    seqan3::bitcompressed_vector<alphabet_t> sequence{seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 0)};
+
+    for (auto _ : state)
+        for (size_t hash : sequence | seqan3::views::kmer_hash(seqan3::ungapped{20}))
+            benchmark::DoNotOptimize(hash);
+
+    state.counters["letters/s"] = benchmark::Counter(state.iterations() * sequence.size(),
+                                                     benchmark::Counter::kIsRate);
+}
+
+template <typename alphabet_t>
+void kmer_hashes_bulk(benchmark::State & state)
+{
+    seqan3::bitcompressed_vector<alphabet_t> sequence{seqan3::test::generate_sequence<alphabet_t>(100'000, 0, 0)};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::kmer_hashes(sequence, 20));
+
+    state.counters["letters/s"] = benchmark::Counter(state.iterations() * sequence.size(),
+                                                     benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(kmer_hash_view, seqan3::dna4);
+BENCHMARK_TEMPLATE(kmer_hashes_bulk, seqan3::dna4);
+
+// ============================================================================
+//  run
+// ============================================================================
+
+BENCHMARK_MAIN();
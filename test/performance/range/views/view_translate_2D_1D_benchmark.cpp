@@ -11,6 +11,7 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/translate_frames.hpp>
 #include <seqan3/range/views/join.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/range/views/translate.hpp>
@@ -28,6 +29,7 @@
 struct baseline_tag{}; // Baseline where view is applied and only iterating the output range is benchmarked
 struct translate_tag{}; // Benchmark view_translate followed by seqan3::views::join
 struct translate_join_tag{}; // Benchmark seqan3::views::translate_join
+struct translate_frames_tag{}; // Benchmark seqan3::translate_frames
 
 // ============================================================================
 //  sequential_read
@@ -181,6 +183,11 @@ void copy(benchmark::State & state)
         auto adaptor = seqan3::views::translate_join;
         copy_impl(state, dna_sequence_collection, adaptor);
     }
+    else if constexpr (std::is_same_v<tag_t, translate_frames_tag>)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(seqan3::translate_frames(dna_sequence_collection));
+    }
 }
 
 #ifdef SEQAN3_HAS_SEQAN2
@@ -201,6 +208,7 @@ void copy(benchmark::State & state)
 
 BENCHMARK_TEMPLATE(copy, translate_tag);
 BENCHMARK_TEMPLATE(copy, translate_join_tag);
+BENCHMARK_TEMPLATE(copy, translate_frames_tag);
 
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK_TEMPLATE(copy, seqan::Serial, seqan::Owner<>);
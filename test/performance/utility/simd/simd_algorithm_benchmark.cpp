@@ -11,6 +11,7 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/detail/simd_dispatch.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 
@@ -18,10 +19,9 @@
 // Helper functions
 // ----------------------------------------------------------------------------
 
+template <typename simd_t>
 inline auto make_matrix()
 {
-    using simd_t = seqan3::simd::simd_type_t<int8_t>;
-
     std::array<simd_t, seqan3::simd::simd_traits<simd_t>::length> matrix;
     for (size_t i = 0; i < matrix.size(); ++i)
         for (size_t j = 0; j < matrix.size(); ++j)
@@ -40,15 +40,34 @@ inline auto reduce(simd_t const & vec)
     return sum;
 }
 
+// Skips the benchmark if the simd type has 512 bit but the executing CPU does not support AVX512.
+template <typename simd_t>
+inline bool skip_unsupported(benchmark::State & state)
+{
+    using seqan3::detail::simd_instruction_set;
+
+    if (sizeof(simd_t) == 64u && seqan3::detail::runtime_simd_instruction_set() < simd_instruction_set::avx512)
+    {
+        state.SkipWithError("AVX512 is not supported by the CPU.");
+        return true;
+    }
+
+    return false;
+}
+
 // ----------------------------------------------------------------------------
 // Benchhmark transpose
 // ----------------------------------------------------------------------------
 
+template <typename simd_t>
 static void transpose(benchmark::State& state)
 {
+    if (skip_unsupported<simd_t>(state))
+        return;
+
     size_t sum = 0;
 
-    auto matrix = make_matrix();
+    auto matrix = make_matrix<simd_t>();
 
     for (auto _ : state)
     {
@@ -65,11 +84,18 @@ static void transpose(benchmark::State& state)
     state.counters["checksum"] = sum;
 }
 
-BENCHMARK(transpose);
+BENCHMARK_TEMPLATE(transpose, seqan3::simd::simd_type_t<int8_t>);
+
+#if defined(__AVX512BW__) || SEQAN3_SIMD_FLATTEN_DISPATCH
+BENCHMARK_TEMPLATE(transpose, seqan3::simd::simd_type_t<int8_t, 64>);
+#endif
 
 template <typename source_t, typename target_t>
 static void upcast(benchmark::State& state)
 {
+    if (skip_unsupported<source_t>(state))
+        return;
+
     source_t src = seqan3::simd::iota<source_t>(std::rand() % 100);
     target_t target{};
     size_t sum = 0;
@@ -100,4 +126,13 @@ BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int16_t>, seqan3::simd::sim
 BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int16_t>, seqan3::simd::simd_type_t<int64_t>);
 BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int32_t>, seqan3::simd::simd_type_t<int64_t>);
 
+#if defined(__AVX512BW__) || SEQAN3_SIMD_FLATTEN_DISPATCH
+BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int8_t, 64>, seqan3::simd::simd_type_t<int16_t, 32>);
+BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int8_t, 64>, seqan3::simd::simd_type_t<int32_t, 16>);
+BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int8_t, 64>, seqan3::simd::simd_type_t<int64_t, 8>);
+BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int16_t, 32>, seqan3::simd::simd_type_t<int32_t, 16>);
+BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int16_t, 32>, seqan3::simd::simd_type_t<int64_t, 8>);
+BENCHMARK_TEMPLATE(upcast, seqan3::simd::simd_type_t<int32_t, 16>, seqan3::simd::simd_type_t<int64_t, 8>);
+#endif
+
 BENCHMARK_MAIN();
@@ -21,6 +21,7 @@
 #include <seqan3/range/views/zip.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/detail/simd_dispatch.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 #include <seqan3/utility/simd/views/to_simd.hpp>
@@ -143,6 +144,13 @@ BENCHMARK_TEMPLATE(to_simd_naive_w_condition, std::deque<seqan3::dna4>, seqan3::
 template <typename container_t, typename simd_t>
 void to_simd(benchmark::State& state)
 {
+    if (sizeof(simd_t) == 64u &&
+        seqan3::detail::runtime_simd_instruction_set() < seqan3::detail::simd_instruction_set::avx512)
+    {
+        state.SkipWithError("AVX512 is not supported by the CPU.");
+        return;
+    }
+
     // Preparing the sequences
     std::vector<container_t> sequences;
     sequences.resize(seqan3::simd::simd_traits<simd_t>::length);
@@ -179,6 +187,19 @@ BENCHMARK_TEMPLATE(to_simd, std::list<seqan3::dna4>, seqan3::simd::simd_type_t<i
 BENCHMARK_TEMPLATE(to_simd, std::list<seqan3::dna4>, seqan3::simd::simd_type_t<int32_t>);
 BENCHMARK_TEMPLATE(to_simd, std::list<seqan3::dna4>, seqan3::simd::simd_type_t<int64_t>);
 
+// runs with 512 bit vectors
+#if defined(__AVX512BW__) || SEQAN3_SIMD_FLATTEN_DISPATCH
+BENCHMARK_TEMPLATE(to_simd, std::vector<seqan3::dna4>, seqan3::simd::simd_type_t<int8_t, 64>);
+BENCHMARK_TEMPLATE(to_simd, std::vector<seqan3::dna4>, seqan3::simd::simd_type_t<int16_t, 32>);
+BENCHMARK_TEMPLATE(to_simd, std::vector<seqan3::dna4>, seqan3::simd::simd_type_t<int32_t, 16>);
+BENCHMARK_TEMPLATE(to_simd, std::vector<seqan3::dna4>, seqan3::simd::simd_type_t<int64_t, 8>);
+
+BENCHMARK_TEMPLATE(to_simd, std::deque<seqan3::dna4>, seqan3::simd::simd_type_t<int8_t, 64>);
+BENCHMARK_TEMPLATE(to_simd, std::deque<seqan3::dna4>, seqan3::simd::simd_type_t<int16_t, 32>);
+BENCHMARK_TEMPLATE(to_simd, std::deque<seqan3::dna4>, seqan3::simd::simd_type_t<int32_t, 16>);
+BENCHMARK_TEMPLATE(to_simd, std::deque<seqan3::dna4>, seqan3::simd::simd_type_t<int64_t, 8>);
+#endif
+
 // ============================================================================
 //  run
 // ============================================================================
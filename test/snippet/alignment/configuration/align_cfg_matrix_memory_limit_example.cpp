@@ -0,0 +1,10 @@
+#include <seqan3/alignment/configuration/align_config_matrix_memory_limit.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+int main()
+{
+    // Release the alignment matrices of a thread if they occupy more than 64 MiB.
+    seqan3::configuration config = seqan3::align_cfg::matrix_memory_limit{64u * 1024u * 1024u};
+    auto limit = std::get<seqan3::align_cfg::matrix_memory_limit>(config);
+    limit.bytes = 0; // Allocates new matrices for every alignment.
+}
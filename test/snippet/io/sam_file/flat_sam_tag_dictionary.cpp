@@ -0,0 +1,26 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sam_file/flat_sam_tag_dictionary.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+
+using seqan3::operator""_tag;
+
+struct my_traits : seqan3::sam_file_input_default_traits<>
+{
+    using tag_dictionary = seqan3::flat_sam_tag_dictionary; // instead of seqan3::sam_tag_dictionary
+};
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	9M	=	37	39	TTAGATAAA	*	NM:i:1	AS:i:42
+r002	0	ref	9	30	9M	*	0	0	AGATAAAGG	*	NM:i:0
+)";
+
+int main()
+{
+    seqan3::sam_file_input<my_traits> fin{std::istringstream{sam_file_raw}, seqan3::format_sam{}};
+
+    for (auto & record : fin)
+        seqan3::debug_stream << record.id() << ": " << record.tags().get<"NM"_tag>() << '\n';
+}
@@ -0,0 +1,28 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sam_file/lazy_input.hpp>
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate	GO:none
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	8M2I4M1D3M	=	37	39	TTAGATAAAGGATACTG	*
+r003	0	ref	29	30	5S6M	*	0	0	GCCTAAGCTAA	*	SA:Z:ref,29,-,6H5M,17,0;
+r003	2064	ref	29	17	6H5M	*	0	0	TAGGC	*	SA:Z:ref,9,+,5S6M,30,1;
+r001	147	ref	237	30	9M	=	7	-39	CAGCGGCAT	*	NM:i:1
+)";
+
+int main()
+{
+    std::istringstream stream{sam_file_raw};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_sam{}};
+
+    for (auto & record : fin)
+    {
+        // Only the flag is read, the rest of the record is not parsed.
+        if (static_cast<bool>(record.flag() & seqan3::sam_flag::supplementary_alignment))
+            continue;
+
+        // The sequence is decoded on access.
+        seqan3::debug_stream << record.id() << '\t' << record.sequence() << '\n';
+    }
+}
@@ -0,0 +1,33 @@
+#include <seqan3/std/filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/sorter.hpp>
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:unsorted
+@SQ	SN:ref	LN:45
+r001	147	ref	237	30	9M	=	7	-39	CAGCGGCAT	*	NM:i:1
+r003	0	ref	29	30	5S6M	*	0	0	GCCTAAGCTAA	*	SA:Z:ref,29,-,6H5M,17,0;
+r004	4	*	0	0	*	*	0	0	ACGT	*
+r001	99	ref	7	30	8M2I4M1D3M	=	37	39	TTAGATAAAGGATACTG	*
+)";
+
+int main()
+{
+    auto tmp_file = std::filesystem::temp_directory_path() / "sorted.bam";
+
+    seqan3::sam_file_input fin{std::istringstream{sam_file_raw}, seqan3::format_sam{}};
+
+    {
+        seqan3::sam_file_sorter sorter{tmp_file, std::vector<std::string>{}, std::vector<size_t>{}};
+        sorter.options.memory_limit = 64 * 1024 * 1024; // keep at most 64 MiB of records in memory
+        sorter.options.thread_count = 4;
+
+        sorter = fin;    // the records carry the header of the input file
+        sorter.finish(); // the records are in the order r001 (pos 7), r003, r001 (pos 237), r004
+    }
+
+    std::filesystem::remove(tmp_file);
+}
@@ -0,0 +1,17 @@
+#include <iostream>
+#include <sstream>
+
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+
+int main()
+{
+    std::istringstream fasta_stream{">chr1 first chromosome\nACGTACGT\nACGT\n>chr2\nGGGG\n"};
+
+    // Index the file in a single pass and write it in the .fai format of samtools.
+    seqan3::fasta_index index = seqan3::fasta_index::build(fasta_stream);
+    index.write(std::cout);
+    // chr1    12  23  8   9
+    // chr2    4   43  4   5
+
+    std::cout << index[index.position_of("chr2")].length << '\n'; // 4
+}
@@ -0,0 +1,25 @@
+#include <fstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
+#include <seqan3/std/filesystem>
+
+int main()
+{
+    auto tmp_file = std::filesystem::temp_directory_path() / "my.fasta";
+
+    {
+        // Create a /tmp/my.fasta file.
+        std::ofstream fasta_stream{tmp_file};
+        fasta_stream << ">chr1 first chromosome\nACGTACGT\nACGT\n>chr2\nGGGG\n";
+    }
+
+    // The index is built when opening the file, because there is no /tmp/my.fasta.fai.
+    seqan3::indexed_fasta_file fasta_file{tmp_file};
+
+    // Only the requested interval is read from the file.
+    seqan3::debug_stream << fasta_file.fetch("chr1", 6, 10) << '\n'; // GTAC
+    seqan3::debug_stream << fasta_file.fetch(1, 0, 2) << '\n';       // GG
+
+    std::filesystem::remove(tmp_file);
+}
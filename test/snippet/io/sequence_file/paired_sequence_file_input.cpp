@@ -0,0 +1,41 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/paired_input.hpp>
+
+auto first_input = R"(@read1/1
+ACGT
++
+!##$
+@read2/1
+AGGCTGA
++
+@@@@@@@
+)";
+
+auto second_input = R"(@read1/2
+TTGCA
++
+IIIII
+@read2/2
+GATT
++
+&&&&
+)";
+
+int main()
+{
+    // two files are opened with seqan3::paired_sequence_file_input fin{"R1.fastq.gz", "R2.fastq.gz"};
+    std::istringstream first_stream{first_input};
+    std::istringstream second_stream{second_input};
+    seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+    fin.options.batch_size = 1000; // record pairs per batch
+    fin.options.thread_count = 4;  // threads parsing a batch
+
+    for (auto & batch : fin)
+    {
+        for (auto & [first, second] : batch)
+            seqan3::debug_stream << first.id() << " " << first.sequence() << " | "
+                                 << second.id() << " " << second.sequence() << '\n';
+    }
+}
@@ -0,0 +1,25 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(> TEST1
+ACGT
+> Test2
+AGGCTGA
+> Test3
+GGAGTATAATATATATATATATAT)";
+
+int main()
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+    // the batch stores the IDs, sequences and qualities each in one seqan3::concatenated_sequences
+    decltype(fin)::batch_type batch{};
+
+    // the same batch is reused for all records
+    while (fin.read_batch(batch, 2) > 0)
+    {
+        seqan3::debug_stream << "Batch of " << batch.size() << " records\n";
+        seqan3::debug_stream << batch.ids << '\n' << batch.sequences << '\n';
+    }
+}
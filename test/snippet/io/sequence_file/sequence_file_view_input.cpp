@@ -0,0 +1,33 @@
+#include <fstream>
+#include <iostream>
+
+#include <seqan3/io/sequence_file/view_input.hpp>
+#include <seqan3/std/filesystem>
+
+int main()
+{
+    auto tmp_file = std::filesystem::temp_directory_path() / "my.fastq";
+
+    {
+        // Create a /tmp/my.fastq file.
+        std::ofstream fastq_stream{tmp_file};
+        fastq_stream << "@read1\nACGTACGTNN\n+\nIIIIIIII##\n@read2\nGGGG\n+\nIIII\n";
+    }
+
+    // The uncompressed file is memory mapped and the records refer to its content.
+    seqan3::sequence_file_view_input fin{tmp_file};
+
+    size_t n_count = 0;
+    for (auto & record : fin)
+    {
+        // The sequence is converted lazily to seqan3::dna5.
+        for (seqan3::dna5 const letter : record.sequence())
+            n_count += letter == seqan3::dna5{}.assign_char('N');
+
+        std::cout << record.id() << '\t' << record.sequence_chars() << '\n';
+    }
+
+    std::cout << "N: " << n_count << '\n';
+
+    std::filesystem::remove(tmp_file);
+}
@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/container/packed_sequences.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<seqan3::dna4_vector> sequences{"ACGT"_dna4, "AAAAAAAAC"_dna4, "GT"_dna4};
+
+    // Each letter occupies 2 bits in memory.
+    seqan3::packed_sequences<seqan3::dna4> packed{sequences};
+    seqan3::debug_stream << packed[1] << '\n'; // AAAAAAAAC
+
+    // Write the collection to a file once ...
+    seqan3::test::tmp_filename file_name{"reference.packed"};
+    packed.store(file_name.get_path());
+
+    // ... and map it read-only into memory in every subsequent run.
+    auto mapped = seqan3::packed_sequences<seqan3::dna4>::map(file_name.get_path());
+    seqan3::debug_stream << mapped.size() << '\n'; // 3
+    seqan3::debug_stream << mapped[2] << '\n';     // GT
+}
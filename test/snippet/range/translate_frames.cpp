@@ -0,0 +1,17 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/translate_frames.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<seqan3::dna4_vector> reads{"ACGTACGTA"_dna4, "TTGCAGCTA"_dna4};
+
+    // All six frames of all reads in one contiguous buffer, in the same order as seqan3::views::translate_join.
+    seqan3::concatenated_sequences<std::vector<seqan3::aa27>> frames = seqan3::translate_frames(reads);
+    seqan3::debug_stream << frames << '\n'; // [TYV,RT,VR,YVR,TY,RT,LQL,CS,AA,*LQ,SC,AA]
+
+    // Only the forward frames.
+    seqan3::debug_stream << seqan3::translate_frames(reads[0], seqan3::translation_frames::FWD) << '\n'; // [TYV,RT,VR]
+}
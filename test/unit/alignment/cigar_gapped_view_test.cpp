@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/aligned_sequence/cigar_gapped_view.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna4;
+
+struct cigar_gapped_view_test : ::testing::Test
+{
+    seqan3::dna4_vector reference{"ACGTA"_dna4};
+    seqan3::dna4_vector query{"TTACTAGC"_dna4};
+    std::vector<seqan3::cigar> cigar_vector{{2, 'S'_cigar_operation},
+                                            {2, 'M'_cigar_operation},
+                                            {1, 'I'_cigar_operation},
+                                            {1, 'D'_cigar_operation},
+                                            {1, '='_cigar_operation},
+                                            {1, 'X'_cigar_operation},
+                                            {3, 'H'_cigar_operation},
+                                            {1, 'S'_cigar_operation}};
+
+    using view_t = seqan3::cigar_gapped_view<std::views::all_t<seqan3::dna4_vector &>>;
+};
+
+TEST_F(cigar_gapped_view_test, concepts)
+{
+    EXPECT_TRUE(std::ranges::forward_range<view_t>);
+    EXPECT_TRUE(std::ranges::forward_range<view_t const>);
+    EXPECT_TRUE(std::ranges::view<view_t>);
+    EXPECT_FALSE(std::ranges::sized_range<view_t>);
+    EXPECT_FALSE(std::ranges::common_range<view_t>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<view_t>, seqan3::gapped<seqan3::dna4>>));
+}
+
+TEST_F(cigar_gapped_view_test, reference)
+{
+    seqan3::cigar_gapped_view gapped_reference{reference, cigar_vector, seqan3::cigar_side::reference};
+
+    EXPECT_TRUE((std::same_as<decltype(gapped_reference), view_t>));
+    EXPECT_RANGE_EQ(gapped_reference | seqan3::views::to_char, std::string{"AC-GTA"});
+    EXPECT_RANGE_EQ(std::as_const(gapped_reference) | seqan3::views::to_char, std::string{"AC-GTA"});
+}
+
+TEST_F(cigar_gapped_view_test, query)
+{
+    seqan3::cigar_gapped_view gapped_query{query, cigar_vector, seqan3::cigar_side::query};
+
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, std::string{"ACT-AG"});
+}
+
+TEST_F(cigar_gapped_view_test, skipped_region)
+{
+    std::vector<seqan3::cigar> spliced{{1, 'M'_cigar_operation},
+                                       {2, 'N'_cigar_operation},
+                                       {1, 'P'_cigar_operation},
+                                       {2, 'M'_cigar_operation}};
+
+    EXPECT_RANGE_EQ(seqan3::cigar_gapped_view(reference, spliced, seqan3::cigar_side::reference)
+                        | seqan3::views::to_char,
+                    std::string{"ACGTA"});
+    EXPECT_RANGE_EQ(seqan3::cigar_gapped_view(query, spliced, seqan3::cigar_side::query) | seqan3::views::to_char,
+                    std::string{"T--TA"});
+}
+
+TEST_F(cigar_gapped_view_test, forward_range)
+{
+    std::list<seqan3::dna4> list_query{query.begin(), query.end()};
+    seqan3::cigar_gapped_view gapped_query{list_query, cigar_vector, seqan3::cigar_side::query};
+
+    EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, std::string{"ACT-AG"});
+    EXPECT_EQ(std::ranges::distance(gapped_query), 6);
+}
+
+TEST_F(cigar_gapped_view_test, empty)
+{
+    seqan3::dna4_vector empty_sequence{};
+    std::vector<seqan3::cigar> empty_cigar{};
+    std::vector<seqan3::cigar> clipped_cigar{{2, 'S'_cigar_operation}};
+
+    EXPECT_TRUE(std::ranges::empty(seqan3::cigar_gapped_view(query, empty_cigar, seqan3::cigar_side::query)));
+    EXPECT_TRUE(std::ranges::empty(seqan3::cigar_gapped_view(empty_sequence,
+                                                             clipped_cigar,
+                                                             seqan3::cigar_side::reference)));
+}
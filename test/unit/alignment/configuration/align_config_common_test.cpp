@@ -12,11 +12,13 @@
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_matrix_memory_limit.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_simd_target.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 
@@ -25,9 +27,12 @@ class alignment_configuration_test : public ::testing::Test
 {};
 
 using alignment_result_t = seqan3::alignment_result<seqan3::detail::alignment_result_value_type<int, int, int>>;
+using simd_instruction_set_t = std::integral_constant<seqan3::detail::simd_instruction_set,
+                                                      seqan3::detail::simd_instruction_set::avx2>;
 
 using test_types = ::testing::Types<seqan3::align_cfg::band_fixed_size,
                                     seqan3::align_cfg::gap_cost_affine,
+                                    seqan3::align_cfg::matrix_memory_limit,
                                     seqan3::align_cfg::min_score,
                                     seqan3::align_cfg::method_global,
                                     seqan3::align_cfg::method_local,
@@ -35,6 +40,7 @@ using test_types = ::testing::Types<seqan3::align_cfg::band_fixed_size,
                                     seqan3::align_cfg::scoring_scheme<seqan3::nucleotide_scoring_scheme<int8_t>>,
                                     seqan3::align_cfg::vectorised,
                                     seqan3::align_cfg::detail::result_type<alignment_result_t>,
+                                    seqan3::align_cfg::detail::simd_target<simd_instruction_set_t>,
                                     seqan3::align_cfg::detail::debug>;
 
 TYPED_TEST_SUITE(alignment_configuration_test, test_types, );
@@ -60,7 +66,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to seqan3::align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 18);
+    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 21);
 }
 
 TYPED_TEST(alignment_configuration_test, config_element)
@@ -0,0 +1,35 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_matrix_memory_limit.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_matrix_memory_limit, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::matrix_memory_limit>));
+}
+
+TEST(align_config_matrix_memory_limit, default_value)
+{
+    seqan3::align_cfg::matrix_memory_limit elem{};
+    EXPECT_EQ(elem.bytes, std::numeric_limits<size_t>::max());
+}
+
+TEST(align_config_matrix_memory_limit, configuration)
+{
+    seqan3::configuration cfg{seqan3::align_cfg::matrix_memory_limit{1024}};
+    auto limit = std::get<seqan3::align_cfg::matrix_memory_limit>(cfg);
+    EXPECT_TRUE((std::is_same_v<decltype(limit.bytes), size_t>));
+
+    EXPECT_EQ(std::get<seqan3::align_cfg::matrix_memory_limit>(cfg).bytes, 1024u);
+    EXPECT_EQ(cfg.get_or(seqan3::align_cfg::matrix_memory_limit{}).bytes, 1024u);
+}
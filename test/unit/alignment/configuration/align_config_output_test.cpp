@@ -23,6 +23,7 @@ using test_types = ::testing::Types<seqan3::align_cfg::output_score,
                                     seqan3::align_cfg::output_end_position,
                                     seqan3::align_cfg::output_begin_position,
                                     seqan3::align_cfg::output_alignment,
+                                    seqan3::align_cfg::output_cigar,
                                     seqan3::align_cfg::output_sequence1_id,
                                     seqan3::align_cfg::output_sequence2_id>;
 
@@ -52,6 +53,12 @@ TEST(align_config_output, alignment)
                               seqan3::align_cfg::output_alignment>));
 }
 
+TEST(align_config_output, cigar)
+{
+    EXPECT_TRUE((std::same_as<std::remove_cvref_t<decltype(seqan3::align_cfg::output_cigar{})>,
+                              seqan3::align_cfg::output_cigar>));
+}
+
 TEST(align_config_output, sequence1_id)
 {
     EXPECT_TRUE((std::same_as<std::remove_cvref_t<decltype(seqan3::align_cfg::output_sequence1_id{})>,
@@ -70,6 +77,7 @@ TEST(align_config_output, combine_outputs)
                                 seqan3::align_cfg::output_end_position{} |
                                 seqan3::align_cfg::output_begin_position{} |
                                 seqan3::align_cfg::output_alignment{} |
+                                seqan3::align_cfg::output_cigar{} |
                                 seqan3::align_cfg::output_sequence1_id{} |
                                 seqan3::align_cfg::output_sequence2_id{};
 
@@ -78,6 +86,7 @@ TEST(align_config_output, combine_outputs)
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_end_position>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_begin_position>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_alignment>());
+    EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_cigar>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_sequence1_id>());
     EXPECT_TRUE(cfg.exists<seqan3::align_cfg::output_sequence2_id>());
 }
@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/cigar_builder.hpp>
+#include <seqan3/alignment/matrix/detail/trace_iterator.hpp>
+#include <seqan3/alignment/matrix/detail/two_dimensional_matrix.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+
+struct cigar_builder_test : ::testing::Test
+{
+    static constexpr seqan3::detail::trace_directions N = seqan3::detail::trace_directions::none;
+    static constexpr seqan3::detail::trace_directions D = seqan3::detail::trace_directions::diagonal;
+    static constexpr seqan3::detail::trace_directions U = seqan3::detail::trace_directions::up;
+    static constexpr seqan3::detail::trace_directions UO = seqan3::detail::trace_directions::up_open;
+    static constexpr seqan3::detail::trace_directions L = seqan3::detail::trace_directions::left;
+    static constexpr seqan3::detail::trace_directions LO = seqan3::detail::trace_directions::left_open;
+
+    // The same matrix as in the aligned_sequence_builder_test for the sequences "ACG" and "AG".
+    seqan3::detail::two_dimensional_matrix<seqan3::detail::trace_directions> matrix{seqan3::detail::number_rows{3},
+                                                                                    seqan3::detail::number_cols{4},
+                                                                                    std::vector
+    {
+        N,           LO, L,          L,
+        UO, D | LO | UO, L, D | L | UO,
+        U,       LO | U, D,          L
+    }};
+
+    auto path(size_t const row, size_t const column)
+    {
+        seqan3::detail::matrix_offset offset{seqan3::detail::row_index_type{row},
+                                             seqan3::detail::column_index_type{column}};
+        using iterator_t = decltype(seqan3::detail::trace_iterator{matrix.begin() + offset});
+        return std::ranges::subrange<iterator_t, std::default_sentinel_t>
+        {
+            seqan3::detail::trace_iterator{matrix.begin() + offset},
+            std::default_sentinel
+        };
+    }
+
+    static std::string to_string(std::vector<seqan3::cigar> const & cigar_vector)
+    {
+        std::string result{};
+        for (seqan3::cigar const & element : cigar_vector)
+            result += element.to_string().str();
+
+        return result;
+    }
+
+    seqan3::detail::cigar_builder builder{2u};
+};
+
+TEST_F(cigar_builder_test, construction)
+{
+    EXPECT_TRUE(std::is_nothrow_default_constructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_copy_constructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_move_constructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_copy_assignable_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_move_assignable_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE(std::is_destructible_v<seqan3::detail::cigar_builder>);
+    EXPECT_TRUE((std::is_constructible_v<seqan3::detail::cigar_builder, size_t>));
+}
+
+TEST_F(cigar_builder_test, build_from_2_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(2, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(to_string(cigar_vector), "2I3D");
+}
+
+TEST_F(cigar_builder_test, build_from_2_2)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(2, 2));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(to_string(cigar_vector), "2M");
+}
+
+TEST_F(cigar_builder_test, build_from_2_1)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(2, 1));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 2u}));
+    EXPECT_EQ(to_string(cigar_vector), "1D2I");
+}
+
+TEST_F(cigar_builder_test, build_from_1_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(1, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_EQ(to_string(cigar_vector), "2D1M1S");
+}
+
+TEST_F(cigar_builder_test, build_from_1_1)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(1, 1));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 1u}));
+    EXPECT_EQ(to_string(cigar_vector), "1M1S");
+}
+
+TEST_F(cigar_builder_test, build_from_0_3)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(0, 3));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 3u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_EQ(to_string(cigar_vector), "3D2S");
+}
+
+TEST_F(cigar_builder_test, build_from_0_0)
+{
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = builder(path(0, 0));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_EQ(to_string(cigar_vector), "2S");
+}
+
+TEST_F(cigar_builder_test, both_empty)
+{
+    seqan3::detail::cigar_builder empty_builder{0u};
+    auto [first_sequence_slice_positions, second_sequence_slice_positions, cigar_vector] = empty_builder(path(0, 0));
+
+    EXPECT_EQ(first_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_EQ(second_sequence_slice_positions, (std::pair<size_t, size_t>{0u, 0u}));
+    EXPECT_TRUE(cigar_vector.empty());
+}
@@ -69,3 +69,35 @@ struct iterator_fixture<matrix_iterator_t> : public ::testing::Test
 };
 
 INSTANTIATE_TYPED_TEST_SUITE_P(trace_matrix_single_column_test, iterator_fixture, matrix_iterator_t, );
+
+TEST(combined_score_and_trace_matrix_test, resize_reuses_memory)
+{
+    using seqan3::detail::column_index_type;
+    using seqan3::detail::row_index_type;
+
+    matrix_t matrix{};
+    EXPECT_EQ(matrix.memory_footprint(), 0u);
+
+    matrix.resize(column_index_type<size_t>{10}, row_index_type<size_t>{10}, 3);
+    size_t const footprint = matrix.memory_footprint();
+    EXPECT_GE(footprint, 10u * 10u * sizeof(trace_t) + 2u * 10u * sizeof(score_t));
+
+    // A smaller matrix reuses the memory and is initialised again.
+    matrix.resize(column_index_type<size_t>{4}, row_index_type<size_t>{5}, -1);
+    EXPECT_EQ(matrix.memory_footprint(), footprint);
+
+    size_t column_count = 0;
+    for (auto && column : matrix)
+    {
+        size_t row_count = 0;
+        for (auto && cell : column)
+        {
+            EXPECT_EQ(cell.best_score(), -1);
+            EXPECT_EQ(cell.best_trace(), seqan3::detail::trace_directions::none);
+            ++row_count;
+        }
+        EXPECT_EQ(row_count, 5u);
+        ++column_count;
+    }
+    EXPECT_EQ(column_count, 4u);
+}
@@ -197,6 +197,14 @@ TYPED_TEST(two_dimensional_matrix_test, resize)
     matrix.resize(seqan3::detail::number_rows{3}, seqan3::detail::number_cols{4});
     EXPECT_EQ(matrix.cols(), 4u);
     EXPECT_EQ(matrix.rows(), 3u);
+    EXPECT_GE(matrix.capacity(), 12u);
+
+    // Shrinking keeps the allocated memory.
+    size_t const capacity = matrix.capacity();
+    matrix.resize(seqan3::detail::number_rows{2}, seqan3::detail::number_cols{2});
+    EXPECT_EQ(matrix.cols(), 2u);
+    EXPECT_EQ(matrix.rows(), 2u);
+    EXPECT_EQ(matrix.capacity(), capacity);
 }
 
 TYPED_TEST(two_dimensional_matrix_test, range)
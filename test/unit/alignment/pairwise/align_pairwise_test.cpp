@@ -14,11 +14,14 @@
 
 #include <meta/meta.hpp>
 
+#include <seqan3/alignment/aligned_sequence/cigar_gapped_view.hpp>
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/sam_file/detail/cigar.hpp>
 #include <seqan3/range/views/to_char.hpp>
 #include <seqan3/range/views/to.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 
@@ -294,6 +297,48 @@ TYPED_TEST(align_pairwise_test, bug_1598)
     auto results = seqan3::align_pairwise(std::tie(s1, s2), cfg);
 }
 
+TYPED_TEST(align_pairwise_test, cigar)
+{
+    auto seq1 = "ACGTGATG"_dna4;
+    auto seq2 = "AGTGATACT"_dna4;
+
+    {  // edit distance
+        seqan3::configuration cfg = seqan3::align_cfg::method_global{} |
+                                    seqan3::align_cfg::edit_scheme |
+                                    seqan3::align_cfg::output_cigar{};
+
+        for (auto && res : call_alignment<TypeParam>(std::tie(seq1, seq2), cfg))
+            EXPECT_EQ(seqan3::detail::get_cigar_string(res.cigar()), "1M1D6M2I");
+    }
+
+    {  // local alignment with soft clipped query
+        seqan3::configuration cfg = seqan3::align_cfg::method_local{} |
+                                    seqan3::align_cfg::scoring_scheme{
+                                        seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                          seqan3::mismatch_score{-5}}} |
+                                    seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                                       seqan3::align_cfg::extension_score{-1}} |
+                                    seqan3::align_cfg::output_begin_position{} |
+                                    seqan3::align_cfg::output_alignment{} |
+                                    seqan3::align_cfg::output_cigar{};
+
+        for (auto && res : call_alignment<TypeParam>(std::tie(seq1, seq2), cfg))
+        {
+            EXPECT_EQ(res.sequence1_begin_position(), 2u);
+            EXPECT_EQ(res.sequence2_begin_position(), 1u);
+            EXPECT_EQ(seqan3::detail::get_cigar_string(res.cigar()), "1S5M3S");
+
+            auto && [gap1, gap2] = res.alignment();
+            seqan3::cigar_gapped_view gapped_reference{seq1 | std::views::drop(res.sequence1_begin_position()),
+                                                       res.cigar(),
+                                                       seqan3::cigar_side::reference};
+            seqan3::cigar_gapped_view gapped_query{seq2, res.cigar(), seqan3::cigar_side::query};
+            EXPECT_RANGE_EQ(gapped_reference | seqan3::views::to_char, gap1 | seqan3::views::to_char);
+            EXPECT_RANGE_EQ(gapped_query | seqan3::views::to_char, gap2 | seqan3::views::to_char);
+        }
+    }
+}
+
 TEST(align_pairwise_test, parallel_without_parameter)
 {
     auto seq1 = "ACGTGATG"_dna4;
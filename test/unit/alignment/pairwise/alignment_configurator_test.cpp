@@ -280,3 +280,37 @@ TEST(alignment_configurator, configure_result_score_type)
     EXPECT_EQ(result.sequence2_end_position(), 4u);
     EXPECT_SAME_TYPE(decltype(result.score()), double);
 }
+
+TEST(alignment_configurator, alignments_per_vector)
+{
+    auto cfg = seqan3::align_cfg::method_global{} |
+               seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                  seqan3::align_cfg::extension_score{-1}} |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+               seqan3::align_cfg::output_score{};
+
+    auto r = setup();
+    using sequences_t = decltype(r);
+    using scalar_config_t = decltype(seqan3::detail::alignment_configurator::configure<sequences_t>(cfg).second);
+    using simd_config_t =
+        decltype(seqan3::detail::alignment_configurator::configure<sequences_t>(cfg |
+                                                                                seqan3::align_cfg::vectorised{}).second);
+
+    EXPECT_EQ(seqan3::detail::alignment_configurator::alignments_per_vector<scalar_config_t>(), 1u);
+
+    // The vectorised alignment uses the widest instruction set that is supported by the executing CPU and that generic
+    // code can be compiled for.
+    using traits_t = seqan3::detail::alignment_configuration_traits<simd_config_t>;
+    size_t const runtime_length =
+        seqan3::detail::simd_instruction_set_byte_width(std::min(seqan3::detail::runtime_simd_instruction_set(),
+                                                        seqan3::detail::max_flattened_simd_instruction_set)) /
+        sizeof(int32_t);
+    EXPECT_EQ(seqan3::detail::alignment_configurator::alignments_per_vector<simd_config_t>(),
+              std::max<size_t>(traits_t::alignments_per_vector, runtime_length));
+
+    // The vectorised alignment receives multiple batches at once to distribute them by length.
+    EXPECT_EQ(seqan3::detail::alignment_configurator::chunk_size<scalar_config_t>(), 1u);
+    EXPECT_EQ(seqan3::detail::alignment_configurator::chunk_size<simd_config_t>(),
+              seqan3::detail::alignment_configurator::alignments_per_vector<simd_config_t>() *
+              seqan3::detail::alignment_configurator::scheduled_batches_per_chunk);
+}
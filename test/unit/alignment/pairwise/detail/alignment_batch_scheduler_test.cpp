@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/detail/alignment_batch_scheduler.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/zip.hpp>
+
+using seqan3::operator""_dna4;
+
+// Records the lengths of the first sequences of every batch and returns the index as result.
+struct batch_recorder
+{
+    template <typename indexed_sequence_pairs_t, typename callback_t>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        std::vector<size_t> lengths{};
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            lengths.push_back(std::ranges::size(get<0>(sequence_pair)));
+            callback(static_cast<int>(idx));
+        }
+
+        batches->push_back(std::move(lengths));
+    }
+
+    std::vector<std::vector<size_t>> * batches{};
+};
+
+struct alignment_batch_scheduler_test : public ::testing::Test
+{
+    using sequence_t = std::vector<seqan3::dna4>;
+
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{{"ACGTA"_dna4, "ACGTA"_dna4},
+                                                                   {"A"_dna4, "ACG"_dna4},
+                                                                   {"ACGT"_dna4, "ACGT"_dna4},
+                                                                   {"AC"_dna4, "AC"_dna4},
+                                                                   {"A"_dna4, "A"_dna4}};
+    std::vector<std::vector<size_t>> batches{};
+    std::vector<int> results{};
+
+    void schedule(size_t const batch_size)
+    {
+        seqan3::detail::alignment_batch_scheduler<batch_recorder, int> scheduler{batch_recorder{&batches}, batch_size};
+
+        scheduler(seqan3::views::zip(sequence_pairs, std::views::iota(0)), [&] (int const result)
+        {
+            results.push_back(result);
+        });
+    }
+};
+
+TEST_F(alignment_batch_scheduler_test, batches_of_similar_length)
+{
+    schedule(2u);
+
+    // The pairs are sorted by the length of the first and then of the second sequence.
+    EXPECT_EQ(batches, (std::vector<std::vector<size_t>>{{1, 1}, {2, 4}, {5}}));
+    // The results are reported in the original order.
+    EXPECT_EQ(results, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(alignment_batch_scheduler_test, single_batch)
+{
+    schedule(8u);
+
+    EXPECT_EQ(batches, (std::vector<std::vector<size_t>>{{1, 1, 2, 4, 5}}));
+    EXPECT_EQ(results, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(alignment_batch_scheduler_test, empty)
+{
+    sequence_pairs.clear();
+    schedule(2u);
+
+    EXPECT_TRUE(batches.empty());
+    EXPECT_TRUE(results.empty());
+}
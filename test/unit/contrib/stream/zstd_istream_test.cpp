@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+template <>
+class istream<seqan3::contrib::zstd_istream> : public ::testing::Test
+{
+public:
+    static inline std::string compressed
+    {
+        '\x28','\xB5','\x2F','\xFD','\x20','\x2B','\x59','\x01','\x00','\x54','\x68','\x65','\x20','\x71','\x75','\x69',
+        '\x63','\x6B','\x20','\x62','\x72','\x6F','\x77','\x6E','\x20','\x66','\x6F','\x78','\x20','\x6A','\x75','\x6D',
+        '\x70','\x73','\x20','\x6F','\x76','\x65','\x72','\x20','\x74','\x68','\x65','\x20','\x6C','\x61','\x7A','\x79',
+        '\x20','\x64','\x6F','\x67'
+    };
+};
+
+using test_types = ::testing::Types<seqan3::contrib::zstd_istream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, istream, test_types, );
+
+std::string decompress(std::string const & compressed)
+{
+    std::istringstream primary{compressed};
+    seqan3::contrib::zstd_istream stream{primary};
+    return std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(zstd_istream, concatenated_and_skippable_frames)
+{
+    std::string const & frame = istream<seqan3::contrib::zstd_istream>::compressed;
+    std::string const skippable{'\x50', '\x2A', '\x4D', '\x18', '\x02', '\x00', '\x00', '\x00', '\x01', '\x02'};
+
+    EXPECT_EQ(decompress(frame + skippable + frame), uncompressed + uncompressed);
+}
+
+TEST(zstd_istream, empty)
+{
+    EXPECT_EQ(decompress(std::string{}), std::string{});
+}
+
+TEST(zstd_istream, truncated)
+{
+    std::string const & frame = istream<seqan3::contrib::zstd_istream>::compressed;
+
+    EXPECT_THROW(decompress(frame.substr(0, frame.size() - 5)), seqan3::io_error);
+}
@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+#include <seqan3/io/stream/concept.hpp>
+
+// The compressed bytes depend on the version of libzstd, hence the output is decompressed for comparison.
+
+std::string compress(std::string const & data, size_t const thread_count, size_t const frame_size)
+{
+    std::ostringstream primary{};
+
+    {
+        seqan3::contrib::zstd_ostream stream{primary, 3, thread_count, frame_size};
+        stream << data;
+    }
+
+    return primary.str();
+}
+
+std::string decompress(std::string const & compressed)
+{
+    std::istringstream primary{compressed};
+    seqan3::contrib::zstd_istream stream{primary};
+    return std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+uint32_t read32(std::string const & data, size_t const position)
+{
+    uint32_t value{};
+    std::memcpy(&value, data.data() + position, sizeof(value));
+    return seqan3::detail::to_little_endian(value);
+}
+
+std::string const data = []
+{
+    std::string result{};
+    for (size_t i = 0; i < 100000; ++i)
+        result += std::to_string(i * i) + ',';
+    return result;
+}();
+
+TEST(zstd_ostream, concept_check)
+{
+    EXPECT_TRUE((seqan3::output_stream_over<seqan3::contrib::zstd_ostream, char>));
+}
+
+TEST(zstd_ostream, single_frame)
+{
+    std::string const compressed = compress(data, 1u, 0u);
+
+    EXPECT_LT(compressed.size(), data.size());
+    EXPECT_EQ(decompress(compressed), data);
+}
+
+TEST(zstd_ostream, threads)
+{
+    EXPECT_EQ(decompress(compress(data, 4u, 0u)), data);
+}
+
+TEST(zstd_ostream, empty)
+{
+    std::string const compressed = compress(std::string{}, 1u, 0u);
+
+    EXPECT_EQ(compressed.substr(0, 4), (std::string{'\x28', '\xB5', '\x2F', '\xFD'})); // a valid (empty) frame
+    EXPECT_EQ(decompress(compressed), std::string{});
+}
+
+TEST(zstd_ostream, seekable)
+{
+    size_t const frame_size = 100000;
+    std::string const compressed = compress(data, 4u, frame_size);
+    size_t const frame_count = (data.size() + frame_size - 1) / frame_size;
+
+    EXPECT_EQ(decompress(compressed), data);
+
+    // footer: number of frames, descriptor, seekable magic number
+    size_t const footer = compressed.size() - 9u;
+    EXPECT_EQ(read32(compressed, footer), frame_count);
+    EXPECT_EQ(compressed[footer + 4], '\x00');
+    EXPECT_EQ(read32(compressed, footer + 5), 0x8F92EAB1u);
+
+    // the seek table is a skippable frame
+    size_t const table = footer - frame_count * 8u - 8u;
+    EXPECT_EQ(read32(compressed, table), 0x184D2A5Eu);
+    EXPECT_EQ(read32(compressed, table + 4), frame_count * 8u + 9u);
+
+    // every frame can be decompressed on its own
+    size_t compressed_offset = 0;
+    size_t decompressed_offset = 0;
+    for (size_t i = 0; i < frame_count; ++i)
+    {
+        uint32_t const compressed_size = read32(compressed, table + 8u + i * 8u);
+        uint32_t const decompressed_size = read32(compressed, table + 12u + i * 8u);
+
+        EXPECT_EQ(decompressed_size, std::min(frame_size, data.size() - decompressed_offset));
+        EXPECT_EQ(decompress(compressed.substr(compressed_offset, compressed_size)),
+                  data.substr(decompressed_offset, decompressed_size));
+
+        compressed_offset += compressed_size;
+        decompressed_offset += decompressed_size;
+    }
+
+    EXPECT_EQ(compressed_offset, table);
+    EXPECT_EQ(decompressed_offset, data.size());
+}
@@ -0,0 +1,207 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <chrono>
+#include <functional>
+#include <seqan3/std/ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/algorithm_executor_async.hpp>
+
+// A dummy algorithm that just counts the number of equal characters in two sequences.
+struct dummy_algorithm
+{
+    template <typename sequences_t, typename callback_t>
+    void operator()(sequences_t && sequence_pair, callback_t && callback) const
+    {
+        auto && [first_seq, second_seq] = sequence_pair;
+
+        size_t count = 0;
+        for (size_t i = 0; i < std::min(first_seq.size(), second_seq.size()); ++i)
+            if (first_seq[i] == second_seq[i])
+                ++count;
+
+        if (count != 0)  // Simulating not to call the callback without a result.
+            callback(count);
+    }
+};
+
+template <typename resource_t>
+struct algorithm_type_for_input
+{
+    using algorithm_input_t = std::ranges::range_value_t<resource_t>;
+    using callback_t = std::function<void(size_t)>;
+    using type = std::function<void(algorithm_input_t, callback_t)>;
+};
+
+struct algorithm_executor_async_test : public ::testing::Test
+{
+    using sequence_pair_t = std::pair<std::string, std::string>;
+    using sequence_pairs_t = std::vector<sequence_pair_t>;
+    using algorithm_t = typename algorithm_type_for_input<sequence_pairs_t &>::type;
+    using executor_t = seqan3::detail::algorithm_executor_async<sequence_pairs_t &, algorithm_t, size_t>;
+
+    // The i-th sequence pair has i equal characters; the 0-th pair does not produce a result.
+    sequence_pairs_t sequence_pairs = []
+    {
+        sequence_pairs_t pairs{};
+        for (size_t i = 0; i < 100; ++i)
+            pairs.emplace_back(std::string(i, 'A') + "C", std::string(i, 'A') + "G");
+        return pairs;
+    }();
+
+    // Do not use more than 4 threads.
+    size_t thread_count() const
+    {
+        return std::max<size_t>(std::min<size_t>(4, std::thread::hardware_concurrency()), 2);
+    }
+};
+
+TEST_F(algorithm_executor_async_test, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_constructible_v<executor_t>);
+    EXPECT_TRUE(std::is_move_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_assignable_v<executor_t>);
+    EXPECT_TRUE(std::is_move_assignable_v<executor_t>);
+}
+
+TEST_F(algorithm_executor_async_test, type_deduction)
+{
+    seqan3::detail::algorithm_executor_async exec{sequence_pairs, algorithm_t{dummy_algorithm{}}, size_t{}, 2u};
+    EXPECT_TRUE((std::same_as<decltype(exec), executor_t>));
+    EXPECT_EQ(exec.next_result().value(), 1u);
+}
+
+TEST_F(algorithm_executor_async_test, next_result_input_order)
+{
+    executor_t exec{sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, thread_count()};
+
+    for (size_t i = 1; i < sequence_pairs.size(); ++i)
+        EXPECT_EQ(exec.next_result().value(), i);
+
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+}
+
+TEST_F(algorithm_executor_async_test, next_result_completion_order)
+{
+    executor_t exec{sequence_pairs,
+                    algorithm_t{dummy_algorithm{}},
+                    0u,
+                    thread_count(),
+                    3u,
+                    seqan3::detail::result_order::completion};
+
+    std::vector<size_t> results{};
+    for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+
+    std::ranges::sort(results);
+    ASSERT_EQ(results.size(), sequence_pairs.size() - 1);
+    for (size_t i = 0; i < results.size(); ++i)
+        EXPECT_EQ(results[i], i + 1);
+}
+
+TEST_F(algorithm_executor_async_test, capacity_one)
+{
+    executor_t exec{sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, thread_count(), 1u};
+
+    for (size_t i = 1; i < sequence_pairs.size(); ++i)
+        EXPECT_EQ(exec.next_result().value(), i);
+
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+}
+
+TEST_F(algorithm_executor_async_test, empty_resource)
+{
+    sequence_pairs_t empty{};
+    executor_t exec{empty, algorithm_t{dummy_algorithm{}}, 0u, thread_count()};
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+}
+
+TEST_F(algorithm_executor_async_test, input_range)
+{
+    std::istringstream stream{"1 2 3 4 5 6 7 8 9 10"};
+    auto numbers = std::ranges::istream_view<size_t>(stream);
+    EXPECT_FALSE(std::ranges::forward_range<decltype(numbers)>);
+
+    using algorithm_t = std::function<void(size_t &, std::function<void(size_t)>)>;
+    algorithm_t twice = [] (size_t & number, std::function<void(size_t)> callback)
+    {
+        callback(2 * number);
+    };
+
+    seqan3::detail::algorithm_executor_async exec{std::move(numbers), twice, 0u, thread_count()};
+
+    for (size_t i = 1; i <= 10; ++i)
+        EXPECT_EQ(exec.next_result().value(), 2 * i);
+
+    EXPECT_FALSE(static_cast<bool>(exec.next_result()));
+}
+
+TEST_F(algorithm_executor_async_test, exception)
+{
+    algorithm_t throwing = [] (sequence_pair_t const & sequence_pair, std::function<void(size_t)> callback)
+    {
+        if (sequence_pair.first.size() == 11)
+            throw std::runtime_error{"invalid sequence"};
+
+        dummy_algorithm{}(sequence_pair, callback);
+    };
+
+    executor_t exec{sequence_pairs, throwing, 0u, thread_count()};
+
+    EXPECT_THROW(
+    {
+        for (auto result = exec.next_result(); result.has_value(); result = exec.next_result())
+        {}
+    }, std::runtime_error);
+}
+
+TEST_F(algorithm_executor_async_test, early_destruction)
+{
+    algorithm_t slow = [] (sequence_pair_t const & sequence_pair, std::function<void(size_t)> callback)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds{100});
+        dummy_algorithm{}(sequence_pair, callback);
+    };
+
+    {
+        executor_t exec{sequence_pairs, slow, 0u, thread_count()};
+        EXPECT_EQ(exec.next_result().value(), 1u);
+    } // Must not dead lock.
+
+    {
+        executor_t exec{sequence_pairs, slow, 0u, thread_count()};
+    } // Must not dead lock without fetching any result.
+}
+
+TEST_F(algorithm_executor_async_test, move_assignment)
+{
+    executor_t exec{sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, thread_count()};
+    executor_t exec_move_assigned{sequence_pairs, algorithm_t{dummy_algorithm{}}, 0u, thread_count()};
+
+    EXPECT_EQ(exec.next_result().value(), 1u);
+    exec_move_assigned = std::move(exec);
+
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 2u);
+    EXPECT_EQ(exec_move_assigned.next_result().value(), 3u);
+
+    executor_t exec_move_constructed{std::move(exec_move_assigned)};
+    for (size_t i = 4; i < sequence_pairs.size(); ++i)
+        EXPECT_EQ(exec_move_constructed.next_result().value(), i);
+
+    EXPECT_FALSE(static_cast<bool>(exec_move_constructed.next_result()));
+}
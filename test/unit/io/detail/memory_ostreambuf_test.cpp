@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <ostream>
+#include <seqan3/std/span>
+#include <string>
+#include <string_view>
+
+#include <seqan3/io/detail/memory_ostreambuf.hpp>
+#include <seqan3/io/stream/detail/fast_ostreambuf_iterator.hpp>
+
+std::string_view as_string_view(std::span<char const> const written)
+{
+    return {written.data(), written.size()};
+}
+
+TEST(memory_ostreambuf, write)
+{
+    seqan3::detail::memory_ostreambuf<char> buffer{};
+    std::ostream stream{&buffer};
+
+    EXPECT_TRUE(buffer.written().empty());
+
+    stream << "ACGT" << '\t' << 42;
+    EXPECT_EQ(as_string_view(buffer.written()), "ACGT\t42");
+}
+
+TEST(memory_ostreambuf, grow)
+{
+    seqan3::detail::memory_ostreambuf<char> buffer{};
+    std::ostream stream{&buffer};
+    std::string const large(10000, 'A');
+
+    stream << 'C' << large;
+    stream.write(large.data(), large.size());
+
+    seqan3::detail::fast_ostreambuf_iterator<char> it{buffer};
+    for (size_t i = 0; i < 5000; ++i)
+        *it = 'G';
+
+    std::string const expected = "C" + large + large + std::string(5000, 'G');
+    EXPECT_EQ(as_string_view(buffer.written()), expected);
+}
+
+TEST(memory_ostreambuf, clear)
+{
+    seqan3::detail::memory_ostreambuf<char> buffer{};
+    std::ostream stream{&buffer};
+
+    stream << std::string(5000, 'A');
+    char const * data = buffer.written().data();
+    buffer.clear();
+    EXPECT_TRUE(buffer.written().empty());
+
+    stream << "ACGT";
+    EXPECT_EQ(as_string_view(buffer.written()), "ACGT");
+    EXPECT_EQ(buffer.written().data(), data); // the memory is reused
+}
@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <seqan3/io/detail/read_ahead_istream.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using source_ptr_t = seqan3::detail::read_ahead_istream<char>::source_ptr_t;
+
+//!\brief Some text that spans many of the small buffers used below.
+std::string make_text()
+{
+    std::string text{};
+    for (size_t i = 0; i < 1000; ++i)
+        text += "line " + std::to_string(i) + '\n';
+    return text;
+}
+
+//!\brief Owns a string stream as source of a read-ahead stream.
+source_ptr_t make_source(std::string const & text)
+{
+    return {new std::istringstream{text}, [] (std::istream * ptr) { delete ptr; }};
+}
+
+//!\brief A stream buffer that fails after returning some characters.
+struct failing_streambuf : public std::streambuf
+{
+    std::string data{"ACGTACGTAC"}; // two full buffers
+
+    std::streamsize xsgetn(char * s, std::streamsize n) override
+    {
+        if (data.empty())
+            throw seqan3::io_error{"failure"};
+
+        std::streamsize const count = std::min<std::streamsize>(n, data.size());
+        data.copy(s, count);
+        data.erase(0, count);
+        return count;
+    }
+};
+
+TEST(read_ahead_istream, read_from_stream)
+{
+    std::string const text = make_text();
+
+    for (size_t buffer_count : {1u, 2u, 5u})
+    {
+        for (size_t buffer_size : {1u, 7u, 100000u})
+        {
+            seqan3::detail::read_ahead_istream<char> stream{make_source(text), buffer_size, buffer_count};
+            std::string const result{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+            EXPECT_EQ(result, text);
+        }
+    }
+}
+
+TEST(read_ahead_istream, read_from_file)
+{
+    std::string const text = make_text();
+    seqan3::test::tmp_filename filename{"read_ahead.txt"};
+
+    {
+        std::ofstream out{filename.get_path()};
+        out << text;
+    }
+
+    source_ptr_t file{new std::ifstream{filename.get_path()}, [] (std::istream * ptr) { delete ptr; }};
+    std::string line{};
+    std::getline(*file, line); // starts after the first line
+
+    seqan3::detail::read_ahead_istream<char> stream{std::move(file), filename.get_path(), 13u, 2u};
+    std::string const result{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(line, "line 0");
+    EXPECT_EQ(result, text.substr(7));
+}
+
+TEST(read_ahead_istream, putback)
+{
+    seqan3::detail::read_ahead_istream<char> stream{make_source("ACGTACGT"), 3u, 1u};
+    std::string result{};
+
+    for (char c{}; stream.get(c); )
+    {
+        result += c;
+
+        if (result.size() == 3u || result.size() == 6u) // at the end of a buffer
+        {
+            ASSERT_TRUE(stream.get(c));
+            ASSERT_TRUE(stream.unget());
+            ASSERT_TRUE(stream.unget());
+            ASSERT_TRUE(stream.get(c));
+            EXPECT_EQ(c, result.back());
+        }
+    }
+
+    EXPECT_EQ(result, "ACGTACGT");
+}
+
+TEST(read_ahead_istream, empty)
+{
+    seqan3::detail::read_ahead_istream<char> stream{make_source(""), 4u, 2u};
+    EXPECT_EQ(stream.peek(), std::char_traits<char>::eof());
+}
+
+TEST(read_ahead_istream, destroy_before_end)
+{
+    std::string const text = make_text();
+    seqan3::detail::read_ahead_istream<char> stream{make_source(text), 5u, 3u};
+
+    std::string line{};
+    std::getline(stream, line);
+    EXPECT_EQ(line, "line 0");
+} // the background thread waits for a free buffer while the stream is destroyed
+
+TEST(read_ahead_istream, error)
+{
+    failing_streambuf source{};
+    seqan3::detail::read_ahead_istreambuf<char> buffer{source, 5u, 2u};
+    std::string result{};
+
+    auto read_all = [&] ()
+    {
+        for (auto c = buffer.sgetc(); c != std::char_traits<char>::eof(); c = buffer.snextc())
+            result.push_back(std::char_traits<char>::to_char_type(c));
+    };
+
+    // the data read before the error is returned, then the error is rethrown
+    EXPECT_THROW(read_all(), seqan3::io_error);
+    EXPECT_EQ(result, "ACGTACGTAC");
+    EXPECT_EQ(buffer.sgetc(), std::char_traits<char>::eof()); // the error is only reported once
+}
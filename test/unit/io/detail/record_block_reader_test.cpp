@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/detail/record_block_reader.hpp>
+
+using span_t = std::span<char const>;
+
+std::string to_string(span_t const s)
+{
+    return std::string{s.data(), s.size()};
+}
+
+TEST(memory_istreambuf, read)
+{
+    std::string const data{"line1\nline2\n"};
+    seqan3::detail::memory_istreambuf<char> buffer{span_t{data.data(), data.size()}};
+    std::istream stream{&buffer};
+
+    std::string line;
+    EXPECT_FALSE(buffer.exhausted());
+    std::getline(stream, line);
+    EXPECT_EQ(line, "line1");
+    std::getline(stream, line);
+    EXPECT_EQ(line, "line2");
+    EXPECT_TRUE(buffer.exhausted());
+    EXPECT_FALSE(std::getline(stream, line));
+}
+
+TEST(record_block_reader, read_block)
+{
+    std::istringstream stream{"aaaa\nbbbbbbbbbbbb\r\ncc\n\ndd"};
+    seqan3::detail::record_block_reader<char> reader{6u};
+
+    EXPECT_EQ(to_string(reader.read_block(stream)), "aaaa\n");
+    EXPECT_EQ(to_string(reader.read_block(stream)), "bbbbbbbbbbbb\r\ncc\n\n"); // line longer than a block
+    EXPECT_EQ(to_string(reader.read_block(stream)), "dd"); // last line without newline
+    EXPECT_TRUE(reader.read_block(stream).empty());
+    EXPECT_TRUE(reader.read_block(stream).empty());
+}
+
+TEST(record_block_reader, read_block_unconsumed)
+{
+    std::istringstream stream{">a\nAC\nGT\n>b\nTT\n"};
+    seqan3::detail::record_block_reader<char> reader{9u};
+
+    EXPECT_EQ(to_string(reader.read_block(stream)), ">a\nAC\nGT\n");
+    EXPECT_FALSE(reader.is_last_block());
+
+    // The record may continue in the next block, so it is kept.
+    EXPECT_EQ(to_string(reader.read_block(stream, 9u)), ">a\nAC\nGT\n>b\nTT\n");
+    EXPECT_TRUE(reader.is_last_block());
+    EXPECT_EQ(to_string(reader.read_block(stream, 6u)), ">b\nTT\n");
+    EXPECT_TRUE(reader.read_block(stream).empty());
+}
+
+TEST(record_block_reader, read_whole_stream)
+{
+    std::string data{};
+    for (size_t i = 0; i < 1000; ++i)
+        data += "record" + std::to_string(i) + "\n";
+
+    std::istringstream stream{data};
+    seqan3::detail::record_block_reader<char> reader{100u};
+
+    std::string result{};
+    for (span_t block = reader.read_block(stream); !block.empty(); block = reader.read_block(stream))
+    {
+        EXPECT_EQ(block.back(), '\n');
+        result += to_string(block);
+    }
+
+    EXPECT_EQ(result, data);
+}
+
+TEST(record_block_reader, split)
+{
+    std::string const data{"aa\nbb\ncc\r\n\ndd\nee"};
+    std::vector<span_t> chunks{};
+
+    seqan3::detail::record_block_reader<char>::split(span_t{data.data(), data.size()}, 3u, chunks);
+    ASSERT_EQ(chunks.size(), 2u); // chunks are extended to the end of the line including empty lines
+    EXPECT_EQ(to_string(chunks[0]), "aa\nbb\ncc\r\n\n");
+    EXPECT_EQ(to_string(chunks[1]), "dd\nee");
+
+    seqan3::detail::record_block_reader<char>::split(span_t{data.data(), data.size()}, 8u, chunks);
+    ASSERT_EQ(chunks.size(), 5u);
+    EXPECT_EQ(to_string(chunks[0]), "aa\n");
+    EXPECT_EQ(to_string(chunks[2]), "cc\r\n\n");
+    EXPECT_EQ(to_string(chunks[4]), "ee");
+
+    seqan3::detail::record_block_reader<char>::split(span_t{data.data(), data.size()}, 1u, chunks);
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(to_string(chunks[0]), data);
+
+    seqan3::detail::record_block_reader<char>::split(span_t{}, 4u, chunks);
+    EXPECT_TRUE(chunks.empty());
+}
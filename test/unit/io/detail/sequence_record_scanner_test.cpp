@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <seqan3/io/detail/sequence_record_scanner.hpp>
+
+using seqan3::detail::sequence_record_scanner;
+
+TEST(sequence_record_scanner, fasta_record)
+{
+    std::string const block{"> id 1\r\nACGT\nGG\n\n>id2\nTT"};
+    char const * const block_end = block.data() + block.size();
+
+    auto fields = sequence_record_scanner{block_end, true}.fasta_record(block.data());
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_EQ(fields->id, "id 1");
+    EXPECT_EQ(fields->sequence, "ACGT\nGG");
+    EXPECT_TRUE(fields->qualities.empty());
+    EXPECT_EQ(*fields->end, '>');
+
+    // the last record may continue in the next block
+    EXPECT_FALSE(sequence_record_scanner(block_end, false).fasta_record(fields->end).has_value());
+
+    fields = sequence_record_scanner{block_end, true}.fasta_record(fields->end);
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_EQ(fields->id, "id2");
+    EXPECT_EQ(fields->sequence, "TT");
+    EXPECT_EQ(fields->end, block_end);
+
+    EXPECT_THROW(sequence_record_scanner(block_end, true).fasta_record(block.data() + 2), seqan3::parse_error);
+}
+
+TEST(sequence_record_scanner, fastq_record)
+{
+    // multi-line sequence and qualities, a quality line starting with '@'
+    std::string const block{"@id1\nAC\nGT\n+\n@@\n!!\n@id2\nA\n+id2\nI"};
+    char const * const block_end = block.data() + block.size();
+
+    auto fields = sequence_record_scanner{block_end, true}.fastq_record(block.data());
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_EQ(fields->id, "id1");
+    EXPECT_EQ(fields->sequence, "AC\nGT");
+    EXPECT_EQ(fields->qualities, "@@\n!!");
+    EXPECT_EQ(*fields->end, '@');
+
+    EXPECT_FALSE(sequence_record_scanner(block_end, false).fastq_record(fields->end).has_value());
+
+    fields = sequence_record_scanner{block_end, true}.fastq_record(fields->end);
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_EQ(fields->id, "id2");
+    EXPECT_EQ(fields->qualities, "I");
+    EXPECT_EQ(fields->end, block_end);
+}
+
+TEST(sequence_record_scanner, fastq_errors)
+{
+    auto scan = [] (std::string const & block)
+    {
+        return sequence_record_scanner{block.data() + block.size(), true}.fastq_record(block.data());
+    };
+
+    EXPECT_THROW(scan(">id\nACGT\n"), seqan3::parse_error);
+    EXPECT_THROW(scan("@id\nACGT\n"), seqan3::unexpected_end_of_input);
+    EXPECT_THROW(scan("@id\nACGT\n+\n!!"), seqan3::unexpected_end_of_input);
+    EXPECT_THROW(scan("@id\nACGT\n+\n!!\n!!!\n"), seqan3::parse_error);
+}
@@ -0,0 +1,111 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/io/sam_file/detail/bam_sequence_codec.hpp>
+
+using seqan3::operator""_dna5;
+using seqan3::operator""_dna4;
+using seqan3::operator""_sam_dna16;
+
+// ACGTN (odd length) packed as in the BAM specification: A=1, C=2, G=4, T=8, N=15.
+static std::string const packed{'\x12', '\x48', '\xf0'};
+
+TEST(bam_sequence_codec, decode)
+{
+    using codec_t = seqan3::detail::bam_sequence_codec<seqan3::dna5>;
+
+    std::vector<seqan3::dna5> seq(5);
+    auto it = codec_t::decode(packed, 0, 5, seq.begin());
+    EXPECT_EQ(it, seq.end());
+    EXPECT_EQ(seq, "ACGTN"_dna5);
+
+    // Start and end in the middle of a byte.
+    std::vector<seqan3::dna5> part(3);
+    codec_t::decode(packed, 1, 3, part.begin());
+    EXPECT_EQ(part, "CGT"_dna5);
+
+    part.resize(2);
+    codec_t::decode(packed, 3, 2, part.begin());
+    EXPECT_EQ(part, "TN"_dna5);
+
+    // Empty range.
+    EXPECT_EQ(codec_t::decode(packed, 2, 0, part.begin()), part.begin());
+}
+
+TEST(bam_sequence_codec, decode_converts_through_char)
+{
+    // sam_dna16 letters without a dna4 equivalent are converted via their character, e.g. N becomes A.
+    std::vector<seqan3::dna4> seq{};
+    seqan3::detail::bam_sequence_codec<seqan3::dna4>::decode_append(packed, 0, 5, seq);
+    EXPECT_EQ(seq, "ACGTA"_dna4);
+
+    // The full range of sam_dna16.
+    std::string const all{'\x01', '\x23', '\x45', '\x67', '\x89', '\xab', '\xcd', '\xef'};
+    std::vector<seqan3::sam_dna16> seq16{};
+    seqan3::detail::bam_sequence_codec<seqan3::sam_dna16>::decode_append(all, 0, 16, seq16);
+    EXPECT_EQ(seq16, "=ACMGRSVTWYHKDBN"_sam_dna16);
+}
+
+TEST(bam_sequence_codec, decode_append)
+{
+    using codec_t = seqan3::detail::bam_sequence_codec<seqan3::dna5>;
+
+    // Resizable random access container.
+    std::vector<seqan3::dna5> seq{"GG"_dna5};
+    codec_t::decode_append(packed, 1, 4, seq);
+    EXPECT_EQ(seq, "GGCGTN"_dna5);
+
+    // Container without random access.
+    std::list<seqan3::dna5> list{};
+    codec_t::decode_append(packed, 0, 5, list);
+    EXPECT_EQ((std::vector<seqan3::dna5>{list.begin(), list.end()}), "ACGTN"_dna5);
+}
+
+TEST(bam_sequence_codec, encode)
+{
+    using codec_t = seqan3::detail::bam_sequence_codec<seqan3::dna5>;
+
+    std::vector<seqan3::dna5> const seq{"ACGTN"_dna5};
+    std::string buffer(3, '\x00');
+    auto it = codec_t::encode(seq.begin(), seq.size(), buffer);
+    EXPECT_EQ(it, seq.end());
+    EXPECT_EQ(buffer, packed);
+
+    // Even length.
+    buffer.assign(2, '\x00');
+    codec_t::encode(seq.begin(), 4, buffer);
+    EXPECT_EQ(buffer, packed.substr(0, 2));
+}
+
+TEST(bam_sequence_codec, round_trip)
+{
+    using codec_t = seqan3::detail::bam_sequence_codec<seqan3::sam_dna16>;
+
+    std::vector<seqan3::sam_dna16> seq{};
+    for (size_t i = 0; i < 101; ++i)
+        seq.push_back(seqan3::sam_dna16{}.assign_rank((i * 7) % 16));
+
+    std::string buffer((seq.size() + 1) / 2, '\x00');
+    codec_t::encode(seq.begin(), seq.size(), buffer);
+
+    std::vector<seqan3::sam_dna16> decoded{};
+    codec_t::decode_append(buffer, 0, seq.size(), decoded);
+    EXPECT_EQ(decoded, seq);
+
+    decoded.clear();
+    codec_t::decode_append(buffer, 13, 50, decoded);
+    EXPECT_EQ(decoded, (std::vector<seqan3::sam_dna16>{seq.begin() + 13, seq.begin() + 63}));
+}
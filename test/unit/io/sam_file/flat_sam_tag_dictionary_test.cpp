@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/io/sam_file/flat_sam_tag_dictionary.hpp>
+
+using seqan3::operator""_tag;
+
+TEST(flat_sam_tag_dictionary, set_and_get)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+    EXPECT_TRUE(dict.empty());
+
+    dict.set<"NM"_tag>(3);
+    dict.set<"CO"_tag>("comment");
+    dict.set("XY"_tag, std::vector<uint16_t>{1u, 300u});
+    dict.set("XZ"_tag, 'a');
+    dict.set("XF"_tag, 1.5f);
+
+    EXPECT_EQ(dict.size(), 5u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 3);
+    EXPECT_EQ(dict.get<"CO"_tag>(), "comment");
+    EXPECT_EQ(std::get<std::vector<uint16_t>>(dict.at("XY"_tag)), (std::vector<uint16_t>{1u, 300u}));
+    EXPECT_EQ(std::get<char>(dict.at("XZ"_tag)), 'a');
+    EXPECT_EQ(std::get<float>(dict.at("XF"_tag)), 1.5f);
+
+    // overwrite
+    dict.set<"NM"_tag>(-70000);
+    EXPECT_EQ(dict.size(), 5u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), -70000);
+    EXPECT_EQ(dict.get<"CO"_tag>(), "comment");
+}
+
+TEST(flat_sam_tag_dictionary, lookup)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+    dict.set<"NM"_tag>(3);
+
+    EXPECT_TRUE(dict.contains("NM"_tag));
+    EXPECT_FALSE(dict.contains("AS"_tag));
+    EXPECT_EQ(dict.count("NM"_tag), 1u);
+    EXPECT_EQ(dict.count("AS"_tag), 0u);
+    EXPECT_THROW(dict.at("AS"_tag), std::out_of_range);
+    EXPECT_THROW(dict.get<"AS"_tag>(), std::out_of_range);
+}
+
+TEST(flat_sam_tag_dictionary, erase_and_clear)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+    dict.set<"NM"_tag>(3);
+    dict.set<"CO"_tag>("comment");
+    dict.set<"AS"_tag>(42);
+
+    EXPECT_EQ(dict.erase("CO"_tag), 1u);
+    EXPECT_EQ(dict.erase("CO"_tag), 0u);
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 3);
+    EXPECT_EQ(dict.get<"AS"_tag>(), 42);
+
+    dict.clear();
+    EXPECT_TRUE(dict.empty());
+    EXPECT_TRUE(dict.raw_bam_data().empty());
+}
+
+TEST(flat_sam_tag_dictionary, iteration_is_ordered_by_tag)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+    dict.set<"NM"_tag>(3);
+    dict.set<"AS"_tag>(42);
+    dict.set<"CO"_tag>("comment");
+
+    std::vector<uint16_t> tags{};
+    for (auto && [tag, value] : dict)
+        tags.push_back(tag);
+
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"AS"_tag, "CO"_tag, "NM"_tag}));
+}
+
+TEST(flat_sam_tag_dictionary, raw_bam_data)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+    dict.set<"NM"_tag>(7);
+    dict.set<"CO"_tag>("ab");
+
+    using namespace std::string_literals;
+    EXPECT_EQ(std::string(dict.raw_bam_data().begin(), dict.raw_bam_data().end()), "NMC\x07"s "COZab\0"s);
+
+    seqan3::flat_sam_tag_dictionary copy{};
+    copy.assign_raw_bam_data(dict.raw_bam_data());
+    EXPECT_TRUE(copy == dict);
+    EXPECT_EQ(copy.get<"NM"_tag>(), 7);
+    EXPECT_EQ(copy.get<"CO"_tag>(), "ab");
+}
+
+TEST(flat_sam_tag_dictionary, malformed_raw_bam_data)
+{
+    using namespace std::string_literals;
+    seqan3::flat_sam_tag_dictionary dict{};
+
+    EXPECT_THROW(dict.assign_raw_bam_data("NM"s), seqan3::format_error);            // missing type
+    EXPECT_THROW(dict.assign_raw_bam_data("NMi\x01"s), seqan3::format_error);       // truncated value
+    EXPECT_THROW(dict.assign_raw_bam_data("NMQ\x01"s), seqan3::format_error);       // unknown type
+    EXPECT_THROW(dict.assign_raw_bam_data("COZab"s), seqan3::format_error);         // missing null terminator
+    EXPECT_THROW(dict.assign_raw_bam_data("XYBc\x03\0\0\0\x01"s), seqan3::format_error); // truncated array
+}
+
+TEST(flat_sam_tag_dictionary, conversion_to_and_from_sam_tag_dictionary)
+{
+    seqan3::sam_tag_dictionary map{};
+    map.get<"NM"_tag>() = 3;
+    map.get<"CO"_tag>() = "comment";
+    map["XY"_tag] = std::vector<int32_t>{-1, 2, 3};
+
+    seqan3::flat_sam_tag_dictionary dict{map};
+    EXPECT_EQ(dict.size(), 3u);
+    EXPECT_TRUE(static_cast<seqan3::sam_tag_dictionary>(dict) == map);
+
+    seqan3::flat_sam_tag_dictionary other{};
+    other.set<"CO"_tag>("comment");
+    other.set("XY"_tag, std::vector<int32_t>{-1, 2, 3});
+    other.set<"NM"_tag>(3);
+    EXPECT_TRUE(dict == other); // insertion order does not matter
+
+    other.set<"NM"_tag>(4);
+    EXPECT_TRUE(dict != other);
+}
+
+TEST(flat_sam_tag_dictionary, set_bam_encoded)
+{
+    seqan3::flat_sam_tag_dictionary dict{};
+    dict.set<"NM"_tag>(3);
+    dict.set<"CO"_tag>("comment");
+
+    dict.set_bam_encoded("CO"_tag, [] (std::vector<char> & buffer)
+    {
+        for (char c : {'Z', 'a', 'b', '\0'})
+            buffer.push_back(c);
+    });
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_EQ(dict.get<"CO"_tag>(), "ab");
+    EXPECT_EQ(dict.get<"NM"_tag>(), 3);
+
+    // a throwing encoder leaves the dictionary without the tag
+    EXPECT_THROW(dict.set_bam_encoded("AS"_tag, [] (std::vector<char> & buffer)
+    {
+        buffer.push_back('i');
+        throw seqan3::format_error{"error"};
+    }), seqan3::format_error);
+    EXPECT_FALSE(dict.contains("AS"_tag));
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 3);
+}
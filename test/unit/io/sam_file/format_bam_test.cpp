@@ -664,3 +664,84 @@ TEST_F(bam_format, issue2417)
 
     EXPECT_EQ(num_records, 1u);
 }
+
+// ----------------------------------------------------------------------------
+// seqan3::flat_sam_tag_dictionary
+// ----------------------------------------------------------------------------
+
+struct flat_tags_traits : seqan3::sam_file_input_default_traits<>
+{
+    using tag_dictionary = seqan3::flat_sam_tag_dictionary;
+};
+
+using bam_file_read = sam_file_read<seqan3::format_bam>;
+
+TEST_F(bam_file_read, flat_sam_tag_dictionary)
+{
+    using tag_fields = seqan3::fields<seqan3::field::id, seqan3::field::tags>;
+
+    std::istringstream flat_stream{verbose_reads_input};
+    seqan3::sam_file_input<flat_tags_traits, tag_fields> flat_fin{flat_stream, seqan3::format_bam{}};
+
+    std::istringstream stream{verbose_reads_input};
+    seqan3::sam_file_input fin{stream, seqan3::format_bam{}, tag_fields{}};
+
+    auto it = fin.begin();
+    size_t counter{0};
+    for (auto & [id, tags] : flat_fin)
+    {
+        ASSERT_NE(it, fin.end());
+        EXPECT_EQ(id, (*it).id());
+        EXPECT_EQ(static_cast<seqan3::sam_tag_dictionary>(tags), (*it).tags()); // decoded lazily
+        ++it;
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(bam_file_read, flat_sam_tag_dictionary_pass_through)
+{
+    using sam_fields = seqan3::fields<seqan3::field::header_ptr,
+                                      seqan3::field::id,
+                                      seqan3::field::flag,
+                                      seqan3::field::ref_id,
+                                      seqan3::field::ref_offset,
+                                      seqan3::field::mapq,
+                                      seqan3::field::cigar,
+                                      seqan3::field::offset,
+                                      seqan3::field::mate,
+                                      seqan3::field::seq,
+                                      seqan3::field::qual,
+                                      seqan3::field::tags>;
+    using flat_input_t = seqan3::sam_file_input<flat_tags_traits, sam_fields, seqan3::type_list<seqan3::format_bam>>;
+
+    std::istringstream istream{verbose_reads_input};
+    std::ostringstream ostream{};
+    std::vector<seqan3::flat_sam_tag_dictionary> original_tags{};
+
+    {
+        flat_input_t fin{istream, seqan3::format_bam{}};
+        seqan3::sam_file_output fout{ostream, seqan3::format_bam{}, sam_fields{}};
+
+        for (auto & record : fin)
+        {
+            original_tags.push_back(record.tags());
+            fout.push_back(record);
+        }
+    }
+
+    // the raw BAM data of the tags is written unchanged
+    std::istringstream written_stream{ostream.str()};
+    flat_input_t written_fin{written_stream, seqan3::format_bam{}};
+
+    size_t counter{0};
+    for (auto & record : written_fin)
+    {
+        ASSERT_LT(counter, original_tags.size());
+        EXPECT_RANGE_EQ(record.tags().raw_bam_data(), original_tags[counter].raw_bam_data());
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
@@ -382,3 +382,59 @@ TEST_F(sam_format, issue2195)
         EXPECT_RANGE_EQ((*fin.begin()).base_qualities(), expected_quality);
     }
 }
+
+// ----------------------------------------------------------------------------
+// seqan3::flat_sam_tag_dictionary
+// ----------------------------------------------------------------------------
+
+struct flat_tags_traits : seqan3::sam_file_input_default_traits<>
+{
+    using tag_dictionary = seqan3::flat_sam_tag_dictionary;
+};
+
+using sam_file_read_flat = sam_file_read<seqan3::format_sam>;
+
+TEST_F(sam_file_read_flat, flat_sam_tag_dictionary)
+{
+    using tag_fields = seqan3::fields<seqan3::field::id, seqan3::field::tags>;
+
+    std::istringstream flat_stream{verbose_reads_input};
+    seqan3::sam_file_input<flat_tags_traits, tag_fields> flat_fin{flat_stream, seqan3::format_sam{}};
+
+    std::istringstream stream{verbose_reads_input};
+    seqan3::sam_file_input fin{stream, seqan3::format_sam{}, tag_fields{}};
+
+    auto it = fin.begin();
+    size_t counter{0};
+    for (auto & [id, tags] : flat_fin)
+    {
+        ASSERT_NE(it, fin.end());
+        EXPECT_EQ(id, (*it).id());
+        EXPECT_EQ(static_cast<seqan3::sam_tag_dictionary>(tags), (*it).tags());
+        ++it;
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sam_format, flat_sam_tag_dictionary_errors)
+{
+    using flat_input_t = seqan3::sam_file_input<flat_tags_traits,
+                                                seqan3::fields<seqan3::field::tags>,
+                                                seqan3::type_list<seqan3::format_sam>>;
+
+    for (std::string tag : {"NM:X:3", "NM:B:x3,4", "bH:H:1AE", "bH:H:1G"})
+    {
+        std::istringstream istream{"*\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\t" + tag + "\n"};
+        flat_input_t fin{istream, seqan3::format_sam{}};
+        EXPECT_THROW(fin.begin(), seqan3::format_error) << tag;
+    }
+
+    // the last value of a duplicated tag is stored
+    std::istringstream istream{"*\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\tNM:i:3\tCO:Z:abc\tNM:i:4\n"};
+    flat_input_t fin{istream, seqan3::format_sam{}};
+    auto & tags = seqan3::get<seqan3::field::tags>(*fin.begin());
+    EXPECT_EQ(tags.size(), 2u);
+    EXPECT_EQ(tags.get<"NM"_tag>(), 4);
+}
@@ -515,6 +515,43 @@ TEST_F(sam_file_input_f, read_empty_bz2_file)
 }
 #endif
 
+#ifdef SEQAN3_HAS_ZSTD
+std::string input_zst
+{
+    '\x28','\xB5','\x2F','\xFD','\x20','\xC3','\x1D','\x04','\x00','\xB2','\x87','\x19','\x19','\x50','\xB5','\x0E',
+    '\xC8','\x46','\x20','\xA2','\xD6','\xEF','\x2F','\x2F','\x56','\x45','\x61','\xDB','\x10','\xD9','\x40','\xFA',
+    '\x46','\x50','\x15','\x5A','\xA1','\x06','\xC0','\xA2','\x24','\x0F','\x39','\x9C','\x3B','\xBD','\xF4','\x36',
+    '\xED','\x96','\xD1','\x79','\x8C','\xF2','\xB1','\x79','\xF2','\xC5','\x67','\x27','\x34','\x37','\xED','\x87',
+    '\x51','\x10','\x43','\xD3','\xA9','\x6F','\xD4','\x6D','\xB9','\xB2','\xC4','\xF5','\x39','\x74','\x0E','\xA1',
+    '\x3C','\x04','\x9E','\x3A','\x1D','\x4E','\x6C','\x5A','\x7A','\x21','\x08','\xDC','\x6F','\x47','\xF4','\x0C',
+    '\x13','\xCF','\x54','\x28','\x71','\x65','\xCB','\x67','\xE7','\xFC','\xCB','\xCA','\xCE','\xF2','\x5C','\x51',
+    '\x56','\x16','\x0A','\x00','\x50','\x24','\x81','\x30','\x49','\xA0','\x11','\x4A','\x48','\x30','\xC2','\x15',
+    '\x83','\xFB','\x70','\x24','\x08','\x16','\x4E','\x05','\x0C','\x6B','\x98','\x78'
+};
+
+TEST_F(sam_file_input_f, decompression_by_filename_zst)
+{
+    seqan3::test::tmp_filename filename{"sam_file_output_test.sam.zst"};
+
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+
+        std::copy(input_zst.begin(), input_zst.end(), std::ostreambuf_iterator<char>{of});
+    }
+
+    seqan3::sam_file_input fin{filename.get_path()};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sam_file_input_f, decompression_by_stream_zst)
+{
+    seqan3::sam_file_input fin{std::istringstream{input_zst}, seqan3::format_sam{}};
+
+    decompression_impl(*this, fin);
+}
+#endif
+
 // ----------------------------------------------------------------------------
 // SAM format specificities
 // ----------------------------------------------------------------------------
@@ -605,6 +642,105 @@ TEST_F(sam_file_input_sam_format_f, construct_from_stream_and_read_alignment_wit
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(sam_file_input_sam_format_f, parallel_parsing)
+{
+    // many records such that they are distributed over several chunks
+    std::string many_records{input};
+    std::string const records{input.substr(input.find("read1"))};
+    for (size_t i = 0; i < 1000; ++i)
+        many_records += records;
+
+    for (size_t thread_count : {1u, 2u, 4u})
+    {
+        seqan3::sam_file_input fin{std::istringstream{many_records}, seqan3::format_sam{}};
+        fin.options.thread_count = thread_count;
+
+        size_t counter = 0;
+        for (auto & rec : fin)
+        {
+            EXPECT_RANGE_EQ(rec.sequence(), seq_comp[counter % 3]);
+            EXPECT_EQ(rec.id(), id_comp[counter % 3]);
+            EXPECT_RANGE_EQ(rec.base_qualities(), qual_comp[counter % 3]);
+            EXPECT_EQ(rec.reference_id(), 0);
+            EXPECT_EQ(rec.header_ptr(), &fin.header());
+
+            counter++;
+        }
+
+        EXPECT_EQ(counter, 3003u);
+    }
+}
+
+TEST_F(sam_file_input_sam_format_f, parallel_parsing_with_reference_information)
+{
+    seqan3::sam_file_input fin{std::istringstream{input},
+                               ref_ids,
+                               ref_seqs,
+                               seqan3::format_sam{},
+                               seqan3::fields<seqan3::field::alignment>{}};
+    fin.options.thread_count = 4u;
+
+    size_t counter = 0;
+    for (auto & [ alignment ] : fin)
+    {
+        EXPECT_RANGE_EQ(std::get<0>(alignment), std::get<0>(alignments_expected[counter]));
+        EXPECT_RANGE_EQ(std::get<1>(alignment), std::get<1>(alignments_expected[counter]));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sam_file_input_sam_format_f, parallel_parsing_without_reference_information)
+{
+    // without @SQ lines the reference ids are added to the header while reading -> sequential fallback
+    std::string const no_sq_input{"read1\t41\tref1\t1\t61\t*\t*\t0\t0\tACGT\t*\n"
+                                  "read2\t42\tref2\t2\t62\t*\t*\t0\t0\tAGGC\t*\n"};
+
+    seqan3::sam_file_input fin{std::istringstream{no_sq_input}, seqan3::format_sam{}};
+    fin.options.thread_count = 4u;
+
+    EXPECT_EQ(std::ranges::distance(fin), 2);
+    EXPECT_EQ(fin.header().ref_ids(), (std::deque<std::string>{"ref1", "ref2"}));
+}
+
+TEST_F(sam_file_input_sam_format_f, parallel_parsing_error_after_valid_records)
+{
+    std::string const faulty_input{input + "read4\tnot_a_number\tref\t3\t63\t*\t*\t0\t0\tACGT\t*\n"};
+
+    seqan3::sam_file_input fin{std::istringstream{faulty_input}, seqan3::format_sam{}};
+    fin.options.thread_count = 2u;
+
+    auto it = fin.begin();
+    EXPECT_EQ((*it).id(), "read1");
+    ++it;
+    EXPECT_EQ((*it).id(), "read2");
+    ++it;
+    EXPECT_EQ((*it).id(), "read3");
+    EXPECT_THROW(++it, seqan3::format_error);
+}
+
+TEST_F(sam_file_input_sam_format_f, read_ahead)
+{
+    seqan3::test::tmp_filename filename{"sam_file_input_read_ahead.sam"};
+    {
+        std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+        filecreator << input;
+    }
+
+    for (size_t thread_count : {1u, 2u})
+    {
+        seqan3::sam_file_input fin{filename.get_path()};
+        fin.options.thread_count = thread_count;
+        fin.options.read_ahead_buffer_count = 2u;
+        fin.options.read_ahead_buffer_size = 7u; // records span several buffers
+
+        decompression_impl(*this, fin);
+        EXPECT_EQ(fin.header().ref_ids(), (std::deque<std::string>{"ref"}));
+    }
+}
+
 // ----------------------------------------------------------------------------
 // BAM format specificities
 // ----------------------------------------------------------------------------
@@ -705,4 +841,19 @@ TEST_F(sam_file_input_bam_format_f, construct_by_stream)
 
     EXPECT_EQ(counter, 3u);
 }
+TEST_F(sam_file_input_bam_format_f, read_ahead)
+{
+    seqan3::test::tmp_filename filename{"sam_file_input_read_ahead.bam"};
+    {
+        std::ofstream filecreator{filename.get_path(), std::ios::out | std::ios::binary};
+        filecreator << binary_input;
+    }
+
+    seqan3::sam_file_input fin{filename.get_path()};
+    fin.options.read_ahead_buffer_count = 3u;
+    fin.options.read_ahead_buffer_size = 16u; // decompressed on the background thread
+
+    decompression_impl(*this, fin);
+    EXPECT_EQ(fin.header().comments[0], std::string{"This is a comment."});
+}
 #endif // SEQAN3_HAS_ZLIB
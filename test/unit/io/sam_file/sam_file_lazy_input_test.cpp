@@ -0,0 +1,239 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <sstream>
+
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/core/detail/debug_stream_alphabet.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/lazy_input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna5;
+using seqan3::operator""_phred42;
+using seqan3::operator""_tag;
+
+TEST(sam_file_lazy_input, concepts)
+{
+    using t = seqan3::sam_file_lazy_input<>;
+    EXPECT_TRUE((std::ranges::input_range<t>));
+    EXPECT_FALSE((std::ranges::input_range<t const>));
+    EXPECT_FALSE((std::movable<t>));
+
+    using it_t = typename t::iterator;
+    EXPECT_TRUE((std::input_iterator<it_t>));
+    EXPECT_TRUE((std::sentinel_for<typename t::sentinel, it_t>));
+}
+
+struct sam_file_lazy_input_f : public ::testing::Test
+{
+    std::string sam_input =
+R"(@HD	VN:1.6	SO:unknown
+@SQ	SN:ref	LN:34
+@SQ	SN:ref2	LN:20
+read1	41	ref	1	61	1S1M1D2M	ref	10	300	ACGT	!##$	AS:i:2	NM:i:7
+read2	42	ref2	2	62	7M1D1M1S	=	10	-300	AGGCTGNAG	!##$&'()*	xy:B:S,3,4,5
+*	4	*	0	0	*	*	0	0	GGAGTATA	!!*+,-./
+)";
+
+    //!\brief Converts the SAM input to BAM.
+    std::string bam_input()
+    {
+        using sam_fields = seqan3::fields<seqan3::field::header_ptr,
+                                          seqan3::field::id,
+                                          seqan3::field::flag,
+                                          seqan3::field::ref_id,
+                                          seqan3::field::ref_offset,
+                                          seqan3::field::mapq,
+                                          seqan3::field::cigar,
+                                          seqan3::field::offset,
+                                          seqan3::field::mate,
+                                          seqan3::field::seq,
+                                          seqan3::field::qual,
+                                          seqan3::field::tags>;
+
+        std::istringstream sam_stream{sam_input};
+        std::ostringstream bam_stream{};
+
+        {
+            seqan3::sam_file_input fin{sam_stream, seqan3::format_sam{}, sam_fields{}};
+            seqan3::sam_file_output fout{bam_stream, seqan3::format_bam{}, sam_fields{}};
+
+            for (auto & record : fin)
+                fout.push_back(record);
+        }
+
+        return bam_stream.str();
+    }
+
+    template <typename file_t>
+    void check_cheap_fields(file_t & fin)
+    {
+        EXPECT_EQ(fin.header().ref_ids().size(), 2u);
+
+        auto it = fin.begin();
+        EXPECT_EQ((*it).id(), "read1");
+        EXPECT_EQ((*it).flag(), seqan3::sam_flag{41u});
+        EXPECT_EQ((*it).mapping_quality(), 61u);
+        EXPECT_EQ((*it).reference_id(), 0);
+        EXPECT_EQ((*it).reference_position(), 0);
+        EXPECT_EQ((*it).mate_reference_id(), 0);
+        EXPECT_EQ((*it).mate_position(), 9);
+        EXPECT_EQ((*it).template_length(), 300);
+        EXPECT_EQ((*it).header_ptr(), &fin.header());
+
+        ++it;
+        EXPECT_EQ((*it).id(), "read2");
+        EXPECT_EQ((*it).flag(), seqan3::sam_flag{42u});
+        EXPECT_EQ((*it).reference_id(), 1);
+        EXPECT_EQ((*it).reference_position(), 1);
+        EXPECT_EQ((*it).mate_reference_id(), 1); // '=' refers to RNAME
+        EXPECT_EQ((*it).template_length(), -300);
+
+        ++it;
+        EXPECT_TRUE((*it).id().empty());
+        EXPECT_TRUE(static_cast<bool>((*it).flag() & seqan3::sam_flag::unmapped));
+        EXPECT_EQ((*it).reference_id(), std::nullopt);
+        EXPECT_EQ((*it).reference_position(), std::nullopt);
+        EXPECT_EQ((*it).mate_reference_id(), std::nullopt);
+        EXPECT_EQ((*it).mate_position(), std::nullopt);
+
+        ++it;
+        EXPECT_TRUE(it == fin.end());
+    }
+
+    template <typename file_t>
+    void check_decoded_fields(file_t & fin)
+    {
+        auto it = fin.begin();
+        EXPECT_RANGE_EQ((*it).sequence(), "ACGT"_dna5);
+        EXPECT_RANGE_EQ((*it).base_qualities(), "!##$"_phred42);
+        EXPECT_EQ((*it).sequence_position(), 1);
+        EXPECT_RANGE_EQ((*it).cigar_sequence(), (std::vector<seqan3::cigar>{{1, 'S'_cigar_operation},
+                                                                          {1, 'M'_cigar_operation},
+                                                                          {1, 'D'_cigar_operation},
+                                                                          {2, 'M'_cigar_operation}}));
+        EXPECT_EQ(std::get<int32_t>((*it).tags().at("AS"_tag)), 2);
+
+        // The decoded fields are cached until the file moves on.
+        EXPECT_EQ(&(*it).sequence(), &(*it).sequence());
+        EXPECT_EQ(&(*it).tags(), &(*it).tags());
+
+        ++it;
+        auto tags = (*it).tags();
+        EXPECT_EQ(std::get<std::vector<uint16_t>>(tags["xy"_tag]), (std::vector<uint16_t>{3, 4, 5}));
+
+        auto record = *it; // copies stay valid when the file moves on
+        ++it;
+        EXPECT_RANGE_EQ((*it).sequence(), "GGAGTATA"_dna5);
+        EXPECT_RANGE_EQ(record.sequence(), "AGGCTGNAG"_dna5);
+        EXPECT_EQ(record.id(), "read2");
+    }
+};
+
+TEST_F(sam_file_lazy_input_f, sam_cheap_fields)
+{
+    std::istringstream stream{sam_input};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_sam{}};
+    check_cheap_fields(fin);
+}
+
+TEST_F(sam_file_lazy_input_f, sam_decoded_fields)
+{
+    std::istringstream stream{sam_input};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_sam{}};
+    check_decoded_fields(fin);
+}
+
+TEST_F(sam_file_lazy_input_f, bam_cheap_fields)
+{
+    std::istringstream stream{bam_input()};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_bam{}};
+
+    int32_t block_size{};
+    std::memcpy(&block_size, fin.front().raw_record().data(), sizeof(block_size));
+    EXPECT_EQ(fin.front().raw_record().size(), sizeof(block_size) + block_size);
+
+    check_cheap_fields(fin);
+}
+
+TEST_F(sam_file_lazy_input_f, bam_decoded_fields)
+{
+    std::istringstream stream{bam_input()};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_bam{}};
+    check_decoded_fields(fin);
+}
+
+TEST_F(sam_file_lazy_input_f, filter)
+{
+    std::istringstream stream{sam_input};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_sam{}};
+
+    std::vector<seqan3::dna5_vector> sequences{};
+    for (auto & record : fin | std::views::filter([] (auto const & r) { return r.mapping_quality() > 61u; }))
+        sequences.push_back(record.sequence());
+
+    ASSERT_EQ(sequences.size(), 1u);
+    EXPECT_RANGE_EQ(sequences[0], "AGGCTGNAG"_dna5);
+}
+
+TEST_F(sam_file_lazy_input_f, read_ahead)
+{
+    std::istringstream sam_stream{sam_input};
+    seqan3::sam_file_lazy_input sam_fin{sam_stream, seqan3::format_sam{}};
+    sam_fin.options.read_ahead_buffer_count = 2u;
+    sam_fin.options.read_ahead_buffer_size = 5u; // the header was read on construction
+    check_decoded_fields(sam_fin);
+
+    std::istringstream bam_stream{bam_input()};
+    seqan3::sam_file_lazy_input bam_fin{bam_stream, seqan3::format_bam{}};
+    bam_fin.options.read_ahead_buffer_count = 2u;
+    bam_fin.options.read_ahead_buffer_size = 5u;
+    check_cheap_fields(bam_fin);
+}
+
+TEST_F(sam_file_lazy_input_f, header_only)
+{
+    std::istringstream stream{"@HD\tVN:1.6\n@SQ\tSN:ref\tLN:34\n"};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_sam{}};
+
+    EXPECT_EQ(fin.header().ref_ids().size(), 1u);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(sam_file_lazy_input_f, unknown_reference)
+{
+    std::istringstream stream{"@SQ\tSN:ref\tLN:34\nread1\t0\tunknown\t1\t61\t4M\t*\t0\t0\tACGT\t*\n"};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_sam{}};
+
+    EXPECT_THROW((*fin.begin()).reference_id(), seqan3::format_error);
+}
+
+TEST_F(sam_file_lazy_input_f, no_bam)
+{
+    std::istringstream stream{sam_input};
+    EXPECT_THROW((seqan3::sam_file_lazy_input{stream, seqan3::format_bam{}}), seqan3::format_error);
+}
+
+TEST_F(sam_file_lazy_input_f, truncated_bam)
+{
+    std::string bam = bam_input();
+    bam.resize(bam.size() - 5);
+    std::istringstream stream{bam};
+    seqan3::sam_file_lazy_input fin{stream, seqan3::format_bam{}};
+
+    auto it = fin.begin();
+    ++it;
+    EXPECT_THROW(++it, seqan3::unexpected_end_of_input);
+}
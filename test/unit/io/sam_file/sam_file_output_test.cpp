@@ -10,9 +10,13 @@
 #include <seqan3/std/iterator>
 #include <sstream>
 
+#include <seqan3/core/debug_stream.hpp>
 #include <seqan3/io/sam_file/input.hpp>
 #include <seqan3/io/sam_file/output.hpp>
 #include <seqan3/test/tmp_filename.hpp>
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/test/bgzf_output.hpp>
+#endif
 
 using seqan3::operator""_dna4;
 using seqan3::operator""_dna5;
@@ -574,6 +578,118 @@ TEST(rows, convert_sam_to_blast)
     // TODO when blast format is implemented
 }
 
+// ----------------------------------------------------------------------------
+// parallel encoding
+// ----------------------------------------------------------------------------
+
+using parallel_fields = seqan3::fields<seqan3::field::seq,
+                                       seqan3::field::id,
+                                       seqan3::field::ref_id,
+                                       seqan3::field::ref_offset,
+                                       seqan3::field::mapq>;
+using parallel_record = seqan3::record<seqan3::type_list<seqan3::dna5_vector,
+                                                         std::string,
+                                                         std::string,
+                                                         std::optional<int32_t>,
+                                                         uint8_t>,
+                                       parallel_fields>;
+
+std::vector<parallel_record> parallel_records(size_t const count)
+{
+    std::vector<parallel_record> records{};
+
+    for (size_t i = 0; i < count; ++i)
+        records.emplace_back(seqs[i % 3], "read" + std::to_string(i), (i % 2) ? "ref1" : "ref2",
+                             static_cast<int32_t>(i), static_cast<uint8_t>(i % 60));
+
+    return records;
+}
+
+template <typename format_t, typename range_t>
+std::string parallel_write(format_t const & format, range_t const & range, size_t const thread_count)
+{
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<size_t> const ref_lengths{100000, 200000};
+    std::ostringstream stream{};
+
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, format, parallel_fields{}};
+        fout.options.thread_count = thread_count;
+        fout = range;
+    }
+
+    return stream.str();
+}
+
+TEST(parallel_encoding, sam)
+{
+    auto const records = parallel_records(20000);
+    std::string const sequential = parallel_write(seqan3::format_sam{}, records, 1u);
+
+    EXPECT_EQ(parallel_write(seqan3::format_sam{}, records, 4u), sequential);
+    EXPECT_EQ(parallel_write(seqan3::format_sam{}, records, 7u), sequential);
+}
+
+TEST(parallel_encoding, bam)
+{
+    auto const records = parallel_records(20000);
+    std::string const sequential = parallel_write(seqan3::format_bam{}, records, 1u);
+
+    EXPECT_EQ(parallel_write(seqan3::format_bam{}, records, 4u), sequential);
+}
+
+TEST(parallel_encoding, more_chunks_than_slots)
+{
+    // More chunks than can be encoded ahead of the writer; the threads are reused for the second range.
+    auto const records = parallel_records(60000);
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<size_t> const ref_lengths{100000, 200000};
+
+    auto write_twice = [&] (size_t const thread_count)
+    {
+        std::ostringstream stream{};
+
+        {
+            seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_sam{}, parallel_fields{}};
+            fout.options.thread_count = thread_count;
+            fout = records;
+            fout = records;
+        }
+
+        return stream.str();
+    };
+
+    EXPECT_EQ(write_twice(2u), write_twice(1u));
+}
+
+TEST(parallel_encoding, less_records_than_threads)
+{
+    auto const records = parallel_records(3);
+
+    EXPECT_EQ(parallel_write(seqan3::format_sam{}, records, 8u), parallel_write(seqan3::format_sam{}, records, 1u));
+    EXPECT_EQ(parallel_write(seqan3::format_sam{}, std::vector<parallel_record>{}, 8u),
+              parallel_write(seqan3::format_sam{}, std::vector<parallel_record>{}, 1u));
+}
+
+TEST(parallel_encoding, error)
+{
+    auto records = parallel_records(20000);
+    get<seqan3::field::ref_id>(records[12345]) = "unknown_ref";
+
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<size_t> const ref_lengths{100000, 200000};
+    std::ostringstream stream{};
+    seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_sam{}, parallel_fields{}};
+    fout.options.thread_count = 4u;
+
+    EXPECT_THROW(fout = records, seqan3::format_error);
+
+    // all records before the invalid one are written
+    records.resize(12345);
+    fout.get_stream().flush();
+    EXPECT_EQ(stream.str(), parallel_write(seqan3::format_sam{}, records, 1u));
+}
+
 // ----------------------------------------------------------------------------
 // compression
 // ----------------------------------------------------------------------------
@@ -650,7 +766,7 @@ TEST(compression, by_filename_gz)
 
     std::string buffer = compression_by_filename_impl(filename);
     buffer[9] = '\x00'; // zero out OS byte.
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(seqan3::test::comparable_bgzf(buffer), seqan3::test::comparable_bgzf(expected_bgzf));
 }
 
 TEST(compression, by_stream_gz)
@@ -672,7 +788,7 @@ TEST(compression, by_filename_bgzf)
 
     std::string buffer = compression_by_filename_impl(filename);
     buffer[9] = '\x00'; // zero out OS byte.
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(seqan3::test::comparable_bgzf(buffer), seqan3::test::comparable_bgzf(expected_bgzf));
 }
 
 TEST(compression, by_stream_bgzf)
@@ -685,7 +801,7 @@ TEST(compression, by_stream_bgzf)
     }
     std::string buffer = out.str();
     buffer[9] = '\x00'; // zero out OS byte.
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(seqan3::test::comparable_bgzf(buffer), seqan3::test::comparable_bgzf(expected_bgzf));
 }
 #endif
 
@@ -721,3 +837,21 @@ TEST(compression, by_stream_bz2)
     EXPECT_EQ(out.str(), expected_bz2);
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+// The compressed bytes depend on the version of libzstd, hence the file is compared after decompression.
+TEST(compression, by_filename_zst)
+{
+    seqan3::test::tmp_filename filename{"sam_file_output_test.sam.zst"};
+    seqan3::test::tmp_filename plain_filename{"sam_file_output_test.sam"};
+
+    std::string const buffer = compression_by_filename_impl(filename);
+    std::string const plain = compression_by_filename_impl(plain_filename);
+
+    EXPECT_EQ(buffer.substr(0, 4), (std::string{'\x28', '\xB5', '\x2F', '\xFD'}));
+
+    std::istringstream primary{buffer};
+    seqan3::contrib::zstd_istream decompressed{primary};
+    EXPECT_EQ((std::string{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}}), plain);
+}
+#endif
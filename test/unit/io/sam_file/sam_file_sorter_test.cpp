@@ -0,0 +1,231 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <random>
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/sorter.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#if SEQAN3_HAS_ZLIB
+
+using seqan3::operator""_dna5;
+
+using sorter_fields = seqan3::fields<seqan3::field::seq,
+                                     seqan3::field::id,
+                                     seqan3::field::ref_id,
+                                     seqan3::field::ref_offset,
+                                     seqan3::field::mapq>;
+
+struct sorter_record
+{
+    std::optional<int32_t> ref_id;
+    std::optional<int32_t> ref_offset;
+    std::string id;
+};
+
+struct sam_file_sorter_f : public ::testing::Test
+{
+    std::vector<std::string> ref_ids{"ref1", "ref2", "ref3"};
+    std::vector<size_t> ref_lengths{100000, 200000, 300000};
+
+    //!\brief Random records with duplicate positions and unmapped records.
+    std::vector<sorter_record> random_records(size_t const count)
+    {
+        std::mt19937 rng{42};
+        std::vector<sorter_record> records{};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            sorter_record record{std::nullopt, std::nullopt, "read" + std::to_string(i)};
+
+            if (rng() % 10 != 0u)
+            {
+                record.ref_id = static_cast<int32_t>(rng() % 3);
+                record.ref_offset = static_cast<int32_t>(rng() % 1000);
+            }
+
+            records.push_back(record);
+        }
+
+        return records;
+    }
+
+    //!\brief Adds the records to the sorter.
+    template <typename sorter_t>
+    void push(sorter_t & sorter, std::vector<sorter_record> const & records)
+    {
+        for (auto const & record : records)
+            sorter.emplace_back("ACGT"_dna5, record.id, record.ref_id, record.ref_offset, uint8_t{60});
+    }
+
+    //!\brief Returns the ids in the expected order, i.e. stable sorted by reference id and position.
+    std::vector<std::string> expected_ids(std::vector<sorter_record> records)
+    {
+        auto key = [] (sorter_record const & r)
+        {
+            return std::pair{static_cast<uint32_t>(r.ref_id.value_or(-1)), r.ref_offset.value_or(-1)};
+        };
+
+        std::ranges::stable_sort(records, std::less<>{}, key);
+
+        std::vector<std::string> ids{};
+        for (auto const & record : records)
+            ids.push_back(record.id);
+
+        return ids;
+    }
+
+    //!\brief Reads the ids of the written file and checks the header.
+    std::vector<std::string> written_ids(std::filesystem::path const & path)
+    {
+        seqan3::sam_file_input fin{path, seqan3::fields<seqan3::field::id, seqan3::field::header_ptr>{}};
+
+        std::vector<std::string> ids{};
+        for (auto & record : fin)
+            ids.push_back(record.id());
+
+        EXPECT_EQ(fin.header().sorting, "coordinate");
+        EXPECT_EQ(fin.header().ref_ids().size(), 3u);
+        return ids;
+    }
+};
+
+TEST_F(sam_file_sorter_f, in_memory)
+{
+    seqan3::test::tmp_filename filename{"sorted.bam"};
+    auto const records = random_records(5000);
+
+    {
+        seqan3::sam_file_sorter sorter{filename.get_path(), ref_ids, ref_lengths, sorter_fields{}};
+        sorter.options.tmp_directory = filename.get_path().parent_path();
+        push(sorter, records);
+        sorter.finish();
+    }
+
+    EXPECT_EQ(written_ids(filename.get_path()), expected_ids(records));
+    EXPECT_EQ(std::ranges::distance(std::filesystem::directory_iterator{filename.get_path().parent_path()}), 1);
+}
+
+TEST_F(sam_file_sorter_f, spill)
+{
+    seqan3::test::tmp_filename filename{"sorted.bam"};
+    auto const records = random_records(20000);
+
+    {
+        seqan3::sam_file_sorter sorter{filename.get_path(), ref_ids, ref_lengths, sorter_fields{}};
+        sorter.options.memory_limit = 50000; // about 20 runs
+        sorter.options.thread_count = 4;
+        sorter.options.tmp_directory = filename.get_path().parent_path();
+        push(sorter, records);
+
+        // the runs are written to a temporary directory next to the output file
+        EXPECT_EQ(std::ranges::distance(std::filesystem::directory_iterator{filename.get_path().parent_path()}), 2);
+    } // the destructor finishes the file
+
+    EXPECT_EQ(written_ids(filename.get_path()), expected_ids(records));
+    EXPECT_EQ(std::ranges::distance(std::filesystem::directory_iterator{filename.get_path().parent_path()}), 1);
+}
+
+TEST_F(sam_file_sorter_f, multi_pass_merge)
+{
+    seqan3::test::tmp_filename filename{"sorted.bam"};
+    auto const records = random_records(20000);
+
+    for (size_t fan_in : {2u, 3u, 7u})
+    {
+        {
+            seqan3::sam_file_sorter sorter{filename.get_path(), ref_ids, ref_lengths, sorter_fields{}};
+            sorter.options.memory_limit = 50000; // about 20 runs
+            sorter.options.merge_fan_in = fan_in;
+            sorter.options.tmp_directory = filename.get_path().parent_path();
+            push(sorter, records);
+            sorter.finish();
+        }
+
+        EXPECT_EQ(written_ids(filename.get_path()), expected_ids(records));
+        EXPECT_EQ(std::ranges::distance(std::filesystem::directory_iterator{filename.get_path().parent_path()}), 1);
+    }
+}
+
+TEST_F(sam_file_sorter_f, parallel_sort)
+{
+    seqan3::test::tmp_filename filename{"sorted.bam"};
+    auto const records = random_records(30000);
+
+    for (size_t thread_count : {2u, 3u, 8u})
+    {
+        {
+            seqan3::sam_file_sorter sorter{filename.get_path(), ref_ids, ref_lengths, sorter_fields{}};
+            sorter.options.thread_count = thread_count;
+            push(sorter, records);
+        }
+
+        EXPECT_EQ(written_ids(filename.get_path()), expected_ids(records));
+    }
+}
+
+TEST_F(sam_file_sorter_f, header_of_record)
+{
+    seqan3::test::tmp_filename filename{"sorted.bam"};
+    std::string const input{"@HD\tVN:1.6\tSO:unsorted\n@SQ\tSN:ref1\tLN:100\n"
+                            "read1\t0\tref1\t20\t60\t4M\t*\t0\t0\tACGT\t*\n"
+                            "read2\t4\t*\t0\t0\t*\t*\t0\t0\tACGT\t*\n"
+                            "read3\t0\tref1\t10\t60\t4M\t*\t0\t0\tACGT\t*\n"};
+
+    seqan3::sam_file_input fin{std::istringstream{input}, seqan3::format_sam{}};
+
+    {
+        std::vector<std::string> no_ids{};
+        seqan3::sam_file_sorter sorter{filename.get_path(), no_ids, std::vector<size_t>{}};
+        sorter = fin;
+    }
+
+    EXPECT_EQ(fin.header().sorting, "unsorted"); // only changed while writing the header
+
+    seqan3::sam_file_input written{filename.get_path()};
+    std::vector<std::string> ids{};
+    for (auto & record : written)
+        ids.push_back(record.id());
+
+    EXPECT_EQ(written.header().sorting, "coordinate");
+    EXPECT_EQ(ids, (std::vector<std::string>{"read3", "read1", "read2"}));
+}
+
+TEST_F(sam_file_sorter_f, failed_finish)
+{
+    seqan3::test::tmp_filename filename{"sorted.bam"};
+    std::filesystem::path const directory = filename.get_path().parent_path();
+
+    seqan3::sam_file_sorter sorter{filename.get_path(), ref_ids, ref_lengths, sorter_fields{}};
+    sorter.options.memory_limit = 50000;
+    sorter.options.tmp_directory = directory;
+    push(sorter, random_records(5000));
+
+    // remove a run, such that it cannot be merged
+    for (auto const & entry : std::filesystem::directory_iterator{directory})
+        if (entry.is_directory())
+            std::filesystem::remove(entry.path() / "run_0.bgzf");
+
+    EXPECT_THROW(sorter.finish(), seqan3::io_error);
+    EXPECT_FALSE(std::filesystem::exists(filename.get_path())); // the incomplete file is removed
+    EXPECT_TRUE(std::filesystem::is_empty(directory)); // and the runs as well
+    EXPECT_NO_THROW(sorter.finish());
+}
+
+TEST_F(sam_file_sorter_f, no_bam)
+{
+    seqan3::test::tmp_filename filename{"sorted.sam"};
+    EXPECT_THROW((seqan3::sam_file_sorter{filename.get_path(), ref_ids, ref_lengths}), seqan3::file_open_error);
+}
+
+#endif // SEQAN3_HAS_ZLIB
@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <seqan3/io/sequence_file/fasta_index.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+static std::string const fasta_file
+{
+    ">chr1 first chromosome\n"
+    "ACGTACGTAC\n"
+    "GTACGTACGT\n"
+    "ACG\n"
+    ">chr2\n"
+    "TTTT\n"
+    ">empty\n"
+    ">chr3\tthird\n"
+    "GGGGGG\n"
+    "CC\n"
+    "\n"
+};
+
+static std::string const fai_file
+{
+    "chr1\t23\t23\t10\t11\n"
+    "chr2\t4\t55\t4\t5\n"
+    "empty\t0\t67\t0\t0\n"
+    "chr3\t8\t79\t6\t7\n"
+};
+
+TEST(fasta_index, build)
+{
+    std::istringstream stream{fasta_file};
+    seqan3::fasta_index const index = seqan3::fasta_index::build(stream);
+
+    ASSERT_EQ(index.size(), 4u);
+    EXPECT_EQ(index[0], (seqan3::fasta_index_entry{"chr1", 23, 23, 10, 11}));
+    EXPECT_EQ(index[1], (seqan3::fasta_index_entry{"chr2", 4, 55, 4, 5}));
+    EXPECT_EQ(index[2], (seqan3::fasta_index_entry{"empty", 0, 67, 0, 0}));
+    EXPECT_EQ(index[3], (seqan3::fasta_index_entry{"chr3", 8, 79, 6, 7}));
+
+    EXPECT_EQ(index.position_of("chr2"), 1u);
+    EXPECT_EQ(index.position_of("chr3"), 3u);
+    EXPECT_THROW(index.position_of("chr1 first chromosome"), std::out_of_range);
+    EXPECT_THROW(index[4], std::out_of_range);
+}
+
+TEST(fasta_index, offset_of)
+{
+    std::istringstream stream{fasta_file};
+    seqan3::fasta_index const index = seqan3::fasta_index::build(stream);
+
+    for (seqan3::fasta_index_entry const & entry : index.entries())
+    {
+        std::string sequence{};
+        for (uint64_t position = 0; position < entry.length; ++position)
+            sequence.push_back(fasta_file[entry.offset_of(position)]);
+
+        EXPECT_EQ(sequence.size(), entry.length);
+        EXPECT_EQ(sequence.find_first_of("\n>"), std::string::npos);
+    }
+
+    EXPECT_EQ(fasta_file.substr(index[0].offset_of(10), 3), "GTA");
+    EXPECT_EQ(fasta_file.substr(index[0].offset_of(20), 3), "ACG");
+}
+
+TEST(fasta_index, build_carriage_return_and_missing_line_break)
+{
+    std::istringstream stream{">a\r\nACGT\r\nAC\r\n>b\nAAA\nAA"};
+    seqan3::fasta_index const index = seqan3::fasta_index::build(stream);
+
+    ASSERT_EQ(index.size(), 2u);
+    EXPECT_EQ(index[0], (seqan3::fasta_index_entry{"a", 6, 4, 4, 6}));
+    EXPECT_EQ(index[1], (seqan3::fasta_index_entry{"b", 5, 17, 3, 4}));
+
+    std::istringstream single_line{">a\nACGT"};
+    EXPECT_EQ(seqan3::fasta_index::build(single_line)[0], (seqan3::fasta_index_entry{"a", 4, 3, 4, 5}));
+}
+
+TEST(fasta_index, build_errors)
+{
+    std::istringstream longer_line{">a\nACG\nACGT\n"};
+    EXPECT_THROW(seqan3::fasta_index::build(longer_line), seqan3::parse_error);
+
+    std::istringstream line_after_short_line{">a\nACGT\nAC\nAC\n"};
+    EXPECT_THROW(seqan3::fasta_index::build(line_after_short_line), seqan3::parse_error);
+
+    std::istringstream line_after_empty_line{">a\nACGT\n\nACGT\n"};
+    EXPECT_THROW(seqan3::fasta_index::build(line_after_empty_line), seqan3::parse_error);
+
+    std::istringstream mixed_line_breaks{">a\nACGT\r\nACGT\n"};
+    EXPECT_THROW(seqan3::fasta_index::build(mixed_line_breaks), seqan3::parse_error);
+
+    std::istringstream duplicate_id{">a\nACGT\n>a\nACGT\n"};
+    EXPECT_THROW(seqan3::fasta_index::build(duplicate_id), seqan3::parse_error);
+
+    std::istringstream no_header{"ACGT\n>a\nACGT\n"};
+    EXPECT_THROW(seqan3::fasta_index::build(no_header), seqan3::parse_error);
+}
+
+TEST(fasta_index, read_write)
+{
+    std::istringstream fasta_stream{fasta_file};
+    seqan3::fasta_index const index = seqan3::fasta_index::build(fasta_stream);
+
+    std::ostringstream fai_stream{};
+    index.write(fai_stream);
+    EXPECT_EQ(fai_stream.str(), fai_file);
+
+    std::istringstream read_stream{fai_file};
+    seqan3::fasta_index const read_index = seqan3::fasta_index::read(read_stream);
+    EXPECT_EQ(read_index, index);
+    EXPECT_EQ(read_index.position_of("chr3"), 3u);
+}
+
+TEST(fasta_index, read_errors)
+{
+    std::istringstream too_few_fields{"chr1\t23\t23\t10\n"};
+    EXPECT_THROW(seqan3::fasta_index::read(too_few_fields), seqan3::parse_error);
+
+    std::istringstream too_many_fields{"chr1\t23\t23\t10\t11\t40\n"};
+    EXPECT_THROW(seqan3::fasta_index::read(too_many_fields), seqan3::parse_error);
+
+    std::istringstream invalid_number{"chr1\t23\t2x\t10\t11\n"};
+    EXPECT_THROW(seqan3::fasta_index::read(invalid_number), seqan3::parse_error);
+
+    std::istringstream invalid_line_width{"chr1\t23\t23\t10\t9\n"};
+    EXPECT_THROW(seqan3::fasta_index::read(invalid_line_width), seqan3::parse_error);
+
+    std::istringstream duplicate_id{"chr1\t23\t23\t10\t11\nchr1\t23\t23\t10\t11\n"};
+    EXPECT_THROW(seqan3::fasta_index::read(duplicate_id), seqan3::parse_error);
+}
+
+TEST(fasta_index, files)
+{
+    seqan3::test::tmp_filename fasta_filename{"fasta_index_test.fasta"};
+    seqan3::test::tmp_filename fai_filename{"fasta_index_test.fasta.fai"};
+
+    {
+        std::ofstream fasta_stream{fasta_filename.get_path(), std::ios::binary};
+        fasta_stream << fasta_file;
+    }
+
+    seqan3::fasta_index const index = seqan3::fasta_index::build(fasta_filename.get_path());
+    index.write(fai_filename.get_path());
+
+    {
+        std::ifstream fai_stream{fai_filename.get_path()};
+        std::string const content{std::istreambuf_iterator<char>{fai_stream}, std::istreambuf_iterator<char>{}};
+        EXPECT_EQ(content, fai_file);
+    }
+
+    EXPECT_EQ(seqan3::fasta_index::read(fai_filename.get_path()), index);
+    EXPECT_THROW(seqan3::fasta_index::build(fasta_filename.get_path().string() + ".missing"),
+                 seqan3::file_open_error);
+}
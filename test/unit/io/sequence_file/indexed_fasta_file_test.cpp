@@ -0,0 +1,212 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/indexed_fasta_file.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+    #include <seqan3/contrib/stream/gz_ostream.hpp>
+#endif
+
+struct indexed_fasta_file_test : public ::testing::Test
+{
+    //!\brief Random sequences with different lengths.
+    std::vector<std::string> sequences = []()
+    {
+        std::mt19937_64 engine{42};
+        std::vector<std::string> result{};
+
+        for (size_t length : {0u, 1u, 59u, 60u, 61u, 1000u, 150'000u})
+        {
+            std::string sequence(length, 'A');
+            for (char & c : sequence)
+                c = "ACGTN"[engine() % 5];
+
+            result.push_back(std::move(sequence));
+        }
+
+        return result;
+    }();
+
+    //!\brief Formats the sequences as FASTA with 60 letters per line.
+    std::string fasta_content(std::string const & line_break = "\n") const
+    {
+        std::string content{};
+
+        for (size_t i = 0; i < sequences.size(); ++i)
+        {
+            content += ">seq" + std::to_string(i) + " description" + line_break;
+            for (size_t position = 0; position < sequences[i].size(); position += 60)
+                content += sequences[i].substr(position, 60) + line_break;
+        }
+
+        return content;
+    }
+
+    //!\brief Converts the characters to seqan3::dna5.
+    static seqan3::dna5_vector to_dna5(std::string_view const chars)
+    {
+        seqan3::dna5_vector result(chars.size());
+        for (size_t i = 0; i < chars.size(); ++i)
+            seqan3::assign_char_to(chars[i], result[i]);
+
+        return result;
+    }
+
+    //!\brief Compares all intervals with the given step size.
+    void check_intervals(seqan3::indexed_fasta_file<> & file)
+    {
+        ASSERT_EQ(file.index().size(), sequences.size());
+
+        for (size_t i = 0; i < sequences.size(); ++i)
+        {
+            size_t const length = sequences[i].size();
+            size_t const step = std::max<size_t>(1u, length / 23u);
+
+            for (size_t begin = 0; begin <= length; begin += step)
+                for (size_t end = begin; end <= length; end += step)
+                    EXPECT_EQ(file.fetch(i, begin, end), to_dna5(std::string_view{sequences[i]}.substr(begin,
+                                                                                                         end - begin)));
+
+            EXPECT_EQ(file.fetch("seq" + std::to_string(i), 0, length), to_dna5(sequences[i]));
+        }
+    }
+};
+
+TEST_F(indexed_fasta_file_test, fetch)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << fasta_content();
+    }
+
+    seqan3::indexed_fasta_file file{filename.get_path()};
+    check_intervals(file);
+}
+
+TEST_F(indexed_fasta_file_test, fetch_carriage_return)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << fasta_content("\r\n");
+    }
+
+    seqan3::indexed_fasta_file file{filename.get_path()};
+    check_intervals(file);
+}
+
+TEST_F(indexed_fasta_file_test, fetch_reuse_and_alphabet)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << ">chr1\nACGTAC\nGTTT\n>chr2\nNNAC\n";
+    }
+
+    seqan3::indexed_fasta_file<seqan3::dna4> file{filename.get_path()};
+    std::vector<seqan3::dna4> sequence{};
+
+    using seqan3::operator""_dna4;
+    file.fetch(sequence, 0, 4, 8);
+    EXPECT_EQ(sequence, "ACGT"_dna4);
+    file.fetch(sequence, 1, 0, 3);
+    EXPECT_EQ(sequence, "AAA"_dna4); // N is converted to A in dna4.
+    file.fetch(sequence, 1, 2, 2);
+    EXPECT_TRUE(sequence.empty());
+}
+
+TEST_F(indexed_fasta_file_test, existing_index)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta"};
+    std::filesystem::path const fai_path{filename.get_path().string() + ".fai"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << ">chr1\nACGTAC\nGTTT\n>chr2\nNNAC\n";
+    }
+
+    // The existing index is used instead of building a new one.
+    {
+        std::ofstream stream{fai_path};
+        stream << "other\t4\t24\t4\t5\n";
+    }
+
+    using seqan3::operator""_dna5;
+    seqan3::indexed_fasta_file file{filename.get_path()};
+    ASSERT_EQ(file.index().size(), 1u);
+    EXPECT_EQ(file.fetch("other", 1, 4), "NAC"_dna5);
+
+    seqan3::indexed_fasta_file file_with_index{filename.get_path(), seqan3::fasta_index::read(fai_path)};
+    EXPECT_EQ(file_with_index.fetch(0, 0, 2), "NN"_dna5);
+}
+
+TEST_F(indexed_fasta_file_test, errors)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta"};
+
+    EXPECT_THROW(seqan3::indexed_fasta_file{filename.get_path()}, seqan3::file_open_error);
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << ">chr1\nACGTAC\nGTTT\n";
+    }
+
+    seqan3::indexed_fasta_file file{filename.get_path()};
+    EXPECT_THROW(file.fetch("chr2", 0, 1), std::out_of_range);
+    EXPECT_THROW(file.fetch(1, 0, 1), std::out_of_range);
+    EXPECT_THROW(file.fetch(0, 0, 11), std::out_of_range);
+    EXPECT_THROW(file.fetch(0, 5, 4), std::out_of_range);
+
+    // The index does not match the file.
+    std::istringstream fai_stream{"chr1\t100\t6\t6\t7\n"};
+    seqan3::indexed_fasta_file truncated_file{filename.get_path(), seqan3::fasta_index::read(fai_stream)};
+    EXPECT_THROW(truncated_file.fetch(0, 90, 100), seqan3::unexpected_end_of_input);
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+TEST_F(indexed_fasta_file_test, fetch_bgzf)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta.gz"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        seqan3::contrib::bgzf_ostream bgzf_stream{stream};
+        bgzf_stream << fasta_content();
+    }
+
+    seqan3::indexed_fasta_file file{filename.get_path()};
+    check_intervals(file);
+}
+
+TEST_F(indexed_fasta_file_test, reject_gz)
+{
+    seqan3::test::tmp_filename filename{"indexed_fasta_file_test.fasta.gz"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        seqan3::contrib::gz_ostream gz_stream{stream};
+        gz_stream << fasta_content();
+    }
+
+    EXPECT_THROW(seqan3::indexed_fasta_file(filename.get_path(), seqan3::fasta_index{}), seqan3::file_open_error);
+}
+#endif
@@ -0,0 +1,263 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/detail/debug_stream_alphabet.hpp>
+#include <seqan3/io/sequence_file/paired_input.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#if SEQAN3_HAS_ZLIB
+#include <seqan3/contrib/stream/gz_ostream.hpp>
+#endif
+
+using seqan3::operator""_dna5;
+
+struct paired_sequence_file_input_f : public ::testing::Test
+{
+    // multi-line records and a quality line starting with '@'
+    std::string first_input{"@read1/1 comment\nACGT\n+\n!##$\n"
+                            "@read2/1\nAGG\nCTG\n+\n@@@\n@@@\n"
+                            "\n"
+                            "@read3/1\nGGAG\n+read3/1\n&&&&\n"};
+
+    std::string second_input{"@read1/2 other comment\nTTTT\n+\nIIII\n"
+                             "@read2/2\nCC\n+\n##\n"
+                             "@read3/2\nA\n+\n!"};
+
+    std::vector<std::string> first_ids{"read1/1 comment", "read2/1", "read3/1"};
+    std::vector<std::string> second_ids{"read1/2 other comment", "read2/2", "read3/2"};
+    std::vector<seqan3::dna5_vector> first_sequences{"ACGT"_dna5, "AGGCTG"_dna5, "GGAG"_dna5};
+    std::vector<seqan3::dna5_vector> second_sequences{"TTTT"_dna5, "CC"_dna5, "A"_dna5};
+
+    //!\brief Checks the pairs of all batches and the batch sizes.
+    template <typename file_t>
+    void check(file_t & fin, size_t const batch_size)
+    {
+        size_t counter = 0;
+        for (auto & batch : fin)
+        {
+            EXPECT_EQ(batch.size(), std::min(batch_size, 3u - counter));
+
+            for (auto & [first, second] : batch)
+            {
+                EXPECT_EQ(first.id(), first_ids[counter]);
+                EXPECT_EQ(second.id(), second_ids[counter]);
+                EXPECT_RANGE_EQ(first.sequence(), first_sequences[counter]);
+                EXPECT_RANGE_EQ(second.sequence(), second_sequences[counter]);
+                EXPECT_EQ(first.base_qualities().size(), first_sequences[counter].size());
+                ++counter;
+            }
+        }
+
+        EXPECT_EQ(counter, 3u);
+    }
+
+    //!\brief Returns the records of both inputs alternately.
+    std::string interleaved_input()
+    {
+        std::string result{};
+        size_t first_pos = 0;
+        size_t second_pos = 0;
+
+        for (size_t i = 1; i <= 3u; ++i)
+        {
+            std::string const next{"@read" + std::to_string(i + 1)};
+            size_t const first_end = std::min(first_input.find(next), first_input.size());
+            size_t const second_end = std::min(second_input.find(next), second_input.size());
+            result += first_input.substr(first_pos, first_end - first_pos);
+            result += second_input.substr(second_pos, second_end - second_pos) + '\n';
+            first_pos = first_end;
+            second_pos = second_end;
+        }
+
+        return result;
+    }
+};
+
+TEST_F(paired_sequence_file_input_f, concepts)
+{
+    using file_t = seqan3::paired_sequence_file_input<>;
+    EXPECT_TRUE((std::ranges::input_range<file_t>));
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<file_t>, file_t::batch_type>));
+    EXPECT_TRUE((std::same_as<file_t::record_type, typename seqan3::sequence_file_input<>::record_type>));
+}
+
+TEST_F(paired_sequence_file_input_f, two_streams)
+{
+    for (size_t batch_size : {1u, 2u, 10u})
+    {
+        for (size_t thread_count : {1u, 2u, 4u})
+        {
+            std::istringstream first_stream{first_input};
+            std::istringstream second_stream{second_input};
+            seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+            fin.options.batch_size = batch_size;
+            fin.options.thread_count = thread_count;
+
+            check(fin, batch_size);
+        }
+    }
+}
+
+TEST_F(paired_sequence_file_input_f, interleaved_stream)
+{
+    std::istringstream stream{interleaved_input()};
+    seqan3::paired_sequence_file_input fin{stream};
+    fin.options.batch_size = 2u;
+    fin.options.thread_count = 2u;
+
+    check(fin, 2u);
+}
+
+TEST_F(paired_sequence_file_input_f, two_files)
+{
+    seqan3::test::tmp_filename first_filename{"paired_R1.fastq"};
+    seqan3::test::tmp_filename second_filename{"paired_R2.fastq"};
+
+    {
+        std::ofstream{first_filename.get_path()} << first_input;
+        std::ofstream{second_filename.get_path()} << second_input;
+    }
+
+    seqan3::paired_sequence_file_input fin{first_filename.get_path(), second_filename.get_path()};
+    fin.options.read_ahead_buffer_count = 2u;
+    fin.options.read_ahead_buffer_size = 7u;
+
+    check(fin, fin.options.batch_size);
+}
+
+TEST_F(paired_sequence_file_input_f, custom_fields_and_fasta)
+{
+    std::istringstream first_stream{">read1/1\nACGT\nAC\n>read2/1\nGG\n"};
+    std::istringstream second_stream{">read1/2\nTT\n>read2/2\nCC\n"};
+    seqan3::paired_sequence_file_input<seqan3::sequence_file_input_default_traits_dna,
+                                       seqan3::fields<seqan3::field::seq>> fin{first_stream, second_stream};
+
+    auto & batch = fin.front();
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_RANGE_EQ(batch[0].first.sequence(), "ACGTAC"_dna5);
+    EXPECT_RANGE_EQ(batch[1].second.sequence(), "CC"_dna5);
+}
+
+TEST_F(paired_sequence_file_input_f, many_records)
+{
+    // more than a block of 4 MiB per file, such that records span blocks
+    std::string first{};
+    std::string second{};
+    std::string const sequence(150, 'A');
+    std::string const qualities(150, 'I');
+
+    for (size_t i = 0; i < 20000u; ++i)
+    {
+        first += "@r" + std::to_string(i) + "/1\n" + sequence + "\n+\n" + qualities + '\n';
+        second += "@r" + std::to_string(i) + "/2\n" + sequence + "\n+\n" + qualities + '\n';
+    }
+
+    std::istringstream first_stream{first};
+    std::istringstream second_stream{second};
+    seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+    fin.options.batch_size = 3000u;
+    fin.options.thread_count = 4u;
+
+    size_t counter = 0;
+    for (auto & batch : fin)
+    {
+        for (auto & [first_record, second_record] : batch)
+        {
+            EXPECT_EQ(first_record.id(), "r" + std::to_string(counter) + "/1");
+            EXPECT_EQ(second_record.sequence().size(), 150u);
+            ++counter;
+        }
+    }
+
+    EXPECT_EQ(counter, 20000u);
+}
+
+TEST_F(paired_sequence_file_input_f, read_name_mismatch)
+{
+    std::string const first{first_input.substr(0, first_input.find("\n\n@read3"))};
+    std::string const swapped{"@read2/2\nCC\n+\n##\n@read1/2\nTTTT\n+\nIIII\n"};
+
+    {
+        std::istringstream first_stream{first};
+        std::istringstream second_stream{swapped};
+        seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+        EXPECT_THROW(fin.begin(), seqan3::parse_error);
+    }
+
+    {
+        std::istringstream first_stream{first};
+        std::istringstream second_stream{swapped};
+        seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+        fin.options.check_read_names = false;
+        EXPECT_EQ(fin.front().size(), 2u);
+    }
+}
+
+TEST_F(paired_sequence_file_input_f, different_record_count)
+{
+    {
+        std::istringstream first_stream{first_input};
+        std::istringstream second_stream{second_input.substr(0, second_input.find("@read3"))};
+        seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+        EXPECT_THROW(fin.begin(), seqan3::unexpected_end_of_input);
+    }
+
+    {
+        std::istringstream stream{first_input};
+        seqan3::paired_sequence_file_input fin{stream};
+        fin.options.check_read_names = false;
+        EXPECT_THROW(fin.begin(), seqan3::unexpected_end_of_input); // three records are not interleaved pairs
+    }
+}
+
+TEST_F(paired_sequence_file_input_f, invalid_record)
+{
+    std::istringstream first_stream{first_input};
+    std::istringstream second_stream{"@read1/2\nTTTT\n+\nIIII\n@read2/2\nCX\n+\n##\n@read3/2\nA\n+\n!\n"};
+    seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+    fin.options.thread_count = 3u;
+
+    EXPECT_THROW(fin.begin(), seqan3::parse_error);
+}
+
+TEST_F(paired_sequence_file_input_f, empty)
+{
+    std::istringstream first_stream{};
+    std::istringstream second_stream{};
+    seqan3::paired_sequence_file_input fin{first_stream, second_stream};
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+#if SEQAN3_HAS_ZLIB
+TEST_F(paired_sequence_file_input_f, compressed_files)
+{
+    seqan3::test::tmp_filename first_filename{"paired_R1.fastq.gz"};
+    seqan3::test::tmp_filename second_filename{"paired_R2.fastq.gz"};
+
+    {
+        std::ofstream first_file{first_filename.get_path(), std::ios::binary};
+        seqan3::contrib::gz_ostream{first_file} << first_input;
+        std::ofstream second_file{second_filename.get_path(), std::ios::binary};
+        seqan3::contrib::gz_ostream{second_file} << second_input;
+    }
+
+    seqan3::paired_sequence_file_input fin{first_filename.get_path(), second_filename.get_path()};
+    fin.options.read_ahead_buffer_count = 2u; // decompressed concurrently
+    fin.options.batch_size = 2u;
+
+    check(fin, 2u);
+}
+#endif
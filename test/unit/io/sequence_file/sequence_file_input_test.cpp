@@ -15,6 +15,7 @@
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/core/detail/debug_stream_alphabet.hpp>
 #include <seqan3/range/views/convert.hpp>
+#include <seqan3/range/views/to_rank.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 
@@ -519,3 +520,136 @@ TEST_F(sequence_file_input_f, read_empty_bz2_file)
     EXPECT_TRUE(fin.begin() == fin.end());
 }
 #endif
+
+// ----------------------------------------------------------------------------
+// read-ahead
+// ----------------------------------------------------------------------------
+
+TEST_F(sequence_file_input_f, read_ahead_by_filename)
+{
+    seqan3::test::tmp_filename filename{"sequence_file_input_read_ahead.fasta"};
+
+    {
+        std::ofstream of{filename.get_path()};
+        of << input;
+    }
+
+    seqan3::sequence_file_input fin{filename.get_path()};
+    fin.options.read_ahead_buffer_count = 2;
+    fin.options.read_ahead_buffer_size = 5;
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, read_ahead_by_stream)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+    fin.options.read_ahead_buffer_count = 3;
+    fin.options.read_ahead_buffer_size = 1;
+
+    decompression_impl(*this, fin);
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+TEST_F(sequence_file_input_f, read_ahead_decompression_gz)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input_gz}, seqan3::format_fasta{}};
+    fin.options.read_ahead_buffer_count = 2;
+    fin.options.read_ahead_buffer_size = 16;
+
+    decompression_impl(*this, fin);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// batch reading
+// ----------------------------------------------------------------------------
+
+TEST_F(sequence_file_input_f, read_batch)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+    typename decltype(fin)::batch_type batch{};
+
+    EXPECT_EQ(fin.read_batch(batch, 2u), 2u);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch.sequences.size(), 2u);
+    EXPECT_EQ(batch.base_qualities.size(), 2u);
+    for (size_t i = 0; i < 2u; ++i)
+    {
+        EXPECT_RANGE_EQ(batch.ids[i], id_comp[i]);
+        EXPECT_RANGE_EQ(batch.sequences[i], seq_comp[i]);
+        EXPECT_TRUE(batch.base_qualities[i].empty()); // FASTA has no qualities
+    }
+
+    EXPECT_EQ(fin.read_batch(batch, 2u), 1u);
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_RANGE_EQ(batch.ids[0], id_comp[2]);
+    EXPECT_RANGE_EQ(batch.sequences[0], seq_comp[2]);
+
+    EXPECT_EQ(fin.read_batch(batch, 2u), 0u);
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(sequence_file_input_f, read_batch_reuses_memory)
+{
+    typename seqan3::sequence_file_input<>::batch_type batch{};
+
+    seqan3::sequence_file_input first_file{std::istringstream{input}, seqan3::format_fasta{}};
+    EXPECT_EQ(first_file.read_batch(batch, 3u), 3u);
+    auto const * const ids = batch.ids.raw_data().first.data();
+    auto const * const sequences = batch.sequences.raw_data().first.data();
+
+    seqan3::sequence_file_input second_file{std::istringstream{input}, seqan3::format_fasta{}};
+    EXPECT_EQ(second_file.read_batch(batch, 3u), 3u);
+    EXPECT_EQ(batch.ids.raw_data().first.data(), ids);
+    EXPECT_EQ(batch.sequences.raw_data().first.data(), sequences);
+    EXPECT_RANGE_EQ(batch.sequences[2], seq_comp[2]);
+}
+
+TEST_F(sequence_file_input_f, read_batch_mixed_with_iterator)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+    typename decltype(fin)::batch_type batch{};
+
+    auto it = fin.begin();
+    EXPECT_EQ((*it).id(), id_comp[0]);
+
+    EXPECT_EQ(fin.read_batch(batch, 1u), 1u);
+    EXPECT_RANGE_EQ(batch.ids[0], id_comp[0]); // the current record is the first of the batch
+
+    EXPECT_EQ((*fin.begin()).id(), id_comp[1]);
+    EXPECT_EQ(fin.read_batch(batch, 10u), 2u);
+    EXPECT_RANGE_EQ(batch.ids[1], id_comp[2]);
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(sequence_file_input_f, read_batch_custom_fields)
+{
+    std::string const fastq{"@ID1\nACGT\n+\n!#%'\n@ID2\nTT\n+\nII\n"};
+
+    {
+        seqan3::sequence_file_input fin{std::istringstream{fastq},
+                                        seqan3::format_fastq{},
+                                        seqan3::fields<seqan3::field::id, seqan3::field::seq_qual>{}};
+        typename decltype(fin)::batch_type batch{};
+
+        EXPECT_EQ(fin.read_batch(batch, 10u), 2u);
+        EXPECT_RANGE_EQ(batch.sequences[0], "ACGT"_dna5);
+        EXPECT_RANGE_EQ(batch.sequences[1], "TT"_dna5);
+        EXPECT_RANGE_EQ(batch.base_qualities[0] | seqan3::views::to_rank, (std::vector<size_t>{0, 2, 4, 6}));
+        EXPECT_RANGE_EQ(batch.base_qualities[1] | seqan3::views::to_rank, (std::vector<size_t>{40, 40}));
+    }
+
+    {
+        seqan3::sequence_file_input fin{std::istringstream{fastq},
+                                        seqan3::format_fastq{},
+                                        seqan3::fields<seqan3::field::seq>{}};
+        typename decltype(fin)::batch_type batch{};
+
+        EXPECT_EQ(fin.read_batch(batch, 10u), 2u);
+        EXPECT_EQ(batch.ids.concat_size(), 0u); // not selected
+        EXPECT_EQ(batch.base_qualities.size(), 2u);
+        EXPECT_EQ(batch.base_qualities.concat_size(), 0u);
+        EXPECT_RANGE_EQ(batch.sequences[1], "TT"_dna5);
+    }
+}
@@ -0,0 +1,259 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/sequence_file/view_input.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+
+using seqan3::operator""_dna5;
+using seqan3::operator""_phred42;
+
+//!\brief The fields of a record copied into containers.
+struct owning_record
+{
+    std::string id;
+    std::vector<seqan3::dna5> sequence;
+    std::vector<seqan3::phred42> qualities;
+
+    bool operator==(owning_record const & rhs) const
+    {
+        return id == rhs.id && sequence == rhs.sequence && qualities == rhs.qualities;
+    }
+
+    bool operator!=(owning_record const & rhs) const
+    {
+        return !(*this == rhs);
+    }
+};
+
+template <typename file_t>
+std::vector<owning_record> read_all(file_t & file)
+{
+    std::vector<owning_record> records{};
+
+    for (auto & record : file)
+    {
+        owning_record & copy = records.emplace_back();
+        copy.id = record.id();
+        std::ranges::copy(record.sequence(), std::back_inserter(copy.sequence));
+        std::ranges::copy(record.base_qualities(), std::back_inserter(copy.qualities));
+    }
+
+    return records;
+}
+
+struct sequence_file_view_input_test : public ::testing::Test
+{
+    std::string fasta
+    {
+        ">ID1 first\n"
+        "ACGTTTTTTTTTTTTTTT\n"
+        "GGG\n"
+        "\n"
+        ";ID2\r\n"
+        "AGG\r\n"
+        "CTGN\r\n"
+        ">  ID3\n"
+        ">ID4\n"
+        "GGAGTATAATATATATATATATAT"
+    };
+
+    std::vector<owning_record> fasta_records
+    {
+        {"ID1 first", "ACGTTTTTTTTTTTTTTTGGG"_dna5, {}},
+        {"ID2", "AGGCTGN"_dna5, {}},
+        {"ID3", ""_dna5, {}},
+        {"ID4", "GGAGTATAATATATATATATATAT"_dna5, {}}
+    };
+
+    std::string fastq
+    {
+        "@ID1\n"
+        "ACGT\n"
+        "+\n"
+        "!##$\n"
+        "@ID2 second\r\n"
+        "AGG\r\n"
+        "CTGN\r\n"
+        "+ID2 second\r\n"
+        "@@!\r\n"
+        "+@!!\r\n"
+        "@ID3\n"
+        "\n"
+        "+\n"
+        "\n"
+        "@ID4\n"
+        "GGAG\n"
+        "+\n"
+        "@@@@"
+    };
+
+    std::vector<owning_record> fastq_records
+    {
+        {"ID1", "ACGT"_dna5, "!##$"_phred42},
+        {"ID2 second", "AGGCTGN"_dna5, "@@!+@!!"_phred42},
+        {"ID3", ""_dna5, {}},
+        {"ID4", "GGAG"_dna5, "@@@@"_phred42}
+    };
+};
+
+TEST_F(sequence_file_view_input_test, concepts)
+{
+    using file_t = seqan3::sequence_file_view_input<>;
+    EXPECT_TRUE((std::ranges::input_range<file_t>));
+    EXPECT_FALSE((std::ranges::input_range<file_t const>));
+}
+
+TEST_F(sequence_file_view_input_test, fasta_stream)
+{
+    // Every block size splits the records at different positions.
+    for (size_t block_size = 1; block_size <= fasta.size() + 1; ++block_size)
+    {
+        std::istringstream stream{fasta};
+        seqan3::sequence_file_view_input file{stream, block_size};
+
+        EXPECT_FALSE(file.is_memory_mapped());
+        EXPECT_EQ(read_all(file), fasta_records) << "block size " << block_size;
+    }
+}
+
+TEST_F(sequence_file_view_input_test, fastq_stream)
+{
+    for (size_t block_size = 1; block_size <= fastq.size() + 1; ++block_size)
+    {
+        std::istringstream stream{fastq};
+        seqan3::sequence_file_view_input file{stream, block_size};
+
+        EXPECT_EQ(read_all(file), fastq_records) << "block size " << block_size;
+    }
+}
+
+TEST_F(sequence_file_view_input_test, raw_characters)
+{
+    std::istringstream stream{fastq};
+    seqan3::sequence_file_view_input file{stream};
+
+    auto it = file.begin();
+    EXPECT_EQ((*it).sequence_chars(), "ACGT");
+    EXPECT_EQ((*it).base_quality_chars(), "!##$");
+    ++it;
+    EXPECT_EQ((*it).sequence_chars(), "AGG\r\nCTGN");
+    EXPECT_EQ((*it).base_quality_chars(), "@@!\r\n+@!!");
+}
+
+TEST_F(sequence_file_view_input_test, memory_mapped_file)
+{
+    seqan3::test::tmp_filename filename{"sequence_file_view_input_test.fasta"};
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        stream << fasta;
+    }
+
+    seqan3::sequence_file_view_input file{filename.get_path()};
+    EXPECT_TRUE(file.is_memory_mapped());
+
+    // The records of a memory mapped file stay valid.
+    std::vector<seqan3::sequence_record_view<>> records{};
+    for (auto & record : file)
+        records.push_back(record);
+
+    ASSERT_EQ(records.size(), fasta_records.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(records[i].id(), fasta_records[i].id);
+        EXPECT_TRUE(std::ranges::equal(records[i].sequence(), fasta_records[i].sequence));
+    }
+}
+
+TEST_F(sequence_file_view_input_test, alphabets)
+{
+    std::istringstream stream{fastq};
+    seqan3::sequence_file_view_input<seqan3::dna4, seqan3::phred42> file{stream};
+
+    using seqan3::operator""_dna4;
+    EXPECT_TRUE(std::ranges::equal(file.front().sequence(), "ACGT"_dna4));
+}
+
+TEST_F(sequence_file_view_input_test, empty)
+{
+    std::istringstream stream{"\n\n"};
+    seqan3::sequence_file_view_input file{stream};
+    EXPECT_TRUE(file.begin() == file.end());
+
+    seqan3::test::tmp_filename filename{"sequence_file_view_input_test.fasta"};
+    {
+        std::ofstream empty_file{filename.get_path()};
+    }
+
+    seqan3::sequence_file_view_input mapped_file{filename.get_path()};
+    EXPECT_TRUE(mapped_file.begin() == mapped_file.end());
+}
+
+TEST_F(sequence_file_view_input_test, errors)
+{
+    std::istringstream unknown_format{"ACGT\n"};
+    seqan3::sequence_file_view_input unknown_format_file{unknown_format};
+    EXPECT_THROW(unknown_format_file.begin(), seqan3::parse_error);
+
+    std::istringstream missing_qualities{"@ID1\nACGT\n+\n!!"};
+    seqan3::sequence_file_view_input missing_qualities_file{missing_qualities};
+    EXPECT_THROW(missing_qualities_file.begin(), seqan3::unexpected_end_of_input);
+
+    std::istringstream missing_plus{"@ID1\nACGT\n"};
+    seqan3::sequence_file_view_input missing_plus_file{missing_plus};
+    EXPECT_THROW(missing_plus_file.begin(), seqan3::unexpected_end_of_input);
+
+    std::istringstream too_many_qualities{"@ID1\nACGT\n+\n!!\n!!!\n"};
+    seqan3::sequence_file_view_input too_many_qualities_file{too_many_qualities};
+    EXPECT_THROW(too_many_qualities_file.begin(), seqan3::parse_error);
+
+    std::istringstream mixed_formats{"@ID1\nACGT\n+\n!!!!\n>ID2\nACGT\n"};
+    seqan3::sequence_file_view_input mixed_formats_file{mixed_formats};
+    auto it = mixed_formats_file.begin();
+    EXPECT_THROW(++it, seqan3::parse_error);
+
+    EXPECT_THROW(seqan3::sequence_file_view_input{std::filesystem::path{"/does/not/exist.fa"}},
+                 seqan3::file_open_error);
+}
+
+#ifdef SEQAN3_HAS_ZLIB
+TEST_F(sequence_file_view_input_test, compressed_file)
+{
+    seqan3::test::tmp_filename filename{"sequence_file_view_input_test.fastq.gz"};
+
+    std::string content{};
+    std::vector<owning_record> expected{};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        content += fastq + "\n";
+        expected.insert(expected.end(), fastq_records.begin(), fastq_records.end());
+    }
+
+    {
+        std::ofstream stream{filename.get_path(), std::ios::binary};
+        seqan3::contrib::bgzf_ostream compressed_stream{stream};
+        compressed_stream << content;
+    }
+
+    seqan3::sequence_file_view_input file{filename.get_path(), 1000u};
+    EXPECT_FALSE(file.is_memory_mapped());
+    EXPECT_EQ(read_all(file), expected);
+}
+#endif
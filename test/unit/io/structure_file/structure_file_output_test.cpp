@@ -22,6 +22,9 @@
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 #include <seqan3/test/tmp_filename.hpp>
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/test/bgzf_output.hpp>
+#endif
 
 using seqan3::operator""_rna5;
 using seqan3::operator""_wuss51;
@@ -481,7 +484,7 @@ TEST_F(structure_file_output_compression, by_filename_gz)
     seqan3::test::tmp_filename filename{"structure_file_output_test.dbn.gz"};
     std::string buffer = compression_by_filename_impl(filename);
     buffer[9] = '\x00'; // zero out OS byte
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(seqan3::test::comparable_bgzf(buffer), seqan3::test::comparable_bgzf(expected_bgzf));
 }
 
 TEST_F(structure_file_output_compression, by_stream_gz)
@@ -501,7 +504,7 @@ TEST_F(structure_file_output_compression, by_filename_bgzf)
     seqan3::test::tmp_filename filename{"structure_file_output_test.dbn.bgzf"};
     std::string buffer = compression_by_filename_impl(filename);
     buffer[9] = '\x00'; // zero out OS byte
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(seqan3::test::comparable_bgzf(buffer), seqan3::test::comparable_bgzf(expected_bgzf));
 }
 
 TEST_F(structure_file_output_compression, by_stream_bgzf)
@@ -513,7 +516,7 @@ TEST_F(structure_file_output_compression, by_stream_bgzf)
     }
     std::string buffer = out.str();
     buffer[9] = '\x00'; // zero out OS byte
-    EXPECT_EQ(buffer, expected_bgzf);
+    EXPECT_EQ(seqan3::test::comparable_bgzf(buffer), seqan3::test::comparable_bgzf(expected_bgzf));
 }
 #endif
 
@@ -8,9 +8,14 @@
 #include <gtest/gtest.h>
 
 #include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/range/container/bitcompressed_vector.hpp>
 #include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
 
@@ -39,3 +44,91 @@ TEST(bitcompressed_vector_test, issue1743_view_combinability)
     EXPECT_EQ(v.size(), complement.size());
     EXPECT_RANGE_EQ(complement, (seqan3::dna4_vector{'T'_dna4, 'G'_dna4, 'C'_dna4, 'A'_dna4}));
 }
+
+template <typename alphabet_t>
+struct bitcompressed_vector_bulk_test : public ::testing::Test
+{
+    // Lengths around the word boundaries; dna5 letters span two words.
+    std::vector<size_t> sizes{0, 1, 2, 15, 16, 17, 21, 22, 31, 32, 33, 64, 65, 1000};
+};
+
+using bulk_alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15>;
+TYPED_TEST_SUITE(bitcompressed_vector_bulk_test, bulk_alphabet_types, );
+
+TYPED_TEST(bitcompressed_vector_bulk_test, append_range)
+{
+    for (size_t size : this->sizes)
+    {
+        auto source = seqan3::test::generate_sequence<TypeParam>(size, 0, size);
+        seqan3::bitcompressed_vector<TypeParam> vector{source};
+        EXPECT_RANGE_EQ(vector, source);
+
+        // Appending to a non-empty vector.
+        vector.insert(vector.cend(), source.begin(), source.end());
+        EXPECT_EQ(vector.size(), 2 * size);
+        EXPECT_RANGE_EQ(vector | std::views::drop(size), source);
+        EXPECT_RANGE_EQ(vector | std::views::take(size), source);
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_bulk_test, reverse_complement)
+{
+    for (size_t size : this->sizes)
+    {
+        auto source = seqan3::test::generate_sequence<TypeParam>(size, 0, size);
+        seqan3::bitcompressed_vector<TypeParam> vector{source};
+
+        seqan3::reverse_complement(vector);
+
+        EXPECT_EQ(vector.size(), size);
+        EXPECT_RANGE_EQ(vector, source | std::views::reverse | seqan3::views::complement);
+
+        // The unused bits are cleared, so equal sequences compare equal.
+        auto expected = source | std::views::reverse | seqan3::views::complement | seqan3::views::to<std::vector>;
+        EXPECT_EQ(vector, seqan3::bitcompressed_vector<TypeParam>{expected});
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_bulk_test, count_mismatches)
+{
+    for (size_t size : this->sizes)
+    {
+        auto lhs = seqan3::test::generate_sequence<TypeParam>(size, 0, size);
+        auto rhs = seqan3::test::generate_sequence<TypeParam>(size, 0, size + 1);
+
+        size_t expected = 0;
+        for (size_t i = 0; i < size; ++i)
+            expected += lhs[i] != rhs[i];
+
+        seqan3::bitcompressed_vector<TypeParam> packed_lhs{lhs};
+        seqan3::bitcompressed_vector<TypeParam> packed_rhs{rhs};
+
+        EXPECT_EQ(seqan3::count_mismatches(packed_lhs, packed_rhs), expected);
+        EXPECT_EQ(seqan3::count_mismatches(packed_lhs, packed_lhs), 0u);
+
+        // Only the common prefix is compared.
+        packed_rhs.push_back(TypeParam{});
+        EXPECT_EQ(seqan3::count_mismatches(packed_lhs, packed_rhs), expected);
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_bulk_test, kmer_hashes)
+{
+    for (size_t size : this->sizes)
+    {
+        auto source = seqan3::test::generate_sequence<TypeParam>(size, 0, size);
+        seqan3::bitcompressed_vector<TypeParam> vector{source};
+
+        for (uint8_t k : {1, 3, 12})
+        {
+            std::vector<size_t> expected{};
+            if (size >= k)
+                expected = source | seqan3::views::kmer_hash(seqan3::ungapped{k}) | seqan3::views::to<std::vector>;
+
+            EXPECT_EQ(seqan3::kmer_hashes(vector, k), expected);
+        }
+    }
+
+    EXPECT_TRUE(seqan3::kmer_hashes(seqan3::bitcompressed_vector<TypeParam>{}, 0).empty());
+    EXPECT_THROW(seqan3::kmer_hashes(seqan3::bitcompressed_vector<TypeParam>{}, 33), std::invalid_argument);
+}
@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <random>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/packed_sequences.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+template <typename alphabet_t>
+struct packed_sequences_test : public ::testing::Test
+{
+    using sequence_t = std::vector<alphabet_t>;
+
+    // Random sequences with random lengths including empty sequences and sequences spanning multiple words.
+    std::vector<sequence_t> sequences = []
+    {
+        std::mt19937 generator{42};
+        std::uniform_int_distribution<size_t> length{0, 100};
+        std::uniform_int_distribution<size_t> rank{0, seqan3::alphabet_size<alphabet_t> - 1};
+
+        std::vector<sequence_t> result(1000);
+        for (sequence_t & sequence : result)
+        {
+            sequence.resize(length(generator));
+            for (alphabet_t & letter : sequence)
+                seqan3::assign_rank_to(rank(generator), letter);
+        }
+
+        result[3].clear();
+        result.back().clear();
+        return result;
+    }();
+
+    template <typename range_t>
+    static sequence_t to_vector(range_t && range)
+    {
+        sequence_t result{};
+        for (alphabet_t letter : range)
+            result.push_back(letter);
+        return result;
+    }
+
+    template <typename collection_t>
+    void expect_equal_sequences(collection_t const & collection)
+    {
+        ASSERT_EQ(collection.size(), sequences.size());
+
+        size_t i = 0;
+        for (auto && sequence : collection)
+        {
+            EXPECT_EQ(std::ranges::size(sequence), sequences[i].size());
+            EXPECT_EQ(to_vector(sequence), sequences[i]);
+            EXPECT_EQ(to_vector(collection[i]), sequences[i]);
+            ++i;
+        }
+    }
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::aa27>;
+TYPED_TEST_SUITE(packed_sequences_test, alphabet_types, );
+
+TYPED_TEST(packed_sequences_test, concepts)
+{
+    using collection_t = seqan3::packed_sequences<TypeParam>;
+
+    EXPECT_TRUE(std::ranges::random_access_range<collection_t>);
+    EXPECT_TRUE(std::ranges::sized_range<collection_t>);
+    EXPECT_TRUE(std::ranges::random_access_range<std::ranges::range_reference_t<collection_t>>);
+    EXPECT_TRUE(std::ranges::sized_range<std::ranges::range_reference_t<collection_t>>);
+    EXPECT_TRUE(std::ranges::view<std::ranges::range_reference_t<collection_t>>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<std::ranges::range_reference_t<collection_t>>, TypeParam>));
+    EXPECT_TRUE(std::random_access_iterator<seqan3::detail::packed_letter_iterator<TypeParam>>);
+}
+
+TYPED_TEST(packed_sequences_test, construction)
+{
+    using collection_t = seqan3::packed_sequences<TypeParam>;
+
+    EXPECT_TRUE(std::is_default_constructible_v<collection_t>);
+    EXPECT_TRUE(std::is_copy_constructible_v<collection_t>);
+    EXPECT_TRUE(std::is_move_constructible_v<collection_t>);
+    EXPECT_TRUE(std::is_copy_assignable_v<collection_t>);
+    EXPECT_TRUE(std::is_move_assignable_v<collection_t>);
+
+    collection_t empty{};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TYPED_TEST(packed_sequences_test, element_access)
+{
+    seqan3::packed_sequences<TypeParam> collection{this->sequences};
+
+    this->expect_equal_sequences(collection);
+
+    EXPECT_EQ(this->to_vector(collection.front()), this->sequences.front());
+    EXPECT_EQ(this->to_vector(collection.back()), this->sequences.back());
+    EXPECT_EQ(this->to_vector(collection.at(7)), this->sequences[7]);
+    EXPECT_THROW(collection.at(this->sequences.size()), std::out_of_range);
+
+    // Random access within a sequence.
+    auto sequence = collection[10];
+    for (size_t i = 0; i < this->sequences[10].size(); ++i)
+        EXPECT_EQ(sequence[i], this->sequences[10][i]);
+}
+
+TYPED_TEST(packed_sequences_test, concat)
+{
+    seqan3::packed_sequences<TypeParam> collection{this->sequences};
+
+    std::vector<TypeParam> concatenation{};
+    for (auto const & sequence : this->sequences)
+        concatenation.insert(concatenation.end(), sequence.begin(), sequence.end());
+
+    EXPECT_EQ(std::ranges::size(collection.concat()), concatenation.size());
+    EXPECT_EQ(this->to_vector(collection.concat()), concatenation);
+}
+
+TYPED_TEST(packed_sequences_test, copy_shares_buffer)
+{
+    seqan3::packed_sequences<TypeParam> collection{this->sequences};
+    seqan3::packed_sequences<TypeParam> copy{collection};
+    collection = seqan3::packed_sequences<TypeParam>{};
+
+    this->expect_equal_sequences(copy);
+}
+
+TYPED_TEST(packed_sequences_test, memory_footprint)
+{
+    seqan3::packed_sequences<TypeParam> collection{this->sequences};
+
+    size_t letter_count = 0;
+    for (auto const & sequence : this->sequences)
+        letter_count += sequence.size();
+
+    size_t const bits_per_letter = seqan3::detail::packed_letter_iterator<TypeParam>::bits_per_letter;
+    EXPECT_LT(collection.memory_footprint(), letter_count * bits_per_letter / 8 * 1.15 + 1024);
+}
+
+TYPED_TEST(packed_sequences_test, store_and_map)
+{
+    seqan3::test::tmp_filename file_name{"packed_sequences"};
+
+    {
+        seqan3::packed_sequences<TypeParam> collection{this->sequences};
+        collection.store(file_name.get_path());
+        EXPECT_EQ(std::filesystem::file_size(file_name.get_path()), collection.memory_footprint());
+    }
+
+    auto mapped = seqan3::packed_sequences<TypeParam>::map(file_name.get_path());
+    this->expect_equal_sequences(mapped);
+
+    // The mapping stays valid in copies.
+    auto copy = mapped;
+    mapped = seqan3::packed_sequences<TypeParam>{};
+    this->expect_equal_sequences(copy);
+}
+
+TYPED_TEST(packed_sequences_test, store_and_map_empty)
+{
+    seqan3::test::tmp_filename file_name{"packed_sequences"};
+    seqan3::packed_sequences<TypeParam>{}.store(file_name.get_path());
+
+    auto mapped = seqan3::packed_sequences<TypeParam>::map(file_name.get_path());
+    EXPECT_TRUE(mapped.empty());
+}
+
+TEST(packed_sequences, map_errors)
+{
+    using seqan3::operator""_dna4;
+
+    seqan3::test::tmp_filename file_name{"packed_sequences"};
+    EXPECT_THROW(seqan3::packed_sequences<seqan3::dna4>::map(file_name.get_path()), seqan3::file_open_error);
+
+    seqan3::packed_sequences<seqan3::dna4>{std::vector{"ACGT"_dna4, "GATTACA"_dna4}}.store(file_name.get_path());
+
+    // Different alphabet.
+    EXPECT_THROW(seqan3::packed_sequences<seqan3::dna5>::map(file_name.get_path()), seqan3::format_error);
+
+    // Truncated file.
+    std::filesystem::resize_file(file_name.get_path(), std::filesystem::file_size(file_name.get_path()) - 8);
+    EXPECT_THROW(seqan3::packed_sequences<seqan3::dna4>::map(file_name.get_path()), seqan3::format_error);
+
+    // Not a packed sequences file.
+    {
+        std::ofstream file{file_name.get_path()};
+        file << ">seq\nACGT\n";
+    }
+    EXPECT_THROW(seqan3::packed_sequences<seqan3::dna4>::map(file_name.get_path()), seqan3::format_error);
+}
@@ -319,3 +319,42 @@ TEST(gap_decorator, decorator_on_views)
     EXPECT_EQ(*dec3.begin(), 'C'_dna4);
     EXPECT_EQ(*(std::next(dec3.begin())), 'T'_dna4);
 }
+
+TEST(gap_decorator, many_gaps)
+{
+    std::vector<seqan3::dna4> v(200);
+    for (size_t i = 0; i < v.size(); ++i)
+        v[i] = "ACGT"_dna4[i % 4];
+
+    seqan3::gap_decorator dec{v};
+    std::vector<seqan3::gapped<seqan3::dna4>> expected(v.begin(), v.end());
+
+    // Insert gaps in front, in the middle and at the end of existing gaps and letters.
+    for (size_t i = 0; i < 300; ++i)
+    {
+        size_t const pos = (i * 37) % (expected.size() + 1);
+        size_t const count = i % 3 + 1;
+        insert_gap(dec, std::next(dec.begin(), pos), count);
+        expected.insert(expected.begin() + pos, count, seqan3::gap{});
+    }
+
+    EXPECT_RANGE_EQ(dec, expected);
+
+    // Erase parts of the gaps again.
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        if (expected[i] == seqan3::gap{} && i % 2 == 0)
+        {
+            erase_gap(dec, std::next(dec.begin(), i));
+            expected.erase(expected.begin() + i);
+        }
+    }
+
+    EXPECT_EQ(dec.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(dec[i], expected[i]);
+
+    auto it = dec.end();
+    for (size_t i = expected.size(); i > 0; --i)
+        EXPECT_EQ(*--it, expected[i - 1]);
+}
@@ -0,0 +1,105 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/range/detail/elias_fano_sequence.hpp>
+
+std::vector<uint64_t> encode(std::vector<uint64_t> const & values)
+{
+    std::vector<uint64_t> buffer{};
+    seqan3::detail::elias_fano_sequence::encode(buffer, values);
+    return buffer;
+}
+
+TEST(elias_fano_sequence, empty)
+{
+    std::vector<uint64_t> buffer = encode({});
+    seqan3::detail::elias_fano_sequence sequence{buffer};
+
+    EXPECT_EQ(sequence.size(), 0u);
+    EXPECT_EQ(sequence.word_count(), buffer.size());
+}
+
+TEST(elias_fano_sequence, small)
+{
+    std::vector<uint64_t> values{0, 0, 3, 7, 7, 8, 100, 1000};
+    std::vector<uint64_t> buffer = encode(values);
+    seqan3::detail::elias_fano_sequence sequence{buffer};
+
+    ASSERT_EQ(sequence.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(sequence[i], values[i]);
+}
+
+TEST(elias_fano_sequence, large)
+{
+    std::mt19937_64 generator{42};
+    std::geometric_distribution<uint64_t> gap{0.01};
+
+    std::vector<uint64_t> values{0};
+    for (size_t i = 0; i < 10000; ++i)
+        values.push_back(values.back() + gap(generator));
+
+    std::vector<uint64_t> buffer = encode(values);
+    seqan3::detail::elias_fano_sequence sequence{buffer};
+
+    ASSERT_EQ(sequence.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(sequence[i], values[i]);
+
+    // Roughly 2 + log2(100) bits per value instead of 64.
+    EXPECT_LT(buffer.size(), values.size() / 6);
+}
+
+TEST(elias_fano_sequence, large_universe)
+{
+    std::vector<uint64_t> values{0, 1, 5, 1ull << 40, (1ull << 40) + 1, 1ull << 62};
+    std::vector<uint64_t> buffer = encode(values);
+    seqan3::detail::elias_fano_sequence sequence{buffer};
+
+    ASSERT_EQ(sequence.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(sequence[i], values[i]);
+}
+
+TEST(elias_fano_sequence, appended_to_buffer)
+{
+    std::vector<uint64_t> buffer{1, 2, 3};
+    seqan3::detail::elias_fano_sequence::encode(buffer, std::vector<uint64_t>{5, 10, 15});
+    buffer.push_back(42);
+
+    seqan3::detail::elias_fano_sequence sequence{std::span<uint64_t const>{buffer}.subspan(3)};
+    EXPECT_EQ(sequence.word_count(), buffer.size() - 4);
+    EXPECT_EQ(sequence[0], 5u);
+    EXPECT_EQ(sequence[1], 10u);
+    EXPECT_EQ(sequence[2], 15u);
+}
+
+TEST(elias_fano_sequence, unsorted)
+{
+    std::vector<uint64_t> buffer{};
+    EXPECT_THROW(seqan3::detail::elias_fano_sequence::encode(buffer, std::vector<uint64_t>{3, 2}),
+                 std::invalid_argument);
+}
+
+TEST(elias_fano_sequence, corrupted)
+{
+    std::vector<uint64_t> buffer = encode({1, 2, 3});
+
+    EXPECT_THROW((seqan3::detail::elias_fano_sequence{std::span<uint64_t const>{buffer}.first(3)}),
+                 std::invalid_argument);
+    EXPECT_THROW((seqan3::detail::elias_fano_sequence{std::span<uint64_t const>{buffer}.first(buffer.size() - 1)}),
+                 std::invalid_argument);
+
+    buffer[1] = 64; // Invalid number of lower bits.
+    EXPECT_THROW(seqan3::detail::elias_fano_sequence{buffer}, std::invalid_argument);
+}
@@ -0,0 +1,192 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/range/detail/packed_word_operations.hpp>
+
+template <typename bits_t>
+struct packed_word_operations_test : public ::testing::Test
+{
+    static constexpr size_t bits_per_letter = bits_t::value;
+    using operations_t = seqan3::detail::packed_word_operations<bits_per_letter>;
+
+    // Sizes around the word boundaries.
+    std::vector<size_t> sizes{0, 1, 2, 3, 31, 32, 33, 63, 64, 65, 100, 1000};
+
+    std::vector<uint64_t> random_ranks(size_t const size, unsigned const seed = 42) const
+    {
+        std::mt19937_64 generator{seed};
+        std::vector<uint64_t> ranks(size);
+        for (uint64_t & rank : ranks)
+            rank = generator() & operations_t::letter_mask;
+        return ranks;
+    }
+
+    std::vector<uint64_t> pack(std::vector<uint64_t> const & ranks) const
+    {
+        std::vector<uint64_t> words(operations_t::word_count(ranks.size()) + 1, 0u);
+        operations_t::write_range(words.data(), 0u, ranks);
+        return words;
+    }
+
+    std::vector<uint64_t> unpack(std::vector<uint64_t> const & words, size_t const size) const
+    {
+        std::vector<uint64_t> ranks{};
+        operations_t::for_each_rank(words.data(), 0u, size, [&] (uint64_t const rank) { ranks.push_back(rank); });
+        return ranks;
+    }
+};
+
+using bit_widths = ::testing::Types<std::integral_constant<size_t, 1>,
+                                    std::integral_constant<size_t, 2>,
+                                    std::integral_constant<size_t, 3>,
+                                    std::integral_constant<size_t, 4>,
+                                    std::integral_constant<size_t, 5>,
+                                    std::integral_constant<size_t, 8>,
+                                    std::integral_constant<size_t, 13>,
+                                    std::integral_constant<size_t, 32>,
+                                    std::integral_constant<size_t, 64>>;
+TYPED_TEST_SUITE(packed_word_operations_test, bit_widths, );
+
+TYPED_TEST(packed_word_operations_test, read_and_write)
+{
+    using operations_t = typename TestFixture::operations_t;
+
+    std::vector<uint64_t> ranks = this->random_ranks(200);
+    std::vector<uint64_t> words(operations_t::word_count(ranks.size()), 0u);
+
+    for (size_t i = 0; i < ranks.size(); ++i)
+        operations_t::write(words.data(), i, ranks[i]);
+
+    for (size_t i = 0; i < ranks.size(); ++i)
+        EXPECT_EQ(operations_t::read(words.data(), i), ranks[i]);
+
+    // Overwrite letters without changing the neighbours.
+    operations_t::write(words.data(), 77, operations_t::letter_mask);
+    operations_t::write(words.data(), 78, 0u);
+    ranks[77] = operations_t::letter_mask;
+    ranks[78] = 0u;
+
+    for (size_t i = 0; i < ranks.size(); ++i)
+        EXPECT_EQ(operations_t::read(words.data(), i), ranks[i]);
+}
+
+TYPED_TEST(packed_word_operations_test, write_range_and_for_each_rank)
+{
+    using operations_t = typename TestFixture::operations_t;
+
+    for (size_t size : this->sizes)
+    {
+        std::vector<uint64_t> ranks = this->random_ranks(size);
+        std::vector<uint64_t> words = this->pack(ranks);
+
+        for (size_t i = 0; i < size; ++i)
+            EXPECT_EQ(operations_t::read(words.data(), i), ranks[i]);
+
+        EXPECT_EQ(this->unpack(words, size), ranks);
+    }
+}
+
+TYPED_TEST(packed_word_operations_test, write_range_at_position)
+{
+    using operations_t = typename TestFixture::operations_t;
+
+    std::vector<uint64_t> ranks = this->random_ranks(150);
+    std::vector<uint64_t> words = this->pack(ranks);
+    std::vector<uint64_t> infix = this->random_ranks(70, 7);
+
+    operations_t::write_range(words.data(), 37, infix);
+    std::ranges::copy(infix, ranks.begin() + 37);
+
+    EXPECT_EQ(this->unpack(words, ranks.size()), ranks);
+
+    // Partial ranges.
+    std::vector<uint64_t> partial{};
+    operations_t::for_each_rank(words.data(), 13, 101, [&] (uint64_t const rank) { partial.push_back(rank); });
+    EXPECT_TRUE(std::ranges::equal(partial, std::vector<uint64_t>(ranks.begin() + 13, ranks.begin() + 101)));
+}
+
+TYPED_TEST(packed_word_operations_test, reverse_complement)
+{
+    using operations_t = typename TestFixture::operations_t;
+    constexpr size_t bits_per_letter = TestFixture::bits_per_letter;
+
+    if constexpr (bits_per_letter <= 8)
+    {
+        std::vector<uint64_t> xor_complement(1ull << bits_per_letter);
+        std::vector<uint64_t> permutation(1ull << bits_per_letter);
+        for (size_t rank = 0; rank < xor_complement.size(); ++rank)
+        {
+            xor_complement[rank] = rank ^ operations_t::letter_mask;
+            permutation[rank] = (rank * 5 + 1) % permutation.size();
+        }
+
+        for (auto const & complement : {xor_complement, permutation})
+        {
+            for (size_t size : this->sizes)
+            {
+                std::vector<uint64_t> ranks = this->random_ranks(size);
+                std::vector<uint64_t> words = this->pack(ranks);
+                operations_t::reverse_complement(words.data(), size, complement);
+
+                std::vector<uint64_t> expected{};
+                for (uint64_t rank : ranks | std::views::reverse)
+                    expected.push_back(complement[rank]);
+
+                EXPECT_EQ(this->unpack(words, size), expected);
+
+                // The bits behind the last letter are cleared.
+                if (size_t const used_bits = size * bits_per_letter % 64; operations_t::is_word_aligned && used_bits)
+                {
+                    EXPECT_EQ(words[operations_t::word_count(size) - 1] >> used_bits, 0u);
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(packed_word_operations_test, count_mismatches)
+{
+    using operations_t = typename TestFixture::operations_t;
+
+    for (size_t size : this->sizes)
+    {
+        std::vector<uint64_t> lhs_ranks = this->random_ranks(size);
+        std::vector<uint64_t> rhs_ranks = lhs_ranks;
+
+        std::mt19937 generator{size};
+        for (uint64_t & rank : rhs_ranks)
+            if (generator() % 3 == 0)
+                rank = (rank + 1 + generator() % operations_t::letter_mask) & operations_t::letter_mask;
+
+        size_t expected = 0;
+        for (size_t i = 0; i < size; ++i)
+            expected += lhs_ranks[i] != rhs_ranks[i];
+
+        std::vector<uint64_t> lhs = this->pack(lhs_ranks);
+        std::vector<uint64_t> rhs = this->pack(rhs_ranks);
+        rhs.back() = ~0ull; // Bits behind the compared letters are ignored.
+
+        EXPECT_EQ(operations_t::count_mismatches(lhs.data(), rhs.data(), size), expected);
+        EXPECT_EQ(operations_t::count_mismatches(lhs.data(), lhs.data(), size), 0u);
+    }
+}
+
+TEST(packed_word_operations, reverse_letters)
+{
+    using operations_t = seqan3::detail::packed_word_operations<2>;
+    EXPECT_EQ(operations_t::reverse_letters(0b11'10'01ull), 0b01'10'11ull << 58);
+    EXPECT_EQ(operations_t::reverse_letters(operations_t::reverse_letters(0x0123456789abcdefull)),
+              0x0123456789abcdefull);
+    EXPECT_EQ(seqan3::detail::packed_word_operations<8>::reverse_letters(0x0123456789abcdefull),
+              0xefcdab8967452301ull);
+}
@@ -0,0 +1,151 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/rna15.hpp>
+#include <seqan3/alphabet/nucleotide/rna5.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/range/translate_frames.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/translate_join.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_aa27;
+using seqan3::operator""_dna4;
+
+template <typename t>
+struct translate_frames_test : public ::testing::Test
+{
+    static constexpr std::array<seqan3::translation_frames, 6> all_frames{seqan3::translation_frames::FWD_FRAME_0,
+                                                                          seqan3::translation_frames::FWD_FRAME_1,
+                                                                          seqan3::translation_frames::FWD_FRAME_2,
+                                                                          seqan3::translation_frames::REV_FRAME_0,
+                                                                          seqan3::translation_frames::REV_FRAME_1,
+                                                                          seqan3::translation_frames::REV_FRAME_2};
+
+    static std::vector<t> sequence(std::string_view const str)
+    {
+        std::vector<t> seq{};
+        for (char const c : str)
+            seq.push_back(seqan3::assign_char_to(c, t{}));
+
+        return seq;
+    }
+
+    // Compares against seqan3::views::translate, which translates every amino acid on access.
+    template <typename translated_t, typename sequence_t>
+    static void expect_same_as_view(translated_t const & translated,
+                                    sequence_t const & seq,
+                                    seqan3::translation_frames const tf)
+    {
+        auto expected = seq | seqan3::views::translate(tf);
+
+        ASSERT_EQ(translated.size(), expected.size());
+        for (size_t i = 0; i < translated.size(); ++i)
+            EXPECT_RANGE_EQ(translated[i], expected[i]);
+    }
+};
+
+using nucleotide_types = ::testing::Types<seqan3::dna4,
+                                          seqan3::dna5,
+                                          seqan3::dna15,
+                                          seqan3::rna5,
+                                          seqan3::rna15,
+                                          seqan3::sam_dna16>;
+
+TYPED_TEST_SUITE(translate_frames_test, nucleotide_types, );
+
+TYPED_TEST(translate_frames_test, six_frames)
+{
+    std::string const str{"ACGTACGTAGCTAGCTAGCATCGATCGATTTGCAGCGATCATGCAGCTAGCATAGCCGAGACTAGCAGCACGACGATCAGACTGACGTACG"};
+
+    for (size_t length = 0; length < 20; ++length)
+    {
+        std::vector<TypeParam> seq = TestFixture::sequence(std::string_view{str}.substr(0, length));
+        this->expect_same_as_view(seqan3::translate_frames(seq), seq, seqan3::translation_frames::SIX_FRAME);
+    }
+
+    std::vector<TypeParam> seq = TestFixture::sequence(str);
+    this->expect_same_as_view(seqan3::translate_frames(seq), seq, seqan3::translation_frames::SIX_FRAME);
+}
+
+TYPED_TEST(translate_frames_test, selected_frames)
+{
+    std::vector<TypeParam> seq = TestFixture::sequence("ACGTACGTAGCTAGCTAGCATCGATCGATTTGCAGCGATCATGCAGCTAGCAT");
+
+    for (seqan3::translation_frames const tf : TestFixture::all_frames)
+        this->expect_same_as_view(seqan3::translate_frames(seq, tf), seq, tf);
+
+    for (seqan3::translation_frames const tf : {seqan3::translation_frames::FWD,
+                                                seqan3::translation_frames::REV,
+                                                seqan3::translation_frames::FWD_REV_1,
+                                                seqan3::translation_frames::FWD_FRAME_0 |
+                                                seqan3::translation_frames::REV_FRAME_2})
+    {
+        this->expect_same_as_view(seqan3::translate_frames(seq, tf), seq, tf);
+    }
+}
+
+TYPED_TEST(translate_frames_test, ambiguous_letters)
+{
+    if constexpr (seqan3::alphabet_size<TypeParam> > 4)
+    {
+        std::vector<TypeParam> seq = TestFixture::sequence("ACNTANGTAGCTNNCTAGCATCGANCGATT");
+        this->expect_same_as_view(seqan3::translate_frames(seq), seq, seqan3::translation_frames::SIX_FRAME);
+    }
+}
+
+TEST(translate_frames, result)
+{
+    seqan3::concatenated_sequences<std::vector<seqan3::aa27>> translated = seqan3::translate_frames("ACGTACGTA"_dna4);
+
+    ASSERT_EQ(translated.size(), 6u);
+    EXPECT_RANGE_EQ(translated[0], "TYV"_aa27);
+    EXPECT_RANGE_EQ(translated[1], "RT"_aa27);
+    EXPECT_RANGE_EQ(translated[2], "VR"_aa27);
+    EXPECT_RANGE_EQ(translated[3], "YVR"_aa27);
+    EXPECT_RANGE_EQ(translated[4], "TY"_aa27);
+    EXPECT_RANGE_EQ(translated[5], "RT"_aa27);
+}
+
+TEST(translate_frames, input_range)
+{
+    std::string const str{"ACGTACGTAGCTAGCTAGCATCGATCG"};
+    seqan3::dna4_vector seq = str | seqan3::views::char_to<seqan3::dna4> | seqan3::views::to<seqan3::dna4_vector>;
+
+    auto translated = seqan3::translate_frames(std::list<seqan3::dna4>{seq.begin(), seq.end()});
+    auto expected = seqan3::translate_frames(seq);
+    EXPECT_EQ(translated, expected);
+
+    EXPECT_EQ(seqan3::translate_frames(str | seqan3::views::char_to<seqan3::dna4>), expected);
+}
+
+TEST(translate_frames, collection)
+{
+    std::vector<seqan3::dna4_vector> sequences{"ACGTACGTA"_dna4, ""_dna4, "AC"_dna4, "ACGTTTGCAGCTAGCTAGGCAT"_dna4};
+
+    for (seqan3::translation_frames const tf : {seqan3::translation_frames::SIX_FRAME,
+                                                seqan3::translation_frames::FWD_FRAME_1,
+                                                seqan3::translation_frames::REV})
+    {
+        seqan3::concatenated_sequences<std::vector<seqan3::aa27>> translated = seqan3::translate_frames(sequences, tf);
+        auto expected = sequences | seqan3::views::translate_join(tf);
+
+        ASSERT_EQ(translated.size(), expected.size());
+        for (size_t i = 0; i < translated.size(); ++i)
+            EXPECT_RANGE_EQ(translated[i], expected[i]);
+    }
+
+    EXPECT_TRUE(seqan3::translate_frames(std::vector<seqan3::dna4_vector>{}).empty());
+}
@@ -185,6 +185,23 @@ TYPED_TEST_P(bi_fm_index_cursor_test, to_fwd_cursor)
     }
 }
 
+TYPED_TEST_P(bi_fm_index_cursor_test, suffix_array_interval)
+{
+    typename TypeParam::index_type bi_fm{this->text};   // "ACGGTAGGACGTAGC"
+
+    auto it = bi_fm.cursor();
+    EXPECT_TRUE(it.suffix_array_interval() == (seqan3::suffix_array_interval{0u, bi_fm.size()}));
+
+    EXPECT_TRUE(it.extend_left(seqan3::views::slice(this->text, 3, 7))); // "GTAG"
+    auto [lb, rb] = it.suffix_array_interval();
+    EXPECT_EQ(rb - lb, it.count());
+    EXPECT_TRUE(it.suffix_array_interval() == it.to_fwd_cursor().suffix_array_interval());
+
+    EXPECT_TRUE(it.extend_right()); // "GTAGC"
+    EXPECT_EQ(it.suffix_array_interval().end_position - it.suffix_array_interval().begin_position, 1u);
+    EXPECT_TRUE(it.suffix_array_interval() == it.to_fwd_cursor().suffix_array_interval());
+}
+
 TYPED_TEST_P(bi_fm_index_cursor_test, serialisation)
 {
     typename TypeParam::index_type bi_fm{this->text};
@@ -196,4 +213,4 @@ TYPED_TEST_P(bi_fm_index_cursor_test, serialisation)
 }
 
 REGISTER_TYPED_TEST_SUITE_P(bi_fm_index_cursor_test, cursor, extend, extend_char, extend_range, extend_and_cycle,
-                            extend_range_and_cycle, to_fwd_cursor, serialisation);
+                            extend_range_and_cycle, to_fwd_cursor, suffix_array_interval, serialisation);
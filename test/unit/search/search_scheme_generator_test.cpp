@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "helper_search_scheme.hpp"
+
+#include <seqan3/search/detail/search_scheme_generator.hpp>
+
+#include <gtest/gtest.h>
+
+using seqan3::detail::search_scheme_generator;
+
+// Every error distribution must be enumerated by at least one search of the generated search scheme.
+void expect_complete_coverage(seqan3::detail::search_scheme_dyn_type const & scheme,
+                              uint8_t const min_error,
+                              uint8_t const max_error)
+{
+    std::vector<std::vector<uint8_t>> expected, actual;
+    seqan3::search_scheme_error_distribution(actual, scheme);
+    seqan3::search_scheme_error_distribution(expected, seqan3::trivial_search_scheme(min_error,
+                                                                                     max_error,
+                                                                                     scheme.front().blocks()));
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    actual.erase(std::unique(actual.begin(), actual.end()), actual.end());
+
+    EXPECT_EQ(actual, expected) << "min_error: " << +min_error << " max_error: " << +max_error;
+}
+
+TEST(search_scheme_generator_test, error_distributions)
+{
+    EXPECT_EQ(search_scheme_generator::error_distributions(0, 0, 3),
+              (std::vector<std::vector<uint8_t>>{{0, 0, 0}}));
+    EXPECT_EQ(search_scheme_generator::error_distributions(1, 1, 2),
+              (std::vector<std::vector<uint8_t>>{{1, 0}, {0, 1}}));
+    EXPECT_EQ(search_scheme_generator::error_distributions(0, 2, 2),
+              (std::vector<std::vector<uint8_t>>{{0, 0}, {1, 0}, {2, 0}, {0, 1}, {1, 1}, {0, 2}}));
+}
+
+TEST(search_scheme_generator_test, coverage)
+{
+    for (size_t text_length : {1'000ul, 1'000'000ul, 3'000'000'000ul})
+    {
+        search_scheme_generator generator{4, text_length};
+        for (uint8_t max_error = 0; max_error <= 5; ++max_error)
+        {
+            for (uint8_t min_error = 0; min_error <= max_error; ++min_error)
+            {
+                for (size_t query_length : {1ul, 5ul, 40ul, 150ul})
+                    expect_complete_coverage(generator.generate(min_error, max_error, query_length),
+                                             min_error,
+                                             max_error);
+            }
+        }
+    }
+}
+
+TEST(search_scheme_generator_test, disjoint)
+{
+    EXPECT_TRUE(search_scheme_generator::is_disjoint(seqan3::detail::optimum_search_scheme_dyn<0, 2>(), 0, 2));
+    EXPECT_TRUE(search_scheme_generator::is_disjoint({{{1}, {0}, {3}}}, 0, 3));
+    EXPECT_FALSE(search_scheme_generator::is_disjoint({{{1, 2}, {0, 0}, {0, 1}}, {{2, 1}, {0, 0}, {0, 1}}}, 0, 1));
+}
+
+TEST(search_scheme_generator_test, optimum_search_scheme_dyn)
+{
+    auto scheme = seqan3::detail::optimum_search_scheme_dyn(1, 3);
+    ASSERT_TRUE(scheme.has_value());
+
+    auto const & expected = seqan3::detail::optimum_search_scheme<1, 3>;
+    ASSERT_EQ(scheme->size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal((*scheme)[i].pi, expected[i].pi));
+        EXPECT_TRUE(std::ranges::equal((*scheme)[i].l, expected[i].l));
+        EXPECT_TRUE(std::ranges::equal((*scheme)[i].u, expected[i].u));
+    }
+
+    EXPECT_FALSE(seqan3::detail::optimum_search_scheme_dyn(0, 4).has_value());
+    EXPECT_FALSE(seqan3::detail::optimum_search_scheme_dyn(3, 2).has_value());
+}
+
+TEST(search_scheme_generator_test, blocks_length)
+{
+    search_scheme_generator generator{4, 1'000'000};
+
+    for (uint8_t max_error = 0; max_error <= 4; ++max_error)
+    {
+        for (size_t query_length : {1ul, 3ul, 40ul, 101ul})
+        {
+            auto const scheme = generator.generate(0, max_error, query_length);
+            auto const blocks_length = generator.optimal_blocks_length(scheme, query_length);
+
+            EXPECT_EQ(blocks_length.size(), scheme.front().blocks());
+            EXPECT_EQ(std::accumulate(blocks_length.begin(), blocks_length.end(), 0ul), query_length);
+            if (query_length >= blocks_length.size())
+            {
+                EXPECT_TRUE(std::ranges::none_of(blocks_length, [] (size_t const length) { return length == 0; }));
+            }
+        }
+    }
+}
+
+TEST(search_scheme_generator_test, expected_node_count)
+{
+    search_scheme_generator generator{4, 1'000'000};
+
+    for (uint8_t max_error = 1; max_error <= 5; ++max_error)
+    {
+        seqan3::detail::search_scheme_dyn_type const trivial{{{1}, {0}, {max_error}}};
+        auto const scheme = generator.generate(0, max_error, 50);
+
+        EXPECT_LT(generator.expected_node_count(scheme, generator.optimal_blocks_length(scheme, 50)),
+                  generator.expected_node_count(trivial, {50}));
+    }
+
+    // Exact search: one node for every depth at which the prefix occurs in the text (almost) surely.
+    search_scheme_generator huge_text_generator{4, std::numeric_limits<size_t>::max()};
+    seqan3::detail::search_scheme_dyn_type const exact{{{1}, {0}, {0}}};
+    EXPECT_NEAR(huge_text_generator.expected_node_count(exact, {10}), 10.0, 1e-6);
+}
+
+TEST(search_scheme_generator_test, block_info)
+{
+    auto const scheme = seqan3::detail::optimum_search_scheme_dyn<0, 2>();
+    auto const block_info = seqan3::detail::search_scheme_block_info(scheme, std::vector<size_t>{1, 2, 3, 4});
+
+    ASSERT_EQ(block_info.size(), 3u);
+    // pi = {1, 2, 3, 4}
+    EXPECT_EQ(std::get<0>(block_info[0]), (std::vector<size_t>{1, 3, 6, 10}));
+    EXPECT_EQ(std::get<1>(block_info[0]), 0u);
+    // pi = {3, 2, 1, 4}
+    EXPECT_EQ(std::get<0>(block_info[1]), (std::vector<size_t>{3, 5, 6, 10}));
+    EXPECT_EQ(std::get<1>(block_info[1]), 3u);
+    // pi = {4, 3, 2, 1}
+    EXPECT_EQ(std::get<0>(block_info[2]), (std::vector<size_t>{4, 7, 9, 10}));
+    EXPECT_EQ(std::get<1>(block_info[2]), 6u);
+}
+
+TEST(search_scheme_generator_test, cache)
+{
+    seqan3::detail::search_scheme_cache cache{4, 1'000'000, 2u};
+    seqan3::detail::search_scheme_cache::entry uncached{};
+
+    auto const & entry = cache.get(0, 2, 100, uncached);
+    EXPECT_EQ(std::addressof(cache.get(0, 2, 100, uncached)), std::addressof(entry));
+    EXPECT_NE(std::addressof(cache.get(0, 2, 101, uncached)), std::addressof(entry));
+    EXPECT_NE(std::addressof(cache.get(0, 2, 101, uncached)), std::addressof(uncached));
+
+    // the cache is full
+    auto const & uncached_entry = cache.get(0, 2, 102, uncached);
+    EXPECT_EQ(std::addressof(uncached_entry), std::addressof(uncached));
+    for (auto const & [blocks_length, start_pos] : uncached_entry.block_info)
+        EXPECT_EQ(blocks_length.back(), 102u);
+
+    EXPECT_EQ(entry.block_info.size(), entry.search_scheme.size());
+    for (auto const & [blocks_length, start_pos] : entry.block_info)
+        EXPECT_EQ(blocks_length.back(), 100u);
+
+    EXPECT_EQ(entry.disjoint, search_scheme_generator::is_disjoint(entry.search_scheme, 0, 2));
+}
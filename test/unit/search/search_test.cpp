@@ -8,7 +8,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <seqan3/std/ranges>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
@@ -17,6 +19,7 @@
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
+#include <seqan3/search/detail/search_common.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
@@ -144,6 +147,42 @@ TYPED_TEST(search_test, parallel_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | position, std::vector(num_queries, 0));
 }
 
+TYPED_TEST(search_test, buffers_are_reused_across_queries)
+{
+    using result_t = std::ranges::range_value_t<decltype(search("ACGT"_dna4, this->index))>;
+    using hit_buffer_t = seqan3::detail::reusable_search_buffer<std::vector<typename TypeParam::cursor_type>>;
+    using result_buffer_t = seqan3::detail::reusable_search_buffer<std::vector<result_t>>;
+
+    EXPECT_RANGE_EQ(search("ACGT"_dna4, this->index) | position, (std::vector{0, 4, 8}));
+
+    // The buffers of the query were returned to this thread and kept their memory.
+    typename TypeParam::cursor_type const * hit_storage{nullptr};
+    result_t const * result_storage{nullptr};
+    {
+        hit_buffer_t hit_buffer{};
+        result_buffer_t result_buffer{};
+        EXPECT_TRUE(hit_buffer.get().empty());
+        EXPECT_GE(hit_buffer.get().capacity(), 1u);
+        EXPECT_TRUE(result_buffer.get().empty());
+        EXPECT_GE(result_buffer.get().capacity(), 3u);
+        hit_storage = hit_buffer.get().data();
+        result_storage = result_buffer.get().data();
+    }
+
+    // The next query on this thread uses the same memory again.
+    EXPECT_RANGE_EQ(search("ACGT"_dna4, this->index) | position, (std::vector{0, 4, 8}));
+    {
+        hit_buffer_t hit_buffer{};
+        result_buffer_t result_buffer{};
+        EXPECT_EQ(hit_buffer.get().data(), hit_storage);
+        EXPECT_EQ(result_buffer.get().data(), result_storage);
+
+        // A nested search, e.g. from a callback, gets another buffer.
+        result_buffer_t nested_buffer{};
+        EXPECT_NE(nested_buffer.get().data(), result_storage);
+    }
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     seqan3::configuration const cfg1 = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{-0.5}};
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/utility/parallel/detail/worker_pool.hpp>
+
+TEST(worker_pool, thread_count)
+{
+    EXPECT_EQ(seqan3::detail::worker_pool{0u}.thread_count(), 1u);
+    EXPECT_EQ(seqan3::detail::worker_pool{1u}.thread_count(), 1u);
+    EXPECT_EQ(seqan3::detail::worker_pool{4u}.thread_count(), 4u);
+}
+
+TEST(worker_pool, run)
+{
+    for (size_t thread_count : {1u, 2u, 4u})
+    {
+        seqan3::detail::worker_pool pool{thread_count};
+
+        // many rounds with the same threads
+        for (size_t task_count = 0; task_count < 100u; ++task_count)
+        {
+            std::vector<size_t> results(task_count, 0u);
+            pool.run(task_count, [&] (size_t const i) { results[i] += i + 1; });
+
+            for (size_t i = 0; i < task_count; ++i)
+                EXPECT_EQ(results[i], i + 1);
+        }
+    }
+}
+
+TEST(worker_pool, concurrent_execution)
+{
+    seqan3::detail::worker_pool pool{4u};
+    std::atomic<size_t> arrived{0u};
+
+    // every task waits for all others, which only finishes if the four tasks run concurrently
+    pool.run(4u, [&] (size_t)
+    {
+        ++arrived;
+        while (arrived.load() < 4u)
+            std::this_thread::yield();
+    });
+
+    EXPECT_EQ(arrived.load(), 4u);
+}
+
+TEST(worker_pool, exception)
+{
+    seqan3::detail::worker_pool pool{3u};
+    std::atomic<size_t> executed{0u};
+
+    EXPECT_THROW(pool.run(10u, [&] (size_t const i)
+                 {
+                     ++executed;
+                     if (i == 5u)
+                         throw std::runtime_error{"task failed"};
+                 }),
+                 std::runtime_error);
+
+    EXPECT_EQ(executed.load(), 10u); // the other tasks are still executed
+
+    // the pool is still usable
+    executed = 0u;
+    pool.run(10u, [&] (size_t) { ++executed; });
+    EXPECT_EQ(executed.load(), 10u);
+}
@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/detail/simd_dispatch.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+
+using seqan3::detail::simd_instruction_set;
+
+TEST(simd_dispatch, instruction_set_order)
+{
+    EXPECT_LE(seqan3::detail::compiled_simd_instruction_set, seqan3::detail::max_simd_instruction_set);
+    EXPECT_LE(seqan3::detail::compiled_simd_instruction_set, seqan3::detail::runtime_simd_instruction_set());
+    EXPECT_LE(seqan3::detail::runtime_simd_instruction_set(), seqan3::detail::max_simd_instruction_set);
+    // The result is cached.
+    EXPECT_EQ(seqan3::detail::runtime_simd_instruction_set(), seqan3::detail::runtime_simd_instruction_set());
+}
+
+TEST(simd_dispatch, compiled_instruction_set)
+{
+    constexpr size_t max_length = seqan3::detail::default_simd_max_length<seqan3::detail::builtin_simd>;
+
+    EXPECT_EQ(seqan3::detail::simd_instruction_set_byte_width(seqan3::detail::compiled_simd_instruction_set),
+              max_length);
+}
+
+TEST(simd_dispatch, byte_width)
+{
+    EXPECT_EQ(seqan3::detail::simd_instruction_set_byte_width(simd_instruction_set::none), 0u);
+    EXPECT_EQ(seqan3::detail::simd_instruction_set_byte_width(simd_instruction_set::sse4), 16u);
+    EXPECT_EQ(seqan3::detail::simd_instruction_set_byte_width(simd_instruction_set::avx2), 32u);
+    EXPECT_EQ(seqan3::detail::simd_instruction_set_byte_width(simd_instruction_set::avx512), 64u);
+}
+
+// Transposes a byte matrix with the vector width of the given instruction set and returns the flattened matrix.
+// The wide vectors are only passed by reference to the transpose kernel and are filled and read through memory.
+struct transpose_fn
+{
+    template <simd_instruction_set instruction_set>
+    void operator()(std::integral_constant<simd_instruction_set, instruction_set>,
+                    std::vector<uint8_t> & flat_matrix) const
+    {
+        constexpr size_t length = seqan3::detail::simd_instruction_set_byte_width(instruction_set);
+
+        flat_matrix.clear();
+        if constexpr (length > 0)
+        {
+            using simd_t = seqan3::simd::simd_type_t<uint8_t, length>;
+
+            flat_matrix.resize(length * length);
+            for (size_t i = 0; i < length; ++i)
+                for (size_t j = 0; j < length; ++j)
+                    flat_matrix[i * length + j] = j;
+
+            std::array<simd_t, length> matrix;
+            std::memcpy(matrix.data(), flat_matrix.data(), flat_matrix.size());
+            seqan3::simd::transpose(matrix);
+            std::memcpy(flat_matrix.data(), matrix.data(), flat_matrix.size());
+        }
+    }
+};
+
+struct ignore_fn
+{
+    template <typename ...args_t>
+    void operator()(args_t && ...) const
+    {}
+};
+
+template <typename ...args_t>
+SEQAN3_CONCEPT simd_invocable = requires (args_t && ...args)
+{
+    seqan3::detail::simd_invoke<seqan3::detail::compiled_simd_instruction_set>(ignore_fn{}, args...);
+};
+
+TEST(simd_dispatch, rejects_simd_vectors)
+{
+    using simd_t = seqan3::simd::simd_type_t<uint8_t>;
+
+    EXPECT_TRUE((simd_invocable<int, std::vector<uint8_t> &>));
+    EXPECT_FALSE((simd_invocable<int, simd_t>));
+    EXPECT_FALSE((simd_invocable<simd_t const &>));
+}
+
+TEST(simd_dispatch, simd_dispatch)
+{
+    std::vector<uint8_t> flat_matrix{};
+    seqan3::detail::simd_dispatch(transpose_fn{}, flat_matrix);
+
+    size_t const length =
+        seqan3::detail::simd_instruction_set_byte_width(seqan3::detail::runtime_simd_instruction_set());
+    ASSERT_EQ(flat_matrix.size(), length * length);
+
+    for (size_t i = 0; i < length; ++i)
+        for (size_t j = 0; j < length; ++j)
+            EXPECT_EQ(flat_matrix[i * length + j], i);
+}
+
+TEST(simd_dispatch, simd_invoke)
+{
+    auto test_instruction_set = [] (auto instruction_set)
+    {
+        constexpr size_t length = seqan3::detail::simd_instruction_set_byte_width(instruction_set);
+
+        if constexpr (instruction_set <= seqan3::detail::max_simd_instruction_set && length > 0)
+        {
+            if (seqan3::detail::runtime_simd_instruction_set() < instruction_set)
+                return;
+
+            std::vector<uint8_t> flat_matrix{};
+            seqan3::detail::simd_invoke<instruction_set>(transpose_fn{}, instruction_set, flat_matrix);
+
+            ASSERT_EQ(flat_matrix.size(), length * length);
+            for (size_t i = 0; i < length; ++i)
+                for (size_t j = 0; j < length; ++j)
+                    EXPECT_EQ(flat_matrix[i * length + j], i);
+        }
+    };
+
+    test_instruction_set(std::integral_constant<simd_instruction_set, simd_instruction_set::sse4>{});
+    test_instruction_set(std::integral_constant<simd_instruction_set, simd_instruction_set::avx2>{});
+    test_instruction_set(std::integral_constant<simd_instruction_set, simd_instruction_set::avx512>{});
+}
+
+TEST(simd_dispatch, simd_target_invoker)
+{
+    auto add = [] (int const a, int const b) { return a + b; };
+    seqan3::detail::simd_target_invoker<seqan3::detail::compiled_simd_instruction_set, decltype(add)> invoker{add};
+
+    std::function<int(int, int)> wrapped{invoker};
+    EXPECT_EQ(wrapped(3, 4), 7);
+}